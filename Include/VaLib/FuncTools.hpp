@@ -4,6 +4,8 @@
 #pragma once
 
 #include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/FuncTools/FuncRef.hpp>
+#include <VaLib/FuncTools/Memoize.hpp>
 #include <VaLib/FuncTools/Method.hpp>
 
 #include <VaLib/FuncTools/Partial.hpp>
@@ -3,167 +3,308 @@
 // (C) 2025 VaLibTeam
 #pragma once
 
+#include <VaLib/Meta/BasicDefine.hpp>
 #include <VaLib/Types/BasicTypedef.hpp>
 #include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
 
+#include <cstring>
+#include <new>
 #include <type_traits>
 #include <utility>
 
-template <typename Signature>
-class VaFunc;
+namespace va::detail {
 
-template <typename R, typename... Args>
-class VaFunc<R(Args...)> {
-protected:
-    static constexpr Size bufSize = sizeof(void (*)()) * 8;
+/// @brief Inline capacity of VaFunc and VaUniqueFunc unless given; makes sizeof(VaFunc) 64 bytes on 64-bit targets.
+inline constexpr Size funcDefaultInlineSize = 6 * sizeof(void*);
 
-    struct alignas(MaxAlignType) Buffer {
-        byte data[bufSize];
-    };
+/**
+ * @brief Per-type operations of a stored callable. One static instance exists per callable type and storage mode.
+ *
+ * Callables that are trivially copyable and stored inline need none of these and use no table at all.
+ */
+struct FuncOps {
+    void (*relocate)(void* dst, void* src) noexcept; ///< Moves src into dst and destroys src; null if a byte copy does that
+    void (*copy)(void* dst, const void* src);        ///< Copy-constructs src into dst; null for move-only functions
+    void (*destroy)(void* storage) noexcept;
+};
 
-    struct CallableBase {
-        virtual R invoke(Args&&...) = 0;
-        virtual CallableBase* clone(Buffer& buffer) const = 0;
-        virtual CallableBase* move(Buffer& buffer) = 0;
-        virtual void destroy(bool inBuffer) = 0;
-        virtual ~CallableBase() = default;
-    };
+/**
+ * @brief Implements the operations of FuncOps for callable type F.
+ * @tparam Inline Whether F lives in the storage itself, or the storage holds an owning F*.
+ */
+template <typename F, bool Inline>
+struct FuncManager {
+    static inline F* get(void* storage) noexcept {
+        if constexpr (Inline) {
+            return std::launder(static_cast<F*>(storage));
+        } else {
+            return *static_cast<F**>(storage);
+        }
+    }
 
-    template <typename F>
-    struct CallableImpl : CallableBase {
-        F func;
+    template <typename R, typename... Args>
+    static R invoke(void* storage, Args&&... args) {
+        if constexpr (std::is_void_v<R>) {
+            (*get(storage))(std::forward<Args>(args)...);
+        } else {
+            return (*get(storage))(std::forward<Args>(args)...);
+        }
+    }
 
-        template <typename U>
-        CallableImpl(U&& f) : func(std::forward<U>(f)) {}
+    static void relocate(void* dst, void* src) noexcept {
+        F* from = get(src);
+        new (dst) F(std::move(*from));
+        from->~F();
+    }
 
-        R invoke(Args&&... args) override {
-            return func(std::forward<Args>(args)...);
+    static void copy(void* dst, const void* src) {
+        const F* from = get(const_cast<void*>(src));
+        if constexpr (Inline) {
+            new (dst) F(*from);
+        } else {
+            *static_cast<F**>(dst) = new F(*from);
         }
+    }
 
-        CallableBase* clone(Buffer& buffer) const override {
-            if (sizeof(CallableImpl) <= bufSize) {
-                return new (&buffer) CallableImpl(func);
-            } else {
-                return new CallableImpl(func);
-            }
+    static void destroy(void* storage) noexcept {
+        if constexpr (Inline) {
+            get(storage)->~F();
+        } else {
+            delete get(storage);
         }
+    }
 
-        CallableBase* move(Buffer& buffer) override {
-            if (sizeof(CallableImpl) <= bufSize) {
-                return new (&buffer) CallableImpl(std::move(func));
-            } else {
-                return new CallableImpl(std::move(func));
-            }
-        }
+    template <bool Copyable>
+    static constexpr FuncOps makeOps() noexcept {
+        FuncOps result = {nullptr, nullptr, &destroy};
+        if constexpr (Inline) result.relocate = &relocate; // A heap-stored callable is moved by copying its pointer
+        if constexpr (Copyable) result.copy = &copy;
+        return result;
+    }
 
-        void destroy(bool inBuffer) noexcept(tt::IsNoexceptDestructible<F>) override {
-            if (inBuffer) {
-                this->~CallableImpl();
-            } else {
-                delete this;
-            }
-        }
+    template <bool Copyable>
+    static constexpr FuncOps ops = makeOps<Copyable>();
+};
+
+/**
+ * @brief Common implementation of VaFunc and VaUniqueFunc.
+ *
+ * Instead of a virtual CallableBase, a function stores a direct pointer to the invoke thunk of its
+ * callable (one indirect call, no vtable load) and a pointer to a static FuncOps table for copying,
+ * moving and destroying it. Callables of up to N bytes that can be moved without throwing live in
+ * the inline storage; larger ones are allocated on the heap. An empty function points to a thunk
+ * that throws, so calls need no null check.
+ */
+template <bool Copyable, Size N, typename R, typename... Args>
+class FuncBase {
+  protected:
+    using Invoke = R (*)(void*, Args&&...);
+
+    static constexpr Size storageSize = N < sizeof(void*) ? sizeof(void*) : N;
+
+    struct alignas(MaxAlignType) Storage {
+        byte data[storageSize];
     };
 
-    CallableBase* callable = nullptr;
+    template <typename F>
+    static constexpr bool fitsInline =
+        sizeof(F) <= storageSize && alignof(F) <= alignof(MaxAlignType) && tt::IsNoexceptMoveConstructible<F>;
 
-    bool inBuffer = false;
-    Buffer buffer;
+    [[noreturn]] static R emptyInvoke(void*, Args&&...) { throw ValueError(VaStaticMessage("call a null function")); }
 
-public:
-    VaFunc() noexcept = default;
-    VaFunc(std::nullptr_t) noexcept : VaFunc() {}
+    Invoke invoker = &emptyInvoke;
+    const FuncOps* ops = nullptr;
+    mutable Storage storage = {}; ///< Zeroed, so that copying a small trivially copyable callable byte by byte reads no indeterminate bytes.
 
-    template <
-        typename F,
-        typename = tt::EnableIf< !tt::IsSame<typename tt::Decay<F>, VaFunc> >
-    >
-    VaFunc(F&& f) {
-        using Impl = CallableImpl<std::decay_t<F>>;
-        if (sizeof(Impl) <= bufSize) {
-            callable = new (static_cast<void*>(&buffer)) Impl(std::forward<F>(f));
-            inBuffer = true;
+    template <typename F, typename U>
+    void emplace(U&& f) {
+        // A reference to a function can't be null, only a pointer can
+        if constexpr ((std::is_pointer_v<F> || std::is_member_pointer_v<F>) && !std::is_function_v<tt::RemoveReference<U>>) {
+            if (f == nullptr) return;
+        }
+
+        if constexpr (fitsInline<F>) {
+            new (&storage) F(std::forward<U>(f));
+            if constexpr (!tt::IsTriviallyCopyable<F>) ops = &FuncManager<F, true>::template ops<Copyable>;
+            invoker = &FuncManager<F, true>::template invoke<R, Args...>;
         } else {
-            callable = new Impl(std::forward<F>(f));
-            inBuffer = false;
+            *reinterpret_cast<F**>(&storage) = new F(std::forward<U>(f));
+            ops = &FuncManager<F, false>::template ops<Copyable>;
+            invoker = &FuncManager<F, false>::template invoke<R, Args...>;
         }
     }
 
-    VaFunc(const VaFunc& other) {
-        if (other.callable) {
-            callable = other.callable->clone(buffer);
-            inBuffer = (callable == reinterpret_cast<CallableBase*>(&buffer));
+    void copyFrom(const FuncBase& other) {
+        if (other.ops) {
+            other.ops->copy(&storage, &other.storage);
+        } else {
+            std::memcpy(&storage, &other.storage, sizeof(Storage));
         }
+        ops = other.ops;
+        invoker = other.invoker;
     }
 
-    VaFunc(VaFunc&& other) noexcept {
-        if (other.callable) {
-            callable = other.callable->move(buffer);
-            inBuffer = (callable == reinterpret_cast<CallableBase*>(&buffer));
-            other.callable = nullptr;
+    void moveFrom(FuncBase& other) noexcept {
+        if (other.ops && other.ops->relocate) {
+            other.ops->relocate(&storage, &other.storage);
+        } else {
+            std::memcpy(&storage, &other.storage, sizeof(Storage));
         }
+        ops = other.ops;
+        invoker = other.invoker;
+
+        other.ops = nullptr;
+        other.invoker = &emptyInvoke;
     }
 
-    ~VaFunc() { reset(); }
+  public:
+    FuncBase() noexcept = default;
 
-    VaFunc& operator=(const VaFunc& other) {
+    FuncBase(const FuncBase& other)
+        requires Copyable
+    {
+        copyFrom(other);
+    }
+
+    FuncBase(FuncBase&& other) noexcept { moveFrom(other); }
+
+    ~FuncBase() { reset(); }
+
+    FuncBase& operator=(const FuncBase& other)
+        requires Copyable
+    {
         if (this != &other) {
             reset();
-            if (other.callable) {
-                callable = other.callable->clone(buffer);
-                inBuffer = (callable == reinterpret_cast<CallableBase*>(&buffer));
-            }
+            copyFrom(other);
         }
         return *this;
     }
 
-    VaFunc& operator=(VaFunc&& other) noexcept {
+    FuncBase& operator=(FuncBase&& other) noexcept {
         if (this != &other) {
             reset();
-            if (other.callable) {
-                callable = other.callable->move(buffer);
-                inBuffer = (callable == reinterpret_cast<CallableBase*>(&buffer));
-                other.callable = nullptr;
-            }
+            moveFrom(other);
         }
         return *this;
     }
 
-    void swap(VaFunc& other) noexcept {
+    /**
+     * @brief Destroys the stored callable; the function becomes empty.
+     */
+    void reset() noexcept {
+        if (ops) ops->destroy(&storage);
+        ops = nullptr;
+        invoker = &emptyInvoke;
+    }
+
+    void swap(FuncBase& other) noexcept {
         if (this == &other) return;
 
-        VaFunc tmp = std::move(other);
+        FuncBase tmp = std::move(other);
         other = std::move(*this);
         *this = std::move(tmp);
     }
 
-    void reset() {
-        if (!callable) return;
+    /**
+     * @brief Calls the stored callable.
+     * @throws ValueError If the function is empty.
+     */
+    inline R call(Args... args) const { return invoker(&storage, std::forward<Args>(args)...); }
 
-        callable->destroy(inBuffer);
-        callable = nullptr;
-    }
+    inline R operator()(Args... args) const { return invoker(&storage, std::forward<Args>(args)...); }
 
-    inline R call(Args... args) const {
-        if (!callable) throw ValueError("call a null function");
-        return callable->invoke(std::forward<Args>(args)...);
+    /**
+     * @brief Whether a callable of type F would be stored inline (without a heap allocation).
+     */
+    template <typename F>
+    static constexpr bool storesInline() noexcept {
+        return fitsInline<tt::Decay<F>>;
     }
 
-    inline R operator()(Args... args) const {
-        if (!callable) throw ValueError("call a null function");
-        return callable->invoke(std::forward<Args>(args)...);
-    }
+    /// @brief Number of bytes available for inline callables.
+    static constexpr Size getInlineCapacity() noexcept { return storageSize; }
 
   public operators:
-    friend bool operator==(const VaFunc& lhs, std::nullptr_t) noexcept {
-        return lhs.callable == nullptr;
+    friend bool operator==(const FuncBase& lhs, std::nullptr_t) noexcept {
+        return lhs.invoker == &emptyInvoke;
     }
 
-    friend bool operator!=(const VaFunc& lhs, std::nullptr_t) noexcept {
-        return lhs.callable != nullptr;
+    friend bool operator!=(const FuncBase& lhs, std::nullptr_t) noexcept {
+        return lhs.invoker != &emptyInvoke;
     }
 
     inline explicit operator bool() const noexcept {
-        return callable != nullptr;
+        return invoker != &emptyInvoke;
+    }
+};
+
+} // namespace va::detail
+
+/**
+ * @brief Type-erased, copyable function wrapper (like std::function).
+ * @tparam Signature Call signature, e.g. int(int, int).
+ * @tparam InlineSize Callables up to this many bytes are stored without a heap allocation.
+ *
+ * @note Calling an empty VaFunc throws ValueError.
+ */
+template <typename Signature, Size InlineSize = va::detail::funcDefaultInlineSize>
+class VaFunc;
+
+template <typename R, typename... Args, Size InlineSize>
+class VaFunc<R(Args...), InlineSize> : public va::detail::FuncBase<true, InlineSize, R, Args...> {
+  protected:
+    using Base = va::detail::FuncBase<true, InlineSize, R, Args...>;
+
+  public:
+    VaFunc() noexcept = default;
+    VaFunc(std::nullptr_t) noexcept : VaFunc() {}
+
+    template <
+        typename F,
+        typename = tt::EnableIf< !tt::IsSame<tt::Decay<F>, VaFunc> >
+    >
+    VaFunc(F&& f) {
+        static_assert(std::is_copy_constructible_v<tt::Decay<F>>, "VaFunc requires a copyable callable; use VaUniqueFunc");
+        this->template emplace<tt::Decay<F>>(std::forward<F>(f));
     }
+
+    VaFunc(const VaFunc&) = default;
+    VaFunc(VaFunc&&) noexcept = default;
+    VaFunc& operator=(const VaFunc&) = default;
+    VaFunc& operator=(VaFunc&&) noexcept = default;
+};
+
+/**
+ * @brief Type-erased, move-only function wrapper (like std::move_only_function).
+ *        Accepts callables that cannot be copied, e.g. lambdas capturing a VaUniquePtr.
+ * @tparam Signature Call signature, e.g. void(int).
+ * @tparam InlineSize Callables up to this many bytes are stored without a heap allocation.
+ *
+ * @note Calling an empty VaUniqueFunc throws ValueError.
+ */
+template <typename Signature, Size InlineSize = va::detail::funcDefaultInlineSize>
+class VaUniqueFunc;
+
+template <typename R, typename... Args, Size InlineSize>
+class VaUniqueFunc<R(Args...), InlineSize> : public va::detail::FuncBase<false, InlineSize, R, Args...> {
+  protected:
+    using Base = va::detail::FuncBase<false, InlineSize, R, Args...>;
+
+  public:
+    VaUniqueFunc() noexcept = default;
+    VaUniqueFunc(std::nullptr_t) noexcept : VaUniqueFunc() {}
+
+    template <
+        typename F,
+        typename = tt::EnableIf< !tt::IsSame<tt::Decay<F>, VaUniqueFunc> >
+    >
+    VaUniqueFunc(F&& f) {
+        this->template emplace<tt::Decay<F>>(std::forward<F>(f));
+    }
+
+    VaUniqueFunc(const VaUniqueFunc&) = delete;
+    VaUniqueFunc(VaUniqueFunc&&) noexcept = default;
+    VaUniqueFunc& operator=(const VaUniqueFunc&) = delete;
+    VaUniqueFunc& operator=(VaUniqueFunc&&) noexcept = default;
 };
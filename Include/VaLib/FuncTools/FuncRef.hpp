@@ -0,0 +1,93 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Non-owning reference to a callable (like std::function_ref).
+ * @tparam Signature Call signature, e.g. bool(const int&).
+ *
+ * Holds only a pointer to the callable and a pointer to a call thunk, so it is trivially copyable,
+ * never allocates and binds to lambdas, functors, function pointers and VaFunc alike. Meant for
+ * callback parameters that are only called during the call they are passed to.
+ *
+ * @warning The referenced callable must outlive the VaFuncRef. Binding a temporary is fine for a
+ *          function argument, but not for a VaFuncRef variable.
+ */
+template <typename Signature>
+class VaFuncRef;
+
+template <typename R, typename... Args>
+class VaFuncRef<R(Args...)> {
+  protected:
+    union Target {
+        void* object;
+        void (*function)();
+    };
+
+    using Thunk = R (*)(Target, Args&&...);
+
+    Target target;
+    Thunk thunk;
+
+    template <typename F>
+    static R callObject(Target target, Args&&... args) {
+        F& f = *static_cast<F*>(target.object);
+        if constexpr (std::is_void_v<R>) {
+            f(std::forward<Args>(args)...);
+        } else {
+            return f(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename F>
+    static R callFunction(Target target, Args&&... args) {
+        F f = reinterpret_cast<F>(target.function);
+        if constexpr (std::is_void_v<R>) {
+            f(std::forward<Args>(args)...);
+        } else {
+            return f(std::forward<Args>(args)...);
+        }
+    }
+
+  public:
+    /**
+     * @brief Binds a function pointer. The pointer itself is stored, so it need not outlive the VaFuncRef.
+     * @param f Function to call; must not be null.
+     */
+    template <typename FR, typename... FArgs, typename = tt::EnableIf<std::is_invocable_r_v<R, FR (*)(FArgs...), Args...>>>
+    VaFuncRef(FR (*f)(FArgs...)) noexcept {
+        target.function = reinterpret_cast<void (*)()>(f);
+        thunk = &callFunction<FR (*)(FArgs...)>;
+    }
+
+    /**
+     * @brief Binds any other callable by reference.
+     */
+    template <
+        typename F,
+        typename = tt::EnableIf<
+            !tt::IsSame<tt::Decay<F>, VaFuncRef> && !std::is_function_v<std::remove_reference_t<F>> &&
+            std::is_invocable_r_v<R, std::remove_reference_t<F>&, Args...>
+        >
+    >
+    VaFuncRef(F&& f) noexcept {
+        using Object = std::remove_reference_t<F>;
+        target.object = const_cast<void*>(static_cast<const volatile void*>(std::addressof(f)));
+        thunk = &callObject<Object>;
+    }
+
+    VaFuncRef(const VaFuncRef&) noexcept = default;
+    VaFuncRef& operator=(const VaFuncRef&) noexcept = default;
+
+    inline R call(Args... args) const { return thunk(target, std::forward<Args>(args)...); }
+
+    inline R operator()(Args... args) const { return thunk(target, std::forward<Args>(args)...); }
+};
@@ -0,0 +1,442 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/CacheStats.hpp>
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/Tuple.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace va::detail {
+
+/// @brief Default number of shards of VaConcurrentMemoized.
+inline constexpr Size memoDefaultShards = 16;
+
+/**
+ * @brief Call signature R(Args...) of a function pointer or of a functor with a single,
+ *        non-template operator() (e.g. a non-generic lambda).
+ */
+template <typename F>
+struct CallSignature: CallSignature<decltype(&F::operator())> {};
+
+template <typename R, typename... Args>
+struct CallSignature<R (*)(Args...)> {
+    using Type = R(Args...);
+};
+
+template <typename R, typename... Args>
+struct CallSignature<R (*)(Args...) noexcept>: CallSignature<R (*)(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallSignature<R (C::*)(Args...)>: CallSignature<R (*)(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallSignature<R (C::*)(Args...) const>: CallSignature<R (*)(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallSignature<R (C::*)(Args...) noexcept>: CallSignature<R (*)(Args...)> {};
+
+template <typename C, typename R, typename... Args>
+struct CallSignature<R (C::*)(Args...) const noexcept>: CallSignature<R (*)(Args...)> {};
+
+/// @brief The given Signature, or the one deduced from F if Signature is void.
+template <typename Signature, typename F>
+struct MemoSignatureOf {
+    using Type = Signature;
+};
+
+template <typename F>
+struct MemoSignatureOf<void, F> {
+    using Type = typename CallSignature<tt::Decay<F>>::Type;
+};
+
+template <typename Signature, typename F>
+using MemoSignature = typename MemoSignatureOf<Signature, F>::Type;
+
+/**
+ * @brief The cache behind VaMemoized: a VaDict from argument tuples to results.
+ *
+ * The insertion order of the dict doubles as the eviction order. Entries are appended at the back;
+ * with a capacity, a hit moves the entry to the back as well, so the front is always the least
+ * recently used entry. Without a capacity the order is the insertion order, so with a TTL the front
+ * is always the entry that expires first and expired entries are dropped from the front in O(1).
+ *
+ * @note With both a capacity and a TTL, hits reorder entries, so an expired entry can sit behind a
+ *       fresh one. It is still never returned; it is recomputed when looked up or evicted as the
+ *       least recently used entry.
+ */
+template <typename Key, typename R>
+class MemoCache {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  protected:
+    struct Slot {
+        R value;
+        Clock::time_point expires;
+    };
+
+    VaDict<Key, Slot> entries;
+    Size capacity;
+    Clock::duration ttl;
+    VaCacheStats stats;
+
+    void dropExpired(Clock::time_point now) {
+        while (!entries.isEmpty() && entries.valueAtFront().expires <= now) {
+            entries.del(entries.keyAtFront());
+            stats.evictions++;
+        }
+    }
+
+  public:
+    MemoCache(Size capacity, Clock::duration ttl) : capacity(capacity), ttl(ttl) {
+        if (capacity) entries.reserve(capacity + capacity / 3 + 2); // Never rehashes once full
+    }
+
+    /// @brief Current time if entries can expire; otherwise no clock is read.
+    inline Clock::time_point now() const { return hasTtl() ? Clock::now() : Clock::time_point(); }
+
+    inline bool hasTtl() const noexcept { return ttl > Clock::duration::zero(); }
+
+    /**
+     * @brief Looks up a cached result and counts the hit or miss.
+     * @return Pointer to the result, or nullptr if it is missing or has expired.
+     */
+    const R* lookup(const Key& key, Clock::time_point now) {
+        Slot* slot = capacity ? entries.moveToBack(key) : entries.find(key);
+        if (!slot || (hasTtl() && slot->expires <= now)) {
+            stats.misses++;
+            return nullptr;
+        }
+
+        stats.hits++;
+        return &slot->value;
+    }
+
+    /**
+     * @brief Stores a result, evicting the least recently used entry if the cache is full.
+     */
+    void insert(const Key& key, const R& value, Clock::time_point now) {
+        if (hasTtl() && !capacity) dropExpired(now);
+
+        Clock::time_point expires = hasTtl() ? now + ttl : Clock::time_point::max();
+        if (Slot* slot = entries.find(key)) { // An expired entry, or one computed concurrently
+            slot->value = value;
+            slot->expires = expires;
+            entries.moveToBack(key);
+            return;
+        }
+
+        if (capacity && entries.getSize() >= capacity) {
+            entries.del(entries.keyAtFront());
+            stats.evictions++;
+        }
+        entries.putAtBack(key, Slot{value, expires});
+    }
+
+    inline bool contains(const Key& key, Clock::time_point now) const {
+        const Slot* slot = entries.find(key);
+        return slot && !(hasTtl() && slot->expires <= now);
+    }
+
+    inline void clear() { entries.clear(); }
+    inline void resetStats() noexcept { stats = VaCacheStats(); }
+
+    inline const VaCacheStats& getStats() const noexcept { return stats; }
+    inline Size getSize() const noexcept { return entries.getSize(); }
+    inline Size getCapacity() const noexcept { return capacity; }
+    inline Clock::duration getTtl() const noexcept { return ttl; }
+};
+
+} // namespace va::detail
+
+/**
+ * @brief A function wrapped with a cache of its results, keyed on the argument tuple.
+ * @tparam Signature Call signature R(Args...) of the wrapped function.
+ * @tparam F Type of the wrapped callable.
+ *
+ * The arguments are decayed and stored as a VaTuple (hashed with VaHash), so every argument type
+ * must be copyable, equality comparable and hashable. Optionally the cache is bounded to a number
+ * of entries (least recently used entries are evicted) and/or entries expire after a time to live.
+ *
+ * Created by va::memoize(), va::memoizeLru() and va::memoizeTtl().
+ *
+ * @note The wrapped function may call the memoized object recursively.
+ * @warning Not thread-safe; use VaConcurrentMemoized for a cache shared between threads.
+ */
+template <typename Signature, typename F>
+class VaMemoized;
+
+template <typename R, typename... Args, typename F>
+class VaMemoized<R(Args...), F> {
+    static_assert(!std::is_void_v<R>, "a memoized function must return a value");
+
+  public:
+    using Key = VaTuple<tt::Decay<Args>...>;
+    using Clock = std::chrono::steady_clock;
+
+  protected:
+    F func;
+    va::detail::MemoCache<Key, R> cache;
+
+  public:
+    /**
+     * @brief Wraps a function.
+     * @param func Function to memoize.
+     * @param capacity Maximum number of cached results; 0 means unbounded.
+     * @param ttl Time after which a cached result expires; zero means never.
+     */
+    explicit VaMemoized(F func, Size capacity = 0, Clock::duration ttl = Clock::duration::zero())
+        : func(std::move(func)), cache(capacity, ttl) {}
+
+    /**
+     * @brief Returns the cached result for args, calling the function only on a miss.
+     */
+    R operator()(Args... args) {
+        Key key{args...};
+        Clock::time_point now = cache.now();
+        if (const R* hit = cache.lookup(key, now)) return *hit;
+
+        R result = std::invoke(func, args...);
+        cache.insert(key, result, now);
+        return result;
+    }
+
+    inline R call(Args... args) { return (*this)(args...); }
+
+    /// @brief Whether a result for args is cached (does not count as a hit or miss).
+    inline bool contains(Args... args) const { return cache.contains(Key{args...}, cache.now()); }
+
+    /// @brief Drops all cached results; the counters are kept.
+    inline void clear() { cache.clear(); }
+
+    inline void resetStats() noexcept { cache.resetStats(); }
+
+    inline VaCacheStats getStats() const noexcept { return cache.getStats(); }
+    inline Size getSize() const noexcept { return cache.getSize(); }
+    inline Size getCapacity() const noexcept { return cache.getCapacity(); }
+    inline Clock::duration getTtl() const noexcept { return cache.getTtl(); }
+};
+
+/**
+ * @brief Thread-safe VaMemoized: the cache is split into shards, each with its own lock.
+ * @tparam Signature Call signature R(Args...) of the wrapped function.
+ * @tparam F Type of the wrapped callable.
+ *
+ * A key always maps to the same shard, so threads working on different keys rarely contend.
+ * The function is called outside the lock, so a slow computation does not block the shard;
+ * as a consequence two threads missing the same key at the same time may both compute it.
+ * The capacity is a total, split between the shards so that their capacities add up to it exactly;
+ * a skewed key distribution may therefore evict a little early. There are never more shards than
+ * the capacity.
+ *
+ * Created by va::memoizeConcurrent().
+ *
+ * @warning The wrapped function is called concurrently (through a const reference) and must be thread-safe.
+ */
+template <typename Signature, typename F>
+class VaConcurrentMemoized;
+
+template <typename R, typename... Args, typename F>
+class VaConcurrentMemoized<R(Args...), F> {
+    static_assert(!std::is_void_v<R>, "a memoized function must return a value");
+
+  public:
+    using Key = VaTuple<tt::Decay<Args>...>;
+    using Clock = std::chrono::steady_clock;
+
+  protected:
+    struct alignas(va::detail::cacheLineSize) Shard {
+        mutable std::mutex mutex;
+        va::detail::MemoCache<Key, R> cache;
+
+        Shard(Size capacity, Clock::duration ttl) : cache(capacity, ttl) {}
+    };
+
+    F func;
+    Shard* shards;
+    Size shardCount;
+    Size shardBits;
+
+    inline Shard& shardFor(const Key& key) const {
+        return shards[va::detail::shardIndex(VaHash<Key>{}(key), shardBits)];
+    }
+
+  public:
+    /**
+     * @brief Wraps a function.
+     * @param func Function to memoize.
+     * @param capacity Maximum total number of cached results, split between the shards; 0 means unbounded.
+     * @param ttl Time after which a cached result expires; zero means never.
+     * @param shardCount Number of shards, rounded up to a power of two, then lowered to at most the capacity;
+     *                   0 means the default (16).
+     */
+    explicit VaConcurrentMemoized(
+        F func, Size capacity = 0, Clock::duration ttl = Clock::duration::zero(), Size shardCount = 0
+    ) : func(std::move(func)) {
+        shardBits = va::detail::shardBits(shardCount ? shardCount : va::detail::memoDefaultShards);
+        shardBits = va::detail::fitShardBits(shardBits, capacity);
+        this->shardCount = Size(1) << shardBits;
+
+        shards = static_cast<Shard*>(::operator new(sizeof(Shard) * this->shardCount, std::align_val_t(alignof(Shard))));
+        Size built = 0;
+        try {
+            for (; built < this->shardCount; built++) {
+                new (&shards[built]) Shard(va::detail::shardLimit(capacity, built, this->shardCount), ttl);
+            }
+        } catch (...) {
+            while (built) shards[--built].~Shard();
+            ::operator delete(shards, std::align_val_t(alignof(Shard)));
+            throw;
+        }
+    }
+
+    VaConcurrentMemoized(const VaConcurrentMemoized&) = delete;
+    VaConcurrentMemoized& operator=(const VaConcurrentMemoized&) = delete;
+
+    ~VaConcurrentMemoized() {
+        for (Size i = 0; i < shardCount; i++) shards[i].~Shard();
+        ::operator delete(shards, std::align_val_t(alignof(Shard)));
+    }
+
+    /**
+     * @brief Returns the cached result for args, calling the function only on a miss.
+     */
+    R operator()(Args... args) const {
+        Key key{args...};
+        Shard& shard = shardFor(key);
+        Clock::time_point now = shard.cache.now();
+
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (const R* hit = shard.cache.lookup(key, now)) return *hit;
+        }
+
+        R result = std::invoke(func, args...);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.insert(key, result, now);
+        return result;
+    }
+
+    inline R call(Args... args) const { return (*this)(args...); }
+
+    /// @brief Whether a result for args is cached (does not count as a hit or miss).
+    bool contains(Args... args) const {
+        Key key{args...};
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.contains(key, shard.cache.now());
+    }
+
+    /// @brief Drops all cached results; the counters are kept.
+    void clear() {
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            shards[i].cache.clear();
+        }
+    }
+
+    void resetStats() {
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            shards[i].cache.resetStats();
+        }
+    }
+
+    /// @brief Sum of the counters of all shards.
+    VaCacheStats getStats() const {
+        VaCacheStats total;
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            total += shards[i].cache.getStats();
+        }
+        return total;
+    }
+
+    /// @brief Total number of cached results.
+    Size getSize() const {
+        Size total = 0;
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            total += shards[i].cache.getSize();
+        }
+        return total;
+    }
+
+    inline Size getShardCount() const noexcept { return shardCount; }
+};
+
+namespace va {
+
+/**
+ * @brief Wraps f with an unbounded cache of its results.
+ * @tparam Signature Call signature R(Args...); deduced for function pointers and non-generic
+ *         lambdas, must be given for generic lambdas and overloaded functors.
+ * @param f Pure function to memoize.
+ * @return A VaMemoized.
+ *
+ * @code
+ * auto slowSquare = va::memoize([](int x) { return x * x; });
+ * auto joined = va::memoize<VaString(const VaString&, int)>([](const auto& s, int n) { ... });
+ * @endcode
+ */
+template <typename Signature = void, typename F>
+inline auto memoize(F f) {
+    return VaMemoized<detail::MemoSignature<Signature, F>, F>(std::move(f));
+}
+
+/**
+ * @brief Wraps f with a cache of at most capacity results; the least recently used one is evicted first.
+ * @tparam Signature Call signature; see memoize().
+ * @param f Pure function to memoize.
+ * @param capacity Maximum number of cached results.
+ * @return A VaMemoized.
+ */
+template <typename Signature = void, typename F>
+inline auto memoizeLru(F f, Size capacity) {
+    return VaMemoized<detail::MemoSignature<Signature, F>, F>(std::move(f), capacity);
+}
+
+/**
+ * @brief Wraps f with a cache whose results expire after ttl.
+ * @tparam Signature Call signature; see memoize().
+ * @param f Function to memoize.
+ * @param ttl Time to live of a cached result.
+ * @param capacity Maximum number of cached results; 0 means unbounded.
+ * @return A VaMemoized.
+ */
+template <typename Signature = void, typename F, typename Rep, typename Period>
+inline auto memoizeTtl(F f, std::chrono::duration<Rep, Period> ttl, Size capacity = 0) {
+    return VaMemoized<detail::MemoSignature<Signature, F>, F>(
+        std::move(f), capacity, std::chrono::duration_cast<std::chrono::steady_clock::duration>(ttl)
+    );
+}
+
+/**
+ * @brief Wraps f with a thread-safe, sharded cache of its results.
+ * @tparam Signature Call signature; see memoize().
+ * @param f Thread-safe pure function to memoize.
+ * @param capacity Maximum total number of cached results, split between the shards; 0 means unbounded.
+ * @param shardCount Number of shards; 0 means the default (16). Never more than the capacity.
+ * @return A VaConcurrentMemoized.
+ */
+template <typename Signature = void, typename F>
+inline auto memoizeConcurrent(F f, Size capacity = 0, Size shardCount = 0) {
+    return VaConcurrentMemoized<detail::MemoSignature<Signature, F>, F>(
+        std::move(f), capacity, std::chrono::steady_clock::duration::zero(), shardCount
+    );
+}
+
+} // namespace va
@@ -6,3 +6,4 @@
 #include <VaLib/Mem/UniquePtr.hpp>
 #include <VaLib/Mem/SharedPtr.hpp>
 #include <VaLib/Mem/WeakPtr.hpp>
+#include <VaLib/Mem/SlabPool.hpp>
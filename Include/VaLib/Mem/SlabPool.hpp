@@ -0,0 +1,302 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+
+#include <new>
+
+/**
+ * @brief Reference-counted arena handing out uninitialized storage for objects of type T.
+ *        Storage is carved from contiguous slabs, so objects allocated together end up
+ *        next to each other in memory. While the pool has a single owner, that owner keeps
+ *        its own free list and slots are never returned to the pool. An owner letting go of a
+ *        shared pool hands its unused slots back with @ref donate, and the other owners take
+ *        them with @ref takeSpare before allocating a new slab. The slabs are released all at
+ *        once when the last owner drops its reference.
+ *
+ * @tparam T The type of objects stored in the pool.
+ *
+ * @note Two pools can be merged with @ref Merge. The merged-from pool then forwards to the
+ *       merged-into one, which lets containers exchange objects in O(1) without copying.
+ *       Use @ref resolve to get the pool that currently owns the slabs.
+ * @warning The reference count is not atomic. Containers sharing a pool must not be used
+ *          concurrently from different threads.
+ */
+template <typename T>
+class VaSlabPool {
+  protected:
+    static constexpr Size slabAlign = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+
+    struct alignas(slabAlign) Slab {
+        Slab* next; ///< Next slab in the chain
+        Size count; ///< Number of slots in this slab
+
+        inline T* items() noexcept { return reinterpret_cast<T*>(this + 1); }
+        inline bool contains(const T* ptr) const noexcept {
+            const T* first = reinterpret_cast<const T*>(this + 1);
+            return ptr >= first && ptr < first + count;
+        }
+    };
+
+    Slab* slabs;         ///< First slab in the chain
+    Slab* lastSlab;      ///< Last slab in the chain (for O(1) merging)
+    Size capacity;       ///< Total number of slots across all slabs
+    Size refs;           ///< Number of owners, including pools forwarding to this one
+    VaSlabPool* forward; ///< Pool this one was merged into, or nullptr
+
+    T* spareHead;    ///< First unused slot handed back by a former owner
+    T* spareTail;    ///< Last unused slot handed back by a former owner
+    Size spareCount; ///< Number of unused slots handed back
+
+    VaSlabPool() noexcept
+        : slabs(nullptr), lastSlab(nullptr), capacity(0), refs(1), forward(nullptr), spareHead(nullptr), spareTail(nullptr), spareCount(0) {}
+
+    ~VaSlabPool() {
+        Slab* current = slabs;
+        while (current) {
+            Slab* next = current->next;
+            ::operator delete(current, std::align_val_t(slabAlign));
+            current = next;
+        }
+    }
+
+  public:
+    VaSlabPool(const VaSlabPool&) = delete;
+    VaSlabPool& operator=(const VaSlabPool&) = delete;
+
+    /**
+     * @brief Creates a new, empty pool with a reference count of one.
+     * @return Pointer to the new pool. Release it with @ref Release.
+     */
+    static VaSlabPool* New() { return new VaSlabPool(); }
+
+    /**
+     * @brief Drops one reference to the pool, destroying it (and any pool it forwards to
+     *        whose count drops to zero) when no owners remain.
+     * @param pool The pool to release. May be nullptr.
+     */
+    static void Release(VaSlabPool* pool) noexcept {
+        while (pool && --pool->refs == 0) {
+            VaSlabPool* next = pool->forward;
+            delete pool;
+            pool = next;
+        }
+    }
+
+    /**
+     * @brief Merges the slabs of one pool into another. After the call, @p from forwards to @p into.
+     * @tparam Next Callable returning a reference to the link field of a slot (`T*&(T*)`).
+     * @param into The pool receiving the slabs (must be resolved).
+     * @param from The pool giving up its slabs (must be resolved).
+     * @param next Accessor for the link field, used to move the unused slots handed back to @p from.
+     * @return The pool that now owns all slabs.
+     */
+    template <typename Next>
+    static VaSlabPool* Merge(VaSlabPool* into, VaSlabPool* from, Next&& next) noexcept {
+        if (into == from) return into;
+
+        if (from->slabs) {
+            if (into->lastSlab) {
+                into->lastSlab->next = from->slabs;
+            } else {
+                into->slabs = from->slabs;
+            }
+            into->lastSlab = from->lastSlab;
+        }
+        into->capacity += from->capacity;
+        if (from->spareHead) into->donate(from->spareHead, from->spareTail, from->spareCount, next);
+
+        from->slabs = from->lastSlab = nullptr;
+        from->capacity = 0;
+        from->spareHead = from->spareTail = nullptr;
+        from->spareCount = 0;
+        from->forward = into;
+        into->refs++;
+
+        return into;
+    }
+
+    /**
+     * @brief Follows the forwarding chain to the pool that currently owns the slabs.
+     * @return The owning pool.
+     */
+    VaSlabPool* resolve() noexcept {
+        VaSlabPool* pool = this;
+        while (pool->forward) pool = pool->forward;
+        return pool;
+    }
+
+    /// @brief Adds a reference to the pool.
+    inline void retain() noexcept { refs++; }
+
+    /**
+     * @brief Checks whether the pool has more than one owner.
+     * @return True if another container or pool references this one.
+     */
+    inline bool isShared() const noexcept { return refs > 1; }
+
+    /**
+     * @brief Returns the total number of slots across all slabs.
+     */
+    inline Size getCapacity() const noexcept { return capacity; }
+
+    /**
+     * @brief Returns the number of unused slots handed back by former owners.
+     */
+    inline Size getSpareCount() const noexcept { return spareCount; }
+
+    /**
+     * @brief Hands a list of unused slots back to the pool, so that other owners can reuse them.
+     * @tparam Next Callable returning a reference to the link field of a slot (`T*&(T*)`).
+     * @param first First slot of the list.
+     * @param last Last slot of the list.
+     * @param count Number of slots in the list.
+     * @param next Accessor for the link field.
+     *
+     * @warning Must only be called on a resolved pool.
+     */
+    template <typename Next>
+    void donate(T* first, T* last, Size count, Next&& next) noexcept {
+        next(last) = spareHead;
+        spareHead = first;
+        if (!spareTail) spareTail = last;
+        spareCount += count;
+    }
+
+    /**
+     * @brief Takes every unused slot handed back to the pool and puts them in front of a free list.
+     * @tparam Next Callable returning a reference to the link field of a slot (`T*&(T*)`).
+     * @param freeHead First slot of the free list receiving the slots. May be nullptr.
+     * @param freeCount Size of that free list; incremented by the number of slots taken.
+     * @param next Accessor for the link field.
+     * @return New head of the free list.
+     *
+     * @warning Must only be called on a resolved pool.
+     */
+    template <typename Next>
+    T* takeSpare(T* freeHead, Size& freeCount, Next&& next) noexcept {
+        if (!spareHead) return freeHead;
+
+        T* first = spareHead;
+        next(spareTail) = freeHead;
+        freeCount += spareCount;
+
+        spareHead = spareTail = nullptr;
+        spareCount = 0;
+        return first;
+    }
+
+    /**
+     * @brief Allocates a new slab of uninitialized slots.
+     * @param count Number of slots in the slab.
+     * @return Pointer to the first slot. The slots are contiguous.
+     *
+     * @throws std::bad_alloc If the allocation fails.
+     */
+    T* allocate(Size count) {
+        void* mem = ::operator new(sizeof(Slab) + count * sizeof(T), std::align_val_t(slabAlign));
+
+        Slab* slab = static_cast<Slab*>(mem);
+        slab->next = nullptr;
+        slab->count = count;
+
+        if (lastSlab) {
+            lastSlab->next = slab;
+        } else {
+            slabs = slab;
+        }
+        lastSlab = slab;
+        capacity += count;
+
+        return slab->items();
+    }
+
+    /**
+     * @brief Releases every slab whose slots are all unused.
+     *        The unused slots are given as an intrusive singly linked list.
+     * @tparam Next Callable returning a reference to the link field of a slot (`T*&(T*)`).
+     * @param freeHead First unused slot.
+     * @param freeCount Number of unused slots; updated to the number left after the call.
+     * @param next Accessor for the link field.
+     * @return New head of the list of unused slots.
+     *
+     * @note Runs in O(freeCount * slabs). Since slabs usually grow geometrically, the number
+     *       of slabs stays logarithmic in the capacity.
+     * @warning Must only be called on an unshared, resolved pool, with a list describing
+     *          every unused slot of the pool (take the handed back ones with @ref takeSpare first).
+     */
+    template <typename Next>
+    T* releaseUnused(T* freeHead, Size& freeCount, Next&& next) noexcept {
+        Size slabCount = 0;
+        for (Slab* s = slabs; s; s = s->next) slabCount++;
+        if (slabCount == 0) return freeHead;
+
+        Size* unused = new (std::nothrow) Size[slabCount]();
+        if (!unused) return freeHead;
+
+        auto slabIndex = [this](const T* ptr) -> Size {
+            Size i = 0;
+            for (Slab* s = slabs; s; s = s->next, i++) {
+                if (s->contains(ptr)) return i;
+            }
+            return i;
+        };
+
+        for (T* node = freeHead; node; node = next(node)) {
+            Size i = slabIndex(node);
+            if (i < slabCount) unused[i]++;
+        }
+
+        // mark fully unused slabs, then rebuild the free list without their slots
+        Size i = 0;
+        for (Slab* s = slabs; s; s = s->next, i++) {
+            unused[i] = (unused[i] == s->count);
+        }
+
+        T* newHead = nullptr;
+        T* newTail = nullptr;
+        Size newCount = 0;
+        for (T* node = freeHead; node;) {
+            T* following = next(node);
+            Size idx = slabIndex(node);
+            if (idx >= slabCount || !unused[idx]) {
+                if (newTail) {
+                    next(newTail) = node;
+                } else {
+                    newHead = node;
+                }
+                newTail = node;
+                newCount++;
+            }
+            node = following;
+        }
+        if (newTail) next(newTail) = nullptr;
+
+        Slab* prev = nullptr;
+        Slab* current = slabs;
+        i = 0;
+        while (current) {
+            Slab* following = current->next;
+            if (unused[i]) {
+                if (prev) {
+                    prev->next = following;
+                } else {
+                    slabs = following;
+                }
+                capacity -= current->count;
+                ::operator delete(current, std::align_val_t(slabAlign));
+            } else {
+                prev = current;
+            }
+            current = following;
+            i++;
+        }
+        lastSlab = prev;
+
+        delete[] unused;
+        freeCount = newCount;
+        return newHead;
+    }
+};
@@ -9,3 +9,5 @@
 #include <VaLib/Meta/TemplateConstant.hpp>
 #include <VaLib/Meta/TemplateTuple.hpp>
 #include <VaLib/Meta/TemplateStringLiteral.hpp>
+#include <VaLib/Meta/FixedString.hpp>
+#include <VaLib/Meta/StringMatch.hpp>
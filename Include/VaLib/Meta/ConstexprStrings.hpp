@@ -3,6 +3,11 @@
 // (C) 2025 VaLibTeam
 #pragma once
 
+#include <VaLib/Types/BasicTypedef.hpp>
+
+#include <cstring>
+#include <type_traits>
+
 namespace va {
 
 constexpr bool constexprStrEq(const char* a, const char* b) {
@@ -10,4 +15,53 @@ constexpr bool constexprStrEq(const char* a, const char* b) {
     return *a == *b;
 }
 
+constexpr Size constexprStrLen(const char* str) {
+    Size len = 0;
+    while (str[len]) len++;
+    return len;
+}
+
+/**
+ * @brief Compares the first len characters of a and b; memcmp at run time.
+ */
+constexpr bool constexprStrEq(const char* a, const char* b, Size len) {
+    if (std::is_constant_evaluated()) {
+        for (Size i = 0; i < len; i++) {
+            if (a[i] != b[i]) return false;
+        }
+        return true;
+    }
+    return len == 0 || std::memcmp(a, b, len) == 0;
+}
+
+/**
+ * @brief Copies len characters from src to dst, which must not overlap; memcpy at run time.
+ */
+constexpr void constexprStrCopy(char* dst, const char* src, Size len) {
+    if (std::is_constant_evaluated()) {
+        for (Size i = 0; i < len; i++) dst[i] = src[i];
+        return;
+    }
+    if (len) std::memcpy(dst, src, len);
+}
+
+/**
+ * @brief Hashes len characters with 64-bit FNV-1a.
+ *
+ * @note This is the hash of VaString, so `constexprStrHash("key")` equals
+ * `VaHash<VaString>{}(VaString("key"))`.
+ */
+constexpr Size constexprStrHash(const char* str, Size len) {
+    Size hash = Size(14695981039346656037ull);
+    for (Size i = 0; i < len; i++) {
+        hash ^= Size(uint8(str[i]));
+        hash *= Size(1099511628211ull);
+    }
+    return hash;
+}
+
+constexpr Size constexprStrHash(const char* str) {
+    return constexprStrHash(str, constexprStrLen(str));
+}
+
 }
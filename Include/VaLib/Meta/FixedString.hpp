@@ -0,0 +1,76 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Meta/ConstexprStrings.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/String.hpp>
+
+/**
+ * @brief A string literal that can be passed as a template argument.
+ *
+ * @tparam N Size of the literal, including the terminating null character.
+ *
+ * @code
+ * template <VaFixedString Name>
+ * struct Command {};
+ *
+ * Command<"help"> help;
+ * @endcode
+ *
+ * @note Unlike VaTemplateStringLiteral, which spells the string as a pack of chars,
+ * the literal is written as is and deduced by class template argument deduction.
+ */
+template <Size N>
+struct VaFixedString {
+    char chars[N] = {};
+
+    static constexpr Size len = N - 1;
+
+    constexpr VaFixedString() = default;
+
+    constexpr VaFixedString(const char (&str)[N]) {
+        for (Size i = 0; i < N; i++) chars[i] = str[i];
+    }
+
+    constexpr const char* data() const noexcept { return chars; }
+
+    /**
+     * @brief Returns the VaHash of the string, the same as for an equal VaString.
+     */
+    constexpr Size hash() const noexcept { return va::constexprStrHash(chars, len); }
+
+    template <Size M>
+    constexpr bool operator==(const VaFixedString<M>& other) const noexcept {
+        return len == other.len && va::constexprStrEq(chars, other.chars, len);
+    }
+};
+
+namespace va {
+
+/**
+ * @brief Copies the VaString built by Make at compile time into a VaFixedString.
+ *
+ * @tparam Make A constexpr callable, usually a lambda, returning a VaString.
+ *
+ * As with va::toArray(), the VaString itself can't outlive the constant evaluation, so Make is
+ * evaluated once for the length and once for the characters.
+ *
+ * @code
+ * constexpr auto banner = va::toFixedString<[] { return VaString("v") + VaString(3, '.') + "1"; }>();
+ * static_assert(banner == VaFixedString("v...1"));
+ * @endcode
+ */
+template <auto Make>
+consteval auto toFixedString() {
+    constexpr Size n = len(Make());
+
+    const VaString str = Make();
+    VaFixedString<n + 1> result;
+    for (Size i = 0; i < n; i++) result.chars[i] = str[i];
+    return result;
+}
+
+} // namespace va
@@ -0,0 +1,243 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Meta/ConstexprStrings.hpp>
+#include <VaLib/Meta/FixedString.hpp>
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Types/Tuple.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace va {
+
+/**
+ * @brief A case of va::match(): fn is called when the string equals Key.
+ */
+template <VaFixedString Key, typename F>
+struct MatchCase {
+    static constexpr auto key = Key;
+    F fn;
+};
+
+/**
+ * @brief The fallback of va::match(): fn is called when no case matches.
+ */
+template <typename F>
+struct MatchDefault {
+    F fn;
+};
+
+/**
+ * @brief Makes a case of va::match() that calls fn when the string equals Key.
+ */
+template <VaFixedString Key, typename F>
+constexpr MatchCase<Key, tt::Decay<F>> on(F&& fn) {
+    return {std::forward<F>(fn)};
+}
+
+/**
+ * @brief Makes the fallback of va::match(), called when no case matches.
+ */
+template <typename F>
+constexpr MatchDefault<tt::Decay<F>> otherwise(F&& fn) {
+    return {std::forward<F>(fn)};
+}
+
+namespace detail {
+
+template <typename T>
+constexpr bool IsMatchCase = false;
+
+template <VaFixedString Key, typename F>
+constexpr bool IsMatchCase<MatchCase<Key, F>> = true;
+
+template <typename T>
+constexpr bool IsMatchDefault = false;
+
+template <typename F>
+constexpr bool IsMatchDefault<MatchDefault<F>> = true;
+
+template <typename T>
+constexpr bool IsMatchArg = IsMatchCase<tt::Decay<T>> || IsMatchDefault<tt::Decay<T>>;
+
+template <typename Case>
+using MatchResult = std::invoke_result_t<decltype(tt::Decay<Case>::fn)&>;
+
+/**
+ * @brief Compile-time slot table of the keys of a va::match().
+ *
+ * A key lands in slot `(hash >> shift) & mask`. The shift and the table size are searched at
+ * compile time so that no two keys share a slot, which leaves a single candidate to compare
+ * the input against.
+ */
+template <VaFixedString... Keys>
+class StringMatchTable {
+  public:
+    static constexpr Size count = sizeof...(Keys);
+    static constexpr Size hashes[] = {Keys.hash()...};
+    static constexpr Size lengths[] = {Keys.len...};
+    static constexpr const char* strings[] = {Keys.data()...};
+
+  protected:
+    static constexpr Size maxBits = 16;
+
+    struct Layout {
+        Size shift;
+        Size bits;
+    };
+
+    static constexpr bool isCollisionFree(Size shift, Size mask) {
+        for (Size i = 0; i < count; i++) {
+            for (Size j = i + 1; j < count; j++) {
+                if (((hashes[i] >> shift) & mask) == ((hashes[j] >> shift) & mask)) return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr Layout findLayout() {
+        Size bits = 0;
+        while ((Size(1) << bits) < 2 * count) bits++;
+
+        for (; bits <= maxBits; bits++) {
+            for (Size shift = 0; shift + bits <= sizeof(Size) * 8; shift++) {
+                if (isCollisionFree(shift, (Size(1) << bits) - 1)) return {shift, bits};
+            }
+        }
+        return {0, maxBits + 1};
+    }
+
+    static constexpr bool hasDuplicates() {
+        for (Size i = 0; i < count; i++) {
+            for (Size j = i + 1; j < count; j++) {
+                if (lengths[i] == lengths[j] && va::constexprStrEq(strings[i], strings[j], lengths[i])) return true;
+            }
+        }
+        return false;
+    }
+
+    static_assert(count < 0xFFFF, "va::match() supports up to 65534 cases");
+    static_assert(!hasDuplicates(), "va::match() has a duplicate case");
+
+    static constexpr Layout layout = findLayout();
+    static_assert(layout.bits <= maxBits, "va::match() could not place its cases in a slot table");
+
+    static constexpr VaArray<uint16, Size(1) << layout.bits> makeSlots() {
+        VaArray<uint16, Size(1) << layout.bits> slots{};
+        for (uint16& slot: slots) slot = uint16(count);
+        for (Size i = 0; i < count; i++) slots[(hashes[i] >> layout.shift) & mask] = uint16(i);
+        return slots;
+    }
+
+  public:
+    static constexpr Size shift = layout.shift;
+    static constexpr Size mask = (Size(1) << layout.bits) - 1;
+    static constexpr VaArray<uint16, Size(1) << layout.bits> slots = makeSlots();
+
+    /**
+     * @brief Returns the index of the key equal to str, or count if there is none.
+     */
+    static constexpr Size find(const char* str, Size len) {
+        const Size hash = va::constexprStrHash(str, len);
+        const Size index = slots[(hash >> shift) & mask];
+
+        if (index < count && hashes[index] == hash && lengths[index] == len && va::constexprStrEq(strings[index], str, len)) {
+            return index;
+        }
+        return count;
+    }
+};
+
+template <typename Cases, typename Indices>
+struct StringMatchTableOf;
+
+template <typename... Cases, Size... I>
+struct StringMatchTableOf<VaTuple<Cases...>, std::index_sequence<I...>> {
+    using Type = StringMatchTable<VaTuple<Cases...>::template Element<I>::key...>;
+};
+
+template <typename R, typename Refs, Size I>
+constexpr R matchInvoke(Refs& cases) {
+    return std::invoke(cases.template get<I>().fn);
+}
+
+// Jump table over the cases of a va::match(), one entry per case.
+template <typename R, typename Refs, typename Indices>
+struct MatchDispatch;
+
+template <typename R, typename Refs, Size... I>
+struct MatchDispatch<R, Refs, std::index_sequence<I...>> {
+    static constexpr R (*table[])(Refs&) = {&matchInvoke<R, Refs, I>...};
+};
+
+} // namespace detail
+
+/**
+ * @brief Calls the case whose key equals the string, or the otherwise() fallback.
+ *
+ * @param str The string to match, of len characters.
+ * @param cases va::on<"key">(fn) cases, optionally followed by one va::otherwise(fn).
+ * @return The result of the called function. Every case must return the same type, and
+ * an otherwise() case is required unless that type is void.
+ *
+ * The keys are placed at compile time in a slot table indexed by their VaHash, so a match
+ * costs one hash of the input, one lookup and one string comparison, however many cases
+ * there are. The selected function is then called through a jump table.
+ *
+ * @code
+ * va::match(command,
+ *     va::on<"help">([] { printHelp(); }),
+ *     va::on<"quit">([&] { running = false; }),
+ *     va::otherwise([&] { printUnknown(command); }));
+ * @endcode
+ */
+template <typename... Cases>
+    requires(sizeof...(Cases) > 0 && (detail::IsMatchArg<Cases> && ...))
+constexpr decltype(auto) match(const char* str, Size len, Cases&&... cases) {
+    using CaseTuple = VaTuple<tt::Decay<Cases>...>;
+    using Refs = VaTuple<tt::RemoveReference<Cases>&...>;
+    using R = detail::MatchResult<typename CaseTuple::template Element<0>>;
+
+    constexpr Size caseCount = (Size(detail::IsMatchCase<tt::Decay<Cases>>) + ...);
+    constexpr bool hasDefault = detail::IsMatchDefault<typename CaseTuple::template Element<sizeof...(Cases) - 1>>;
+
+    static_assert(caseCount + Size(hasDefault) == sizeof...(Cases), "otherwise() must be the last case of match()");
+    static_assert((tt::IsSame<detail::MatchResult<Cases>, R> && ...), "match() requires the same return type for every case");
+    static_assert(hasDefault || tt::IsVoid<R>, "match() requires an otherwise() case when the cases return a value");
+
+    Refs refs(cases...);
+
+    if constexpr (caseCount > 0) {
+        using Table = typename detail::StringMatchTableOf<CaseTuple, std::make_index_sequence<caseCount>>::Type;
+        using Dispatch = detail::MatchDispatch<R, Refs, std::make_index_sequence<caseCount>>;
+
+        const Size index = Table::find(str, len);
+        if (index < caseCount) return Dispatch::table[index](refs);
+    }
+
+    if constexpr (hasDefault) {
+        return std::invoke(refs.template get<caseCount>().fn);
+    }
+}
+
+template <typename... Cases>
+    requires(sizeof...(Cases) > 0 && (detail::IsMatchArg<Cases> && ...))
+constexpr decltype(auto) match(const char* str, Cases&&... cases) {
+    return va::match(str, va::constexprStrLen(str), std::forward<Cases>(cases)...);
+}
+
+template <typename... Cases>
+    requires(sizeof...(Cases) > 0 && (detail::IsMatchArg<Cases> && ...))
+decltype(auto) match(const VaString& str, Cases&&... cases) {
+    return va::match(str.begin(), len(str), std::forward<Cases>(cases)...);
+}
+
+} // namespace va
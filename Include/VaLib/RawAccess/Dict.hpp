@@ -5,6 +5,7 @@
 
 #include <VaLib/Types/BasicTypedef.hpp>
 #include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Utils/Hash.hpp>
 
 template <typename K, typename V, typename Hash>
 class VaDict;
@@ -44,4 +45,8 @@ struct VaDictRawView {
     Entry* tail;     ///< Pointer to the last element (in insertion order)
 
     Hash hashFunc;  ///< Hash function used to compute bucket indices from keys
+
+    va::detail::HashSum entriesHash; ///< Running hash of the entries, while hash tracking is on
+    bool hashTracked;                ///< Whether entriesHash is maintained
+    bool hashStale;                  ///< Whether a value may have changed since entriesHash was updated
 };
@@ -11,10 +11,13 @@ struct VaLinkedListNode;
 template <typename T>
 class VaLinkedList;
 
+template <typename T>
+class VaSlabPool;
+
 /**
  * @brief Raw view into the internal state of a linked list.
  *        This struct provides layout-compatible access to the internal pointers
- *        and metadata of a linked list: head/tail, length, and freelist.
+ *        and metadata of a linked list: head/tail, length, freelist and node slab pool.
  *
  * @tparam T The type of elements in the list.
  *
@@ -38,4 +41,6 @@ struct VaLinkedListRawView {
 
     Node* freeListHead; ///< Pointer to the first node in the freelist
     Size freeListSize;  ///< Number of nodes currently stored in the freelist
+
+    VaSlabPool<Node>* pool; ///< Slab pool the nodes are carved from
 };
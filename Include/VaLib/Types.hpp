@@ -16,16 +16,32 @@
 #include <VaLib/Types/BasicTypedef.hpp>
 #include <VaLib/Types/Blank.hpp>
 #include <VaLib/Types/Box.hpp>
+#include <VaLib/Types/CacheStats.hpp>
+#include <VaLib/Types/ConcurrentCache.hpp>
+#include <VaLib/Types/ConcurrentStack.hpp>
 #include <VaLib/Types/Dict.hpp>
 #include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/Heap.hpp>
 #include <VaLib/Types/ImmutableString.hpp>
+#include <VaLib/Types/IntrusiveHashIndex.hpp>
+#include <VaLib/Types/IntrusiveList.hpp>
+#include <VaLib/Types/LfuCache.hpp>
 #include <VaLib/Types/LinkedChunkedList.hpp>
 #include <VaLib/Types/LinkedList.hpp>
 #include <VaLib/Types/List.hpp>
+#include <VaLib/Types/LruCache.hpp>
+#include <VaLib/Types/MpmcQueue.hpp>
 #include <VaLib/Types/Pair.hpp>
+#include <VaLib/Types/PolyList.hpp>
+#include <VaLib/Types/PriorityQueue.hpp>
 #include <VaLib/Types/Set.hpp>
 #include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/SpscRing.hpp>
 #include <VaLib/Types/Stack.hpp>
+#include <VaLib/Types/StaticDict.hpp>
+#include <VaLib/Types/StaticList.hpp>
+#include <VaLib/Types/StaticStack.hpp>
 #include <VaLib/Types/String.hpp>
 #include <VaLib/Types/Tuple.hpp>
 #include <VaLib/Types/TypeTraits.hpp>
+#include <VaLib/Types/Variant.hpp>
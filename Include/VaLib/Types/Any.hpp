@@ -5,352 +5,424 @@
 
 #include <VaLib/Types/BasicTypedef.hpp>
 #include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
 
-#include <typeinfo>
-#include <type_traits>
-#include <stdexcept>
+#include <cstring>
 #include <new>
-#include <memory>
+#include <utility>
+
+#if defined(__cpp_rtti) || defined(__GXX_RTTI)
+    #include <typeinfo>
+    #define VA_ANY_HAS_RTTI 1
+#endif
+
+/**
+ * @brief Identifier of a type, unique within a program: the address of a per-type static.
+ *
+ * Unlike std::type_info it needs no RTTI, and comparing two of them is a single pointer compare.
+ *
+ * @note Identifiers of the same type may differ between shared libraries that do not export it.
+ */
+using VaTypeId = const void*;
+
+namespace va::detail {
+
+template <typename T>
+struct TypeTag {
+    static constexpr char id = 0;
+};
 
-class VaAny {
-  protected:
-    using TypeID = const std::type_info;
+/// @brief Default inline size of VaAny and VaUniqueAny: room for a VaString, a VaList or four doubles.
+inline constexpr Size anyDefaultInlineSize = 32;
 
-    static constexpr Size SBO_SIZE = 24;
-    struct alignas(MaxAlignType) AlignedBuffer {
-        byte data[SBO_SIZE];
-    };
+/// @brief Type built by emplace<T>(args...): T, or the decayed argument type if T is void.
+template <typename T, typename... Args>
+struct AnyEmplaced {
+    using Type = T;
+};
+
+template <typename Arg>
+struct AnyEmplaced<void, Arg> {
+    using Type = tt::Decay<Arg>;
+};
 
+} // namespace va::detail
+
+namespace va {
+
+/**
+ * @brief Returns the identifier of T; cv-qualifiers and references are ignored.
+ */
+template <typename T>
+constexpr VaTypeId typeId() noexcept {
+    return &va::detail::TypeTag<tt::RemoveCVRef<T>>::id;
+}
+
+} // namespace va
+
+/**
+ * @class VaBasicAny A container for a single value of any type.
+ *
+ * @tparam InlineSize Size of the inline buffer. Values that fit (and are nothrow movable) are stored
+ *         inline, larger ones are heap-allocated.
+ * @tparam Copyable Whether the container is copyable. A copyable container accepts copyable values
+ *         only, checked at compile time; a move-only one accepts move-only values too.
+ *
+ * Every stored type gets one static table of operations; the container holds a pointer to it and the
+ * value, so checking the type is a single pointer compare and needs no RTTI. Values that are
+ * trivially copyable (when inline) or heap-allocated are moved by copying the bytes.
+ *
+ * Use the aliases: VaAny (copyable) and VaUniqueAny (move-only).
+ *
+ * @code
+ * VaAny any = VaString("hello");
+ * if (any.isType<VaString>()) print(any.get<VaString>());
+ *
+ * VaUniqueAny owner = VaUniquePtr<Socket>(...);
+ * @endcode
+ */
+template <Size InlineSize = va::detail::anyDefaultInlineSize, bool Copyable = true>
+class VaBasicAny {
+    static_assert(InlineSize >= sizeof(void*), "the inline buffer must hold at least a pointer");
+
+  protected:
     struct VTable {
-        void (*destroy)(void*);
-        void (*copy)(const void*, void*);
-        void (*move)(void*, void*);
-        void* (*clone)(const void*);
+        VaTypeId type;
+        bool onHeap;
+        void (*destroy)(VaBasicAny&) noexcept;             ///< nullptr for trivially destructible inline values
+        void (*copy)(const VaBasicAny&, VaBasicAny&);      ///< nullptr if the container is move-only
+        void (*move)(VaBasicAny&, VaBasicAny&) noexcept;   ///< Moves and destroys the source; nullptr to copy the bytes
+#ifdef VA_ANY_HAS_RTTI
+        const std::type_info& (*info)() noexcept;
+#endif
     };
 
-    const VTable* vtable = nullptr;
-    TypeID* type = nullptr;
-    bool onHeap = false;
-
-    union {
+    union Storage {
         void* heapPtr;
-        AlignedBuffer sboBuf;
+        alignas(MaxAlignType) byte buffer[InlineSize];
     };
 
-    void* dataPtr() { return onHeap ? heapPtr : static_cast<void*>(&sboBuf); }
-    const void* dataPtr() const { return onHeap ? heapPtr : static_cast<const void*>(&sboBuf); }
+    const VTable* vtable = nullptr;
+    Storage storage;
+
+    template <typename T>
+    static constexpr bool fitsInline = sizeof(T) <= InlineSize && alignof(T) <= alignof(MaxAlignType) && tt::IsNoexceptMoveConstructible<T>;
+
+    template <typename T>
+    inline T* ptr() noexcept {
+        if constexpr (fitsInline<T>) {
+            return std::launder(reinterpret_cast<T*>(storage.buffer));
+        } else {
+            return static_cast<T*>(storage.heapPtr);
+        }
+    }
 
     template <typename T>
-    static const VTable* makeVTable() {
-        static const VTable vt = {// destroy
-            [](void* ptr) { static_cast<T*>(ptr)->~T(); },
-
-            // copy
-            [](const void* src, void* dest) {
-                #if __cplusplus >= CPP17
-                    if constexpr (tt::IsCopyConstructible<T>) {
-                        new (dest) T(*static_cast<const T*>(src));
-                    } else {
-                        throw TypeError("Type is not copyable");
-                    }
-                #else
-                    if (tt::IsCopyConstructible<T>) {
-                        new (dest) T(*static_cast<const T*>(src));
-                    } else {
-                        throw TypeError("Type is not copyable");
-                    }
-                #endif
-            },
-
-            // move
-            [](void* src, void* dest) { new (dest) T(std::move(*static_cast<T*>(src))); },
-
-            // clone (heap copy)
-            [](const void* src) -> void* {
-                #if __cplusplus >= CPP17
-                    if constexpr (tt::IsCopyConstructible<T>) {
-                        void* mem = operator new(sizeof(T));
-                        new (mem) T(*static_cast<const T*>(src));
-                        return mem;
-                    } else {
-                        throw TypeError("Type is not copyable");
-                    }
-                #else
-                    if (tt::IsCopyConstructible<T>) {
-                        void* mem = operator new(sizeof(T));
-                        new (mem) T(*static_cast<const T*>(src));
-                        return mem;
-                    } else {
-                        throw TypeError("Type is not copyable");
-                    }
-                #endif
-            }};
-        return &vt;
+    inline const T* ptr() const noexcept {
+        return const_cast<VaBasicAny*>(this)->template ptr<T>();
+    }
+
+    template <typename T>
+    static void destroyValue(VaBasicAny& any) noexcept {
+        if constexpr (fitsInline<T>) {
+            any.ptr<T>()->~T();
+        } else {
+            delete any.ptr<T>();
+        }
+    }
+
+    template <typename T>
+    static void copyValue(const VaBasicAny& src, VaBasicAny& dest) {
+        if constexpr (fitsInline<T>) {
+            new (dest.storage.buffer) T(*src.ptr<T>());
+        } else {
+            dest.storage.heapPtr = new T(*src.ptr<T>());
+        }
+    }
+
+    template <typename T>
+    static void moveValue(VaBasicAny& src, VaBasicAny& dest) noexcept {
+        T* value = src.ptr<T>();
+        new (dest.storage.buffer) T(std::move(*value));
+        value->~T();
+    }
+
+#ifdef VA_ANY_HAS_RTTI
+    template <typename T>
+    static const std::type_info& infoOf() noexcept {
+        return typeid(T);
+    }
+#endif
+
+    template <typename T>
+    static constexpr void (*destroyFor())(VaBasicAny&) noexcept {
+        if constexpr (fitsInline<T> && tt::IsTriviallyDestructible<T>) {
+            return nullptr;
+        } else {
+            return &destroyValue<T>;
+        }
+    }
+
+    template <typename T>
+    static constexpr void (*copyFor())(const VaBasicAny&, VaBasicAny&) {
+        if constexpr (Copyable) {
+            return &copyValue<T>;
+        } else {
+            return nullptr;
+        }
+    }
+
+    template <typename T>
+    static constexpr void (*moveFor())(VaBasicAny&, VaBasicAny&) noexcept {
+        if constexpr (!fitsInline<T> || tt::IsTriviallyCopyable<T>) {
+            return nullptr;
+        } else {
+            return &moveValue<T>;
+        }
+    }
+
+    template <typename T>
+    static constexpr VTable vtableFor = {
+        va::typeId<T>(), !fitsInline<T>, destroyFor<T>(), copyFor<T>(), moveFor<T>(),
+#ifdef VA_ANY_HAS_RTTI
+        &infoOf<T>,
+#endif
+    };
+
+    void copyFrom(const VaBasicAny& other) {
+        if (!other.vtable) return;
+        other.vtable->copy(other, *this);
+        vtable = other.vtable;
+    }
+
+    void moveFrom(VaBasicAny& other) noexcept {
+        if (!other.vtable) return;
+        if (other.vtable->move) {
+            other.vtable->move(other, *this);
+        } else {
+            std::memcpy(&storage, &other.storage, sizeof(Storage));
+        }
+        vtable = other.vtable;
+        other.vtable = nullptr;
     }
 
   public:
+    /// @brief Size of the inline buffer.
+    static constexpr Size inlineSize = InlineSize;
+
     /**
-     * @brief Default constructor for VaAny.
+     * @brief Checks whether a value of type T would be stored inline, without allocating.
      */
-    VaAny() = default;
+    template <typename T>
+    static constexpr bool isStoredInline = fitsInline<tt::Decay<T>>;
 
     /**
-     * @brief Constructs a VaAny object with the given value.
-     * @tparam T The type of the value to store.
-     * @param value The value to store in the VaAny object.
-     *
-     * @note This constructor uses perfect forwarding to store the value.
+     * @brief Default constructor: an empty container.
      */
-    template <typename T>
-    VaAny(T&& value) {
-        emplace<std::decay_t<T>>(std::forward<T>(value));
-    }
+    VaBasicAny() noexcept = default;
 
     /**
-     * @brief Copy constructor for VaAny.
-     *        Creates a new VaAny object as a copy of the given object.
-     *        If the value is stored on the heap, it will be cloned.
-     *        Otherwise, it will be copied into the small buffer optimization (SBO) storage.
-     * @param other The VaAny object to copy from.
+     * @brief Constructs a container holding value.
+     * @tparam T The type of the value; the stored type is its decayed type.
+     * @param value The value to store, copied or moved.
      */
-    VaAny(const VaAny& other) {
-        if (other.vtable) {
-            vtable = other.vtable;
-            type = other.type;
-            onHeap = other.onHeap;
-
-            if (onHeap) {
-                heapPtr = vtable->clone(other.dataPtr());
-            } else {
-                vtable->copy(other.dataPtr(), &sboBuf);
-            }
-        }
+    template <typename T, typename = tt::EnableIf<!tt::IsSame<tt::Decay<T>, VaBasicAny>>>
+    VaBasicAny(T&& value) {
+        emplace(std::forward<T>(value));
     }
 
     /**
-     * @brief Move constructor for VaAny.
-     *        Creates a new VaAny object by transferring ownership of the value from
-     *        the given object. If the value is stored on the heap, the pointer is
-     *        moved. Otherwise, the value is moved into the SBO storage.
-     * @param other The VaAny object to move from.
+     * @brief Constructs a value of type T in place from args.
      */
-    VaAny(VaAny&& other) noexcept {
-        if (other.vtable) {
-            vtable = other.vtable;
-            type = other.type;
-            onHeap = other.onHeap;
-
-            if (onHeap) {
-                heapPtr = other.heapPtr;
-                other.heapPtr = nullptr;
-            } else {
-                vtable->move(other.dataPtr(), &sboBuf);
-            }
-
-            other.vtable = nullptr;
-            other.type = nullptr;
-        }
+    template <typename T, typename... Args>
+    explicit VaBasicAny(std::in_place_type_t<T>, Args&&... args) {
+        emplace<T>(std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Destructor for VaAny.
-     *        Cleans up any resources held by the object, including destroying
-     *        the stored value and deallocating memory if the value is stored on the heap.
+     * @brief Copy constructor. Heap-allocated values are cloned; inline ones are copied into the buffer.
+     * @param other The container to copy from.
+     */
+    VaBasicAny(const VaBasicAny& other) requires Copyable { copyFrom(other); }
+
+    /**
+     * @brief Move constructor. Takes over the heap allocation, or moves the inline value.
+     * @param other The container to move from; it is left empty.
+     */
+    VaBasicAny(VaBasicAny&& other) noexcept { moveFrom(other); }
+
+    /**
+     * @brief Destroys the stored value and frees its allocation, if any.
      */
-    ~VaAny() { reset(); }
+    ~VaBasicAny() { reset(); }
 
     /**
-     * @brief Copy assignment operator for VaAny.
-     *        Assigns the value from another VaAny object to this one.
-     *        If the value is stored on the heap, it will be cloned.
-     *        Otherwise, it will be copied into the small buffer optimization (SBO) storage.
-     * @param other The VaAny object to copy from.
-     * @return A reference to this VaAny object.
+     * @brief Copy assignment operator.
+     * @param other The container to copy from.
+     * @return A reference to this container.
      */
-    VaAny& operator=(const VaAny& other) {
+    VaBasicAny& operator=(const VaBasicAny& other) requires Copyable {
         if (this != &other) {
             reset();
-            if (other.vtable) {
-                vtable = other.vtable;
-                type = other.type;
-                onHeap = other.onHeap;
-
-                if (onHeap) {
-                    heapPtr = vtable->clone(other.dataPtr());
-                } else {
-                    vtable->copy(other.dataPtr(), &sboBuf);
-                }
-            }
+            copyFrom(other);
         }
         return *this;
     }
 
     /**
-     * @brief Move assignment operator for VaAny.
-     *        Transfers ownership of the value from another VaAny object to this one.
-     *        If the value is stored on the heap, the pointer is moved.
-     *        Otherwise, the value is moved into the SBO storage.
-     * @param other The VaAny object to move from.
-     * @return A reference to this VaAny object.
+     * @brief Move assignment operator.
+     * @param other The container to move from; it is left empty.
+     * @return A reference to this container.
      */
-    VaAny& operator=(VaAny&& other) noexcept {
+    VaBasicAny& operator=(VaBasicAny&& other) noexcept {
         if (this != &other) {
             reset();
-            if (other.vtable) {
-                vtable = other.vtable;
-                type = other.type;
-                onHeap = other.onHeap;
-
-                if (onHeap) {
-                    heapPtr = other.heapPtr;
-                    other.heapPtr = nullptr;
-                } else {
-                    vtable->move(other.dataPtr(), &sboBuf);
-                }
-
-                other.vtable = nullptr;
-                other.type = nullptr;
-            }
+            moveFrom(other);
         }
         return *this;
     }
 
     /**
-     * @brief Constructs a new value in the VaAny object, replacing any existing value.
-     * @tparam T The type of the value to construct.
-     * @param value The value to construct in the VaAny object.
+     * @brief Replaces the stored value with a new one constructed in place.
+     * @tparam T The type to construct. If omitted, the decayed type of the single argument.
+     * @param args The constructor arguments.
+     * @return A reference to the new value.
+     *
+     * @details The value is stored inline if it fits the buffer and is nothrow movable, otherwise it
+     *          is heap-allocated. The previous value is destroyed first.
      *
-     * @details This method uses perfect forwarding to construct the value in-place.
-     *          If the size and alignment of the type allow, the value is stored in
-     *          the small buffer optimization (SBO) storage. Otherwise, it is allocated
-     *          on the heap. Any previously stored value is destroyed before the new
-     *          value is constructed.
+     * @code
+     * any.emplace<VaString>(3, 'x'); // Constructs "xxx"
+     * any.emplace(42);               // Stores an int
+     * @endcode
      */
-    template <typename T>
-    void emplace(T&& value) {
-        using U = std::decay_t<T>;
-        const VTable* vt = makeVTable<U>();
+    template <typename T = void, typename... Args>
+    typename va::detail::AnyEmplaced<T, Args...>::Type& emplace(Args&&... args) {
+        using U = typename va::detail::AnyEmplaced<T, Args...>::Type;
+        static_assert(!Copyable || tt::IsCopyConstructible<U>, "VaAny requires a copyable type; use VaUniqueAny for move-only types");
         reset();
 
-        type = &typeid(U);
-        vtable = vt;
-
-        if (sizeof(U) <= SBO_SIZE && alignof(U) <= alignof(AlignedBuffer)) {
-            onHeap = false;
-            new (&sboBuf) U(std::forward<T>(value));
+        U* value;
+        if constexpr (fitsInline<U>) {
+            value = new (storage.buffer) U(std::forward<Args>(args)...);
         } else {
-            onHeap = true;
-            heapPtr = operator new(sizeof(U));
-            new (heapPtr) U(std::forward<T>(value));
+            value = new U(std::forward<Args>(args)...);
+            storage.heapPtr = value;
         }
+        vtable = &vtableFor<U>;
+        return *value;
     }
 
     /**
-     * @brief Resets the VaAny object, destroying any stored value.
-     * @details If a value is stored in the VaAny object, this method destroys it
-     *          and deallocates any memory if the value was stored on the heap.
-     *          After calling this method, the VaAny object will be empty.
+     * @brief Destroys the stored value and frees its allocation, if any.
+     *        The container is empty afterwards.
      */
     void reset() noexcept {
         if (vtable) {
-            vtable->destroy(dataPtr());
-            if (onHeap) {
-                operator delete(heapPtr);
-            }
+            if (vtable->destroy) vtable->destroy(*this);
             vtable = nullptr;
-            type = nullptr;
         }
     }
 
     /**
-     * @brief Swaps the contents of this VaAny object with another.
-     * @param other The VaAny object to swap with.
-     *
-     * @details This method exchanges the contents of the two VaAny objects.
-     *          If the objects are the same, no operation is performed.
+     * @brief Swaps the contents of two containers.
+     * @param other The container to swap with.
      */
-    void swap(VaAny& other) noexcept {
+    void swap(VaBasicAny& other) noexcept {
         if (this == &other) return;
-        VaAny temp = std::move(*this);
+        VaBasicAny temp = std::move(*this);
         *this = std::move(other);
         other = std::move(temp);
     }
 
     /**
      * @brief Retrieves the stored value as the specified type.
-     * @tparam T The type to cast the stored value to.
-     * @return A reference to the stored value of type T.
+     * @tparam T The type of the stored value.
+     * @return A reference to the stored value.
      *
      * @throws InvalidAnyCastError If the stored value is not of type T.
-     * @details This method casts the stored value to the specified type T.
-     *          If the stored value's type does not match T, an exception is thrown.
      */
+    // @{
     template <typename T>
     T& get() {
-        if (!type || *type != typeid(T)) throw InvalidAnyCastError();
-        return *static_cast<T*>(dataPtr());
+        if (!isType<T>()) throw InvalidAnyCastError();
+        return *ptr<T>();
+    }
+    template <typename T>
+    const T& get() const {
+        if (!isType<T>()) throw InvalidAnyCastError();
+        return *ptr<T>();
     }
+    // @}
 
     /**
-     * @brief Retrieves the stored value as the specified type (const version).
-     * @tparam T The type to cast the stored value to.
-     * @return A const reference to the stored value of type T.
-     *
-     * @throws InvalidAnyCastError If the stored value is not of type T.
-     * @details This method casts the stored value to the specified type T.
-     *          If the stored value's type does not match T, an exception is thrown.
+     * @brief Retrieves the stored value as the specified type without throwing.
+     * @return A pointer to the stored value, or nullptr if it is not of type T.
      */
+    // @{
     template <typename T>
-    const T& get() const {
-        if (!type || *type != typeid(T)) throw InvalidAnyCastError();
-        return *static_cast<const T*>(dataPtr());
+    T* tryGet() noexcept {
+        return isType<T>() ? ptr<T>() : nullptr;
     }
+    template <typename T>
+    const T* tryGet() const noexcept {
+        return isType<T>() ? ptr<T>() : nullptr;
+    }
+    // @}
 
     /**
-     * @brief Checks if the VaAny object contains a value.
-     * @return True if the object contains a value, false otherwise.
-     *
-     * @details This method returns true if the VaAny object currently holds a value,
-     *          and false if it is empty.
+     * @brief Checks if the container holds a value.
      */
     bool hasValue() const noexcept { return vtable != nullptr; }
 
     /**
      * @brief Checks if the stored value is of the specified type.
-     * @tparam T The type to check against the stored value.
-     * @return True if the stored value is of type T, false otherwise.
+     * @return True if the stored value is of type T, false otherwise (or if empty).
      *
-     * @details This method compares the type of the stored value with the specified type T.
-     *          If the stored value's type matches T, it returns true. Otherwise, it returns false.
+     * @note A single pointer compare against the operation table of T.
      */
     template <typename T>
-    bool isType() const {
-        return type && *type == typeid(T);
+    bool isType() const noexcept {
+        return vtable == &vtableFor<tt::Decay<T>>;
     }
 
     /**
-     * @brief Retrieves the type information of the currently stored value.
-     * @return A reference to the std::type_info object representing the type of the stored value.
-     *
-     * @details If the VaAny object is empty, this method returns the type information for void.
+     * @brief Identifier of the stored type, or of void if the container is empty.
      */
-    TypeID& currentType() const { return type ? *type : typeid(void); }
+    VaTypeId typeId() const noexcept { return vtable ? vtable->type : va::typeId<void>(); }
 
+#ifdef VA_ANY_HAS_RTTI
     /**
-     * @brief Provides a raw pointer to the stored value.
-     * @return A void pointer to the stored value.
+     * @brief Retrieves the type information of the stored value.
+     * @return The std::type_info of the stored type, or of void if the container is empty.
      *
-     * @details This method returns a raw pointer to the stored value, allowing unsafe access.
-     *          Use this method with caution, as it bypasses type safety.
+     * @note Only available with RTTI; prefer typeId() or isType() for comparisons.
      */
-    void* unsafePtr() noexcept { return dataPtr(); }
+    const std::type_info& currentType() const noexcept { return vtable ? vtable->info() : typeid(void); }
+#endif
 
     /**
-     * @brief Provides a raw pointer to the stored value (const version).
-     * @return A const void pointer to the stored value.
+     * @brief Checks whether the stored value lives in the heap rather than in the inline buffer.
+     */
+    bool isOnHeap() const noexcept { return vtable && vtable->onHeap; }
+
+    /**
+     * @brief Provides a raw pointer to the stored value.
+     * @return A void pointer to the stored value, or nullptr if the container is empty.
      *
-     * @details This method returns a raw pointer to the stored value, allowing unsafe access.
-     *          Use this method with caution, as it bypasses type safety.
+     * @details This bypasses type safety; use with caution.
      */
-    const void* unsafePtr() const noexcept { return dataPtr(); }
+    // @{
+    void* unsafePtr() noexcept {
+        if (!vtable) return nullptr;
+        return vtable->onHeap ? storage.heapPtr : static_cast<void*>(storage.buffer);
+    }
+    const void* unsafePtr() const noexcept { return const_cast<VaBasicAny*>(this)->unsafePtr(); }
+    // @}
 };
+
+/// @brief A copyable container for a single value of any copyable type.
+using VaAny = VaBasicAny<>;
+
+/// @brief A move-only container for a single value of any type, including move-only ones.
+using VaUniqueAny = VaBasicAny<va::detail::anyDefaultInlineSize, false>;
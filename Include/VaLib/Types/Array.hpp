@@ -89,6 +89,16 @@ class VaArray {
         return data[index];
     }
 
+    /**
+     * @brief Accesses element with bounds checking, without throwing
+     * @param index Index of element to access
+     * @return Pointer to requested element, or nullptr if index >= N
+     */
+    // @{
+    constexpr T* tryAt(Size index) noexcept { return index < N ? &data[index] : nullptr; }
+    constexpr const T* tryAt(Size index) const noexcept { return index < N ? &data[index] : nullptr; }
+    // @}
+
     /**
      * @brief Concatenates two arrays
      * @tparam L Size of second array
@@ -274,7 +284,7 @@ class VaArray {
     }
 
   public friends:
-    friend inline Size len(const VaArray& arr) { return N; }
+    friend constexpr Size len(const VaArray&) noexcept { return N; }
 
   public iterators:
     using Iterator = T*;
@@ -301,6 +311,44 @@ class VaArray {
     constexpr ConstReverseIterator crend() const noexcept { return ConstReverseIterator(cbegin()); }
 };
 
+namespace va {
+
+/**
+ * @brief Copies the VaList or VaString built by Make at compile time into a VaArray.
+ *
+ * @tparam Make A constexpr callable, usually a lambda, returning the container to copy.
+ * @return A VaArray holding the elements of the container, of the same length.
+ *
+ * Memory allocated during constant evaluation must be released before the evaluation ends, so
+ * a VaList or VaString computed at compile time can't be stored in a constexpr variable itself.
+ * toArray() evaluates Make once to learn the length and once more to copy the elements into
+ * a VaArray, which can be, and so ends up in read-only memory with no startup cost.
+ *
+ * @code
+ * constexpr auto squares = va::toArray<[] {
+ *     VaList<int> list;
+ *     for (int i = 1; i <= 16; i++) list.append(i * i);
+ *     return list;
+ * }>();
+ *
+ * static_assert(len(squares) == 16 && squares[3] == 16);
+ * @endcode
+ *
+ * @note The container must not be empty, and its elements must not own memory themselves.
+ */
+template <auto Make>
+consteval auto toArray() {
+    using T = tt::RemoveCVRef<decltype(Make()[0])>;
+    constexpr Size n = len(Make());
+
+    const auto container = Make();
+    VaArray<T, n> result{};
+    for (Size i = 0; i < n; i++) result[i] = container[i];
+    return result;
+}
+
+} // namespace va
+
 namespace std {
 
 // for structured bindings
@@ -0,0 +1,29 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+
+/**
+ * @brief Hit/miss counters of a cache, for instrumentation.
+ */
+struct VaCacheStats {
+    Size hits = 0;      ///< Lookups answered from the cache
+    Size misses = 0;    ///< Lookups that had to compute (or load) the value
+    Size evictions = 0; ///< Entries dropped because the cache was full or they expired
+
+    /// @brief Fraction of lookups that were hits; 0 if there were none.
+    inline double hitRate() const noexcept {
+        Size total = hits + misses;
+        return total ? double(hits) / double(total) : 0.0;
+    }
+
+    /// @brief Adds the counters of another cache (e.g. to sum up the shards of a concurrent cache).
+    inline VaCacheStats& operator+=(const VaCacheStats& other) noexcept {
+        hits += other.hits;
+        misses += other.misses;
+        evictions += other.evictions;
+        return *this;
+    }
+};
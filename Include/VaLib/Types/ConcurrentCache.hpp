@@ -0,0 +1,265 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/CacheStats.hpp>
+#include <VaLib/Types/LfuCache.hpp>
+#include <VaLib/Types/LruCache.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace va::detail {
+
+/// @brief Default number of shards of VaShardedCache.
+inline constexpr Size cacheDefaultShards = 16;
+
+} // namespace va::detail
+
+/**
+ * @class VaShardedCache A thread-safe cache made of independent shards of a single-threaded cache.
+ *
+ * @tparam Cache The cache type of each shard, e.g. VaLruCache<K, V> or VaLfuCache<K, V>.
+ *
+ * A key always maps to the same shard, picked from the hash of the key, and each shard has its
+ * own lock, so threads working on different keys rarely contend. The limits are totals, split
+ * between the shards so that their limits add up to them exactly, and there are never more shards
+ * than a limit, or than default-cost entries fit in the byte limit. A skewed key distribution may
+ * therefore evict a little early; eviction order (LRU or LFU) holds within each shard.
+ *
+ * Lookups copy the value out under the lock, since a pointer into a shard would not be safe to
+ * use once the lock is released.
+ *
+ * @see VaConcurrentLruCache, VaConcurrentLfuCache
+ */
+template <typename Cache>
+class VaShardedCache {
+  public:
+    using KeyType = typename Cache::KeyType;
+    using ValueType = typename Cache::ValueType;
+    using Weigher = typename Cache::Weigher;
+    using EvictionCallback = typename Cache::EvictionCallback;
+
+  protected:
+    using K = KeyType;
+    using V = ValueType;
+
+    struct alignas(va::detail::cacheLineSize) Shard {
+        mutable std::mutex mutex;
+        Cache cache;
+
+        Shard(Size maxEntries, Size maxBytes, const Weigher& weigher) : cache(maxEntries, maxBytes, weigher) {}
+    };
+
+    Shard* shards;
+    Size shardCount;
+    Size shardBits;
+    typename Cache::HashType hashFunc;
+
+    inline Shard& shardFor(const K& key) const { return shards[va::detail::shardIndex(hashFunc(key), shardBits)]; }
+
+    /**
+     * @brief Number of entries a byte limit holds at the default cost, at least 1; 0 means no limit.
+     *        Without a weigher, this keeps every shard able to hold an entry. With one, the cost of an
+     *        entry is unknown and the byte limit is taken as is.
+     */
+    static inline Size entryUnits(Size maxBytes, const Weigher& weigher) noexcept {
+        if (!maxBytes || weigher) return maxBytes;
+        Size entries = maxBytes / va::detail::cacheDefaultCost<K, V>;
+        return entries ? entries : 1;
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty cache.
+     * @param maxEntries Maximum total number of entries, split between the shards; 0 means no entry limit.
+     * @param maxBytes Maximum total cost, split between the shards; 0 means no byte limit.
+     * @param weigher Computes the cost of an entry; see Cache.
+     * @param shardCount Number of shards, rounded up to a power of two, then lowered until each shard
+     *                   gets at least one entry of each nonzero limit (of the default cost for maxBytes
+     *                   without a weigher); 0 means the default (16).
+     */
+    explicit VaShardedCache(Size maxEntries, Size maxBytes = 0, Weigher weigher = nullptr, Size shardCount = 0) {
+        shardBits = va::detail::shardBits(shardCount ? shardCount : va::detail::cacheDefaultShards);
+        shardBits = va::detail::fitShardBits(va::detail::fitShardBits(shardBits, maxEntries), entryUnits(maxBytes, weigher));
+        this->shardCount = Size(1) << shardBits;
+
+        shards = static_cast<Shard*>(::operator new(sizeof(Shard) * this->shardCount, std::align_val_t(alignof(Shard))));
+        Size built = 0;
+        try {
+            for (; built < this->shardCount; built++) {
+                Size entries = va::detail::shardLimit(maxEntries, built, this->shardCount);
+                Size bytes = va::detail::shardLimit(maxBytes, built, this->shardCount);
+                new (&shards[built]) Shard(entries, bytes, weigher);
+            }
+        } catch (...) {
+            while (built) shards[--built].~Shard();
+            ::operator delete(shards, std::align_val_t(alignof(Shard)));
+            throw;
+        }
+    }
+
+    VaShardedCache(const VaShardedCache&) = delete;
+    VaShardedCache& operator=(const VaShardedCache&) = delete;
+
+    ~VaShardedCache() {
+        for (Size i = 0; i < shardCount; i++) shards[i].~Shard();
+        ::operator delete(shards, std::align_val_t(alignof(Shard)));
+    }
+
+    /**
+     * @brief Looks up an entry, counting a use of it, and copies its value out.
+     * @param key The key to look up.
+     * @param value Output parameter for the value, if found.
+     * @return true on a hit, false on a miss.
+     */
+    bool get(const K& key, V& value) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        V* found = shard.cache.get(key);
+        if (!found) return false;
+        value = *found;
+        return true;
+    }
+
+    /**
+     * @brief Looks up an entry without counting a use or touching the statistics.
+     * @param key The key to look up.
+     * @param value Output parameter for the value, if found.
+     * @return true if the key is cached.
+     */
+    bool peek(const K& key, V& value) const {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        const V* found = std::as_const(shard.cache).peek(key);
+        if (!found) return false;
+        value = *found;
+        return true;
+    }
+
+    /**
+     * @brief Inserts or replaces an entry.
+     * @return false if the entry alone exceeds the byte limit of its shard and was not stored.
+     */
+    bool put(const K& key, const V& value) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.put(key, value);
+    }
+
+    /**
+     * @brief Returns the cached value for key, computing and storing it on a miss.
+     * @param key The key.
+     * @param make Callable returning the value for key; only called on a miss.
+     * @return The cached or computed value.
+     *
+     * @note make is called without holding the lock, so two threads missing the same key at the
+     *       same time may both compute it; the later result replaces the earlier one.
+     */
+    template <typename Fn>
+    V getOrCompute(const K& key, Fn&& make) {
+        Shard& shard = shardFor(key);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (V* found = shard.cache.get(key)) return *found;
+        }
+
+        V value = make(key);
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, value);
+        return value;
+    }
+
+    /**
+     * @brief Removes an entry. The eviction callback is not called.
+     * @return true if the key was cached.
+     */
+    bool del(const K& key) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.del(key);
+    }
+
+    bool contains(const K& key) const {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.contains(key);
+    }
+
+    /**
+     * @brief Removes every entry of every shard. The statistics are kept.
+     */
+    void clear() {
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            shards[i].cache.clear();
+        }
+    }
+
+    /**
+     * @brief Sets the eviction callback of every shard.
+     *
+     * @warning The callback runs while the shard is locked and must not use this cache.
+     */
+    void setEvictionCallback(const EvictionCallback& callback) {
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            shards[i].cache.setEvictionCallback(callback);
+        }
+    }
+
+    void resetStats() {
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            shards[i].cache.resetStats();
+        }
+    }
+
+    /// @brief Sum of the statistics of all shards.
+    VaCacheStats getStats() const {
+        VaCacheStats total;
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            total += shards[i].cache.getStats();
+        }
+        return total;
+    }
+
+    /// @brief Total number of entries.
+    Size getSize() const {
+        Size total = 0;
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            total += shards[i].cache.getSize();
+        }
+        return total;
+    }
+
+    /// @brief Total cost of the entries.
+    Size getBytes() const {
+        Size total = 0;
+        for (Size i = 0; i < shardCount; i++) {
+            std::lock_guard<std::mutex> lock(shards[i].mutex);
+            total += shards[i].cache.getBytes();
+        }
+        return total;
+    }
+
+    inline Size getShardCount() const noexcept { return shardCount; }
+};
+
+/// @brief Thread-safe, sharded VaLruCache.
+template <typename K, typename V, typename Hash = VaHash<K>>
+using VaConcurrentLruCache = VaShardedCache<VaLruCache<K, V, Hash>>;
+
+/// @brief Thread-safe, sharded VaLfuCache.
+template <typename K, typename V, typename Hash = VaHash<K>>
+using VaConcurrentLfuCache = VaShardedCache<VaLfuCache<K, V, Hash>>;
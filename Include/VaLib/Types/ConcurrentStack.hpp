@@ -0,0 +1,485 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// With a 16-byte CAS (x86-64 built with -mcx16, AArch64), the tag gets a word of its own
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && UINTPTR_MAX > 0xFFFFFFFFu
+    #define VA_TAGGED_PTR_WIDE 1
+#endif
+
+namespace va {
+namespace detail {
+
+/**
+ * @brief A pointer packed together with a modification counter into one word, so that a CAS
+ *        of the whole word detects a node that was popped and pushed again (ABA).
+ *
+ * @note Where a 16-byte CAS is available (VA_TAGGED_PTR_WIDE), the word holds the whole pointer
+ *       and a 64-bit tag, which never wraps in practice.
+ * @note Otherwise, on 64-bit targets the pointer takes the low 48 bits (the user-space address
+ *       range of x86-64 and AArch64 with 4-level page tables) and the tag the high 16 bits; on
+ *       32-bit targets each takes 32 bits. A 16-bit tag wraps after 65,536 modifications, so a
+ *       thread preempted between reading the word and its CAS for that long could still hit ABA.
+ *       Build with -mcx16 on x86-64 to close that window.
+ * @warning With a 48-bit pointer, nodes must live at addresses that fit in it: check them with
+ *          fits(). Addresses beyond 47 bits (5-level paging, LA57) or with tagged top bits
+ *          (TBI, MTE, PAC) do not.
+ */
+template <typename Node>
+struct TaggedPtr {
+#ifdef VA_TAGGED_PTR_WIDE
+    using Word = unsigned __int128;
+    static constexpr uint32 pointerBits = 64;
+#else
+    using Word = uint64;
+    static constexpr uint32 pointerBits = sizeof(void*) == 8 ? 48 : 32;
+#endif
+    static constexpr Word pointerMask = (Word(1) << pointerBits) - 1;
+
+    static inline Word pack(Node* node, Word tag) noexcept {
+        return (static_cast<Word>(reinterpret_cast<std::uintptr_t>(node)) & pointerMask) | (tag << pointerBits);
+    }
+
+    static inline Node* pointer(Word word) noexcept {
+        return reinterpret_cast<Node*>(static_cast<std::uintptr_t>(word & pointerMask));
+    }
+
+    static inline Word tag(Word word) noexcept { return word >> pointerBits; }
+
+    /// @brief Packs a new pointer with the tag of the previous word incremented.
+    static inline Word next(Word previous, Node* node) noexcept { return pack(node, tag(previous) + 1); }
+
+    /// @brief Checks whether an address survives packing.
+    static inline bool fits(const void* address) noexcept {
+        return (static_cast<Word>(reinterpret_cast<std::uintptr_t>(address)) & ~pointerMask) == 0;
+    }
+};
+
+/**
+ * @brief Lock-free LIFO of nodes linked through an atomic `next` field, protected against ABA by a tag.
+ *
+ * @warning Nodes must stay allocated as long as the list is used (they may be read after being popped).
+ */
+template <typename Node>
+class TaggedNodeList {
+  protected:
+    using Tagged = TaggedPtr<Node>;
+    using Word = typename Tagged::Word;
+
+#ifdef VA_TAGGED_PTR_WIDE
+    // std::atomic of 16 bytes goes through libatomic; the __sync builtins inline the CAS (full barrier)
+    alignas(16) mutable Word top;
+
+    inline Word load(std::memory_order) const noexcept { return __sync_val_compare_and_swap(&top, Word(0), Word(0)); }
+
+    inline bool exchange(Word& expected, Word desired, std::memory_order) noexcept {
+        Word seen = __sync_val_compare_and_swap(&top, expected, desired);
+        if (seen == expected) return true;
+        expected = seen;
+        return false;
+    }
+#else
+    std::atomic<Word> top;
+
+    inline Word load(std::memory_order order) const noexcept { return top.load(order); }
+
+    inline bool exchange(Word& expected, Word desired, std::memory_order order) noexcept {
+        return top.compare_exchange_weak(expected, desired, order, std::memory_order_acquire);
+    }
+#endif
+
+  public:
+    TaggedNodeList() noexcept : top(0) {}
+
+    /**
+     * @brief Pushes a chain of nodes already linked from first to last.
+     */
+    void pushChain(Node* first, Node* last) noexcept {
+        Word old = load(std::memory_order_relaxed);
+        for (;;) {
+            last->next.store(Tagged::pointer(old), std::memory_order_relaxed);
+            if (exchange(old, Tagged::next(old, first), std::memory_order_release)) return;
+        }
+    }
+
+    inline void push(Node* node) noexcept { pushChain(node, node); }
+
+    /**
+     * @brief Pops one node.
+     * @return The node, or nullptr if the list is empty.
+     */
+    Node* pop() noexcept {
+        Word old = load(std::memory_order_acquire);
+        for (;;) {
+            Node* node = Tagged::pointer(old);
+            if (!node) return nullptr;
+
+            Node* next = node->next.load(std::memory_order_relaxed);
+            if (exchange(old, Tagged::next(old, next), std::memory_order_acquire)) return node;
+        }
+    }
+
+    inline bool isEmpty() const noexcept { return Tagged::pointer(load(std::memory_order_acquire)) == nullptr; }
+};
+
+} // namespace detail
+} // namespace va
+
+/**
+ * @class VaConcurrentStack A lock-free LIFO stack (Treiber stack) safe to use from any number of threads.
+ *
+ * @tparam T Type of the stored elements.
+ *
+ * @note ABA protection: the top pointer carries a modification tag (see va::detail::TaggedPtr for
+ *       its width), and nodes are never returned to the allocator while the stack is alive; popped
+ *       nodes are recycled through a tagged free list instead. Reading a node that was concurrently popped is therefore always safe.
+ * @note Each thread keeps a small cache of free nodes, so steady push/pop traffic neither touches
+ *       the allocator nor contends on the shared free list.
+ * @note A thread keeps caches for the last 4 stacks of the same T it used; using a fifth one
+ *       flushes one of those caches back to its shared free list.
+ * @note Node storage is reference counted by the stack and by the thread caches holding its nodes.
+ *       Up to one cache worth of nodes per thread may outlive the stack until that thread has
+ *       used 4 other VaConcurrentStack<T> or exits.
+ * @throws ValueError When allocating nodes, if the allocator returns an address the tagged top
+ *         pointer cannot hold (see va::detail::TaggedPtr).
+ */
+template <typename T>
+class VaConcurrentStack {
+  protected:
+    static constexpr Size lineSize = va::detail::cacheLineSize;
+    static constexpr Size cacheLimit = 64;   ///< Maximum number of nodes kept in a thread cache
+    static constexpr Size cacheSlots = 4;    ///< Number of stacks a thread keeps caches for
+    static constexpr Size firstChunkSize = 64;
+
+    struct Node {
+        std::atomic<Node*> next;
+        union {
+            T value;
+        };
+
+        Node() noexcept : next(nullptr) {}
+        ~Node() {}
+    };
+
+    struct alignas(alignof(Node)) Chunk {
+        Chunk* next;
+        Size count;
+
+        inline Node* nodes() noexcept { return reinterpret_cast<Node*>(this + 1); }
+    };
+
+    using Tagged = va::detail::TaggedPtr<Node>;
+
+    /**
+     * @brief Owns the node chunks and the shared free list. Shared by the stack and the thread caches.
+     */
+    struct Storage {
+        alignas(lineSize) va::detail::TaggedNodeList<Node> freeNodes;
+        alignas(lineSize) std::atomic<Chunk*> chunks;
+        std::atomic<Size> chunkNodes; ///< Total number of nodes in all chunks
+        std::atomic<Size> refs;
+
+        Storage() : chunks(nullptr), chunkNodes(0), refs(1) {}
+
+        ~Storage() {
+            Chunk* chunk = chunks.load(std::memory_order_relaxed);
+            while (chunk) {
+                Chunk* next = chunk->next;
+                ::operator delete(chunk, std::align_val_t(alignof(Chunk)));
+                chunk = next;
+            }
+        }
+
+        inline void retain() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+
+        static void release(Storage* storage) noexcept {
+            if (storage && storage->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete storage;
+        }
+
+        /**
+         * @brief Allocates a chunk of nodes and links it into the chunk list.
+         * @return The first node of the chunk; the others are linked after it.
+         */
+        Node* allocateChunk() {
+            Size count = chunkNodes.load(std::memory_order_relaxed);
+            if (count < firstChunkSize) count = firstChunkSize;
+
+            const Size bytes = sizeof(Chunk) + count * sizeof(Node);
+            void* mem = ::operator new(bytes, std::align_val_t(alignof(Chunk)));
+            if (!Tagged::fits(static_cast<char*>(mem) + bytes - 1)) {
+                ::operator delete(mem, std::align_val_t(alignof(Chunk)));
+                throw ValueError(VaStaticMessage("VaConcurrentStack: node address does not fit in a tagged pointer"));
+            }
+
+            Chunk* chunk = static_cast<Chunk*>(mem);
+            chunk->count = count;
+
+            Node* nodes = chunk->nodes();
+            for (Size i = 0; i < count; i++) {
+                new (&nodes[i]) Node();
+                nodes[i].next.store(i + 1 < count ? &nodes[i + 1] : nullptr, std::memory_order_relaxed);
+            }
+
+            chunk->next = chunks.load(std::memory_order_relaxed);
+            while (!chunks.compare_exchange_weak(chunk->next, chunk, std::memory_order_release, std::memory_order_relaxed)) {}
+            chunkNodes.fetch_add(count, std::memory_order_relaxed);
+
+            return nodes;
+        }
+    };
+
+    /**
+     * @brief Per-thread cache of free nodes of one storage.
+     */
+    struct ThreadCache {
+        Storage* owner = nullptr;
+        Node* head = nullptr;
+        Size count = 0;
+
+        /// @brief Returns the cached nodes to their storage and drops the reference to it.
+        void flush() noexcept {
+            if (head) {
+                Node* last = head;
+                while (Node* next = last->next.load(std::memory_order_relaxed)) last = next;
+                owner->freeNodes.pushChain(head, last);
+            }
+            Storage::release(owner);
+            owner = nullptr;
+            head = nullptr;
+            count = 0;
+        }
+
+        ~ThreadCache() {
+            if (owner) flush();
+        }
+    };
+
+    /**
+     * @brief The caches of one thread, one per recently used stack, so that a thread alternating
+     *        between a few stacks keeps the nodes of each. When all are taken, they are flushed in turn.
+     */
+    struct ThreadCaches {
+        ThreadCache slots[cacheSlots];
+        Size turn = 0;
+
+        /// @brief Returns the cache bound to a storage, binding a free slot, or the next in turn, if none is.
+        ThreadCache& bind(Storage* storage) noexcept {
+            ThreadCache* unbound = nullptr;
+            for (ThreadCache& cache: slots) {
+                if (cache.owner == storage) return cache;
+                if (!cache.owner && !unbound) unbound = &cache;
+            }
+
+            if (!unbound) {
+                unbound = &slots[turn];
+                turn = (turn + 1) % cacheSlots;
+                unbound->flush();
+            }
+            storage->retain();
+            unbound->owner = storage;
+            return *unbound;
+        }
+
+        /// @brief Returns the cache bound to a storage, or nullptr.
+        ThreadCache* find(Storage* storage) noexcept {
+            for (ThreadCache& cache: slots) {
+                if (cache.owner == storage) return &cache;
+            }
+            return nullptr;
+        }
+    };
+
+    static ThreadCaches& localCaches() noexcept {
+        thread_local ThreadCaches caches;
+        return caches;
+    }
+
+    alignas(lineSize) va::detail::TaggedNodeList<Node> nodes; ///< The elements, top first
+    alignas(lineSize) std::atomic<Size> count;                ///< Number of elements (an upper bound while pushes are in flight)
+    Storage* storage;
+
+    /**
+     * @brief Takes a free node: from the thread cache, the shared free list or a new chunk.
+     */
+    Node* acquireNode() {
+        ThreadCache& cache = localCaches().bind(storage);
+
+        if (cache.head) {
+            Node* node = cache.head;
+            cache.head = node->next.load(std::memory_order_relaxed);
+            cache.count--;
+            return node;
+        }
+
+        if (Node* node = storage->freeNodes.pop()) return node;
+
+        // keep the rest of the new chunk in the cache, up to its limit
+        Node* node = storage->allocateChunk();
+        Node* rest = node->next.load(std::memory_order_relaxed);
+        Size kept = 0;
+        Node* last = nullptr;
+        for (Node* current = rest; current && kept < cacheLimit; current = current->next.load(std::memory_order_relaxed)) {
+            last = current;
+            kept++;
+        }
+        if (last) {
+            Node* overflow = last->next.load(std::memory_order_relaxed);
+            if (overflow) {
+                Node* overflowLast = overflow;
+                while (Node* next = overflowLast->next.load(std::memory_order_relaxed)) overflowLast = next;
+                storage->freeNodes.pushChain(overflow, overflowLast);
+            }
+            last->next.store(cache.head, std::memory_order_relaxed);
+            cache.head = rest;
+            cache.count += kept;
+        }
+        return node;
+    }
+
+    /**
+     * @brief Returns a node whose value was destroyed. Moves half of a full cache to the shared free list.
+     */
+    void releaseNode(Node* node) noexcept {
+        ThreadCache& cache = localCaches().bind(storage);
+
+        node->next.store(cache.head, std::memory_order_relaxed);
+        cache.head = node;
+        cache.count++;
+
+        if (cache.count > cacheLimit) {
+            Node* first = cache.head;
+            Node* last = first;
+            for (Size i = 1; i < cacheLimit / 2; i++) last = last->next.load(std::memory_order_relaxed);
+
+            cache.head = last->next.load(std::memory_order_relaxed);
+            cache.count -= cacheLimit / 2;
+            storage->freeNodes.pushChain(first, last);
+        }
+    }
+
+    /**
+     * @brief Destroys the value of a popped node and recycles the node, also when unwinding.
+     */
+    struct PoppedNode {
+        VaConcurrentStack* stack;
+        Node* node;
+
+        ~PoppedNode() {
+            node->value.~T();
+            stack->releaseNode(node);
+        }
+    };
+
+  public:
+    VaConcurrentStack() : count(0), storage(new Storage()) {}
+
+    VaConcurrentStack(const VaConcurrentStack&) = delete;
+    VaConcurrentStack& operator=(const VaConcurrentStack&) = delete;
+
+    /**
+     * @brief Destroys the remaining elements.
+     *
+     * @warning No thread may use the stack during destruction.
+     */
+    ~VaConcurrentStack() {
+        Node* node = nodes.pop();
+        while (node) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            node->value.~T();
+            node = next;
+        }
+
+        // nodes cached by the destroying thread are dropped with the storage
+        if (ThreadCache* cache = localCaches().find(storage)) {
+            Storage::release(storage);
+            cache->owner = nullptr;
+            cache->head = nullptr;
+            cache->count = 0;
+        }
+        Storage::release(storage);
+    }
+
+    /**
+     * @brief Constructs an element in place on top of the stack.
+     * @param args Arguments forwarded to the constructor of T.
+     *
+     * @note Lock-free unless a new chunk of nodes has to be allocated.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        Node* node = acquireNode();
+        try {
+            new (&node->value) T(std::forward<Args>(args)...);
+        } catch (...) {
+            releaseNode(node);
+            throw;
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+        nodes.push(node);
+    }
+
+    /**
+     * @brief Pushes an element on top of the stack.
+     * @param value The value to push.
+     */
+    inline void push(const T& value) { emplace(value); }
+    inline void push(T&& value) { emplace(std::move(value)); }
+
+    /**
+     * @brief Pops the top element if there is one.
+     * @param out Receives the popped element.
+     * @return true if an element was popped, false if the stack is empty.
+     *
+     * @note If the move assignment throws, the element is lost.
+     */
+    bool tryPop(T& out) {
+        Node* node = nodes.pop();
+        if (!node) return false;
+
+        count.fetch_sub(1, std::memory_order_relaxed);
+        PoppedNode popped{this, node};
+        out = std::move(node->value);
+        return true;
+    }
+
+    /**
+     * @brief Pops and returns the top element.
+     * @return The popped element.
+     *
+     * @throws IndexOutOfRangeError If the stack is empty.
+     */
+    T pop() {
+        Node* node = nodes.pop();
+        if (!node) throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
+
+        count.fetch_sub(1, std::memory_order_relaxed);
+        PoppedNode popped{this, node};
+        return T(std::move(node->value));
+    }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @note The value is only a snapshot while other threads are active.
+     */
+    inline Size getLength() const noexcept { return count.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks whether the stack is empty.
+     */
+    inline bool isEmpty() const noexcept { return nodes.isEmpty(); }
+
+  public friends:
+    friend inline Size len(const VaConcurrentStack& stack) { return stack.getLength(); }
+};
@@ -24,10 +24,7 @@ struct VaDictEntry {
     VaDictEntry<K, V>* prevOrder; ///< Previous in insertion order
     VaDictEntry<K, V>* nextOrder; ///< Next in insertion order
 
-    VaDictEntry(const K& k, const V& v) : next(nullptr), prevOrder(nullptr), nextOrder(nullptr) {
-        key = k;
-        value = v;
-    }
+    VaDictEntry(const K& k, const V& v) : key(k), value(v), next(nullptr), prevOrder(nullptr), nextOrder(nullptr) {}
 };
 
 /**
@@ -54,6 +51,10 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
 
     Hash hashFunc; ///< Hash function used to compute bucket indices from keys.
 
+    mutable va::detail::HashSum entriesHash; ///< Running hash of the entries, see enableHashTracking().
+    bool hashTracked;                        ///< Whether entriesHash is kept up to date.
+    mutable bool hashStale;                  ///< Whether a value may have changed since entriesHash was updated.
+
     /**
      * @brief Computes the index for a given key in the hash table.
      * @param key The key to compute the index for.
@@ -233,6 +234,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         newEntry->next = buckets[index];
         buckets[index] = newEntry;
         size++;
+        hashInsert(newEntry);
         return newEntry;
     }
 
@@ -254,6 +256,47 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         }
     }
 
+    /**
+     * @brief Computes the hash of one entry, as summed by hash().
+     */
+    static Size entryHash(const K& key, const V& value) {
+        if constexpr (va::detail::IsHashable<K> && va::detail::IsHashable<V>) {
+            return va::detail::hashCombine(VaHash<K>{}(key), VaHash<V>{}(value));
+        } else {
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Sums the hashes of all entries.
+     */
+    va::detail::HashSum computeHash() const {
+        va::detail::HashSum sum;
+        for (const Entry* e = head; e != nullptr; e = e->nextOrder) {
+            sum.add(entryHash(e->key, e->value));
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Adds an entry to, or removes it from, the tracked hash.
+     * @note Nothing to do when tracking is off, or when the hash is stale and will be recomputed anyway.
+     */
+    // @{
+    void hashInsert(const Entry* entry) {
+        if (hashTracked && !hashStale) entriesHash.add(entryHash(entry->key, entry->value));
+    }
+    void hashErase(const Entry* entry) {
+        if (hashTracked && !hashStale) entriesHash.remove(entryHash(entry->key, entry->value));
+    }
+    // @}
+
+    /**
+     * @brief Called before handing out a mutable reference to a value, through which
+     *        the value may change without the tracked hash knowing.
+     */
+    void markHashStale() noexcept { hashStale = true; }
+
   public:
     /**
      * @brief Struct representing a mutable key-value pair reference.
@@ -278,7 +321,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      * @brief Constructs an empty dictionary with a given initial capacity.
      * @param initialCap Initial number of hash buckets (default is 16).
      */
-    VaDict(Size initialCap = 32) : head(nullptr), tail(nullptr), size(0) {
+    VaDict(Size initialCap = 32) : head(nullptr), tail(nullptr), size(0), hashTracked(false), hashStale(false) {
         cap = initialCap;
 
         buckets = new Entry*[cap]();
@@ -292,7 +335,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      * @param other The dictionary to copy from.
      */
     VaDict(const VaDict& other)
-        : cap(other.cap), size(0), head(nullptr), tail(nullptr), hashFunc(other.hashFunc) {
+        : cap(other.cap), size(0), head(nullptr), tail(nullptr), hashFunc(other.hashFunc), hashTracked(false), hashStale(false) {
         buckets = new Entry*[cap]();
         for (Size i = 0; i < cap; ++i) {
             buckets[i] = nullptr;
@@ -303,6 +346,10 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
             put(current->key, current->value);
             current = current->nextOrder;
         }
+
+        entriesHash = other.entriesHash;
+        hashTracked = other.hashTracked;
+        hashStale = other.hashStale;
     }
 
     /**
@@ -311,12 +358,15 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      */
     VaDict(VaDict&& other) noexcept :
         cap(other.cap), size(other.size), buckets(other.buckets),
-        head(other.head), tail(other.tail), hashFunc(std::move(other.hashFunc))
+        head(other.head), tail(other.tail), hashFunc(std::move(other.hashFunc)),
+        entriesHash(other.entriesHash), hashTracked(other.hashTracked), hashStale(other.hashStale)
     {
         other.buckets = nullptr;
         other.head = other.tail = nullptr;
         other.size = 0;
         other.cap = 0;
+        other.entriesHash = {};
+        other.hashStale = false;
     }
 
     /**
@@ -430,6 +480,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         size = 0;
         head = tail = nullptr;
         hashFunc = other.hashFunc;
+        hashTracked = false;
 
         buckets = new Entry*[cap]();
         for (Size i = 0; i < cap; ++i) {
@@ -442,6 +493,10 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
             current = current->nextOrder;
         }
 
+        entriesHash = other.entriesHash;
+        hashTracked = other.hashTracked;
+        hashStale = other.hashStale;
+
         return *this;
     }
 
@@ -462,25 +517,77 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         this->head = other.head;
         this->tail = other.tail;
         this->hashFunc = std::move(other.hashFunc);
+        this->entriesHash = other.entriesHash;
+        this->hashTracked = other.hashTracked;
+        this->hashStale = other.hashStale;
 
         other.buckets = nullptr;
         other.head = other.tail = nullptr;
         other.size = 0;
         other.cap = 0;
+        other.entriesHash = {};
+        other.hashStale = false;
 
         return *this;
     }
 
+    /**
+     * @brief Returns a hash of the key-value pairs that does not depend on their insertion order,
+     *        so that dictionaries equal by operator== hash the same.
+     *
+     * @note O(n), or O(1) while hash tracking is on and the tracked hash is not stale.
+     * @see enableHashTracking()
+     */
     Size hash() const {
-        Size hash = 0;
-        Entry* current = head;
-        while (current != nullptr) {
-            hash ^= VaHash<K>{}(current->key) ^ (VaHash<V>{}(current->value) << 1);
-            current = current->nextOrder;
+        static_assert(va::detail::IsHashable<K> && va::detail::IsHashable<V>, "VaDict::hash() requires VaHash for the keys and values");
+
+        if (!hashTracked) return computeHash().value(size);
+
+        if (hashStale) {
+            entriesHash = computeHash();
+            hashStale = false;
         }
-        return hash;
+        return entriesHash.value(size);
+    }
+
+    /**
+     * @brief Makes the dictionary maintain its hash as entries are added, changed and removed,
+     *        so that hash() is O(1) and operator== tells most unequal dictionaries apart in O(1).
+     *
+     * The hash is kept as a sum of the mixed hashes of the entries, which put(), set(), insert()
+     * and del() update in O(1) with one hash of the key and value, whatever the position of the entry.
+     *
+     * @code
+     * VaDict<VaString, int> request;
+     * request.enableHashTracking();
+     * request.put("page", 2);
+     * cache.get(request.hash()); // O(1)
+     * @endcode
+     *
+     * @note Non-const accessors that return a reference to a value (operator[], at(), find(),
+     *       front(), moveToFront(), mutable iteration, ...) can't see what is done with it, so they
+     *       mark the hash as stale, and the next hash() recomputes it in O(n). Change values with
+     *       put() or set(), and read them through a const reference, to keep hash() O(1).
+     * @note Tracking is copied and moved along with the dictionary.
+     */
+    void enableHashTracking() {
+        static_assert(va::detail::IsHashable<K> && va::detail::IsHashable<V>, "hash tracking requires VaHash for the keys and values");
+
+        entriesHash = computeHash();
+        hashTracked = true;
+        hashStale = false;
     }
 
+    /**
+     * @brief Stops maintaining the hash; hash() is O(n) again.
+     */
+    void disableHashTracking() noexcept { hashTracked = false; }
+
+    /**
+     * @brief Checks whether the dictionary maintains its hash.
+     */
+    bool isHashTracked() const noexcept { return hashTracked; }
+
     /**
      * @brief Ensures capacity is at least the specified amount.
      * @param minCap The minimum number of buckets to reserve.
@@ -517,6 +624,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
 
         newEntry->next = buckets[bucketIndex];
         buckets[bucketIndex] = newEntry;
+        hashInsert(newEntry);
 
         if (index == size) {
             appendEntry(newEntry);
@@ -548,7 +656,9 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         Entry* entry = findEntry(key);
 
         if (entry) {
+            hashErase(entry);
             entry->value = value;
+            hashInsert(entry);
         } else {
             Entry* newEntry = getEntry(key, value);
             pushEntry(newEntry);
@@ -594,7 +704,9 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
 
         if (entry) {
             unlinkFromOrder(entry);
+            hashErase(entry);
             entry->value = value;
+            hashInsert(entry);
             insertBefore(head, entry);
         } else {
             Entry* newEntry = getEntry(key, value);
@@ -635,6 +747,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         if (!removed) return;
 
         unlinkFromOrder(removed);
+        hashErase(removed);
         returnEntry(removed);
         size--;
     }
@@ -660,6 +773,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         if (!removed) return;
 
         unlinkFromOrder(removed);
+        hashErase(removed);
         returnEntry(removed);
         size--;
     }
@@ -686,6 +800,8 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
 
         head = tail = nullptr;
         size = 0;
+        entriesHash = {};
+        hashStale = false;
 
         if (freeEntries) {
             delete[] buckets;
@@ -743,6 +859,68 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         return false;
     }
 
+    /**
+     * @brief Looks up the value for a given key without copying it.
+     * @param key The key to search for.
+     * @return Pointer to the value, or nullptr if the key is not present.
+     *
+     * @note The pointer stays valid until the key is removed; resizing does not move entries.
+     */
+    // @{
+    V* find(const K& key) {
+        markHashStale();
+        Entry* entry = findEntry(key);
+        return entry ? &entry->value : nullptr;
+    }
+    const V* find(const K& key) const {
+        Entry* entry = const_cast<VaDict*>(this)->findEntry(key);
+        return entry ? &entry->value : nullptr;
+    }
+    // @}
+
+    /**
+     * @brief Like at(), but returns nullptr instead of throwing if the key is not present.
+     * @param key The key to search for.
+     * @return Pointer to the value, or nullptr.
+     *
+     * @note Same as find(); named to match the tryAt() of the other containers.
+     */
+    // @{
+    inline V* tryAt(const K& key) { return find(key); }
+    inline const V* tryAt(const K& key) const { return find(key); }
+    // @}
+
+    /**
+     * @brief Moves an existing key to the front or back of the insertion order.
+     * @param key The key to move.
+     * @return Pointer to the value of the moved entry, or nullptr if the key is not present.
+     *
+     * @note O(1): only the order links are updated, the value is not touched.
+     *       Together with keyAtFront() this makes VaDict usable as a recency list (e.g. for an LRU cache).
+     */
+    // @{
+    V* moveToFront(const K& key) {
+        markHashStale();
+        Entry* entry = findEntry(key);
+        if (!entry) return nullptr;
+        if (entry != head) {
+            unlinkFromOrder(entry);
+            insertBefore(head, entry);
+        }
+        return &entry->value;
+    }
+    V* moveToBack(const K& key) {
+        markHashStale();
+        Entry* entry = findEntry(key);
+        if (!entry) return nullptr;
+        if (entry != tail) {
+            unlinkFromOrder(entry);
+            appendEntry(entry);
+        }
+        return &entry->value;
+    }
+    // @}
+
     /**
      * @brief Updates the value associated with a given key.
      * @param key The key to update.
@@ -755,7 +933,9 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
         Entry* entry = findEntry(key);
 
         if (entry) {
+            hashErase(entry);
             entry->value = value;
+            hashInsert(entry);
         } else {
             put(key, value);
         }
@@ -770,6 +950,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      * @note May cause rehash if load factor exceeds threshold.
      */
     V& operator[](const K& key) {
+        markHashStale();
         Entry* entry = findEntry(key);
 
         if (entry) {
@@ -790,6 +971,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      * @throws KeyNotFoundError if the key does not exist.
      */
     V& at(const K& key) {
+        markHashStale();
         Size index = computeIndex(key);
         Entry* entry = buckets[index];
 
@@ -836,6 +1018,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
     // @{
     V& valueAtIndex(Size index) {
         if (index >= size) throw IndexOutOfRangeError(size, index);
+        markHashStale();
 
         Entry* current = head;
         for (Size i = 0; i < index; ++i) {
@@ -893,6 +1076,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      */
     PairRef pairAtIndex(Size index) {
         if (index >= size) throw IndexOutOfRangeError(size, index);
+        markHashStale();
 
         Entry* current = head;
         for (Size i = 0; i < index; ++i) {
@@ -927,6 +1111,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
     // @{
     V& valueAtFront() {
         if (isEmpty()) throw IndexOutOfRangeError(size, 0);
+        markHashStale();
         return head->value;
     }
     V& front() { return valueAtFront(); }
@@ -945,6 +1130,22 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
     const V& front() const { return valueAtFront(); }
     // @}
 
+    /**
+     * @brief Like front() and back(), but return nullptr instead of throwing if the dictionary is empty.
+     */
+    // @{
+    V* tryFront() noexcept {
+        markHashStale();
+        return head ? &head->value : nullptr;
+    }
+    const V* tryFront() const noexcept { return head ? &head->value : nullptr; }
+    V* tryBack() noexcept {
+        markHashStale();
+        return tail ? &tail->value : nullptr;
+    }
+    const V* tryBack() const noexcept { return tail ? &tail->value : nullptr; }
+    // @}
+
     /**
      * @brief Retrieves the key at the front of the dictionary.
      * @return Const reference to the key at the front.
@@ -962,6 +1163,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      */
     PairRef pairAtFront() {
         if (isEmpty()) throw IndexOutOfRangeError(size, 0);
+        markHashStale();
         return PairRef{head->key, head->value};
     }
 
@@ -983,6 +1185,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
     // @{
     V& valueAtBack() {
         if (isEmpty()) throw IndexOutOfRangeError(size, size - 1);
+        markHashStale();
         return tail->value;
     }
     V& back() { return valueAtBack(); }
@@ -1018,6 +1221,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      */
     PairRef pairAtBack() {
         if (isEmpty()) throw IndexOutOfRangeError(size, size - 1);
+        markHashStale();
         return PairRef{tail->key, tail->value};
     }
 
@@ -1097,6 +1301,7 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      * @see getRawView() for a read-only alternative.
      */
     RawView* getUnsafeAccess() {
+        markHashStale();
         return reinterpret_cast<RawView*>(this);
     }
 
@@ -1156,10 +1361,16 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
      * @brief Checks if this dictionary is equal to another, ignoring insertion order.
      * @param other The dictionary to compare with.
      * @return true if all key-value pairs are equal, false otherwise.
+     *
+     * @note When both dictionaries track their hash (see enableHashTracking()), dictionaries
+     *       whose hashes differ are rejected without looking at the entries.
      */
     bool operator==(const VaDict<K, V>& other) const {
         if (size != other.size) return false;
         if (&other == this) return true;
+        if constexpr (va::detail::IsHashable<K> && va::detail::IsHashable<V>) {
+            if (hashTracked && other.isHashTracked() && hash() != other.hash()) return false;
+        }
 
         for (const Entry* e = head; e != nullptr; e = e->nextOrder) {
             V otherValue;
@@ -1276,8 +1487,14 @@ class alignas(VaDictRawView<K, V, Hash>) VaDict {
     using ReverseIterator = std::reverse_iterator<Iterator>;
     using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
 
-    inline Iterator begin() { return Iterator(head); }
-    inline Iterator end() { return Iterator(nullptr); }
+    inline Iterator begin() {
+        markHashStale();
+        return Iterator(head);
+    }
+    inline Iterator end() {
+        markHashStale();
+        return Iterator(nullptr);
+    }
 
     inline ConstIterator begin() const { return ConstIterator(head); }
     inline ConstIterator end() const { return ConstIterator(nullptr); }
@@ -1363,6 +1580,19 @@ VaDict<K, NewV, NewHash> mapValues(VaFunc<NewV(OldV)> mod, const VaDict<K, OldV,
     }
     return result;
 }
+
+/// @brief mapValues() for any callable; invoked directly, without a VaFunc. The new value type is deduced
+///        and the result keeps the hash function of the input.
+template <typename Fn, typename K, typename OldV, typename OldHash,
+          typename NewV = tt::Decay<std::invoke_result_t<Fn&, const OldV&>>>
+VaDict<K, NewV, OldHash> mapValues(Fn&& mod, const VaDict<K, OldV, OldHash>& dict) {
+    VaDict<K, NewV, OldHash> result;
+    result.reserve(dict.getSize());
+    for (const auto& pair: dict) {
+        result.put(pair.key, mod(pair.value));
+    }
+    return result;
+}
 //@}
 
 /**
@@ -1402,6 +1632,20 @@ VaDict<NewK, V, NewHash> mapKeys(VaFunc<NewK(OldK)> mod, const VaDict<OldK, V, O
     }
     return result;
 }
+
+/// @brief mapKeys() for any callable; invoked directly, without a VaFunc. The new key type is deduced.
+///        If it is the old key type, the result keeps the hash function of the input; otherwise it uses `VaHash<NewK>`.
+template <typename Fn, typename V, typename OldK, typename OldHash,
+          typename NewK = tt::Decay<std::invoke_result_t<Fn&, const OldK&>>,
+          typename NewHash = tt::Conditional<tt::IsSame<NewK, OldK>, OldHash, VaHash<NewK>>>
+VaDict<NewK, V, NewHash> mapKeys(Fn&& mod, const VaDict<OldK, V, OldHash>& dict) {
+    VaDict<NewK, V, NewHash> result;
+    result.reserve(dict.getSize());
+    for (const auto& pair: dict) {
+        result.put(mod(pair.key), pair.value);
+    }
+    return result;
+}
 //@}
 
 /**
@@ -1445,6 +1689,21 @@ VaDict<K, V, NewHash> filterByKey(VaFunc<bool(K)> predicate, VaDict<K, V, OldHas
     }
     return result;
 }
+
+/// @brief filterByKey() for any callable; invoked directly, without a VaFunc, and the input is not copied.
+///        The result keeps the hash function of the input.
+template <typename Fn, typename K, typename V, typename OldHash,
+          typename = tt::EnableIf<std::is_invocable_r_v<bool, Fn&, const K&>>>
+VaDict<K, V, OldHash> filterByKey(Fn&& predicate, const VaDict<K, V, OldHash>& dict) {
+    VaDict<K, V, OldHash> result;
+    result.reserve(dict.getSize());
+    for (const auto& pair : dict) {
+        if (predicate(pair.key)) {
+            result.put(pair.key, pair.value);
+        }
+    }
+    return result;
+}
 //@}
 
 /**
@@ -1488,6 +1747,21 @@ VaDict<K, V, NewHash> filterByValue(VaFunc<bool(V)> predicate, VaDict<K, V, OldH
     }
     return result;
 }
+
+/// @brief filterByValue() for any callable; invoked directly, without a VaFunc, and the input is not copied.
+///        The result keeps the hash function of the input.
+template <typename Fn, typename K, typename V, typename OldHash,
+          typename = tt::EnableIf<std::is_invocable_r_v<bool, Fn&, const V&>>>
+VaDict<K, V, OldHash> filterByValue(Fn&& predicate, const VaDict<K, V, OldHash>& dict) {
+    VaDict<K, V, OldHash> result;
+    result.reserve(dict.getSize());
+    for (const auto& pair : dict) {
+        if (predicate(pair.value)) {
+            result.put(pair.key, pair.value);
+        }
+    }
+    return result;
+}
 //@}
 
 } // namespace va
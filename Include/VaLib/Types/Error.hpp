@@ -7,7 +7,11 @@
 #include <VaLib/Types/String.hpp>
 
 #include <VaLib/Types/TypeTraits.hpp>
+
+#include <functional>
 #include <iostream>
+#include <new>
+#include <type_traits>
 
 namespace va {
 
@@ -29,12 +33,35 @@ struct HasThrowIt<T, decltype(std::declval<T>().throwIt(), void())>: TrueType {}
 
 }
 
+/**
+ * @brief An error message with static storage duration, e.g. a string literal.
+ *
+ * Errors built from a VaStaticMessage keep only the pointer, so creating, moving and destroying
+ * them never allocates. The constructor is consteval, so a pointer to a temporary buffer is
+ * rejected at compile time.
+ *
+ * @code
+ * return ValueError(VaStaticMessage("invalid digit"));
+ * @endcode
+ */
+class VaStaticMessage {
+  protected:
+    const char* str;
+
+  public:
+    explicit consteval VaStaticMessage(const char* str) : str(str) {}
+
+    constexpr const char* get() const noexcept { return str; }
+};
+
 /**
  * @brief Base class for all error types.
  */
 class VaBaseError {
   protected:
-    VaString msg; ///< error message
+    VaString msg;                  ///< error message
+    const char* staticMsg = nullptr; ///< static error message, used instead of msg when set
+    int code = 0;                  ///< error code, 0 if not set
 
   public:
     /**
@@ -48,6 +75,18 @@ class VaBaseError {
      */
     explicit VaBaseError(VaString m);
 
+    /**
+     * @brief Constructor with a static error message and an optional error code. Does not allocate.
+     * @param m The error message.
+     * @param code The error code.
+     */
+    explicit VaBaseError(VaStaticMessage m, int code = 0) noexcept : staticMsg(m.get()), code(code) {}
+
+    VaBaseError(const VaBaseError&) = default;
+    VaBaseError(VaBaseError&&) noexcept = default;
+    VaBaseError& operator=(const VaBaseError&) = default;
+    VaBaseError& operator=(VaBaseError&&) noexcept = default;
+
     /**
      * @brief Virtual destructor.
      */
@@ -60,6 +99,12 @@ class VaBaseError {
      * @return The error message as a VaString.
      */
     virtual VaString what() const;
+
+    /**
+     * @brief Get the error code.
+     * @return The code passed to the constructor, or 0.
+     */
+    inline int getCode() const noexcept { return code; }
 };
 
 /**
@@ -101,10 +146,20 @@ class IndexError: public VaBaseError {
 class IndexOutOfRangeError: public IndexError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "index out of the range").
+     * @brief Constructor with the default error message ("index out of the range"), which does not allocate.
      */
-    IndexOutOfRangeError(VaString m = "index out of the range");
+    IndexOutOfRangeError() : IndexError(VaStaticMessage("index out of the range")) {}
+
+    /**
+     * @brief Constructor with an error message.
+     * @param m The error message.
+     */
+    IndexOutOfRangeError(VaString m);
+
+    /**
+     * @brief Constructor with a static error message and an optional error code.
+     */
+    IndexOutOfRangeError(VaStaticMessage m, int code = 0) noexcept : IndexError(m, code) {}
 
     /**
      * @brief Constructor with range and index information.
@@ -121,10 +176,11 @@ class IndexOutOfRangeError: public IndexError {
 class NullPointerError: public VaBaseError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "null pointer error").
+     * @brief Constructor with the default error message ("null pointer error"), which does not allocate.
      */
-    NullPointerError(VaString m = "null pointer error") : VaBaseError(m) {}
+    NullPointerError() : VaBaseError(VaStaticMessage("null pointer error")) {}
+    NullPointerError(VaString m) : VaBaseError(m) {}
+    NullPointerError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
@@ -134,41 +190,62 @@ class NullPointerError: public VaBaseError {
 class DivisionByZeroError: public VaBaseError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "division by zero").
+     * @brief Constructor with the default error message ("division by zero"), which does not allocate.
      */
-    DivisionByZeroError(VaString m = "division by zero") : VaBaseError(m) {}
+    DivisionByZeroError() : VaBaseError(VaStaticMessage("division by zero")) {}
+    DivisionByZeroError(VaString m) : VaBaseError(m) {}
+    DivisionByZeroError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
 class KeyNotFoundError: public VaBaseError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "key not found").
+     * @brief Constructor with the default error message ("key not found"), which does not allocate.
      */
-    KeyNotFoundError(VaString m = "key not found") : VaBaseError(m) {}
+    KeyNotFoundError() : VaBaseError(VaStaticMessage("key not found")) {}
+    KeyNotFoundError(VaString m) : VaBaseError(m) {}
+    KeyNotFoundError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
+    THROWIT;
+};
+
+/**
+ * @brief Error class for exceeding the fixed capacity of a container.
+ */
+class CapacityError: public VaBaseError {
+  public:
+    /**
+     * @brief Constructor with the default error message ("capacity exceeded"), which does not allocate.
+     */
+    CapacityError() : VaBaseError(VaStaticMessage("capacity exceeded")) {}
+    CapacityError(VaString m) : VaBaseError(m) {}
+    CapacityError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
 class InvalidCastError: public VaBaseError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "invalid cast").
+     * @brief Constructor with the default error message ("invalid cast"), which does not allocate.
      */
-    InvalidCastError(VaString m = "invalid cast") : VaBaseError(m) {}
+    InvalidCastError() : VaBaseError(VaStaticMessage("invalid cast")) {}
+    InvalidCastError(VaString m) : VaBaseError(m) {}
+    InvalidCastError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
 class InvalidAnyCastError: public VaBaseError {
   public:
-    InvalidAnyCastError(VaString m = "invalid any cast") : VaBaseError(m) {}
+    InvalidAnyCastError() : VaBaseError(VaStaticMessage("invalid any cast")) {}
+    InvalidAnyCastError(VaString m) : VaBaseError(m) {}
+    InvalidAnyCastError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
 };
 
 class InvalidVariantCastError: public VaBaseError {
   public:
-    InvalidVariantCastError(VaString m = "invalid variant cast") : VaBaseError(m) {}
+    InvalidVariantCastError() : VaBaseError(VaStaticMessage("invalid variant cast")) {}
+    InvalidVariantCastError(VaString m) : VaBaseError(m) {}
+    InvalidVariantCastError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
@@ -178,10 +255,11 @@ class InvalidVariantCastError: public VaBaseError {
 class FileNotFoundError: public VaBaseError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "file not found").
+     * @brief Constructor with the default error message ("file not found"), which does not allocate.
      */
-    FileNotFoundError(VaString m = "file not found") : VaBaseError(m) {}
+    FileNotFoundError() : VaBaseError(VaStaticMessage("file not found")) {}
+    FileNotFoundError(VaString m) : VaBaseError(m) {}
+    FileNotFoundError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
@@ -191,46 +269,177 @@ class FileNotFoundError: public VaBaseError {
 class PermissionError: public VaBaseError {
   public:
     /**
-     * @brief Constructor with a default error message.
-     * @param m The error message (default: "permission denied").
+     * @brief Constructor with the default error message ("permission denied"), which does not allocate.
      */
-    PermissionError(VaString m = "permission denied") : VaBaseError(m) {}
+    PermissionError() : VaBaseError(VaStaticMessage("permission denied")) {}
+    PermissionError(VaString m) : VaBaseError(m) {}
+    PermissionError(VaStaticMessage m, int code = 0) noexcept : VaBaseError(m, code) {}
     THROWIT;
 };
 
+template <typename T, typename E>
+class VaResult;
+
+namespace va::detail {
+
+/// @brief Whether D can be stored as an error of type E: E itself or a class derived from it.
+template <typename E, typename D>
+inline constexpr bool IsErrorOf = tt::IsSame<D, E> || tt::IsBaseOf<E, D>;
+
+/// @brief Whether an error of type D is stored inside a VaResult with the error type E.
+template <typename E, typename D>
+inline constexpr bool ErrorFitsInline = sizeof(D) <= sizeof(E) && alignof(D) <= alignof(E) && tt::IsNoexceptMoveConstructible<D>;
+
+/// @brief How to copy, move and destroy the error held by an ErrorSlot, whose exact type is erased.
+template <typename E>
+struct ErrorOps {
+    E* (*copy)(void* buffer, const E* err);
+    E* (*move)(void* buffer, E* err) noexcept; ///< Also destroys err if it was stored inline.
+    void (*destroy)(E* err) noexcept;
+    bool isInline;
+};
+
+template <typename E, typename D, bool Inline>
+struct ErrorOpsFor {
+    static E* copy(void* buffer, const E* err) {
+        if (!err) return nullptr;
+        if constexpr (!tt::IsCopyConstructible<D>) {
+            throw TypeError(VaStaticMessage("VaResult: the error type is not copyable"));
+        } else if constexpr (Inline) {
+            return new (buffer) D(*static_cast<const D*>(err));
+        } else {
+            return new D(*static_cast<const D*>(err));
+        }
+    }
+
+    static E* move(void* buffer, E* err) noexcept {
+        if constexpr (Inline) {
+            if (!err) return nullptr;
+            D* moved = new (buffer) D(std::move(*static_cast<D*>(err)));
+            static_cast<D*>(err)->~D();
+            return moved;
+        } else {
+            return err; // The allocation is taken over
+        }
+    }
+
+    static void destroy(E* err) noexcept {
+        if constexpr (Inline) {
+            if (err) static_cast<D*>(err)->~D();
+        } else {
+            delete static_cast<D*>(err);
+        }
+    }
+
+    static constexpr ErrorOps<E> ops = {copy, move, destroy, Inline};
+};
+
+/**
+ * @brief The error part of a VaResult.
+ *
+ * An error of type E, or of a class derived from E that is no larger and nothrow movable, is
+ * constructed in the buffer; any other error is heap-allocated. Either way ptr points to it, with
+ * the correct dynamic type, so the error keeps its polymorphic behaviour.
+ */
+template <typename E>
+struct ErrorSlot {
+    E* ptr;
+    const ErrorOps<E>* ops;
+    alignas(E) byte buffer[sizeof(E)];
+
+    template <typename D, typename... Args>
+    void create(Args&&... args) {
+        constexpr bool fits = ErrorFitsInline<E, D>;
+        ops = &ErrorOpsFor<E, D, fits>::ops;
+        if constexpr (fits) {
+            ptr = new (buffer) D(std::forward<Args>(args)...);
+        } else {
+            ptr = new D(std::forward<Args>(args)...);
+        }
+    }
+
+    void adopt(E* err) noexcept {
+        ops = &ErrorOpsFor<E, E, false>::ops;
+        ptr = err;
+    }
+
+    void copyFrom(const ErrorSlot& other) {
+        ops = other.ops;
+        ptr = ops->copy(buffer, other.ptr);
+    }
+
+    void moveFrom(ErrorSlot& other) noexcept {
+        ops = other.ops;
+        ptr = ops->move(buffer, other.ptr);
+        other.ptr = nullptr;
+    }
+
+    void destroy() noexcept { ops->destroy(ptr); }
+};
+
+/// @brief Tag for the VaResult constructors that take the error over from another VaResult.
+struct ErrorFromSlot {};
+
+template <typename T>
+struct IsResult: FalseType {};
+
+template <typename T, typename E>
+struct IsResult<VaResult<T, E>>: TrueType {};
+
+} // namespace va::detail
+
 /**
  * @brief A class representing a result that can either hold a value or an error.
  * @tparam T The type of the value.
  * @tparam E The type of the error (default: VaBaseError).
  *
- * This class uses a union to store either a value of type T or a pointer to an error of type E.
- * The error is stored as a pointer to allow polymorphic behavior (i.e. inheritance).
+ * The error keeps its polymorphic behaviour (i.e. inheritance): a result with the error type E can
+ * hold any error derived from E. An error of type E, or of a derived class that is no larger than E
+ * and nothrow movable, is stored inside the result, so failing does not allocate; larger errors are
+ * heap-allocated. Combined with errors that carry a VaStaticMessage or a code, the whole error path
+ * is allocation-free:
+ *
+ * @code
+ * VaResult<int> parseDigit(char c) {
+ *     if (c < '0' || c > '9') return ValueError(VaStaticMessage("not a digit"));
+ *     return c - '0';
+ * }
+ *
+ * VaResult<int> doubled = parseDigit(c).map([](int x) { return x * 2; });
+ * @endcode
+ *
  * Make sure the error type E has a copy constructor if you plan to copy VaResult objects.
  */
 template <typename T, typename E = VaBaseError>
 class VaResult {
   protected:
+    template <typename, typename>
+    friend class VaResult;
+
     /**
-     * @brief The union that stores either the value or the error pointer.
+     * @brief The union that stores either the value or the error.
      */
     union {
-        T val;  ///< The value, if the result is successful.
-        E* err; ///< The error pointer, if the result is an error.
+        T val;                        ///< The value, if the result is successful.
+        va::detail::ErrorSlot<E> err; ///< The error, if the result is an error.
     };
 
     bool ok; ///< True if the result holds a value, false if it holds an error.
 
     /**
-     * @brief Internal helper to clean up the error if present.
+     * @brief Internal helper to clean up the value or the error.
      */
-    void destroy() noexcept(tt::IsNoexceptDestructible<T> && tt::IsNoexceptDestructible<E>) {
+    void destroy() noexcept(tt::IsNoexceptDestructible<T>) {
         if (ok) {
             val.~T();
         } else {
-            delete err;
+            err.destroy();
         }
     }
 
+    VaResult(va::detail::ErrorFromSlot, const va::detail::ErrorSlot<E>& other) : ok(false) { err.copyFrom(other); }
+    VaResult(va::detail::ErrorFromSlot, va::detail::ErrorSlot<E>&& other) noexcept : ok(false) { err.moveFrom(other); }
+
   public:
     /**
      * @brief Constructor for a successful result.
@@ -241,7 +450,8 @@ class VaResult {
     template <
         typename U,
         typename = tt::EnableIf<
-            tt::IsConstructible<T, U&&> && !tt::IsSame<typename tt::Decay<U>, VaResult>
+            tt::IsConstructible<T, U&&> && !tt::IsSame<typename tt::Decay<U>, VaResult> &&
+            !va::detail::IsErrorOf<E, tt::Decay<U>>
         >
     >
     VaResult(U&& v) : ok(true) {
@@ -250,34 +460,39 @@ class VaResult {
 
     /**
      * @brief Constructor for an error result.
-     * @param e A pointer to the error object (must be allocated on the heap).
+     * @param e A pointer to the error object (must be allocated on the heap). The result takes ownership.
      */
-    VaResult(E* e) : err(e), ok(false) {}
+    VaResult(E* e) : ok(false) { err.adopt(e); }
 
     /**
      * @brief Constructor for an error result.
-     * @param e An error object.
+     * @param e An error object of type E or derived from it; stored inline if it fits.
      */
-    VaResult(E&& e) : err(new E(std::move(e))), ok(false) {}
+    // @{
+    VaResult(E&& e) : ok(false) { err.template create<E>(std::move(e)); }
+
+    template <typename D, tt::EnableIf<va::detail::IsErrorOf<E, tt::Decay<D>>, int> = 0>
+    VaResult(D&& e) : ok(false) {
+        err.template create<tt::Decay<D>>(std::forward<D>(e));
+    }
+    // @}
 
     /**
      * @brief Destructor. Frees the error if present.
      */
-    ~VaResult() noexcept(tt::IsNoexceptDestructible<T> && tt::IsNoexceptDestructible<E>) {
-        destroy();
-    }
+    ~VaResult() noexcept(tt::IsNoexceptDestructible<T>) { destroy(); }
 
     /**
      * @brief Copy constructor.
      * @param other The other VaResult to copy.
      *
-     * The error is deep-copied using the copy constructor of type E.
+     * The error is deep-copied using the copy constructor of its dynamic type.
      */
     VaResult(const VaResult& other) : ok(other.ok) {
         if (ok) {
             new (&val) T(other.val);
         } else {
-            err = other.err ? new E(*other.err) : nullptr;
+            err.copyFrom(other.err);
         }
     }
 
@@ -289,8 +504,7 @@ class VaResult {
         if (ok) {
             new (&val) T(std::move(other.val));
         } else {
-            err = other.err;
-            other.err = nullptr;
+            err.moveFrom(other.err);
         }
     }
 
@@ -307,7 +521,7 @@ class VaResult {
         if (ok) {
             new (&val) T(other.val);
         } else {
-            err = other.err ? new E(*other.err) : nullptr;
+            err.copyFrom(other.err);
         }
         return *this;
     }
@@ -325,8 +539,7 @@ class VaResult {
         if (ok) {
             new (&val) T(std::move(other.val));
         } else {
-            err = other.err;
-            other.err = nullptr;
+            err.moveFrom(other.err);
         }
         return *this;
     }
@@ -343,6 +556,12 @@ class VaResult {
      */
     inline bool isErr() const { return !ok; }
 
+    /**
+     * @brief Whether the error is stored inside the result rather than heap-allocated.
+     * @return False if the result holds a value.
+     */
+    inline bool isErrInline() const noexcept { return !ok && err.ops->isInline; }
+
     /**
      * @brief Get the value if the result is successful.
      * @return The value.
@@ -351,7 +570,7 @@ class VaResult {
      */
     inline const T& unwrap() const {
         if (!ok) {
-            throw ValueError("Attempted to unwrap a VaResult that holds an error");
+            throw ValueError(VaStaticMessage("Attempted to unwrap a VaResult that holds an error"));
         }
         return val;
     }
@@ -364,9 +583,9 @@ class VaResult {
      */
     inline const E* unwrapErr() const {
         if (ok) {
-            throw ValueError("Attempted to unwrapErr a VaResult that holds a value");
+            throw ValueError(VaStaticMessage("Attempted to unwrapErr a VaResult that holds a value"));
         }
-        return err;
+        return err.ptr;
     }
 
     /**
@@ -376,6 +595,83 @@ class VaResult {
      */
     inline const T& unwrapOr(const T& fallback) const { return ok ? val : fallback; }
 
+    /**
+     * @brief Applies fn to the value, keeping the error as it is.
+     * @param fn A callable taking the value.
+     * @return A VaResult<U, E> holding fn's result, or the error. U may be void.
+     * @note On an rvalue the value is passed to fn as an rvalue and the error is moved, not copied.
+     */
+    // @{
+    template <typename F>
+    auto map(F&& fn) const& {
+        using U = std::invoke_result_t<F, const T&>;
+        if (!ok) return VaResult<U, E>(va::detail::ErrorFromSlot{}, err);
+        if constexpr (tt::IsVoid<U>) {
+            std::invoke(std::forward<F>(fn), val);
+            return VaResult<U, E>();
+        } else {
+            return VaResult<U, E>(std::invoke(std::forward<F>(fn), val));
+        }
+    }
+    template <typename F>
+    auto map(F&& fn) && {
+        using U = std::invoke_result_t<F, T&&>;
+        if (!ok) return VaResult<U, E>(va::detail::ErrorFromSlot{}, std::move(err));
+        if constexpr (tt::IsVoid<U>) {
+            std::invoke(std::forward<F>(fn), std::move(val));
+            return VaResult<U, E>();
+        } else {
+            return VaResult<U, E>(std::invoke(std::forward<F>(fn), std::move(val)));
+        }
+    }
+    // @}
+
+    /**
+     * @brief Chains an operation that can fail: calls fn with the value, keeping the error as it is.
+     * @param fn A callable taking the value and returning a VaResult<U, E>.
+     * @return fn's result, or the error.
+     * @note On an rvalue the value is passed to fn as an rvalue and the error is moved, not copied.
+     */
+    // @{
+    template <typename F>
+    auto andThen(F&& fn) const& {
+        using R = std::invoke_result_t<F, const T&>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::andThen: fn must return a VaResult with the same error type");
+        if (!ok) return R(va::detail::ErrorFromSlot{}, err);
+        return std::invoke(std::forward<F>(fn), val);
+    }
+    template <typename F>
+    auto andThen(F&& fn) && {
+        using R = std::invoke_result_t<F, T&&>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::andThen: fn must return a VaResult with the same error type");
+        if (!ok) return R(va::detail::ErrorFromSlot{}, std::move(err));
+        return std::invoke(std::forward<F>(fn), std::move(val));
+    }
+    // @}
+
+    /**
+     * @brief Recovers from an error: calls fn with the error, keeping the value as it is.
+     * @param fn A callable taking the error and returning a VaResult<T, E2>.
+     * @return fn's result, or the value.
+     * @note On an rvalue the value is moved and the error is passed to fn as an rvalue.
+     */
+    // @{
+    template <typename F>
+    auto orElse(F&& fn) const& {
+        using R = std::invoke_result_t<F, const E&>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::orElse: fn must return a VaResult");
+        if (ok) return R(val);
+        return std::invoke(std::forward<F>(fn), static_cast<const E&>(*err.ptr));
+    }
+    template <typename F>
+    auto orElse(F&& fn) && {
+        using R = std::invoke_result_t<F, E&&>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::orElse: fn must return a VaResult");
+        if (ok) return R(std::move(val));
+        return std::invoke(std::forward<F>(fn), std::move(*err.ptr));
+    }
+    // @}
+
     /**
      * @brief Throws the stored error by calling its `throwIt()` method.
      *
@@ -386,10 +682,10 @@ class VaResult {
     template <typename U = E>
     tt::EnableIf<va::HasThrowIt<U>::value, void> throwErr() {
         if (ok) {
-            throw ValueError("Attempted to throw a VaResult that holds a value");
+            throw ValueError(VaStaticMessage("Attempted to throw a VaResult that holds a value"));
         }
 
-        err->throwIt();
+        err.ptr->throwIt();
     }
 
     /**
@@ -402,10 +698,10 @@ class VaResult {
     template <typename U = E>
     tt::EnableIf<!va::HasThrowIt<U>::value, void> throwErr() {
         if (ok) {
-            throw ValueError("Attempted to throw a VaResult that holds a value");
+            throw ValueError(VaStaticMessage("Attempted to throw a VaResult that holds a value"));
         }
 
-        throw *err;
+        throw *err.ptr;
     }
 };
 
@@ -414,58 +710,77 @@ class VaResult {
  * @tparam E The type of the error (default: VaBaseError).
  *
  * This specialization is used when the successful result does not hold any value,
- * only indicating success or failure. The error is still stored as a heap-allocated
- * pointer to support polymorphism (i.e. inheritance).
+ * only indicating success or failure. The error is stored like in VaResult<T, E>: inline
+ * when it fits, otherwise heap-allocated.
  *
  * Make sure the error type E has a copy constructor if you plan to copy VaResult objects.
+ *
+ * @note Creating, checking and destroying a successful result is constexpr, so functions
+ *       returning VaResult<void, E> can be used in constant expressions as long as they succeed.
  */
 template <typename E>
 class VaResult<void, E> {
   protected:
-    E* err = nullptr; ///< The pointer to the error object (heap-allocated).
-    bool ok;          ///< True if the result holds a value, false if it holds an error.
+    template <typename, typename>
+    friend class VaResult;
+
+    union {
+        va::detail::ErrorSlot<E> err; ///< The error, if the result is an error.
+    };
+
+    bool ok; ///< True if the result holds a value, false if it holds an error.
 
     /**
      * @brief Internal helper to clean up the error if present.
      */
-    void destroy() noexcept(tt::IsNoexceptDestructible<E>) {
+    constexpr void destroy() noexcept {
         if (!ok) {
-            delete err;
+            err.destroy();
         }
     }
 
+    VaResult(va::detail::ErrorFromSlot, const va::detail::ErrorSlot<E>& other) : ok(false) { err.copyFrom(other); }
+    VaResult(va::detail::ErrorFromSlot, va::detail::ErrorSlot<E>&& other) noexcept : ok(false) { err.moveFrom(other); }
+
   public:
     /**
      * @brief Constructor for a successful result (no value).
      */
-    VaResult() : ok(true) {}
+    constexpr VaResult() : ok(true) {}
 
     /**
      * @brief Constructor for an error result.
-     * @param e A pointer to the error object (must be allocated on the heap).
+     * @param e A pointer to the error object (must be allocated on the heap). The result takes ownership.
      */
-    VaResult(E* e) : err(e), ok(false) {}
+    VaResult(E* e) : ok(false) { err.adopt(e); }
 
     /**
      * @brief Constructor for an error result.
-     * @param e An error object.
+     * @param e An error object of type E or derived from it; stored inline if it fits.
      */
-    VaResult(E&& e) : err(new E(std::move(e))), ok(false) {}
+    // @{
+    VaResult(E&& e) : ok(false) { err.template create<E>(std::move(e)); }
+
+    template <typename D, tt::EnableIf<va::detail::IsErrorOf<E, tt::Decay<D>>, int> = 0>
+    VaResult(D&& e) : ok(false) {
+        err.template create<tt::Decay<D>>(std::forward<D>(e));
+    }
+    // @}
 
     /**
      * @brief Destructor. Frees the error if present.
      */
-    ~VaResult() noexcept(tt::IsNoexceptDestructible<E>) { destroy(); }
+    constexpr ~VaResult() noexcept { destroy(); }
 
     /**
      * @brief Copy constructor.
      * @param other The other VaResult to copy.
      *
-     * The error is deep-copied using the copy constructor of type E.
+     * The error is deep-copied using the copy constructor of its dynamic type.
      */
-    VaResult(const VaResult& other) : ok(other.ok) {
+    constexpr VaResult(const VaResult& other) : ok(other.ok) {
         if (!ok) {
-            err = other.err ? new E(*other.err) : nullptr;
+            err.copyFrom(other.err);
         }
     }
 
@@ -473,7 +788,11 @@ class VaResult<void, E> {
      * @brief Move constructor.
      * @param other The other VaResult to move from.
      */
-    VaResult(VaResult&& other) noexcept : ok(other.ok), err(other.err) { other.err = nullptr; }
+    constexpr VaResult(VaResult&& other) noexcept : ok(other.ok) {
+        if (!ok) {
+            err.moveFrom(other.err);
+        }
+    }
 
     /**
      * @brief Copy assignment operator.
@@ -486,9 +805,7 @@ class VaResult<void, E> {
 
         ok = other.ok;
         if (!ok) {
-            err = other.err ? new E(*other.err) : nullptr;
-        } else {
-            err = nullptr;
+            err.copyFrom(other.err);
         }
         return *this;
     }
@@ -503,8 +820,9 @@ class VaResult<void, E> {
         destroy();
 
         ok = other.ok;
-        err = other.err;
-        other.err = nullptr;
+        if (!ok) {
+            err.moveFrom(other.err);
+        }
         return *this;
     }
 
@@ -512,13 +830,19 @@ class VaResult<void, E> {
      * @brief Check if the result is successful.
      * @return True if the result indicates success, false otherwise.
      */
-    inline bool isOk() const { return ok; }
+    constexpr bool isOk() const { return ok; }
 
     /**
      * @brief Check if the result is an error.
      * @return True if the result holds an error, false otherwise.
      */
-    inline bool isErr() const { return !ok; }
+    constexpr bool isErr() const { return !ok; }
+
+    /**
+     * @brief Whether the error is stored inside the result rather than heap-allocated.
+     * @return False if the result indicates success.
+     */
+    inline bool isErrInline() const noexcept { return !ok && err.ops->isInline; }
 
     /**
      * @brief Ensure the result is successful.
@@ -530,7 +854,7 @@ class VaResult<void, E> {
      */
     inline void unwrap() const {
         if (!ok) {
-            throw ValueError("Attempted to unwrap a VaResult that holds an error");
+            throw ValueError(VaStaticMessage("Attempted to unwrap a VaResult that holds an error"));
         }
     }
 
@@ -542,10 +866,84 @@ class VaResult<void, E> {
      */
     inline const E* unwrapErr() const {
         if (ok) {
-            throw ValueError("Attempted to unwrapErr a VaResult that holds a value");
+            throw ValueError(VaStaticMessage("Attempted to unwrapErr a VaResult that holds a value"));
         }
-        return err;
+        return err.ptr;
+    }
+
+    /**
+     * @brief Calls fn on success, keeping the error as it is.
+     * @param fn A callable taking no arguments.
+     * @return A VaResult<U, E> holding fn's result, or the error. U may be void.
+     */
+    // @{
+    template <typename F>
+    auto map(F&& fn) const& {
+        using U = std::invoke_result_t<F>;
+        if (!ok) return VaResult<U, E>(va::detail::ErrorFromSlot{}, err);
+        if constexpr (tt::IsVoid<U>) {
+            std::invoke(std::forward<F>(fn));
+            return VaResult<U, E>();
+        } else {
+            return VaResult<U, E>(std::invoke(std::forward<F>(fn)));
+        }
+    }
+    template <typename F>
+    auto map(F&& fn) && {
+        using U = std::invoke_result_t<F>;
+        if (!ok) return VaResult<U, E>(va::detail::ErrorFromSlot{}, std::move(err));
+        if constexpr (tt::IsVoid<U>) {
+            std::invoke(std::forward<F>(fn));
+            return VaResult<U, E>();
+        } else {
+            return VaResult<U, E>(std::invoke(std::forward<F>(fn)));
+        }
+    }
+    // @}
+
+    /**
+     * @brief Chains an operation that can fail: calls fn on success, keeping the error as it is.
+     * @param fn A callable taking no arguments and returning a VaResult<U, E>.
+     * @return fn's result, or the error.
+     */
+    // @{
+    template <typename F>
+    auto andThen(F&& fn) const& {
+        using R = std::invoke_result_t<F>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::andThen: fn must return a VaResult with the same error type");
+        if (!ok) return R(va::detail::ErrorFromSlot{}, err);
+        return std::invoke(std::forward<F>(fn));
+    }
+    template <typename F>
+    auto andThen(F&& fn) && {
+        using R = std::invoke_result_t<F>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::andThen: fn must return a VaResult with the same error type");
+        if (!ok) return R(va::detail::ErrorFromSlot{}, std::move(err));
+        return std::invoke(std::forward<F>(fn));
+    }
+    // @}
+
+    /**
+     * @brief Recovers from an error: calls fn with the error.
+     * @param fn A callable taking the error and returning a VaResult<void, E2>.
+     * @return fn's result, or a successful result.
+     */
+    // @{
+    template <typename F>
+    auto orElse(F&& fn) const& {
+        using R = std::invoke_result_t<F, const E&>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::orElse: fn must return a VaResult");
+        if (ok) return R();
+        return std::invoke(std::forward<F>(fn), static_cast<const E&>(*err.ptr));
+    }
+    template <typename F>
+    auto orElse(F&& fn) && {
+        using R = std::invoke_result_t<F, E&&>;
+        static_assert(va::detail::IsResult<R>::value, "VaResult::orElse: fn must return a VaResult");
+        if (ok) return R();
+        return std::invoke(std::forward<F>(fn), std::move(*err.ptr));
     }
+    // @}
 
     /**
      * @brief Throws the stored error by calling its `throwIt()` method.
@@ -557,10 +955,10 @@ class VaResult<void, E> {
     template <typename U = E>
     tt::EnableIf<va::HasThrowIt<U>::value> throwErr() {
         if (ok) {
-            throw ValueError("Attempted to throw a VaResult that holds a value");
+            throw ValueError(VaStaticMessage("Attempted to throw a VaResult that holds a value"));
         }
 
-        err->throwIt();
+        err.ptr->throwIt();
     }
 
     /**
@@ -573,10 +971,10 @@ class VaResult<void, E> {
     template <typename U = E>
     tt::EnableIf<!va::HasThrowIt<U>::value> throwErr() {
         if (ok) {
-            throw ValueError("Attempted to throw a VaResult that holds a value");
+            throw ValueError(VaStaticMessage("Attempted to throw a VaResult that holds a value"));
         }
 
-        throw *err;
+        throw *err.ptr;
     }
 };
 
@@ -0,0 +1,342 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+namespace va::detail {
+
+/// @brief Default callback of the sift functions: heaps without handles do not track positions.
+struct HeapNoTrack {
+    template <typename T>
+    inline void operator()(const T&, Size) const noexcept {}
+};
+
+/**
+ * @brief Moves data[pos] towards the root until its parent does not compare before it.
+ *
+ * Uses a hole instead of swaps, so every level costs one move. moved(element, index) is
+ * called for every element that lands in a new index, the sifted element included.
+ */
+template <Size Arity, typename T, typename Compare, typename Moved = HeapNoTrack>
+Size heapSiftUp(T* data, Size pos, Compare& comp, Moved moved = Moved()) {
+    T value = std::move(data[pos]);
+    while (pos > 0) {
+        Size parent = (pos - 1) / Arity;
+        if (!comp(value, data[parent])) break;
+
+        data[pos] = std::move(data[parent]);
+        moved(data[pos], pos);
+        pos = parent;
+    }
+
+    data[pos] = std::move(value);
+    moved(data[pos], pos);
+    return pos;
+}
+
+/**
+ * @brief Moves data[pos] towards the leaves until none of its children compares before it.
+ */
+template <Size Arity, typename T, typename Compare, typename Moved = HeapNoTrack>
+Size heapSiftDown(T* data, Size len, Size pos, Compare& comp, Moved moved = Moved()) {
+    T value = std::move(data[pos]);
+    for (;;) {
+        Size child = pos * Arity + 1;
+        if (child >= len) break;
+
+        Size last = len - child > Arity ? child + Arity : len;
+        Size best = child;
+        for (Size c = child + 1; c < last; c++) {
+            if (comp(data[c], data[best])) best = c;
+        }
+
+        if (!comp(data[best], value)) break;
+
+        data[pos] = std::move(data[best]);
+        moved(data[pos], pos);
+        pos = best;
+    }
+
+    data[pos] = std::move(value);
+    moved(data[pos], pos);
+    return pos;
+}
+
+/**
+ * @brief Arranges data[0, len) into a heap in O(len) (Floyd's method).
+ */
+template <Size Arity, typename T, typename Compare, typename Moved = HeapNoTrack>
+void heapify(T* data, Size len, Compare& comp, Moved moved = Moved()) {
+    if (len < 2) return;
+    for (Size i = (len - 2) / Arity + 1; i-- > 0;) heapSiftDown<Arity>(data, len, i, comp, moved);
+}
+
+/**
+ * @brief Sorts a heap in place so that the element popped last comes first.
+ */
+template <Size Arity, typename T, typename Compare>
+void heapSort(T* data, Size len, Compare& comp) {
+    for (Size end = len; end > 1; end--) {
+        std::swap(data[0], data[end - 1]);
+        heapSiftDown<Arity>(data, end - 1, 0, comp);
+    }
+}
+
+} // namespace va::detail
+
+/**
+ * @class VaHeap A d-ary heap on top of VaList storage.
+ *
+ * @tparam T Type of the stored elements.
+ * @tparam Compare Strict weak ordering; top() is an element that no other element compares before.
+ *         The default std::less<T> gives a min-heap, std::greater<T> a max-heap.
+ * @tparam Arity Number of children per node. 2 is the classic binary heap; 4 halves the depth
+ *         and keeps all children of a node within one cache line for small T, which usually
+ *         makes pop() faster at the cost of a few more comparisons per level.
+ *
+ * @note The comparator must not throw. Sifting moves elements through a hole, so an exception
+ *       from the comparator would leave a moved-from element in the heap.
+ */
+template <typename T, typename Compare = std::less<T>, Size Arity = 2>
+class VaHeap {
+    static_assert(Arity >= 2, "VaHeap arity must be at least 2");
+
+  protected:
+    VaList<T> data;
+    [[no_unique_address]] Compare comp;
+
+  public:
+    /**
+     * @brief Constructs an empty heap.
+     * @param comp The comparator.
+     */
+    explicit VaHeap(Compare comp = Compare()) : comp(std::move(comp)) {}
+
+    /**
+     * @brief Builds a heap from the elements of a list in O(n).
+     * @param list The elements; taken over without copying when passed as an rvalue.
+     * @param comp The comparator.
+     */
+    explicit VaHeap(VaList<T> list, Compare comp = Compare()) : data(std::move(list)), comp(std::move(comp)) {
+        va::detail::heapify<Arity>(data.dataPtr(), len(data), this->comp);
+    }
+
+    VaHeap(std::initializer_list<T> init, Compare comp = Compare()) : VaHeap(VaList<T>(init), std::move(comp)) {}
+
+    /**
+     * @brief Adds an element to the heap in O(log n).
+     * @param value The element to add.
+     */
+    void push(const T& value) {
+        data.append(value);
+        va::detail::heapSiftUp<Arity>(data.dataPtr(), len(data) - 1, comp);
+    }
+
+    void push(T&& value) {
+        data.append(std::move(value));
+        va::detail::heapSiftUp<Arity>(data.dataPtr(), len(data) - 1, comp);
+    }
+
+    /**
+     * @brief Constructs an element in place and adds it to the heap.
+     * @param args Arguments forwarded to the constructor of T.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        data.appendEmplace(std::forward<Args>(args)...);
+        va::detail::heapSiftUp<Arity>(data.dataPtr(), len(data) - 1, comp);
+    }
+
+    /**
+     * @brief Returns the top element.
+     *
+     * @throws ValueError If the heap is empty.
+     */
+    const T& top() const {
+        if (data.isEmpty()) throw ValueError(VaStaticMessage("top() on empty heap"));
+        return data[0];
+    }
+
+    /**
+     * @brief Removes and returns the top element in O(log n).
+     * @return The removed element.
+     *
+     * @throws ValueError If the heap is empty.
+     */
+    T pop() {
+        if (data.isEmpty()) throw ValueError(VaStaticMessage("pop() on empty heap"));
+
+        T last = data.pop();
+        if (data.isEmpty()) return last;
+
+        T result = std::move(data[0]);
+        data[0] = std::move(last);
+        va::detail::heapSiftDown<Arity>(data.dataPtr(), len(data), 0, comp);
+        return result;
+    }
+
+    /**
+     * @brief Returns the top element, or nullptr if the heap is empty.
+     */
+    const T* tryTop() const noexcept { return data.tryFront(); }
+
+    /**
+     * @brief Removes the top element and moves it into out, without throwing.
+     * @param out Receives the removed element.
+     * @return True if an element was removed, false if the heap is empty.
+     */
+    bool tryPop(T& out) {
+        if (data.isEmpty()) return false;
+
+        out = pop();
+        return true;
+    }
+
+    /**
+     * @brief Pushes value and then pops the top, in a single sift.
+     * @param value The element to push.
+     * @return The top element after the push; that is value itself if it would become the top.
+     *
+     * @note Cheaper than push() followed by pop(), and never grows the storage.
+     */
+    T pushPop(T value) {
+        if (data.isEmpty() || !comp(data[0], value)) return value;
+
+        std::swap(value, data[0]);
+        va::detail::heapSiftDown<Arity>(data.dataPtr(), len(data), 0, comp);
+        return value;
+    }
+
+    /**
+     * @brief Pops the top and then pushes value, in a single sift.
+     * @param value The element to push.
+     * @return The previous top element.
+     *
+     * @throws ValueError If the heap is empty.
+     */
+    T replaceTop(T value) {
+        if (data.isEmpty()) throw ValueError(VaStaticMessage("replaceTop() on empty heap"));
+
+        std::swap(value, data[0]);
+        va::detail::heapSiftDown<Arity>(data.dataPtr(), len(data), 0, comp);
+        return value;
+    }
+
+    /**
+     * @brief Empties the heap and returns its elements in pop order, in O(n log n).
+     */
+    VaList<T> takeSorted() {
+        va::detail::heapSort<Arity>(data.dataPtr(), len(data), comp);
+
+        VaList<T> result = std::move(data);
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    inline void reserve(Size minCap) { data.reserve(minCap); }
+    inline void clear() { data.clear(); }
+
+    inline bool isEmpty() const noexcept { return data.isEmpty(); }
+    inline Size getLength() const noexcept { return len(data); }
+    inline Size getCapacity() const noexcept { return cap(data); }
+
+  public friends:
+    friend inline Size len(const VaHeap& heap) noexcept { return len(heap.data); }
+    friend inline Size cap(const VaHeap& heap) noexcept { return cap(heap.data); }
+
+  public iterators:
+    /// @brief Iterates over the elements in heap (not sorted) order.
+    using ConstIterator = const T*;
+
+    inline ConstIterator begin() const { return data.begin(); }
+    inline ConstIterator end() const { return data.end(); }
+};
+
+template <typename T, Size Arity = 2>
+using VaMinHeap = VaHeap<T, std::less<T>, Arity>;
+
+template <typename T, Size Arity = 2>
+using VaMaxHeap = VaHeap<T, std::greater<T>, Arity>;
+
+namespace va {
+
+/**
+ * @brief Arranges the elements of a slice into a binary heap in O(n).
+ * @param slice The elements to arrange.
+ * @param comp Strict weak ordering; slice[0] ends up as an element that nothing compares before.
+ */
+template <typename T, typename Compare = std::less<T>>
+void heapify(VaSlice<T> slice, Compare comp = Compare()) {
+    va::detail::heapify<2>(slice.begin(), len(slice), comp);
+}
+
+/**
+ * @brief Checks whether a slice is a binary heap under comp.
+ */
+template <typename T, typename Compare = std::less<T>>
+bool isHeap(const VaSlice<T>& slice, Compare comp = Compare()) {
+    for (Size i = 1; i < len(slice); i++) {
+        if (comp(slice[i], slice[(i - 1) / 2])) return false;
+    }
+    return true;
+}
+
+namespace detail {
+
+template <typename T, typename Compare>
+VaList<T> topK(const T* data, Size n, Size k, Compare& comp) {
+    if (k > n) k = n;
+
+    VaList<T> result;
+    if (k == 0) return result;
+
+    result.reserve(k);
+    for (Size i = 0; i < k; i++) result.append(data[i]);
+
+    T* heap = result.dataPtr();
+    heapify<2>(heap, k, comp);
+
+    for (Size i = k; i < n; i++) {
+        if (comp(heap[0], data[i])) {
+            heap[0] = data[i];
+            heapSiftDown<2>(heap, k, 0, comp);
+        }
+    }
+
+    heapSort<2>(heap, k, comp);
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Returns the k greatest elements of a slice, greatest first.
+ * @param slice The elements to select from.
+ * @param k Number of elements to return; fewer are returned if the slice is shorter.
+ * @param comp Strict weak ordering; pass std::greater<T>() to get the k smallest, smallest first.
+ * @return A list of min(k, len(slice)) elements.
+ *
+ * @note Keeps a heap of only k elements, so it runs in O(n log k) time and O(k) memory.
+ */
+template <typename T, typename Compare = std::less<T>>
+VaList<T> topK(const VaSlice<T>& slice, Size k, Compare comp = Compare()) {
+    return detail::topK(slice.begin(), len(slice), k, comp);
+}
+
+template <typename T, typename Compare = std::less<T>>
+VaList<T> topK(const VaList<T>& list, Size k, Compare comp = Compare()) {
+    return detail::topK(list.begin(), len(list), k, comp);
+}
+
+} // namespace va
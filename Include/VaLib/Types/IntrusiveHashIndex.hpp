@@ -0,0 +1,457 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/IntrusiveList.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <functional>
+#include <iterator>
+
+namespace va {
+namespace detail {
+
+class IntrusiveHashBase;
+
+/// @brief Key type produced by the key extractor of a VaIntrusiveHashIndex.
+template <typename T, auto Key>
+using IntrusiveKeyType = tt::Decay<std::invoke_result_t<decltype(Key), const T&>>;
+
+} // namespace detail
+} // namespace va
+
+/**
+ * @brief Link embedded in an object so that the object can be put into a VaIntrusiveHashIndex.
+ *        One hook lets the object be in one index at a time; add one hook per index the
+ *        object should be able to join at once.
+ *
+ * @note The hash of the key is cached in the hook, so rehashing never calls the hash function.
+ * @note Like VaIntrusiveListHook, copies start unlinked and a linked hook unlinks itself when destroyed.
+ */
+class VaIntrusiveHashHook {
+  protected:
+    VaIntrusiveHashHook* next;            ///< Next hook in the bucket
+    VaIntrusiveHashHook** pprev;          ///< Link pointing at this hook (bucket slot or previous hook's next)
+    Size hash;                            ///< Cached hash of the object's key
+    va::detail::IntrusiveHashBase* owner; ///< Index this hook is linked into, or nullptr
+
+    friend class va::detail::IntrusiveHashBase;
+
+  public:
+    VaIntrusiveHashHook() noexcept : next(nullptr), pprev(nullptr), hash(0), owner(nullptr) {}
+    VaIntrusiveHashHook(const VaIntrusiveHashHook&) noexcept : VaIntrusiveHashHook() {}
+    VaIntrusiveHashHook& operator=(const VaIntrusiveHashHook&) noexcept { return *this; }
+
+    ~VaIntrusiveHashHook() { unlink(); }
+
+    /**
+     * @brief Checks whether the hook is currently linked into an index.
+     */
+    inline bool isLinked() const noexcept { return owner != nullptr; }
+
+    /**
+     * @brief Removes the object from the index it is linked into, in O(1).
+     *
+     * @note Does nothing if the hook is not linked.
+     */
+    inline void unlink() noexcept;
+};
+
+namespace va {
+namespace detail {
+
+/**
+ * @brief Type-independent part of VaIntrusiveHashIndex: the bucket array and the chains of hooks.
+ */
+class IntrusiveHashBase {
+  protected:
+    using Hook = VaIntrusiveHashHook;
+
+    Hook** buckets; ///< Array of bucket heads
+    Size cap;       ///< Number of buckets
+    Size size;      ///< Number of linked hooks
+
+    friend class ::VaIntrusiveHashHook;
+
+    explicit IntrusiveHashBase(Size initialCap) : buckets(nullptr), cap(0), size(0) {
+        if (initialCap > 0) {
+            buckets = new Hook*[initialCap]();
+            cap = initialCap;
+        }
+    }
+
+    ~IntrusiveHashBase() {
+        unlinkAll();
+        delete[] buckets;
+    }
+
+    /**
+     * @brief Links a hook at the front of the bucket selected by its hash.
+     */
+    void linkHook(Hook* hook, Size hash) noexcept {
+        Hook** slot = &buckets[hash % cap];
+
+        hook->hash = hash;
+        hook->owner = this;
+        hook->next = *slot;
+        hook->pprev = slot;
+        if (*slot) (*slot)->pprev = &hook->next;
+        *slot = hook;
+        size++;
+    }
+
+    /**
+     * @brief Unlinks a hook of this index and resets it.
+     */
+    void unlinkHook(Hook* hook) noexcept {
+        *hook->pprev = hook->next;
+        if (hook->next) hook->next->pprev = hook->pprev;
+
+        hook->next = nullptr;
+        hook->pprev = nullptr;
+        hook->owner = nullptr;
+        size--;
+    }
+
+    /**
+     * @brief Unlinks every hook, keeping the bucket array.
+     */
+    void unlinkAll() noexcept {
+        for (Size i = 0; i < cap && size > 0; i++) {
+            Hook* current = buckets[i];
+            while (current) {
+                Hook* next = current->next;
+                current->next = nullptr;
+                current->pprev = nullptr;
+                current->owner = nullptr;
+                current = next;
+                size--;
+            }
+            buckets[i] = nullptr;
+        }
+        size = 0;
+    }
+
+    /**
+     * @brief Moves every hook to a new bucket array. Uses the cached hashes only.
+     * @param newCap The new number of buckets.
+     */
+    void rehash(Size newCap) {
+        Hook** newBuckets = new Hook*[newCap]();
+
+        for (Size i = 0; i < cap; i++) {
+            Hook* current = buckets[i];
+            while (current) {
+                Hook* next = current->next;
+                Hook** slot = &newBuckets[current->hash % newCap];
+
+                current->next = *slot;
+                current->pprev = slot;
+                if (*slot) (*slot)->pprev = &current->next;
+                *slot = current;
+
+                current = next;
+            }
+        }
+
+        delete[] buckets;
+        buckets = newBuckets;
+        cap = newCap;
+    }
+
+    /**
+     * @brief Grows the bucket array so that one more hook keeps the load factor under 0.75.
+     */
+    void ensureCapacity() {
+        if (cap == 0) {
+            rehash(32);
+        } else if ((size + 1) * 4 > cap * 3) {
+            rehash(cap * 2);
+        }
+    }
+
+    /**
+     * @brief Takes over the buckets and hooks of another index, leaving it without buckets.
+     *
+     * @note Runs in O(n) since every hook records its owner.
+     */
+    void adopt(IntrusiveHashBase& other) noexcept {
+        buckets = other.buckets;
+        cap = other.cap;
+        size = other.size;
+        for (Size i = 0; i < cap; i++) {
+            for (Hook* current = buckets[i]; current; current = current->next) current->owner = this;
+        }
+
+        other.buckets = nullptr;
+        other.cap = 0;
+        other.size = 0;
+    }
+
+    /**
+     * @brief Returns the first hook at or after a bucket, or nullptr.
+     */
+    Hook* firstFrom(Size bucket) const noexcept {
+        for (; bucket < cap; bucket++) {
+            if (buckets[bucket]) return buckets[bucket];
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Returns the hook following another one in iteration order, or nullptr.
+     */
+    Hook* following(const Hook* hook) const noexcept {
+        if (hook->next) return hook->next;
+        return firstFrom(hook->hash % cap + 1);
+    }
+
+    static inline Hook* chainOf(Hook* hook) noexcept { return hook->next; }
+    static inline Size hashOf(const Hook* hook) noexcept { return hook->hash; }
+    inline bool isOwnerOf(const Hook& hook) const noexcept { return hook.owner == this; }
+};
+
+} // namespace detail
+} // namespace va
+
+inline void VaIntrusiveHashHook::unlink() noexcept {
+    if (owner) owner->unlinkHook(this);
+}
+
+/**
+ * @class VaIntrusiveHashIndex A hash index over objects that links them through a hook embedded in them.
+ *        Lookups go through a regular bucket array, but the chains are made of the hooks, so inserting
+ *        and removing never allocate per object, and an object can be removed in O(1) given only a
+ *        reference to it.
+ *
+ * @tparam T Type of the indexed objects.
+ * @tparam Key Pointer to the key member of T, or to a const member function returning the key.
+ * @tparam Member Pointer to the VaIntrusiveHashHook member of T used by this index.
+ * @tparam Hash The hash function type (defaults to `VaHash` of the key type).
+ *
+ * @code
+ * struct Connection {
+ *     int fd;
+ *     VaString peer;
+ *     VaIntrusiveHashHook byFd;
+ *     VaIntrusiveHashHook byPeer;
+ * };
+ *
+ * VaIntrusiveHashIndex<Connection, &Connection::fd, &Connection::byFd> connectionsByFd;
+ * VaIntrusiveHashIndex<Connection, &Connection::peer, &Connection::byPeer> connectionsByPeer;
+ * @endcode
+ *
+ * @note The only allocation is the bucket array, which grows when the load factor exceeds 0.75.
+ *       Call reserve() up front to make insertion allocation-free.
+ * @note The index does not own the objects. Destroying an object unlinks it automatically,
+ *       destroying or clearing the index only unlinks the objects.
+ * @note Mapping a hook back to its object needs the Itanium C++ ABI (GCC, Clang); see va::detail::memberOffset.
+ * @warning The key of an object must not change while the object is indexed.
+ */
+template <
+    typename T, auto Key, VaIntrusiveHashHook T::* Member,
+    typename Hash = VaHash<va::detail::IntrusiveKeyType<T, Key>>
+>
+class VaIntrusiveHashIndex : protected va::detail::IntrusiveHashBase {
+  public:
+    using KeyType = va::detail::IntrusiveKeyType<T, Key>;
+
+  protected:
+    Hash hashFunc; ///< Hash function used to compute bucket indices from keys.
+
+    static inline Hook* hookOf(T& obj) noexcept { return &(obj.*Member); }
+    static inline const Hook* hookOf(const T& obj) noexcept { return &(obj.*Member); }
+    static inline T* objectOf(Hook* hook) noexcept { return va::detail::ownerOf(hook, Member); }
+    static inline decltype(auto) keyOf(const T& obj) { return std::invoke(Key, obj); }
+
+    /**
+     * @brief Finds the hook of the object with a given key.
+     * @param key The key to search for.
+     * @param hash The hash of key.
+     * @return The hook, or nullptr if no object has this key.
+     */
+    Hook* findHook(const KeyType& key, Size hash) const {
+        if (cap == 0) return nullptr;
+
+        for (Hook* current = buckets[hash % cap]; current; current = chainOf(current)) {
+            if (hashOf(current) == hash && keyOf(*objectOf(current)) == key) return current;
+        }
+        return nullptr;
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty index with a given number of buckets.
+     * @param initialCap Initial number of hash buckets (default is 32).
+     */
+    VaIntrusiveHashIndex(Size initialCap = 32) : IntrusiveHashBase(initialCap) {}
+
+    VaIntrusiveHashIndex(const VaIntrusiveHashIndex&) = delete;
+    VaIntrusiveHashIndex& operator=(const VaIntrusiveHashIndex&) = delete;
+
+    /**
+     * @brief Move constructor. Takes over the buckets and every object of another index.
+     * @param other The index to move from. It is left empty and without buckets.
+     *
+     * @note Runs in O(n) since every hook records the index it belongs to.
+     */
+    VaIntrusiveHashIndex(VaIntrusiveHashIndex&& other) noexcept : IntrusiveHashBase(0), hashFunc(std::move(other.hashFunc)) {
+        adopt(other);
+    }
+
+    VaIntrusiveHashIndex& operator=(VaIntrusiveHashIndex&& other) noexcept {
+        if (this != &other) {
+            unlinkAll();
+            delete[] buckets;
+            hashFunc = std::move(other.hashFunc);
+            adopt(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Indexes an object under its key.
+     * @param obj The object to index.
+     * @return true if the object was linked, false if another object with the same key is already indexed.
+     *
+     * @throws ValueError If the hook of obj is already linked into an index.
+     * @note Allocates only when the bucket array has to grow.
+     */
+    bool insert(T& obj) {
+        if (hookOf(obj)->isLinked()) throw ValueError(VaStaticMessage("object is already linked into an intrusive index"));
+
+        decltype(auto) key = keyOf(obj);
+        Size hash = hashFunc(key);
+        if (findHook(key, hash)) return false;
+
+        ensureCapacity();
+        linkHook(hookOf(obj), hash);
+        return true;
+    }
+
+    /**
+     * @brief Finds the object with a given key.
+     * @param key The key to search for.
+     * @return Pointer to the object, or nullptr if not found.
+     */
+    T* find(const KeyType& key) const {
+        Hook* hook = findHook(key, hashFunc(key));
+        return hook ? objectOf(hook) : nullptr;
+    }
+
+    /**
+     * @brief Returns the object with a given key.
+     * @param key The key to search for.
+     * @return Reference to the object.
+     *
+     * @throws KeyNotFoundError If no object has this key.
+     */
+    T& at(const KeyType& key) const {
+        Hook* hook = findHook(key, hashFunc(key));
+        if (!hook) throw KeyNotFoundError();
+        return *objectOf(hook);
+    }
+
+    /**
+     * @brief Checks if an object with the given key is indexed.
+     */
+    inline bool contains(const KeyType& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Checks in O(1) whether an object is linked into this index.
+     */
+    inline bool owns(const T& obj) const noexcept { return isOwnerOf(*hookOf(obj)); }
+
+    /**
+     * @brief Unlinks the object with a given key.
+     * @param key The key to remove.
+     * @return Pointer to the unlinked object, or nullptr if not found.
+     *
+     * @note Does nothing if key is not found.
+     */
+    T* del(const KeyType& key) {
+        Hook* hook = findHook(key, hashFunc(key));
+        if (!hook) return nullptr;
+
+        unlinkHook(hook);
+        return objectOf(hook);
+    }
+
+    /**
+     * @brief Unlinks an object from this index in O(1), without hashing its key.
+     * @param obj An object linked into this index.
+     *
+     * @throws ValueError If obj is not in this index.
+     */
+    void unlink(T& obj) {
+        if (!owns(obj)) throw ValueError(VaStaticMessage("object is not linked into this index"));
+        unlinkHook(hookOf(obj));
+    }
+
+    /**
+     * @brief Grows the bucket array so that the given number of objects fit without rehashing.
+     * @param minCount The number of objects to make room for.
+     */
+    void reserve(Size minCount) {
+        Size needed = minCount + minCount / 3 + 1;
+        if (needed > cap) rehash(needed);
+    }
+
+    /**
+     * @brief Unlinks every object. The bucket array is kept.
+     */
+    inline void clear() noexcept { unlinkAll(); }
+
+    inline bool isEmpty() const noexcept { return size == 0; }
+    inline Size getLength() const noexcept { return size; }
+
+  public friends:
+    friend inline Size len(const VaIntrusiveHashIndex& index) { return index.size; }
+    friend inline Size cap(const VaIntrusiveHashIndex& index) { return index.cap; }
+
+  public iterators:
+    /**
+     * @brief Forward iterator over the indexed objects, in bucket order.
+     *
+     * @warning Unlinking the object under the iterator invalidates it; advance first.
+     */
+    class Iterator {
+      protected:
+        Hook* current;
+        const VaIntrusiveHashIndex* index;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator(Hook* hook, const VaIntrusiveHashIndex* index) : current(hook), index(index) {}
+
+        T& operator*() const { return *objectOf(current); }
+        T* operator->() const { return objectOf(current); }
+
+        Iterator& operator++() {
+            current = index->following(current);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const { return current == other.current; }
+        bool operator!=(const Iterator& other) const { return current != other.current; }
+    };
+
+    inline Iterator begin() const { return Iterator(firstFrom(0), this); }
+    inline Iterator end() const { return Iterator(nullptr, this); }
+};
@@ -0,0 +1,550 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <iterator>
+
+namespace va {
+namespace detail {
+
+class IntrusiveListBase;
+
+#ifdef __GXX_ABI_VERSION
+/// Whether pointers to data members hold a plain byte offset, as in the Itanium C++ ABI
+inline constexpr bool memberPointersAreOffsets = true;
+#else
+inline constexpr bool memberPointersAreOffsets = false;
+#endif
+
+/**
+ * @brief Returns the byte offset of a data member inside its enclosing object.
+ *        Read from the member pointer itself, which the Itanium C++ ABI (GCC, Clang) represents as
+ *        that offset: no object is needed, and it works for non-standard-layout types where offsetof
+ *        does not. For a member pointer known at compile time, this folds to a constant.
+ *
+ * @warning Other ABIs are rejected at compile time. MSVC, for one, changes the representation of
+ *          member pointers with the inheritance model of the class.
+ */
+template <typename T, typename M>
+inline Size memberOffset(M T::* member) noexcept {
+    static_assert(memberPointersAreOffsets && sizeof(member) == sizeof(std::ptrdiff_t),
+                  "intrusive containers need the Itanium C++ ABI, where data member pointers are plain offsets");
+    return static_cast<Size>(std::bit_cast<std::ptrdiff_t>(member));
+}
+
+/**
+ * @brief Converts a pointer to a member back to a pointer to the enclosing object.
+ */
+// @{
+template <typename T, typename M>
+inline T* ownerOf(M* field, M T::* member) noexcept {
+    return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(field) - memberOffset(member));
+}
+
+template <typename T, typename M>
+inline const T* ownerOf(const M* field, M T::* member) noexcept {
+    return reinterpret_cast<const T*>(reinterpret_cast<const unsigned char*>(field) - memberOffset(member));
+}
+// @}
+
+} // namespace detail
+} // namespace va
+
+/**
+ * @brief Link embedded in an object so that the object can be put into a VaIntrusiveList.
+ *        One hook lets the object be in one list at a time; add one hook per list the
+ *        object should be able to join at once.
+ *
+ * @note Copying an object does not copy its membership: a copied hook starts unlinked and
+ *       assigning to a hook keeps its current membership.
+ * @note A linked hook unlinks itself when destroyed, so an object may be destroyed while it is still in a list.
+ */
+class VaIntrusiveListHook {
+  protected:
+    VaIntrusiveListHook* next;             ///< Next hook in the list
+    VaIntrusiveListHook* prev;             ///< Previous hook in the list
+    va::detail::IntrusiveListBase* owner;  ///< List this hook is linked into, or nullptr
+
+    friend class va::detail::IntrusiveListBase;
+
+  public:
+    VaIntrusiveListHook() noexcept : next(nullptr), prev(nullptr), owner(nullptr) {}
+    VaIntrusiveListHook(const VaIntrusiveListHook&) noexcept : VaIntrusiveListHook() {}
+    VaIntrusiveListHook& operator=(const VaIntrusiveListHook&) noexcept { return *this; }
+
+    ~VaIntrusiveListHook() { unlink(); }
+
+    /**
+     * @brief Checks whether the hook is currently linked into a list.
+     */
+    inline bool isLinked() const noexcept { return owner != nullptr; }
+
+    /**
+     * @brief Removes the object from the list it is linked into, in O(1).
+     *
+     * @note Does nothing if the hook is not linked.
+     */
+    inline void unlink() noexcept;
+};
+
+namespace va {
+namespace detail {
+
+/**
+ * @brief Type-independent part of VaIntrusiveList: keeps the hooks in order and counts them.
+ */
+class IntrusiveListBase {
+  protected:
+    using Hook = VaIntrusiveListHook;
+
+    Hook* head; ///< First hook in the list
+    Hook* tail; ///< Last hook in the list
+    Size len;   ///< Number of linked hooks
+
+    friend class ::VaIntrusiveListHook;
+
+    IntrusiveListBase() noexcept : head(nullptr), tail(nullptr), len(0) {}
+
+    /**
+     * @brief Links a hook right before another one (at the end if target is nullptr).
+     */
+    void linkBefore(Hook* target, Hook* hook) noexcept {
+        Hook* prev = target ? target->prev : tail;
+
+        hook->next = target;
+        hook->prev = prev;
+        hook->owner = this;
+
+        if (prev) prev->next = hook; else head = hook;
+        if (target) target->prev = hook; else tail = hook;
+        len++;
+    }
+
+    /**
+     * @brief Unlinks a hook of this list and resets it.
+     */
+    void unlinkHook(Hook* hook) noexcept {
+        if (hook->prev) hook->prev->next = hook->next; else head = hook->next;
+        if (hook->next) hook->next->prev = hook->prev; else tail = hook->prev;
+
+        hook->next = hook->prev = nullptr;
+        hook->owner = nullptr;
+        len--;
+    }
+
+    /**
+     * @brief Unlinks every hook.
+     */
+    void unlinkAll() noexcept {
+        Hook* current = head;
+        while (current) {
+            Hook* next = current->next;
+            current->next = current->prev = nullptr;
+            current->owner = nullptr;
+            current = next;
+        }
+
+        head = tail = nullptr;
+        len = 0;
+    }
+
+    /**
+     * @brief Takes over every hook of another list, leaving it empty.
+     *
+     * @note Runs in O(n) since every hook records its owner.
+     */
+    void adopt(IntrusiveListBase& other) noexcept {
+        head = other.head;
+        tail = other.tail;
+        len = other.len;
+        for (Hook* current = head; current; current = current->next) current->owner = this;
+
+        other.head = other.tail = nullptr;
+        other.len = 0;
+    }
+
+    static inline Hook* nextOf(const Hook* hook) noexcept { return hook->next; }
+    static inline Hook* prevOf(const Hook* hook) noexcept { return hook->prev; }
+    inline bool isOwnerOf(const Hook& hook) const noexcept { return hook.owner == this; }
+};
+
+} // namespace detail
+} // namespace va
+
+inline void VaIntrusiveListHook::unlink() noexcept {
+    if (owner) owner->unlinkHook(this);
+}
+
+/**
+ * @class VaIntrusiveList A doubly linked list that links objects through a hook embedded in them.
+ *        The list never allocates, copies or destroys the objects: inserting and removing only
+ *        rewires the hooks, and any object can be removed in O(1) given only a reference to it.
+ *
+ * @tparam T Type of the linked objects.
+ * @tparam Member Pointer to the VaIntrusiveListHook member of T used by this list.
+ *
+ * @code
+ * struct Timer {
+ *     int deadline;
+ *     VaIntrusiveListHook byDeadline;
+ *     VaIntrusiveListHook byOwner;
+ * };
+ *
+ * VaIntrusiveList<Timer, &Timer::byDeadline> pending;
+ * VaIntrusiveList<Timer, &Timer::byOwner> owned;
+ * @endcode
+ *
+ * @note The list does not own the objects; they must outlive their membership (destroying an
+ *       object unlinks it automatically). Destroying or clearing the list only unlinks the objects.
+ * @note Mapping a hook back to its object needs the Itanium C++ ABI (GCC, Clang); see va::detail::memberOffset.
+ */
+template <typename T, VaIntrusiveListHook T::* Member>
+class VaIntrusiveList : protected va::detail::IntrusiveListBase {
+  protected:
+    static inline Hook* hookOf(T& obj) noexcept { return &(obj.*Member); }
+    static inline const Hook* hookOf(const T& obj) noexcept { return &(obj.*Member); }
+    static inline T* objectOf(Hook* hook) noexcept { return va::detail::ownerOf(hook, Member); }
+    static inline const T* objectOf(const Hook* hook) noexcept { return va::detail::ownerOf(hook, Member); }
+
+    /**
+     * @brief Throws if the object can not be linked.
+     */
+    static void checkUnlinked(const T& obj) {
+        if (hookOf(obj)->isLinked()) throw ValueError(VaStaticMessage("object is already linked into an intrusive list"));
+    }
+
+    /**
+     * @brief Throws if the object is not linked into this list.
+     */
+    void checkOwned(const T& obj) const {
+        if (!isOwnerOf(*hookOf(obj))) throw ValueError(VaStaticMessage("object is not linked into this list"));
+    }
+
+  public:
+    VaIntrusiveList() noexcept = default;
+    VaIntrusiveList(const VaIntrusiveList&) = delete;
+    VaIntrusiveList& operator=(const VaIntrusiveList&) = delete;
+
+    /**
+     * @brief Move constructor. Takes over every object of another list.
+     * @param other The list to move from. It is left empty.
+     *
+     * @note Runs in O(n) since every hook records the list it belongs to.
+     */
+    VaIntrusiveList(VaIntrusiveList&& other) noexcept { adopt(other); }
+
+    VaIntrusiveList& operator=(VaIntrusiveList&& other) noexcept {
+        if (this != &other) {
+            unlinkAll();
+            adopt(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor. Unlinks every object; the objects themselves are left untouched.
+     */
+    ~VaIntrusiveList() { unlinkAll(); }
+
+    /**
+     * @brief Links an object at the end of the list.
+     * @param obj The object to link.
+     *
+     * @throws ValueError If the hook of obj is already linked into a list.
+     */
+    void append(T& obj) {
+        checkUnlinked(obj);
+        linkBefore(nullptr, hookOf(obj));
+    }
+
+    /**
+     * @brief Links an object at the front of the list.
+     * @param obj The object to link.
+     *
+     * @throws ValueError If the hook of obj is already linked into a list.
+     */
+    void prepend(T& obj) {
+        checkUnlinked(obj);
+        linkBefore(head, hookOf(obj));
+    }
+
+    /**
+     * @brief Links an object right before another object of this list.
+     * @param pos An object linked into this list.
+     * @param obj The object to link.
+     *
+     * @throws ValueError If pos is not in this list or obj is already linked into a list.
+     */
+    void insertBefore(T& pos, T& obj) {
+        checkOwned(pos);
+        checkUnlinked(obj);
+        linkBefore(hookOf(pos), hookOf(obj));
+    }
+
+    /**
+     * @brief Links an object right after another object of this list.
+     * @param pos An object linked into this list.
+     * @param obj The object to link.
+     *
+     * @throws ValueError If pos is not in this list or obj is already linked into a list.
+     */
+    void insertAfter(T& pos, T& obj) {
+        checkOwned(pos);
+        checkUnlinked(obj);
+        linkBefore(IntrusiveListBase::nextOf(hookOf(pos)), hookOf(obj));
+    }
+
+    /**
+     * @brief Unlinks an object from this list in O(1).
+     * @param obj An object linked into this list.
+     *
+     * @throws ValueError If obj is not in this list.
+     */
+    void unlink(T& obj) {
+        checkOwned(obj);
+        unlinkHook(hookOf(obj));
+    }
+
+    /**
+     * @brief Unlinks and returns the last object.
+     * @return Reference to the unlinked object.
+     *
+     * @throws ValueError If the list is empty.
+     */
+    T& pop() {
+        if (len == 0) throw ValueError(VaStaticMessage("pop() on empty list"));
+        Hook* hook = tail;
+        unlinkHook(hook);
+        return *objectOf(hook);
+    }
+
+    /**
+     * @brief Unlinks and returns the first object.
+     * @return Reference to the unlinked object.
+     *
+     * @throws ValueError If the list is empty.
+     */
+    T& shift() {
+        if (len == 0) throw ValueError(VaStaticMessage("shift() on empty list"));
+        Hook* hook = head;
+        unlinkHook(hook);
+        return *objectOf(hook);
+    }
+
+    /**
+     * @brief Unlinks and returns the last/first object, without throwing.
+     * @return Pointer to the unlinked object, or nullptr if the list is empty.
+     */
+    // @{
+    T* tryPop() noexcept {
+        if (len == 0) return nullptr;
+        Hook* hook = tail;
+        unlinkHook(hook);
+        return objectOf(hook);
+    }
+
+    T* tryShift() noexcept {
+        if (len == 0) return nullptr;
+        Hook* hook = head;
+        unlinkHook(hook);
+        return objectOf(hook);
+    }
+    // @}
+
+    /**
+     * @brief Returns the first object.
+     *
+     * @throws ValueError If the list is empty.
+     */
+    // @{
+    T& front() {
+        if (len == 0) throw ValueError(VaStaticMessage("front() on empty list"));
+        return *objectOf(head);
+    }
+
+    const T& front() const {
+        if (len == 0) throw ValueError(VaStaticMessage("front() on empty list"));
+        return *objectOf(static_cast<const Hook*>(head));
+    }
+    // @}
+
+    /**
+     * @brief Returns the last object.
+     *
+     * @throws ValueError If the list is empty.
+     */
+    // @{
+    T& back() {
+        if (len == 0) throw ValueError(VaStaticMessage("back() on empty list"));
+        return *objectOf(tail);
+    }
+
+    const T& back() const {
+        if (len == 0) throw ValueError(VaStaticMessage("back() on empty list"));
+        return *objectOf(static_cast<const Hook*>(tail));
+    }
+    // @}
+
+    /**
+     * @brief Returns the first/last object, or nullptr if the list is empty.
+     */
+    inline T* tryFront() noexcept { return len ? objectOf(head) : nullptr; }
+    inline const T* tryFront() const noexcept { return len ? objectOf(static_cast<const Hook*>(head)) : nullptr; }
+    inline T* tryBack() noexcept { return len ? objectOf(tail) : nullptr; }
+    inline const T* tryBack() const noexcept { return len ? objectOf(static_cast<const Hook*>(tail)) : nullptr; }
+
+    /**
+     * @brief Returns the object following another one in this list.
+     * @param obj An object linked into this list.
+     * @return Pointer to the next object, or nullptr if obj is the last one.
+     *
+     * @throws ValueError If obj is not in this list.
+     */
+    T* nextOf(const T& obj) const {
+        checkOwned(obj);
+        Hook* hook = IntrusiveListBase::nextOf(hookOf(obj));
+        return hook ? objectOf(hook) : nullptr;
+    }
+
+    /**
+     * @brief Returns the object preceding another one in this list.
+     * @param obj An object linked into this list.
+     * @return Pointer to the previous object, or nullptr if obj is the first one.
+     *
+     * @throws ValueError If obj is not in this list.
+     */
+    T* prevOf(const T& obj) const {
+        checkOwned(obj);
+        Hook* hook = IntrusiveListBase::prevOf(hookOf(obj));
+        return hook ? objectOf(hook) : nullptr;
+    }
+
+    /**
+     * @brief Checks in O(1) whether an object is linked into this list.
+     */
+    inline bool owns(const T& obj) const noexcept { return isOwnerOf(*hookOf(obj)); }
+
+    /**
+     * @brief Unlinks every object.
+     */
+    inline void clear() noexcept { unlinkAll(); }
+
+    inline bool isEmpty() const noexcept { return len == 0; }
+    inline Size getLength() const noexcept { return len; }
+
+  public friends:
+    friend inline Size len(const VaIntrusiveList& list) { return list.len; }
+
+  public iterators:
+    /**
+     * @brief Bidirectional iterator over the linked objects.
+     *
+     * @warning Unlinking the object under the iterator invalidates it; advance first.
+     */
+    class Iterator {
+      protected:
+        Hook* current;
+        const VaIntrusiveList* list;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator(Hook* hook, const VaIntrusiveList* list) : current(hook), list(list) {}
+
+        T& operator*() const { return *objectOf(current); }
+        T* operator->() const { return objectOf(current); }
+
+        Iterator& operator++() {
+            current = IntrusiveListBase::nextOf(current);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        Iterator& operator--() {
+            current = current ? IntrusiveListBase::prevOf(current) : list->tail;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const { return current == other.current; }
+        bool operator!=(const Iterator& other) const { return current != other.current; }
+    };
+
+    /**
+     * @brief Read-only bidirectional iterator over the linked objects.
+     *
+     * @warning Unlinking the object under the iterator invalidates it; advance first.
+     */
+    class ConstIterator {
+      protected:
+        const Hook* current;
+        const VaIntrusiveList* list;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        ConstIterator(const Hook* hook, const VaIntrusiveList* list) : current(hook), list(list) {}
+
+        const T& operator*() const { return *objectOf(current); }
+        const T* operator->() const { return objectOf(current); }
+
+        ConstIterator& operator++() {
+            current = IntrusiveListBase::nextOf(current);
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        ConstIterator& operator--() {
+            current = current ? IntrusiveListBase::prevOf(current) : list->tail;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const ConstIterator& other) const { return current == other.current; }
+        bool operator!=(const ConstIterator& other) const { return current != other.current; }
+    };
+
+    inline Iterator begin() { return Iterator(head, this); }
+    inline Iterator end() { return Iterator(nullptr, this); }
+
+    inline ConstIterator begin() const { return ConstIterator(head, this); }
+    inline ConstIterator end() const { return ConstIterator(nullptr, this); }
+
+    inline ConstIterator cbegin() const { return ConstIterator(head, this); }
+    inline ConstIterator cend() const { return ConstIterator(nullptr, this); }
+};
@@ -0,0 +1,358 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/CacheStats.hpp>
+#include <VaLib/Types/IntrusiveHashIndex.hpp>
+#include <VaLib/Types/IntrusiveList.hpp>
+#include <VaLib/Types/LruCache.hpp>
+
+#include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/Mem/UniquePtr.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <utility>
+
+/**
+ * @class VaLfuCache A bounded key-value cache that evicts the least frequently used entry first.
+ *
+ * @tparam K The key type (must support equality comparison and hashing).
+ * @tparam V The value type.
+ * @tparam Hash The hash function type (defaults to `VaHash<K>`).
+ *
+ * Every operation is O(1): entries are grouped into buckets of equal use count, kept in a list
+ * sorted by count. A hit moves the entry to the bucket of the next count (creating it if needed),
+ * and eviction takes an entry from the first bucket. Within a bucket the entries are in recency
+ * order, so ties are broken by evicting the least recently used entry.
+ *
+ * Limits, weigher, eviction callback and statistics work as in VaLruCache.
+ *
+ * @note Each entry is one node, indexed by key in a VaIntrusiveHashIndex and linked into its
+ *       bucket through a VaIntrusiveListHook, so promoting an entry never allocates.
+ * @warning Not thread-safe; use VaConcurrentLfuCache for a cache shared between threads.
+ */
+template <typename K, typename V, typename Hash = VaHash<K>>
+class VaLfuCache {
+  public:
+    using KeyType = K;
+    using ValueType = V;
+    using HashType = Hash;
+    using Weigher = VaFunc<Size(const K&, const V&)>;
+    using EvictionCallback = VaFunc<void(const K&, V&)>;
+
+  protected:
+    struct Bucket;
+
+    struct Node {
+        K key;
+        V value;
+        Size cost;
+        Bucket* bucket = nullptr;
+        VaIntrusiveHashHook byKey;
+        VaIntrusiveListHook inBucket;
+
+        Node(const K& key, const V& value, Size cost) : key(key), value(value), cost(cost) {}
+    };
+
+    struct Bucket {
+        Size frequency;
+        VaIntrusiveList<Node, &Node::inBucket> nodes; ///< Front is the least recently used
+        VaIntrusiveListHook byFrequency;
+
+        explicit Bucket(Size frequency) : frequency(frequency) {}
+    };
+
+    VaIntrusiveHashIndex<Node, &Node::key, &Node::byKey, Hash> index;
+    VaIntrusiveList<Bucket, &Bucket::byFrequency> buckets; ///< Sorted by ascending frequency
+    Bucket* spare = nullptr; ///< An emptied bucket kept for reuse, so that promotions rarely allocate
+    Size maxEntries;
+    Size maxBytes;
+    Size bytes = 0;
+    Weigher weigher;
+    EvictionCallback onEvict;
+    VaCacheStats stats;
+
+    inline Size costOf(const K& key, const V& value) const {
+        return weigher ? weigher(key, value) : va::detail::cacheDefaultCost<K, V>;
+    }
+
+    Bucket* makeBucket(Size frequency) {
+        if (!spare) return new Bucket(frequency);
+
+        Bucket* bucket = spare;
+        spare = nullptr;
+        bucket->frequency = frequency;
+        return bucket;
+    }
+
+    void dropBucket(Bucket* bucket) {
+        buckets.unlink(*bucket);
+        if (spare) {
+            delete bucket;
+        } else {
+            spare = bucket;
+        }
+    }
+
+    /**
+     * @brief Moves a node to the bucket of the next frequency, in O(1).
+     */
+    void promote(Node& node) {
+        Bucket* from = node.bucket;
+        Bucket* to = buckets.nextOf(*from);
+        bool nextExists = to && to->frequency == from->frequency + 1;
+
+        if (!nextExists && from->nodes.getLength() == 1) { // The node is alone: renumber its bucket
+            from->frequency++;
+            return;
+        }
+        if (!nextExists) {
+            to = makeBucket(from->frequency + 1);
+            buckets.insertAfter(*from, *to);
+        }
+
+        from->nodes.unlink(node);
+        to->nodes.append(node);
+        node.bucket = to;
+        if (from->nodes.isEmpty()) dropBucket(from);
+    }
+
+    /**
+     * @brief Unlinks and destroys a node.
+     */
+    void removeNode(Node& node) {
+        Bucket* bucket = node.bucket;
+        bytes -= node.cost;
+        delete &node; // The hooks unlink the node from the index and the bucket
+        if (bucket->nodes.isEmpty()) dropBucket(bucket);
+    }
+
+    /**
+     * @brief Finds the entry to evict next: the least recently used one of the lowest frequency.
+     * @param keep An entry that must not be chosen, or nullptr.
+     * @return The entry, or nullptr if there is none other than keep.
+     */
+    Node* victim(const Node* keep) {
+        if (buckets.isEmpty()) return nullptr;
+
+        Bucket& first = buckets.front();
+        Node& candidate = first.nodes.front();
+        if (&candidate != keep) return &candidate;
+        if (Node* next = first.nodes.nextOf(candidate)) return next;
+
+        Bucket* second = buckets.nextOf(first);
+        return second ? &second->nodes.front() : nullptr;
+    }
+
+    /**
+     * @brief Evicts entries until the given number of entries and bytes fit.
+     * @param extraEntries Number of entries about to be added (0 or 1).
+     * @param extraBytes Cost of the entries about to be added.
+     * @param keep An entry that must not be evicted, or nullptr.
+     */
+    void makeRoom(Size extraEntries, Size extraBytes, const Node* keep = nullptr) {
+        while ((maxEntries && index.getLength() + extraEntries > maxEntries) || (maxBytes && bytes + extraBytes > maxBytes)) {
+            Node* node = victim(keep);
+            if (!node) return;
+
+            if (onEvict) onEvict(node->key, node->value);
+            removeNode(*node);
+            stats.evictions++;
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty cache.
+     * @param maxEntries Maximum number of entries; 0 means no entry limit.
+     * @param maxBytes Maximum total cost of the entries; 0 means no byte limit.
+     * @param weigher Computes the cost of an entry; defaults to sizeof(K) + sizeof(V).
+     */
+    explicit VaLfuCache(Size maxEntries, Size maxBytes = 0, Weigher weigher = nullptr)
+        : maxEntries(maxEntries), maxBytes(maxBytes), weigher(std::move(weigher)) {
+        if (maxEntries) index.reserve(maxEntries);
+    }
+
+    VaLfuCache(const VaLfuCache&) = delete;
+    VaLfuCache& operator=(const VaLfuCache&) = delete;
+
+    ~VaLfuCache() {
+        clear();
+        delete spare;
+    }
+
+    /**
+     * @brief Looks up an entry and counts one more use of it.
+     * @param key The key to look up.
+     * @return Pointer to the value, or nullptr on a miss. Valid until the entry is removed.
+     *
+     * @note Counts a hit or a miss.
+     */
+    V* get(const K& key) {
+        Node* node = index.find(key);
+        if (!node) {
+            stats.misses++;
+            return nullptr;
+        }
+
+        stats.hits++;
+        promote(*node);
+        return &node->value;
+    }
+
+    /**
+     * @brief Looks up an entry without changing its use count or the statistics.
+     * @param key The key to look up.
+     * @return Pointer to the value, or nullptr if the key is not cached.
+     */
+    // @{
+    V* peek(const K& key) {
+        Node* node = index.find(key);
+        return node ? &node->value : nullptr;
+    }
+    const V* peek(const K& key) const {
+        const Node* node = index.find(key);
+        return node ? &node->value : nullptr;
+    }
+    // @}
+
+    /**
+     * @brief Inserts or replaces an entry. Replacing counts as a use of the entry; a new entry starts with one use.
+     * @param key The key.
+     * @param value The value.
+     * @return true if the entry was stored; false if it alone exceeds the byte limit,
+     *         in which case an older entry under the same key is removed as well.
+     *
+     * @note Evicts least frequently used entries until the new entry fits. A new entry is never
+     *       evicted to make room for itself, even though it has the lowest count.
+     */
+    bool put(const K& key, const V& value) {
+        Size cost = costOf(key, value);
+        if (maxBytes && cost > maxBytes) {
+            del(key);
+            return false;
+        }
+
+        if (Node* node = index.find(key)) {
+            node->value = value;
+            bytes = bytes - node->cost + cost;
+            node->cost = cost;
+            promote(*node);
+            makeRoom(0, 0, node); // The updated entry fits alone, so only others are evicted
+            return true;
+        }
+
+        makeRoom(1, cost);
+
+        // Owned until it is linked everywhere: if indexing or creating the bucket throws,
+        // destroying the node unlinks it from the index again
+        VaUniquePtr<Node> owned(new Node(key, value, cost));
+        Node* node = owned.get();
+        index.insert(*node);
+
+        Bucket* first = buckets.isEmpty() ? nullptr : &buckets.front();
+        if (!first || first->frequency != 1) {
+            first = makeBucket(1);
+            buckets.prepend(*first);
+        }
+        first->nodes.append(*node);
+        node->bucket = first;
+        owned.release();
+        bytes += cost;
+        return true;
+    }
+
+    /**
+     * @brief Returns the cached value for key, computing and storing it on a miss.
+     * @param key The key.
+     * @param make Callable returning the value for key; only called on a miss.
+     * @return The cached or computed value.
+     */
+    template <typename Fn>
+    V getOrCompute(const K& key, Fn&& make) {
+        if (V* value = get(key)) return *value;
+
+        V value = make(key);
+        put(key, value);
+        return value;
+    }
+
+    /**
+     * @brief Removes an entry. The eviction callback is not called.
+     * @param key The key to remove.
+     * @return true if the key was cached.
+     */
+    bool del(const K& key) {
+        Node* node = index.find(key);
+        if (!node) return false;
+
+        removeNode(*node);
+        return true;
+    }
+
+    /**
+     * @brief Checks whether a key is cached, without changing its use count or the statistics.
+     */
+    inline bool contains(const K& key) const { return index.contains(key); }
+
+    /**
+     * @brief Number of uses of a cached entry (1 after insertion, +1 per get() hit or put()).
+     * @return The use count, or 0 if the key is not cached.
+     */
+    Size getFrequency(const K& key) const {
+        const Node* node = index.find(key);
+        return node ? node->bucket->frequency : 0;
+    }
+
+    /**
+     * @brief Removes every entry. The eviction callback is not called; the statistics are kept.
+     */
+    void clear() {
+        while (!buckets.isEmpty()) {
+            Bucket& bucket = buckets.shift();
+            while (!bucket.nodes.isEmpty()) delete &bucket.nodes.shift();
+            delete &bucket;
+        }
+        bytes = 0;
+    }
+
+    /**
+     * @brief Changes the limits, evicting least frequently used entries until the cache fits.
+     * @param maxEntries New maximum number of entries; 0 means no entry limit.
+     * @param maxBytes New maximum total cost; 0 means no byte limit.
+     */
+    void setCapacity(Size maxEntries, Size maxBytes = 0) {
+        this->maxEntries = maxEntries;
+        this->maxBytes = maxBytes;
+        if (maxEntries) index.reserve(maxEntries);
+        makeRoom(0, 0);
+    }
+
+    /**
+     * @brief Sets the function called with every entry evicted to make room, right before it is destroyed.
+     *
+     * @warning The callback must not modify the cache.
+     */
+    inline void setEvictionCallback(EvictionCallback callback) { onEvict = std::move(callback); }
+
+    inline void resetStats() noexcept { stats = VaCacheStats(); }
+
+    inline const VaCacheStats& getStats() const noexcept { return stats; }
+    inline Size getSize() const noexcept { return index.getLength(); }
+    inline Size getBytes() const noexcept { return bytes; }
+    inline Size getMaxEntries() const noexcept { return maxEntries; }
+    inline Size getMaxBytes() const noexcept { return maxBytes; }
+    inline bool isEmpty() const noexcept { return index.isEmpty(); }
+
+    /**
+     * @brief Key of the entry that would be evicted next.
+     * @throws ValueError If the cache is empty.
+     */
+    inline const K& leastFrequentKey() const { return buckets.front().nodes.front().key; }
+
+  public friends:
+    friend inline Size len(const VaLfuCache& cache) { return cache.getSize(); }
+};
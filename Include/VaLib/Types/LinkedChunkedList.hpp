@@ -75,7 +75,7 @@ class VaLinkedChunkedList {
         delete chunk;
     }
 
-    Chunk* chunkContainsIndex(Size index, Size* offset = nullptr) {
+    Chunk* chunkContainsIndex(Size index, Size* offset = nullptr) const noexcept {
         if (!head) return nullptr;
         if (index < len / 2) {
             Chunk* node = head;
@@ -622,6 +622,27 @@ class VaLinkedChunkedList {
         return node->data[offset];
     }
 
+    /// @brief Like at(), but returns nullptr instead of throwing if index is out of bounds.
+    // @{
+    T* tryAt(int32 index) noexcept {
+        if (index < 0) index += static_cast<int32>(len);
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+
+        Size offset = 0;
+        Chunk* node = chunkContainsIndex(static_cast<Size>(index), &offset);
+        return &node->data[offset];
+    }
+
+    const T* tryAt(int32 index) const noexcept {
+        if (index < 0) index += static_cast<int32>(len);
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+
+        Size offset = 0;
+        Chunk* node = chunkContainsIndex(static_cast<Size>(index), &offset);
+        return &node->data[offset];
+    }
+    // @}
+
     void clear() noexcept {
         while (head) {
             Chunk* next = head->next;
@@ -634,32 +655,41 @@ class VaLinkedChunkedList {
 
     T& front() {
         if (!head || head->isEmpty()) {
-            throw ValueError("front() on empty list");
+            throw ValueError(VaStaticMessage("front() on empty list"));
         }
         return head->data[0];
     }
 
     const T& front() const {
         if (!head || head->isEmpty()) {
-            throw ValueError("front() on empty list");
+            throw ValueError(VaStaticMessage("front() on empty list"));
         }
         return head->data[0];
     }
 
     T& back() {
         if (!tail || tail->isEmpty()) {
-            throw ValueError("back() on empty list");
+            throw ValueError(VaStaticMessage("back() on empty list"));
         }
         return tail->data[tail->count - 1];
     }
 
     const T& back() const {
         if (!tail || tail->isEmpty()) {
-            throw ValueError("back() on empty list");
+            throw ValueError(VaStaticMessage("back() on empty list"));
         }
         return tail->data[tail->count - 1];
     }
 
+    /// @brief Like front() and back(), but return nullptr instead of throwing if the list is empty.
+    // @{
+    T* tryFront() noexcept { return len ? &head->data[0] : nullptr; }
+    const T* tryFront() const noexcept { return len ? &head->data[0] : nullptr; }
+
+    T* tryBack() noexcept { return len ? &tail->data[tail->count - 1] : nullptr; }
+    const T* tryBack() const noexcept { return len ? &tail->data[tail->count - 1] : nullptr; }
+    // @}
+
     T& frontUnchecked() noexcept {
         return head->data[0];
     }
@@ -685,7 +715,7 @@ class VaLinkedChunkedList {
         Chunk* node = chunkContainsIndex(index, &offset);
 
         if (!node) {
-            throw ValueError("Invalid index for deletion");
+            throw ValueError(VaStaticMessage("Invalid index for deletion"));
         }
 
         removeFromChunk(node, offset);
@@ -694,7 +724,7 @@ class VaLinkedChunkedList {
 
     T pop() {
         if (!tail || tail->isEmpty()) {
-            throw ValueError("pop() on empty list");
+            throw ValueError(VaStaticMessage("pop() on empty list"));
         }
 
         T value = removeFromChunk(tail, tail->count - 1);
@@ -704,7 +734,7 @@ class VaLinkedChunkedList {
 
     T shift() {
         if (!head || head->isEmpty()) {
-            throw ValueError("shift() on empty list");
+            throw ValueError(VaStaticMessage("shift() on empty list"));
         }
 
         T value = removeFromChunk(head, 0);
@@ -712,6 +742,28 @@ class VaLinkedChunkedList {
         return value;
     }
 
+    /**
+     * @brief Like pop() and shift(), but move the removed element into out and return false
+     *        instead of throwing if the list is empty.
+     */
+    // @{
+    bool tryPop(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&> && tt::IsNoexceptMoveConstructible<T>) {
+        if (len == 0) return false;
+
+        out = removeFromChunk(tail, tail->count - 1);
+        --len;
+        return true;
+    }
+
+    bool tryShift(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&> && tt::IsNoexceptMoveConstructible<T>) {
+        if (len == 0) return false;
+
+        out = removeFromChunk(head, 0);
+        --len;
+        return true;
+    }
+    // @}
+
     /**
      * @brief Returns the number of elements currently stored in the list.
      * @return The current length of the list.
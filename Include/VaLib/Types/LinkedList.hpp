@@ -4,24 +4,46 @@
 #pragma once
 
 #include <VaLib/RawAccess/LinkedList.hpp>
+#include <VaLib/Mem/SlabPool.hpp>
 
 #include <VaLib/Meta/BasicDefine.hpp>
 #include <VaLib/Types/BasicTypedef.hpp>
 #include <VaLib/Types/Error.hpp>
 #include <VaLib/Types/TypeTraits.hpp>
 
+#include <functional>
 #include <initializer_list>
 
+/**
+ * @brief Node of a VaLinkedList.
+ *
+ * @note The value is kept in an anonymous union, so constructing a node does not construct
+ *       the value. The owning list constructs and destroys values explicitly, which lets
+ *       unused nodes sit in the free list without a live value.
+ */
 template <typename T>
 struct VaLinkedListNode {
-    T value;
+    union {
+        T value;
+    };
     VaLinkedListNode<T>* next;
     VaLinkedListNode<T>* prev;
 
     VaLinkedListNode() : next(nullptr), prev(nullptr) {}
     explicit VaLinkedListNode(const T& val) : value(val), next(nullptr), prev(nullptr) {}
+    ~VaLinkedListNode() {}
 };
 
+/**
+ * @brief Doubly linked list whose nodes are carved from slabs and recycled through a free list.
+ *
+ * @tparam T The type of elements in the list.
+ *
+ * @warning Moving nodes between lists (appendEach(VaLinkedList&&), merge, splice, splitAfter...)
+ *          makes the lists share one slab pool, whose reference count and free nodes are not
+ *          synchronized. Lists that shared nodes this way, even ones that were split apart,
+ *          must not be used from different threads at the same time.
+ */
 template <typename T>
 class alignas(VaLinkedListRawView<T>) VaLinkedList {
   public:
@@ -32,9 +54,14 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
     Node* tail; ///< Pointer to the last node in the list
     Size len;   ///< Current number of elements in the list
 
-    Node* freeListHead; ///< Current number of elements in the list
+    using Pool = VaSlabPool<Node>;
+    static constexpr Size minSlabSize = 16; ///< Number of nodes in the first slab
+
+    Node* freeListHead; ///< Pointer to the first node in the free list
     Size freeListSize;  ///< Number of nodes currently stored in the free list
 
+    Pool* pool; ///< Slab pool the nodes are carved from (shared with lists this one exchanged nodes with)
+
     /**
      * @brief Unlinks a node from the list without deallocating it.
      * @param node Pointer to the node to be unlinked.
@@ -108,25 +135,40 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         target->prev = node;
     }
 
+    /// @brief Accessor for the link field of a node, as used by the free list.
+    static Node*& nodeLink(Node* node) noexcept { return node->next; }
+
+    /**
+     * @brief Takes a node from the free list without constructing its value.
+     *        When the free list is empty, it first takes the nodes other lists sharing the slab
+     *        pool handed back, and only then allocates a new slab.
+     * @return Pointer to an unlinked node whose value is not constructed.
+     */
+    Node* getRawNode() {
+        if (!freeListHead && pool) freeListHead = pool->resolve()->takeSpare(freeListHead, freeListSize, nodeLink);
+        if (!freeListHead) {
+            Size total = len + freeListSize;
+            addNodes(total < minSlabSize ? minSlabSize : total);
+        }
+
+        Node* node = freeListHead;
+        freeListHead = freeListHead->next;
+        freeListSize--;
+
+        node->next = nullptr;
+        node->prev = nullptr;
+        return node;
+    }
+
     /**
      * @brief Retrieves a node with a copy of the given value. Reuses from the free list if possible.
      * @param value The value to initialize the node with.
      * @return Pointer to the allocated or reused node.
      */
     Node* getNode(const T& value) {
-        if (freeListHead) {
-            Node* node = freeListHead;
-            freeListHead = freeListHead->next;
-            freeListSize--;
-
-            new (&node->value) T(value);
-            node->next = nullptr;
-            node->prev = nullptr;
-
-            return node;
-        }
-
-        return new Node(value);
+        Node* node = getRawNode();
+        new (&node->value) T(value);
+        return node;
     }
 
     /**
@@ -135,19 +177,9 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @return Pointer to the allocated or reused node.
      */
     Node* getNode(T&& value) {
-        if (freeListHead) {
-            Node* node = freeListHead;
-            freeListHead = freeListHead->next;
-            freeListSize--;
-
-            new (&node->value) T(std::move(value));
-            node->next = nullptr;
-            node->prev = nullptr;
-
-            return node;
-        }
-
-        return new Node(std::move(value));
+        Node* node = getRawNode();
+        new (&node->value) T(std::move(value));
+        return node;
     }
 
     /**
@@ -164,12 +196,17 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
     }
 
     /**
-     * @brief Preallocates a number of nodes and adds them to the free list.
+     * @brief Allocates a slab of nodes and adds them to the free list.
+     *        Nodes of one slab are contiguous and handed out in address order.
      * @param count Number of nodes to add.
      */
-    void addNodes(Size count) noexcept {
-        for (Size i = 0; i < count; ++i) {
-            Node* node = new Node();
+    void addNodes(Size count) {
+        if (count == 0) return;
+        if (!pool) pool = Pool::New();
+
+        Node* slab = pool->resolve()->allocate(count);
+        for (Size i = count; i > 0; --i) {
+            Node* node = new (&slab[i - 1]) Node();
             node->next = freeListHead;
             freeListHead = node;
         }
@@ -177,6 +214,62 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         freeListSize += count;
     }
 
+    /**
+     * @brief Makes the nodes of another list safe to adopt by sharing its slab pool.
+     *        Must be called before linking any node of @p other into this list.
+     * @param other The list whose nodes are about to be moved into this one.
+     */
+    void shareStorage(VaLinkedList& other) noexcept {
+        if (!other.pool || &other == this) return;
+
+        Pool* theirs = other.pool->resolve();
+        if (!pool) {
+            pool = theirs;
+            pool->retain();
+            return;
+        }
+
+        Pool::Merge(pool->resolve(), theirs, nodeLink);
+    }
+
+    /**
+     * @brief Destroys all values and returns every node to the free list.
+     */
+    void returnAll() noexcept {
+        Node* current = head;
+        while (current) {
+            Node* next = current->next;
+            returnNode(current);
+            current = next;
+        }
+
+        head = tail = nullptr;
+        len = 0;
+    }
+
+    /**
+     * @brief Drops the free list and the reference to the slab pool.
+     *        If other lists still share the pool, the free nodes are handed back to it
+     *        so that those lists reuse them instead of allocating new slabs.
+     *
+     * @warning The list must be empty.
+     */
+    void releaseStorage() noexcept {
+        if (pool && freeListHead) {
+            Pool* owner = pool->resolve();
+            if (owner != pool || owner->isShared()) {
+                Node* last = freeListHead;
+                while (last->next) last = last->next;
+                owner->donate(freeListHead, last, freeListSize, nodeLink);
+            }
+        }
+
+        Pool::Release(pool);
+        pool = nullptr;
+        freeListHead = nullptr;
+        freeListSize = 0;
+    }
+
     /**
      * @brief Returns a pointer to the node at a specified index. Traverses from head or tail depending on proximity.
      * @param index Index of the node to retrieve.
@@ -194,6 +287,52 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         }
     }
 
+    /**
+     * @brief Merges two sorted, nullptr-terminated chains linked through `next` only.
+     *        Nodes of @p left come first among equal elements, which keeps the merge stable.
+     * @param left The chain holding the earlier elements.
+     * @param right The chain holding the later elements.
+     * @param out Receives the head of the merged chain. May alias the variable passed as @p right.
+     * @param comp Strict weak ordering of the values.
+     *
+     * @note If comp throws, @p out still receives every node of both chains (in unspecified order).
+     */
+    template <typename Compare>
+    static void mergeChains(Node* left, Node* right, Node*& out, Compare& comp) {
+        Node** link = &out;
+        try {
+            while (left && right) {
+                if (comp(right->value, left->value)) {
+                    *link = right;
+                    link = &right->next;
+                    right = right->next;
+                } else {
+                    *link = left;
+                    link = &left->next;
+                    left = left->next;
+                }
+            }
+        } catch (...) {
+            *link = left;
+            while (*link) link = &(*link)->next;
+            *link = right;
+            throw;
+        }
+        *link = left ? left : right;
+    }
+
+    /**
+     * @brief Rebuilds the `prev` links and the tail after the order was changed through `next` links only.
+     */
+    void relinkBackward() noexcept {
+        Node* prev = nullptr;
+        for (Node* current = head; current; current = current->next) {
+            current->prev = prev;
+            prev = current;
+        }
+        tail = prev;
+    }
+
     #if __cplusplus >= CPP17
         template <typename Tuple, Size... Is>
         inline void prependAllImpl(Tuple&& tup, std::index_sequence<Is...>) {
@@ -206,11 +345,13 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
     /**
      * @brief Default constructor. Initializes an empty list with no reserved capacity.
      */
-    VaLinkedList() : head(nullptr), tail(nullptr), len(0), freeListHead(nullptr), freeListSize(0) {}
+    VaLinkedList() : head(nullptr), tail(nullptr), len(0), freeListHead(nullptr), freeListSize(0), pool(nullptr) {}
 
     /**
      * @brief Constructs an empty list and preallocates a given number of nodes.
      * @param initCap Number of nodes to preallocate in the internal free list.
+     *
+     * @note The preallocated nodes are carved from a single contiguous slab.
      */
     VaLinkedList(Size initCap) : VaLinkedList() { addNodes(initCap); }
 
@@ -219,6 +360,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @param other The list to copy from.
      */
     VaLinkedList(const VaLinkedList& other) : VaLinkedList() {
+        addNodes(other.len);
         Node* current = other.head;
         while (current) {
             append(current->value);
@@ -231,6 +373,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @param init List of elements to initialize the list with.
      */
     VaLinkedList(std::initializer_list<T> init) : VaLinkedList() {
+        addNodes(init.size());
         for (const auto& value: init) {
             append(value);
         }
@@ -240,7 +383,8 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @brief Move constructor. Transfers ownership of resources from another list.
      * @param other The list to move from.
      */
-    VaLinkedList(VaLinkedList&& other) noexcept : len(other.len), freeListHead(other.freeListHead), freeListSize(other.freeListSize) {
+    VaLinkedList(VaLinkedList&& other) noexcept
+        : len(other.len), freeListHead(other.freeListHead), freeListSize(other.freeListSize), pool(other.pool) {
         head = other.head;
         tail = other.tail;
 
@@ -249,18 +393,15 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         other.len = 0;
         other.freeListHead = nullptr;
         other.freeListSize = 0;
+        other.pool = nullptr;
     }
 
     /**
-     * @brief Destructor. Destroys all elements and releases memory used by the free list.
+     * @brief Destructor. Destroys all elements and releases memory used by the node slabs.
      */
     ~VaLinkedList() {
-        clear(true);
-        while (freeListHead) {
-            Node* next = freeListHead->next;
-            delete freeListHead;
-            freeListHead = next;
-        }
+        returnAll();
+        releaseStorage();
     }
 
     /**
@@ -271,6 +412,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
     VaLinkedList& operator=(const VaLinkedList& other) {
         if (this != &other) {
             clear();
+            reserve(other.len);
             Node* current = other.head;
             while (current) {
                 append(current->value);
@@ -287,24 +429,22 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      */
     VaLinkedList& operator=(VaLinkedList&& other) noexcept {
         if (this != &other) {
-            clear();
-            while (freeListHead) {
-                Node* next = freeListHead->next;
-                delete freeListHead;
-                freeListHead = next;
-            }
+            returnAll();
+            releaseStorage();
 
             head = other.head;
             tail = other.tail;
             len = other.len;
             freeListHead = other.freeListHead;
             freeListSize = other.freeListSize;
+            pool = other.pool;
 
             other.head = nullptr;
             other.tail = nullptr;
             other.len = 0;
             other.freeListHead = nullptr;
             other.freeListSize = 0;
+            other.pool = nullptr;
         }
 
         return *this;
@@ -390,6 +530,27 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         return this->get(index);
     }
 
+    /**
+     * @brief Returns the element at the given index with bounds checking, without throwing.
+     *        Supports negative indexing like at().
+     * @param index Position of the element to access. Negative values count from the end of the list.
+     * @return Pointer to the element, or nullptr if index is out of bounds.
+     *
+     * @warning This is a slow O(n/2) operation. Use with care in performance-critical code.
+     */
+    // @{
+    T* tryAt(int32 index) noexcept {
+        if (index < 0) index += len;
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &nodeAt(static_cast<Size>(index))->value;
+    }
+    const T* tryAt(int32 index) const noexcept {
+        if (index < 0) index += len;
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &nodeAt(static_cast<Size>(index))->value;
+    }
+    // @}
+
     /**
      * @brief Sets the value at the specified index to the given value.
      *        Supports negative indexing, where -1 refers to the last element, -2 to the second last, and so on.
@@ -498,7 +659,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
 
     template <typename... Args>
     void appendEmplace(Args&&... args) {
-        Node* node = getNode();
+        Node* node = getRawNode();
         new (&node->value) T(std::forward<Args>(args)...);
         linkToEnd(node);
         len++;
@@ -506,7 +667,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
 
     template <typename... Args>
     void prependEmplace(Args&&... args) {
-        Node* node = getNode();
+        Node* node = getRawNode();
         new (&node->value) T(std::forward<Args>(args)...);
         linkToFront(node);
         len++;
@@ -519,7 +680,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         if (index == len) return appendEmplace(std::forward<Args>(args)...);
 
         Node* current = nodeAt(index);
-        Node* node = getNode();
+        Node* node = getRawNode();
         new (&node->value) T(std::forward<Args>(args)...);
 
         insertBefore(current, node);
@@ -566,6 +727,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      */
     void appendEach(VaLinkedList&& other) {
         if (other.len == 0 || this == &other) return;
+        shareStorage(other);
         if (len == 0) {
             head = other.head;
             tail = other.tail;
@@ -630,6 +792,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      */
     void prependEach(VaLinkedList&& other) {
         if (other.len == 0 || this == &other) return;
+        shareStorage(other);
         if (len == 0) {
             head = other.head;
             tail = other.tail;
@@ -708,6 +871,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
             prependEach(std::move(other));
             return;
         }
+        shareStorage(other);
         Node* atNode = nodeAt(pos);
         Node* before = atNode->prev;
 
@@ -788,7 +952,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @throws ValueError If the list is empty.
      */
     T pop() {
-        if (len == 0) throw ValueError("pop() on empty list");
+        if (len == 0) throw ValueError(VaStaticMessage("pop() on empty list"));
 
         Node* target = tail;
         T value = target->value;
@@ -800,6 +964,23 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         return value;
     }
 
+    /**
+     * @brief Removes the last element and moves it into out, without throwing.
+     * @param out Receives the removed element.
+     * @return True if an element was removed, false if the list is empty.
+     */
+    bool tryPop(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&>) {
+        if (len == 0) return false;
+
+        Node* target = tail;
+        out = std::move(target->value);
+
+        unlinkFromOrder(target);
+        returnNode(target);
+        len--;
+        return true;
+    }
+
     /**
      * @brief Deletes and returns the element at the specified index.
      * @param index The position of the element to delete.
@@ -826,7 +1007,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @throws ValueError If the list is empty.
      */
     T shift() {
-        if (len == 0) throw ValueError("shift() on empty list");
+        if (len == 0) throw ValueError(VaStaticMessage("shift() on empty list"));
 
         Node* target = head;
         T value = target->value;
@@ -838,6 +1019,23 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
         return value;
     }
 
+    /**
+     * @brief Removes the first element and moves it into out, without throwing.
+     * @param out Receives the removed element.
+     * @return True if an element was removed, false if the list is empty.
+     */
+    bool tryShift(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&>) {
+        if (len == 0) return false;
+
+        Node* target = head;
+        out = std::move(target->value);
+
+        unlinkFromOrder(target);
+        returnNode(target);
+        len--;
+        return true;
+    }
+
     /**
      * @brief Returns a reference to the first element in the list.
      * @return Reference to the first element.
@@ -845,7 +1043,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @throws ValueError If the list is empty.
      */
     T& front() {
-        if (len == 0) throw ValueError("front() on empty list");
+        if (len == 0) throw ValueError(VaStaticMessage("front() on empty list"));
         return head->value;
     }
 
@@ -856,7 +1054,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @throws ValueError If the list is empty.
      */
     const T& front() const {
-        if (len == 0) throw ValueError("front() on empty list");
+        if (len == 0) throw ValueError(VaStaticMessage("front() on empty list"));
         return head->value;
     }
 
@@ -867,7 +1065,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @throws ValueError If the list is empty.
      */
     T& back() {
-        if (len == 0) throw ValueError("back() on empty list");
+        if (len == 0) throw ValueError(VaStaticMessage("back() on empty list"));
         return tail->value;
     }
 
@@ -878,10 +1076,28 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @throws ValueError If the list is empty.
      */
     const T& back() const {
-        if (len == 0) throw ValueError("back() on empty list");
+        if (len == 0) throw ValueError(VaStaticMessage("back() on empty list"));
         return tail->value;
     }
 
+    /**
+     * @brief Returns the first element without throwing.
+     * @return Pointer to the first element, or nullptr if the list is empty.
+     */
+    // @{
+    T* tryFront() noexcept { return len ? &head->value : nullptr; }
+    const T* tryFront() const noexcept { return len ? &head->value : nullptr; }
+    // @}
+
+    /**
+     * @brief Returns the last element without throwing.
+     * @return Pointer to the last element, or nullptr if the list is empty.
+     */
+    // @{
+    T* tryBack() noexcept { return len ? &tail->value : nullptr; }
+    const T* tryBack() const noexcept { return len ? &tail->value : nullptr; }
+    // @}
+
     /**
      * @brief Returns a reference to the first element in the list without bounds checking.
      * @return Reference to the first element.
@@ -929,7 +1145,7 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      * @note Nodes are preallocated and added to the free list if necessary.
      * @warning This is a linked list with a free list system. Using reserve() before performing many element addition operations does not improve performance, as linked lists do not benefit from preallocation in the same way as contiguous containers like array lists.
      */
-    void reserve(Size minCap) noexcept {
+    void reserve(Size minCap) {
         Size totalCurrent = len + freeListSize;
         if (minCap > totalCurrent) {
             addNodes(minCap - totalCurrent);
@@ -937,17 +1153,31 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
     }
 
     /**
-     * @brief Frees all unused nodes currently in the free list.
+     * @brief Frees unused nodes currently in the free list.
      *
-     * @note This reduces memory usage by deallocating unused preallocated nodes.
+     * @note Nodes live in slabs, so only slabs with no element in use can be released.
+     *       Nothing is released while the slabs are shared with another list
+     *       (after nodes were moved between lists, e.g. by appendEach(VaLinkedList&&) or a Cursor splice).
      */
     void shrink() noexcept {
-        while (freeListHead) {
-            Node* next = freeListHead->next;
-            delete freeListHead;
-            freeListHead = next;
+        if (!pool) return;
+
+        // Lists this one shared the pool with may be gone: point straight at the pool owning the slabs
+        Pool* owner = pool->resolve();
+        if (owner != pool) {
+            owner->retain();
+            Pool::Release(pool);
+            pool = owner;
         }
-        freeListSize = 0;
+        if (pool->isShared()) return;
+
+        if (len == 0) {
+            releaseStorage();
+            return;
+        }
+
+        freeListHead = pool->takeSpare(freeListHead, freeListSize, nodeLink);
+        freeListHead = pool->releaseUnused(freeListHead, freeListSize, nodeLink);
     }
 
     bool isEmpty() {
@@ -956,27 +1186,13 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
 
     /**
      * @brief Removes all elements from the list.
-     * @param destroyNodes If true, all nodes are deleted instead of returned to the free list.
+     * @param destroyNodes If true, the node slabs are released instead of keeping the nodes in the free list.
      *
      * @note If destroyNodes is false, nodes are preserved for reuse.
      */
     void clear(bool destroyNodes = false) noexcept {
-        Node* current = head;
-        while (current) {
-            Node* next = current->next;
-            unlinkFromOrder(current);
-
-            if (destroyNodes) {
-                delete current;
-            } else {
-                returnNode(current);
-            }
-
-            current = next;
-        }
-
-        head = tail = nullptr;
-        len = 0;
+        returnAll();
+        if (destroyNodes) releaseStorage();
     }
 
     /**
@@ -1188,6 +1404,519 @@ class alignas(VaLinkedListRawView<T>) VaLinkedList {
      */
     friend inline Size cap(const VaLinkedList& lst) noexcept { return lst.len + lst.freeListSize; }
 
+  public:
+    /**
+     * @brief Stable editing handle pointing at one element of the list.
+     *        Unlike index-based methods, every edit made through a cursor is O(1):
+     *        inserting next to it, erasing the element under it, splicing another list
+     *        around it and splitting the list at it.
+     *
+     *        Besides the elements, a cursor can sit on the end position (one past the last
+     *        element, see @ref isEnd). Moving forward from the end wraps to the first element
+     *        and moving backward wraps to the last one.
+     *
+     * @note The cursor tracks its index so that split operations know the length of both halves.
+     *       The index stays correct as long as elements before the cursor are only added or
+     *       removed through the cursor itself.
+     * @warning Erasing the element under a cursor through another handle invalidates the cursor.
+     * @warning Lists produced or consumed by a splice or split share their node storage with
+     *          this list and must not be used from a different thread than this list.
+     */
+    class Cursor {
+      protected:
+        VaLinkedList* list; ///< List the cursor belongs to
+        Node* current;      ///< Node under the cursor, or nullptr at the end position
+        Size idx;           ///< Index of the current node (list length at the end position)
+
+        friend class VaLinkedList;
+
+        template <typename... Args>
+        Node* makeNode(Args&&... args) {
+            Node* node = list->getRawNode();
+            new (&node->value) T(std::forward<Args>(args)...);
+            return node;
+        }
+
+        void linkAfter(Node* node) noexcept {
+            if (!current) {
+                list->linkToFront(node);
+                idx++;
+            } else if (current->next) {
+                list->insertBefore(current->next, node);
+            } else {
+                list->linkToEnd(node);
+            }
+            list->len++;
+        }
+
+        void linkBefore(Node* node) noexcept {
+            if (current) {
+                list->insertBefore(current, node);
+            } else {
+                list->linkToEnd(node);
+            }
+            list->len++;
+            idx++;
+        }
+
+      public:
+        Cursor(VaLinkedList* list, Node* node, Size index) : list(list), current(node), idx(index) {}
+
+        /**
+         * @brief Checks whether the cursor is on the end position.
+         * @return True if the cursor does not point at an element.
+         */
+        inline bool isEnd() const noexcept { return current == nullptr; }
+
+        /**
+         * @brief Converts the cursor to a boolean.
+         * @return True if the cursor points at an element.
+         */
+        inline explicit operator bool() const noexcept { return current != nullptr; }
+
+        /**
+         * @brief Returns the index of the element under the cursor.
+         * @return The index, or the length of the list at the end position.
+         */
+        inline Size index() const noexcept { return idx; }
+
+        /**
+         * @brief Returns the element under the cursor.
+         * @return Reference to the element.
+         *
+         * @throws ValueError If the cursor is on the end position.
+         */
+        T& get() {
+            if (!current) throw ValueError(VaStaticMessage("get() on cursor at end position"));
+            return current->value;
+        }
+
+        /**
+         * @brief Returns the element under the cursor without checking the position.
+         *
+         * @note The behavior is undefined if the cursor is on the end position.
+         */
+        inline T& operator*() const noexcept { return current->value; }
+        inline T* operator->() const noexcept { return &current->value; }
+
+        /**
+         * @brief Moves the cursor to the next element (from the end position: to the first element).
+         * @return Reference to this cursor.
+         */
+        Cursor& moveNext() noexcept {
+            if (current) {
+                current = current->next;
+                idx++;
+            } else {
+                current = list->head;
+                idx = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Moves the cursor to the previous element (from the first element: to the end position).
+         * @return Reference to this cursor.
+         */
+        Cursor& movePrev() noexcept {
+            if (current) {
+                current = current->prev;
+                idx = current ? idx - 1 : list->len;
+            } else if (list->tail) {
+                current = list->tail;
+                idx = list->len - 1;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Inserts an element right after the cursor (at the end position: at the front).
+         * @param value The value to insert.
+         */
+        void insertAfter(const T& value) { linkAfter(list->getNode(value)); }
+        void insertAfter(T&& value) { linkAfter(list->getNode(std::move(value))); }
+
+        /**
+         * @brief Inserts an element right before the cursor (at the end position: at the back).
+         * @param value The value to insert.
+         */
+        void insertBefore(const T& value) { linkBefore(list->getNode(value)); }
+        void insertBefore(T&& value) { linkBefore(list->getNode(std::move(value))); }
+
+        /**
+         * @brief Constructs an element in place right after the cursor.
+         * @param args Arguments forwarded to the constructor of T.
+         */
+        template <typename... Args>
+        void emplaceAfter(Args&&... args) {
+            linkAfter(makeNode(std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Constructs an element in place right before the cursor.
+         * @param args Arguments forwarded to the constructor of T.
+         */
+        template <typename... Args>
+        void emplaceBefore(Args&&... args) {
+            linkBefore(makeNode(std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Removes the element under the cursor and moves the cursor to the next one.
+         *
+         * @throws ValueError If the cursor is on the end position.
+         */
+        void erase() {
+            if (!current) throw ValueError(VaStaticMessage("erase() on cursor at end position"));
+
+            Node* next = current->next;
+            list->unlinkFromOrder(current);
+            list->returnNode(current);
+            list->len--;
+            current = next;
+        }
+
+        /**
+         * @brief Removes the element under the cursor, moves the cursor to the next one and returns the value.
+         * @return The removed value.
+         *
+         * @throws ValueError If the cursor is on the end position.
+         */
+        T remove() {
+            if (!current) throw ValueError(VaStaticMessage("remove() on cursor at end position"));
+
+            T value = std::move(current->value);
+            erase();
+            return value;
+        }
+
+        /**
+         * @brief Moves all elements of another list right after the cursor (at the end position: to the front).
+         * @param other The list to take the elements from. It is left empty.
+         *
+         * @note No element is copied or reallocated. Both lists share their node storage afterwards.
+         */
+        void spliceAfter(VaLinkedList&& other) noexcept {
+            if (other.len == 0 || &other == list) return;
+
+            list->shareStorage(other);
+            Node* prev = current;
+            Node* next = current ? current->next : list->head;
+
+            other.head->prev = prev;
+            other.tail->next = next;
+            if (prev) prev->next = other.head; else list->head = other.head;
+            if (next) next->prev = other.tail; else list->tail = other.tail;
+
+            list->len += other.len;
+            if (!current) idx += other.len;
+
+            other.head = other.tail = nullptr;
+            other.len = 0;
+        }
+
+        /**
+         * @brief Moves all elements of another list right before the cursor (at the end position: to the back).
+         * @param other The list to take the elements from. It is left empty.
+         *
+         * @note No element is copied or reallocated. Both lists share their node storage afterwards.
+         */
+        void spliceBefore(VaLinkedList&& other) noexcept {
+            if (other.len == 0 || &other == list) return;
+
+            list->shareStorage(other);
+            Node* next = current;
+            Node* prev = current ? current->prev : list->tail;
+
+            other.head->prev = prev;
+            other.tail->next = next;
+            if (prev) prev->next = other.head; else list->head = other.head;
+            if (next) next->prev = other.tail; else list->tail = other.tail;
+
+            list->len += other.len;
+            idx += other.len;
+
+            other.head = other.tail = nullptr;
+            other.len = 0;
+        }
+
+        /**
+         * @brief Moves the elements in [first, last) of another list right before the cursor
+         *        (at the end position: to the back).
+         * @param other The list the range belongs to. May be the list of this cursor.
+         * @param first Cursor on the first element to move.
+         * @param last Cursor one past the last element to move.
+         *
+         * @throws ValueError If the cursors do not belong to @p other, are out of order,
+         *         or this cursor lies inside the range.
+         * @note Runs in O(1): the length of the range is taken from the cursor indices,
+         *       so both cursors must have correct indices. @p first and @p last are
+         *       invalidated by the call.
+         */
+        void spliceBefore(VaLinkedList& other, const Cursor& first, const Cursor& last) {
+            if (first.list != &other || last.list != &other) throw ValueError(VaStaticMessage("splice range does not belong to the given list"));
+            if (first.idx > last.idx) throw ValueError(VaStaticMessage("splice range is out of order"));
+
+            Size count = last.idx - first.idx;
+            bool sameList = &other == list;
+            if (count == 0) return;
+            if (sameList) {
+                if (current == first.current || current == last.current) return;
+                if (idx > first.idx && idx < last.idx) throw ValueError(VaStaticMessage("cannot splice a range into itself"));
+            }
+
+            if (!sameList) list->shareStorage(other);
+
+            Node* rangeFirst = first.current;
+            Node* rangeLast = last.current ? last.current->prev : other.tail;
+
+            if (rangeFirst->prev) rangeFirst->prev->next = last.current; else other.head = last.current;
+            if (last.current) last.current->prev = rangeFirst->prev; else other.tail = rangeFirst->prev;
+
+            Node* next = current;
+            Node* prev = current ? current->prev : list->tail;
+
+            rangeFirst->prev = prev;
+            rangeLast->next = next;
+            if (prev) prev->next = rangeFirst; else list->head = rangeFirst;
+            if (next) next->prev = rangeLast; else list->tail = rangeLast;
+
+            if (!sameList) {
+                other.len -= count;
+                list->len += count;
+                idx += count;
+            } else if (first.idx > idx) {
+                idx += count;
+            }
+        }
+
+        /**
+         * @brief Detaches every element after the cursor into a new list.
+         *        At the end position the whole list is detached.
+         * @return A list holding the detached elements.
+         */
+        VaLinkedList splitAfter() {
+            VaLinkedList result;
+            Node* first = current ? current->next : list->head;
+            if (!first) return result;
+
+            result.shareStorage(*list);
+            result.head = first;
+            result.tail = list->tail;
+            result.len = current ? list->len - idx - 1 : list->len;
+
+            if (current) {
+                current->next = nullptr;
+                list->tail = current;
+            } else {
+                list->head = list->tail = nullptr;
+            }
+            first->prev = nullptr;
+
+            list->len -= result.len;
+            if (!current) idx = 0;
+            return result;
+        }
+
+        /**
+         * @brief Detaches every element before the cursor into a new list.
+         *        At the end position the whole list is detached.
+         * @return A list holding the detached elements.
+         */
+        VaLinkedList splitBefore() {
+            VaLinkedList result;
+            Node* last = current ? current->prev : list->tail;
+            if (!last) return result;
+
+            result.shareStorage(*list);
+            result.head = list->head;
+            result.tail = last;
+            result.len = current ? idx : list->len;
+
+            if (current) {
+                current->prev = nullptr;
+                list->head = current;
+            } else {
+                list->head = list->tail = nullptr;
+            }
+            last->next = nullptr;
+
+            list->len -= result.len;
+            idx = current ? 0 : list->len;
+            return result;
+        }
+
+        friend bool operator==(const Cursor& lhs, const Cursor& rhs) { return lhs.current == rhs.current; }
+        friend bool operator!=(const Cursor& lhs, const Cursor& rhs) { return lhs.current != rhs.current; }
+    };
+
+    /**
+     * @brief Returns a cursor pointing at the first element (the end position if the list is empty).
+     */
+    inline Cursor cursorFront() { return Cursor(this, head, 0); }
+
+    /**
+     * @brief Returns a cursor pointing at the last element (the end position if the list is empty).
+     */
+    inline Cursor cursorBack() { return tail ? Cursor(this, tail, len - 1) : cursorEnd(); }
+
+    /**
+     * @brief Returns a cursor on the end position.
+     */
+    inline Cursor cursorEnd() { return Cursor(this, nullptr, len); }
+
+    /**
+     * @brief Returns a cursor pointing at the element at the given index.
+     * @param index Position of the element. Passing the length of the list returns the end position.
+     *
+     * @throws IndexOutOfRangeError If index is greater than the length of the list.
+     * @warning This is a slow O(n/2) operation. Walk an existing cursor instead when possible.
+     */
+    Cursor cursorAt(Size index) {
+        if (index > len) throw IndexOutOfRangeError(len, index);
+        if (index == len) return cursorEnd();
+        return Cursor(this, nodeAt(index), index);
+    }
+
+    /**
+     * @brief Moves the elements in [first, last) of another list right before a position of this list.
+     * @param pos Cursor of this list to insert before (the end position appends).
+     * @param other The list the range belongs to. May be this list.
+     * @param first Cursor on the first element to move.
+     * @param last Cursor one past the last element to move.
+     *
+     * @throws ValueError If @p pos does not belong to this list or the range is invalid.
+     * @note Runs in O(1) regardless of the length of the range. See Cursor::spliceBefore.
+     */
+    void splice(Cursor pos, VaLinkedList& other, const Cursor& first, const Cursor& last) {
+        if (pos.list != this) throw ValueError(VaStaticMessage("splice position does not belong to this list"));
+        pos.spliceBefore(other, first, last);
+    }
+
+    /**
+     * @brief Moves all elements of another list right before a position of this list.
+     * @param pos Cursor of this list to insert before (the end position appends).
+     * @param other The list to take the elements from. It is left empty.
+     *
+     * @throws ValueError If @p pos does not belong to this list.
+     */
+    void splice(Cursor pos, VaLinkedList&& other) {
+        if (pos.list != this) throw ValueError(VaStaticMessage("splice position does not belong to this list"));
+        pos.spliceBefore(std::move(other));
+    }
+
+    /**
+     * @brief Sorts the list in place by relinking its nodes (bottom-up merge sort).
+     * @param comp Strict weak ordering of the elements. Defaults to operator<.
+     *
+     * @note The sort is stable, runs in O(n log n) and allocates nothing: values are never
+     *       moved or copied, so pointers and cursors to elements stay valid (cursor indices do not).
+     * @note If comp throws, the list keeps all of its elements in an unspecified order.
+     */
+    template <typename Compare = std::less<T>>
+    void sort(Compare comp = Compare()) {
+        if (len < 2) return;
+
+        // bins[i] holds a sorted run of 2^i nodes, older runs live in higher bins
+        constexpr Size maxBins = sizeof(Size) * 8;
+        Node* bins[maxBins] = {};
+        Size usedBins = 0;
+
+        Node* remaining = head;
+        Node* run = nullptr;
+        try {
+            while (remaining) {
+                run = remaining;
+                remaining = remaining->next;
+                run->next = nullptr;
+
+                Size i = 0;
+                for (; i < maxBins - 1 && bins[i]; i++) {
+                    Node* older = bins[i];
+                    bins[i] = nullptr;
+                    mergeChains(older, run, run, comp);
+                }
+                bins[i] = run;
+                run = nullptr;
+                if (i >= usedBins) usedBins = i + 1;
+            }
+
+            for (Size i = 0; i < usedBins; i++) {
+                if (!bins[i]) continue;
+                Node* older = bins[i];
+                bins[i] = nullptr;
+                mergeChains(older, run, run, comp);
+            }
+        } catch (...) {
+            Node** link = &run;
+            while (*link) link = &(*link)->next;
+            for (Size i = 0; i < usedBins; i++) {
+                *link = bins[i];
+                while (*link) link = &(*link)->next;
+            }
+            *link = remaining;
+
+            head = run;
+            relinkBackward();
+            throw;
+        }
+
+        head = run;
+        relinkBackward();
+    }
+
+    /**
+     * @brief Merges another sorted list into this sorted list, leaving the other list empty.
+     * @param other The list to merge in. Must be sorted by @p comp.
+     * @param comp Strict weak ordering of the elements. Defaults to operator<.
+     *
+     * @note The merge is stable (on ties, elements of this list come first) and runs in
+     *       O(n + m) comparisons. Consecutive elements of @p other are moved as one range,
+     *       without copying or reallocating. Both lists share their node storage afterwards.
+     * @note If comp throws, every element is in exactly one of the two lists, both still valid.
+     */
+    template <typename Compare = std::less<T>>
+    void merge(VaLinkedList&& other, Compare comp = Compare()) {
+        if (&other == this || other.len == 0) return;
+
+        shareStorage(other);
+        Node* mine = head;
+        while (mine && other.head) {
+            if (!comp(other.head->value, mine->value)) {
+                mine = mine->next;
+                continue;
+            }
+
+            Node* runFirst = other.head;
+            Node* runLast = runFirst;
+            Size count = 1;
+            while (runLast->next && comp(runLast->next->value, mine->value)) {
+                runLast = runLast->next;
+                count++;
+            }
+
+            other.head = runLast->next;
+            if (other.head) other.head->prev = nullptr; else other.tail = nullptr;
+            other.len -= count;
+
+            runFirst->prev = mine->prev;
+            if (mine->prev) mine->prev->next = runFirst; else head = runFirst;
+            runLast->next = mine;
+            mine->prev = runLast;
+            len += count;
+        }
+
+        if (other.head) {
+            other.head->prev = tail;
+            if (tail) tail->next = other.head; else head = other.head;
+            tail = other.tail;
+            len += other.len;
+
+            other.head = other.tail = nullptr;
+            other.len = 0;
+        }
+    }
+
   public iterators:
     /**
      * @brief Bidirectional iterator for traversing and modifying the list.
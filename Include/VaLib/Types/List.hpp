@@ -21,7 +21,10 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <initializer_list>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 template <typename T>
@@ -31,38 +34,71 @@ class alignas(VaListRawView<T>) VaList {
     Size cap; ///< Current capacity of the allocated buffer.
     T* data;  ///< Pointer to the raw array of elements.
 
+    /**
+     * @brief Allocates uninitialized storage for n elements.
+     *
+     * @note Uses std::allocator in constant evaluation, so that lists can be built at compile time,
+     *       and std::malloc at run time.
+     */
+    static constexpr T* allocate(Size n) {
+        if (std::is_constant_evaluated()) return std::allocator<T>().allocate(n);
+        return static_cast<T*>(std::malloc(n * sizeof(T)));
+    }
+
+    /**
+     * @brief Releases storage returned by allocate(), where n is the capacity it was allocated with.
+     */
+    static constexpr void deallocate(T* ptr, Size n) {
+        if (std::is_constant_evaluated()) {
+            if (ptr) std::allocator<T>().deallocate(ptr, n);
+            return;
+        }
+        std::free(ptr);
+    }
+
+    /**
+     * @brief Copies n trivially copyable elements into uninitialized storage; memcpy at run time.
+     */
+    static constexpr void copyTrivial(T* dst, const T* src, Size n) {
+        if (std::is_constant_evaluated()) {
+            for (Size i = 0; i < n; i++) std::construct_at(&dst[i], src[i]);
+            return;
+        }
+        if (n) std::memcpy(dst, src, n * sizeof(T));
+    }
+
     /**
      * @brief Resizes the internal buffer to a new capacity.
      * @param newCap New capacity for the buffer.
      */
-    void resize(Size newCap) {
-        T* newData = static_cast<T*>(std::malloc(newCap * sizeof(T)));
+    constexpr void resize(Size newCap) {
+        T* newData = allocate(newCap);
         if (!newData) throw NullPointerError();
 
         #if __cplusplus >= CPP17
             if constexpr (tt::IsTriviallyCopyable<T>) {
-                std::memcpy(newData, data, len * sizeof(T));
+                copyTrivial(newData, data, len);
             } else {
                 for (Size i = 0; i < len; i++) {
-                    new (&newData[i]) T(std::move(data[i]));
+                    std::construct_at(&newData[i], std::move(data[i]));
                     data[i].~T();
                 }
             }
         #else
             for (Size i = 0; i < len; i++) {
-                new (&newData[i]) T(std::move(data[i]));
+                std::construct_at(&newData[i], std::move(data[i]));
                 data[i].~T();
             }
         #endif
 
-        std::free(data);
+        deallocate(data, cap);
         data = newData;
         cap = newCap;
     }
 
     #if __cplusplus >= CPP17
         template <typename Tuple, Size... Is>
-        inline void prependAllImpl(Tuple&& tup, std::index_sequence<Is...>) {
+        constexpr void prependAllImpl(Tuple&& tup, std::index_sequence<Is...>) {
             // reverse fold using index pack
             ((prepend(std::get<sizeof...(Is) - 1 - Is>(std::forward<Tuple>(tup)))), ...);
         }
@@ -71,19 +107,19 @@ class alignas(VaListRawView<T>) VaList {
     /**
      * @brief Doubles the capacity or sets it to an initial value if zero.
      */
-    inline void expand() { resize(cap == 0 ? 4 : cap * 2); }
+    constexpr void expand() { resize(cap == 0 ? 4 : cap * 2); }
 
     /**
      * @brief Ensures there is enough capacity for a new element.
      */
-    inline void update() {
+    constexpr void update() {
         if (len >= cap) expand();
     }
 
     /**
      * @brief Destroys all elements if their type is not trivially destructible.
      */
-    inline void deleteObjects() {
+    constexpr void deleteObjects() {
         #if __cplusplus >= CPP17
             if constexpr (!tt::IsTriviallyDestructible<T>) {
                 for (Size i = 0; i < len; i++) {
@@ -97,8 +133,8 @@ class alignas(VaListRawView<T>) VaList {
         #endif
     }
 
-    inline void take(VaList&& other) {
-        std::free(data);
+    constexpr void take(VaList&& other) {
+        deallocate(data, cap);
         data = other.data;
         len = other.len;
         cap = other.cap;
@@ -111,17 +147,17 @@ class alignas(VaListRawView<T>) VaList {
     /**
      * @brief Constructs an empty list.
      */
-    VaList() : len(0), cap(0), data(nullptr) {}
+    constexpr VaList() : len(0), cap(0), data(nullptr) {}
 
     /**
      * @brief Constructs the list from an initializer list.
      * @param init List of elements to initialize the list with.
      */
-    VaList(std::initializer_list<T> init) : len(init.size()), cap(init.size()) {
-        data = static_cast<T*>(std::malloc(cap * sizeof(T)));
+    constexpr VaList(std::initializer_list<T> init) : len(init.size()), cap(init.size()) {
+        data = allocate(cap);
         Size i = 0;
         for (const T& val: init) {
-            new (&data[i++]) T(val);
+            std::construct_at(&data[i++], val);
         }
     }
 
@@ -129,20 +165,20 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Copy constructor.
      * @param other The list to copy from.
      */
-    VaList(const VaList& other) : len(other.len), cap(other.cap) {
-        data = static_cast<T*>(std::malloc(cap * sizeof(T)));
+    constexpr VaList(const VaList& other) : len(other.len), cap(other.cap) {
+        data = allocate(cap);
 
         #if __cplusplus >= CPP17
             if constexpr (tt::IsTriviallyCopyable<T>) {
-                std::memcpy(data, other.data, len * sizeof(T));
+                copyTrivial(data, other.data, len);
             } else {
                 for (Size i = 0; i < len; i++) {
-                    new (&data[i]) T(other.data[i]); // Placement new + copy
+                    std::construct_at(&data[i], other.data[i]); // Placement new + copy
                 }
             }
         #else
             for (Size i = 0; i < len; i++) {
-                new (&data[i]) T(other.data[i]); // Placement new + copy
+                std::construct_at(&data[i], other.data[i]); // Placement new + copy
             }
         #endif
     }
@@ -151,7 +187,7 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Move constructor.
      * @param other The list to move from.
      */
-    VaList(VaList&& other) noexcept : len(other.len), cap(other.cap), data(other.data) {
+    constexpr VaList(VaList&& other) noexcept : len(other.len), cap(other.cap), data(other.data) {
         other.data = nullptr;
         other.len = other.cap = 0;
     }
@@ -161,15 +197,19 @@ class alignas(VaListRawView<T>) VaList {
          * @brief Constructs the list from a variadic list of arguments.
          * @tparam Args Types of the arguments.
          * @param args Values to initialize the list with.
+         *
+         * @note A single VaList argument always selects the copy or move constructor, even for
+         *       element types constructible from anything, such as VaAny.
          */
         template <
             typename... Args,
-            typename = tt::EnableIf<(tt::IsConstructible<T, Args> && ...)>
+            typename = tt::EnableIf<(tt::IsConstructible<T, Args> && ...) &&
+                                    !(sizeof...(Args) == 1 && (tt::IsSame<tt::RemoveCVRef<Args>, VaList> && ...))>
         >
-        VaList(Args&&... args) : len(sizeof...(Args)), cap(sizeof...(Args)) {
-            data = static_cast<T*>(std::malloc(cap * sizeof(T)));
+        constexpr VaList(Args&&... args) : len(sizeof...(Args)), cap(sizeof...(Args)) {
+            data = allocate(cap);
             Size i = 0;
-            ((new (&data[i++]) T(std::forward<Args>(args))), ...);
+            ((std::construct_at(&data[i++], std::forward<Args>(args))), ...);
         }
 
         /**
@@ -181,12 +221,12 @@ class alignas(VaListRawView<T>) VaList {
             typename... Args,
             typename = tt::EnableIf<(tt::IsConstructible<T, Args> && ...)>
         >
-        static VaList From(Args&&... args) {
+        static constexpr VaList From(Args&&... args) {
             VaList list;
             list.len = list.cap = (sizeof...(Args));
-            list.data = static_cast<T*>(std::malloc(list.cap * sizeof(T)));
+            list.data = allocate(list.cap);
             Size i = 0;
-            ((new (&list.data[i++]) T(std::forward<Args>(args))), ...);
+            ((std::construct_at(&list.data[i++], std::forward<Args>(args))), ...);
 
             return list;
         }
@@ -195,10 +235,10 @@ class alignas(VaListRawView<T>) VaList {
     /**
      * @brief Destructor. Destroys all elements and frees memory.
      */
-    ~VaList() {
+    constexpr ~VaList() {
         if (data) {
             deleteObjects();
-            std::free(data);
+            deallocate(data, cap);
         }
     }
 
@@ -208,12 +248,12 @@ class alignas(VaListRawView<T>) VaList {
      * @param val The value to fill the list with.
      * @return A VaList containing `count` copies of `val`.
      */
-    static VaList Filled(Size count, const T& val) {
+    static constexpr VaList Filled(Size count, const T& val) {
         VaList list;
         list.len = list.cap = count;
-        list.data = static_cast<T*>(std::malloc(sizeof(T) * count));
+        list.data = allocate(count);
         for (Size i = 0; i < count; i++) {
-            new (&list.data[i]) T(val);
+            std::construct_at(&list.data[i], val);
         }
 
         return list;
@@ -282,27 +322,27 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to copy from.
      * @return Reference to this list.
      */
-    VaList& operator=(const VaList& other) {
+    constexpr VaList& operator=(const VaList& other) {
         if (this == &other) return *this;
 
         deleteObjects();
-        std::free(data);
+        deallocate(data, cap);
 
         len = other.len;
         cap = other.cap;
-        data = static_cast<T*>(std::malloc(cap * sizeof(T)));
+        data = allocate(cap);
 
         #if __cplusplus >= CPP17
             if constexpr (tt::IsTriviallyCopyable<T>) {
-                std::memcpy(data, other.data, len * sizeof(T));
+                copyTrivial(data, other.data, len);
             } else {
                 for (Size i = 0; i < len; i++) {
-                    new (&data[i]) T(other.data[i]);
+                    std::construct_at(&data[i], other.data[i]);
                 }
             }
         #else
             for (Size i = 0; i < len; i++) {
-                new (&data[i]) T(other.data[i]);
+                std::construct_at(&data[i], other.data[i]);
             }
         #endif
 
@@ -314,9 +354,10 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to move from.
      * @return Reference to this list.
      */
-    VaList& operator=(VaList&& other) noexcept {
+    constexpr VaList& operator=(VaList&& other) noexcept {
         if (this == &other) return *this;
-        std::free(data);
+        deleteObjects();
+        deallocate(data, cap);
 
         this->len = other.len;
         this->cap = other.cap;
@@ -331,7 +372,7 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Ensures the internal capacity is at least the specified amount.
      * @param minCap Minimum required capacity.
      */
-    inline void reserve(Size minCap) {
+    constexpr void reserve(Size minCap) {
         if (minCap > cap) resize(minCap);
     }
 
@@ -339,18 +380,18 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Appends a copy of an element to the end of the list.
      * @param elm The element to append.
      */
-    void append(const T& elm) {
+    constexpr void append(const T& elm) {
         update();
-        new (&data[len++]) T(elm);
+        std::construct_at(&data[len++], elm);
     }
 
     /**
      * @brief Appends an element to the end of the list using move semantics.
      * @param elm The element to move.
      */
-    void append(T&& elm) {
+    constexpr void append(T&& elm) {
         update();
-        new (&data[len++]) T(std::move(elm));
+        std::construct_at(&data[len++], std::move(elm));
     }
 
     /**
@@ -360,17 +401,17 @@ class alignas(VaListRawView<T>) VaList {
      * @return Reference to the newly added element.
      */
     template <typename... Args>
-    T& appendEmplace(Args&&... args) {
+    constexpr T& appendEmplace(Args&&... args) {
         update();
-        new (&data[len]) T(std::forward<Args>(args)...);
+        std::construct_at(&data[len], std::forward<Args>(args)...);
         return data[len++];
     }
 
     template <typename... Args>
     [[ deprecated("Use appendEmplace") ]]
-    T& emplace(Args&&... args) {
+    constexpr T& emplace(Args&&... args) {
         update();
-        new (&data[len]) T(std::forward<Args>(args)...);
+        std::construct_at(&data[len], std::forward<Args>(args)...);
         return data[len++];
     }
 
@@ -378,13 +419,13 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Inserts an element at the beginning of the list.
      * @param elm The element to prepend.
      */
-    void prepend(const T& elm) { insert(0, elm); }
+    constexpr void prepend(const T& elm) { insert(0, elm); }
 
     /**
      * @brief Inserts a moved element at the beginning of the list.
      * @param elm The element to move.
      */
-    void prepend(T&& elm) { insert(0, elm); }
+    constexpr void prepend(T&& elm) { insert(0, elm); }
 
     /**
      * @brief Constructs an element in place at the beginning of the list.
@@ -393,7 +434,7 @@ class alignas(VaListRawView<T>) VaList {
      * @return Reference to the newly added element.
      */
     template <typename... Args>
-    T& prependEmplace(Args&&... args) {
+    constexpr T& prependEmplace(Args&&... args) {
         return insertEmplace(0, std::forward<Args>(args)...);
     }
 
@@ -408,14 +449,14 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    void insert(Size index, T value) {
+    constexpr void insert(Size index, T value) {
         if (index > len) throw IndexOutOfRangeError(len, index);
         update();
         for (Size i = len; i > index; i--) {
-            new (&data[i]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i], std::move(data[i - 1]));
             data[i - 1].~T();
         }
-        new (&data[index]) T(std::move(value));
+        std::construct_at(&data[index], std::move(value));
         len++;
     }
 
@@ -429,16 +470,16 @@ class alignas(VaListRawView<T>) VaList {
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
     template <typename... Args>
-    T& insertEmplace(Size index, Args&&... args) {
+    constexpr T& insertEmplace(Size index, Args&&... args) {
         if (index > len) throw IndexOutOfRangeError(len, index);
         update();
 
         for (Size i = len; i > index; i--) {
-            new (&data[i]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
-        new (&data[index]) T(std::forward<Args>(args)...);
+        std::construct_at(&data[index], std::forward<Args>(args)...);
         len++;
         return data[index];
     }
@@ -452,13 +493,13 @@ class alignas(VaListRawView<T>) VaList {
      * to accommodate the new elements.
      */
     template <typename Iterable>
-    void appendEach(const Iterable& other) {
+    constexpr void appendEach(const Iterable& other) {
         Size otherSize = std::distance(std::begin(other), std::end(other));
         if (otherSize == 0) return;
 
         reserve(len + otherSize);
         for (const auto& elm: other) {
-            new (&data[len++]) T(elm);
+            std::construct_at(&data[len++], elm);
         }
     }
 
@@ -473,13 +514,13 @@ class alignas(VaListRawView<T>) VaList {
      * @note The container must support move semantics for its elements.
      */
     template <typename Iterable>
-    void appendEach(Iterable&& other) {
+    constexpr void appendEach(Iterable&& other) {
         Size otherSize = std::distance(std::begin(other), std::end(other));
         if (otherSize == 0) return;
 
         reserve(len + otherSize);
         for (auto& elm: other) {
-            new (&data[len++]) T(std::move(elm));
+            std::construct_at(&data[len++], std::move(elm));
         }
     }
 
@@ -490,16 +531,16 @@ class alignas(VaListRawView<T>) VaList {
      * This method appends all elements from the provided VaList to the end of
      * the current list. The list's capacity is expanded if necessary.
      */
-    void appendEach(const VaList& other) {
+    constexpr void appendEach(const VaList& other) {
         if (other.len == 0) return;
 
         reserve(len + other.len);
         for (Size i = 0; i < other.len; i++) {
-            new (&data[len++]) T(other.data[i]);
+            std::construct_at(&data[len++], other.data[i]);
         }
     }
 
-    void appendEach(VaList&& other) {
+    constexpr void appendEach(VaList&& other) {
         if (other.len == 0) return;
 
         // if the current list is empty, take ownership of the other list's data directly.
@@ -510,12 +551,12 @@ class alignas(VaListRawView<T>) VaList {
 
         reserve(len + other.len);
         for (Size i = 0; i < other.len; i++) {
-            new (&data[len++]) T(std::move(other.data[i]));
+            std::construct_at(&data[len++], std::move(other.data[i]));
             other.data[i].~T();
         }
 
         // free the other list's buffer.
-        std::free(other.data);
+        deallocate(other.data, other.cap);
         other.data = nullptr;
         other.len = other.cap = 0;
     }
@@ -528,19 +569,19 @@ class alignas(VaListRawView<T>) VaList {
      * new elements from the provided container, which are then added to the front.
      */
     template <typename Iterable>
-    void prependEach(const Iterable& other) {
+    constexpr void prependEach(const Iterable& other) {
         Size otherSize = std::distance(std::begin(other), std::end(other));
         if (otherSize == 0) return;
 
         reserve(len + otherSize);
         for (Size i = len; i > 0; i--) {
-            new (&data[i + otherSize - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + otherSize - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         Size i = 0;
         for (const auto& elm: other) {
-            new (&data[i++]) T(elm);
+            std::construct_at(&data[i++], elm);
         }
         len += otherSize;
     }
@@ -556,19 +597,19 @@ class alignas(VaListRawView<T>) VaList {
      * @note The container must support move semantics for its elements.
      */
     template <typename Iterable>
-    void prependEach(Iterable&& other) {
+    constexpr void prependEach(Iterable&& other) {
         Size otherSize = std::distance(std::begin(other), std::end(other));
         if (otherSize == 0) return;
 
         reserve(len + otherSize);
         for (Size i = len; i > 0; i--) {
-            new (&data[i + otherSize - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + otherSize - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         Size i = 0;
         for (auto& elm: other) {
-            new (&data[i++]) T(std::move(elm));
+            std::construct_at(&data[i++], std::move(elm));
         }
         len += otherSize;
     }
@@ -580,17 +621,17 @@ class alignas(VaListRawView<T>) VaList {
      * This method shifts the existing elements in the list to make room for the
      * new elements from the provided VaList, which are then added to the front.
      */
-    void prependEach(const VaList& other) {
+    constexpr void prependEach(const VaList& other) {
         if (other.len == 0) return;
 
         reserve(len + other.len);
         for (Size i = len; i > 0; i--) {
-            new (&data[i + other.len - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + other.len - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         for (Size i = 0; i < other.len; i++) {
-            new (&data[i]) T(other.data[i]);
+            std::construct_at(&data[i], other.data[i]);
         }
         len += other.len;
     }
@@ -609,7 +650,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws NullPointerError If memory allocation fails during resizing.
      */
-    void prependEach(VaList&& other) {
+    constexpr void prependEach(VaList&& other) {
         if (other.len == 0) return;
 
         // if the current list is empty, take ownership of the other list's data directly.
@@ -621,27 +662,27 @@ class alignas(VaListRawView<T>) VaList {
         // if the other list is larger, allocate a new buffer to avoid excessive shifting.
         if (other.len > cap-len) {
             Size newCap = len + other.len;
-            T* newData = static_cast<T*>(std::malloc(newCap * sizeof(T)));
+            T* newData = allocate(newCap);
             if (!newData) throw NullPointerError();
 
             // move the other list's elements into the new buffer.
             for (Size i = 0; i < other.len; i++) {
-                new (&newData[i]) T(std::move(other.data[i]));
+                std::construct_at(&newData[i], std::move(other.data[i]));
                 other.data[i].~T();
             }
 
             // move the current list's elements into the new buffer after the other list's elements.
             for (Size i = 0; i < len; i++) {
-                new (&newData[other.len + i]) T(std::move(data[i]));
+                std::construct_at(&newData[other.len + i], std::move(data[i]));
                 data[i].~T();
             }
 
-            std::free(data);
+            deallocate(data, cap);
             data = newData;
             len += other.len;
             cap = newCap;
 
-            std::free(other.data);
+            deallocate(other.data, other.cap);
             other.data = nullptr;
             other.len = other.cap = 0;
             return;
@@ -650,17 +691,17 @@ class alignas(VaListRawView<T>) VaList {
         // default:
         reserve(len + other.len);
         for (Size i = len; i > 0; i--) {
-            new (&data[i + other.len - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + other.len - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         for (Size i = 0; i < other.len; i++) {
-            new (&data[i]) T(std::move(other.data[i]));
+            std::construct_at(&data[i], std::move(other.data[i]));
             other.data[i].~T();
         }
         len += other.len;
 
-        std::free(other.data);
+        deallocate(other.data, other.cap);
         other.data = nullptr;
         other.len = other.cap = 0;
     }
@@ -676,7 +717,7 @@ class alignas(VaListRawView<T>) VaList {
      * @throws IndexOutOfRangeError If the index is out of bounds.
      */
     template <typename Iterable>
-    void insertEach(Size index, const Iterable& other) {
+    constexpr void insertEach(Size index, const Iterable& other) {
         if (index > len) throw IndexOutOfRangeError(len, index);
 
         Size otherSize = std::distance(std::begin(other), std::end(other));
@@ -684,13 +725,13 @@ class alignas(VaListRawView<T>) VaList {
 
         reserve(len + otherSize);
         for (Size i = len; i > index; i--) {
-            new (&data[i + otherSize - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + otherSize - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         Size i = index;
         for (const auto& elm: other) {
-            new (&data[i++]) T(elm);
+            std::construct_at(&data[i++], elm);
         }
         len += otherSize;
     }
@@ -709,7 +750,7 @@ class alignas(VaListRawView<T>) VaList {
      * @throws IndexOutOfRangeError If the index is out of bounds.
      */
     template <typename Iterable>
-    void insertEach(Size index, Iterable&& other) {
+    constexpr void insertEach(Size index, Iterable&& other) {
         if (index > len) throw IndexOutOfRangeError(len, index);
 
         Size otherSize = std::distance(std::begin(other), std::end(other));
@@ -717,13 +758,13 @@ class alignas(VaListRawView<T>) VaList {
 
         reserve(len + otherSize);
         for (Size i = len; i > index; i--) {
-            new (&data[i + otherSize - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + otherSize - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         Size i = index;
         for (auto& elm: other) {
-            new (&data[i++]) T(std::move(elm));
+            std::construct_at(&data[i++], std::move(elm));
         }
         len += otherSize;
     }
@@ -738,7 +779,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If the index is out of bounds.
      */
-    void insertEach(Size index, const VaList& other) {
+    constexpr void insertEach(Size index, const VaList& other) {
         if (index > len) throw IndexOutOfRangeError(len, index);
         if (other.len == 0) return;
 
@@ -746,17 +787,17 @@ class alignas(VaListRawView<T>) VaList {
         if (newLen > cap) resize(newLen);
 
         for (Size i = len; i > index; i--) {
-            new (&data[i + other.len - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + other.len - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         for (Size i = 0; i < other.len; i++) {
-            new (&data[index + i]) T(other.data[i]);
+            std::construct_at(&data[index + i], other.data[i]);
         }
         len += other.len;
     }
 
-    void insertEach(Size index, VaList&& other) {
+    constexpr void insertEach(Size index, VaList&& other) {
         if (index > len) throw IndexOutOfRangeError(len, index);
         if (other.len == 0) return;
 
@@ -775,32 +816,32 @@ class alignas(VaListRawView<T>) VaList {
         // if the other list is larger, allocate a new buffer to avoid excessive shifting.
         if (other.len > cap - len) {
             Size newCap = len + other.len;
-            T* newData = static_cast<T*>(std::malloc(newCap * sizeof(T)));
+            T* newData = allocate(newCap);
             if (!newData) throw NullPointerError();
 
             for (Size i = 0; i < index; i++) {
-                new (&newData[i]) T(std::move(data[i]));
+                std::construct_at(&newData[i], std::move(data[i]));
                 data[i].~T();
             }
 
             // move the other list's elements into the new buffer.
             for (Size i = 0; i < other.len; i++) {
-                new (&newData[index + i]) T(std::move(other.data[i]));
+                std::construct_at(&newData[index + i], std::move(other.data[i]));
                 other.data[i].~T();
             }
 
             // copy elements after the insertion point.
             for (Size i = index; i < len; i++) {
-                new (&newData[other.len + i]) T(std::move(data[i]));
+                std::construct_at(&newData[other.len + i], std::move(data[i]));
                 data[i].~T();
             }
 
-            std::free(data);
+            deallocate(data, cap);
             data = newData;
             len += other.len;
             cap = newCap;
 
-            std::free(other.data);
+            deallocate(other.data, other.cap);
             other.data = nullptr;
             other.len = other.cap = 0;
             return;
@@ -809,36 +850,36 @@ class alignas(VaListRawView<T>) VaList {
         // default: shift elements and insert.
         reserve(len + other.len);
         for (Size i = len; i > index; i--) {
-            new (&data[i + other.len - 1]) T(std::move(data[i - 1]));
+            std::construct_at(&data[i + other.len - 1], std::move(data[i - 1]));
             data[i - 1].~T();
         }
 
         for (Size i = 0; i < other.len; i++) {
-            new (&data[index + i]) T(std::move(other.data[i]));
+            std::construct_at(&data[index + i], std::move(other.data[i]));
             other.data[i].~T();
         }
         len += other.len;
 
-        std::free(other.data);
+        deallocate(other.data, other.cap);
         other.data = nullptr;
         other.len = other.cap = 0;
     }
 
     template <typename Iterable>
-    void extend(const Iterable& other) {
+    constexpr void extend(const Iterable& other) {
         appendEach(other);
     }
 
     template <typename Iterable>
-    void extend(Iterable&& other) {
+    constexpr void extend(Iterable&& other) {
         appendEach(std::forward<Iterable>(other));
     }
 
-    void extend(const VaList& other) {
+    constexpr void extend(const VaList& other) {
         appendEach(other);
     }
 
-    void extend(VaList&& other) {
+    constexpr void extend(VaList&& other) {
         appendEach(std::move(other));
     }
 
@@ -852,7 +893,7 @@ class alignas(VaListRawView<T>) VaList {
          *       and appends each of them to the list in order.
          */
         template <typename... Args>
-        inline void appendAll(Args&&... args) {
+        constexpr void appendAll(Args&&... args) {
             reserve(len + sizeof...(args));
             (append(std::forward<Args>(args)), ...);
         }
@@ -866,7 +907,7 @@ class alignas(VaListRawView<T>) VaList {
          *       and prepends each of them to the list in reverse order.
          */
         template <typename... Args>
-        inline void prependAll(Args&&... args) {
+        constexpr void prependAll(Args&&... args) {
             reserve(len + sizeof...(args));
             prependAllImpl(VaTuple<Args...>(std::forward<Args>(args)...), std::index_sequence_for<Args...>{});
         }
@@ -883,7 +924,7 @@ class alignas(VaListRawView<T>) VaList {
          * @throws IndexOutOfRangeError If the index is out of bounds.
          */
         template <typename... Args>
-        inline void insertAll(Size index, Args&&... args) {
+        constexpr void insertAll(Size index, Args&&... args) {
             reserve(len + sizeof...(args));
             insertEach(index, {args...});
         }
@@ -895,12 +936,12 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    void del(Size index) {
+    constexpr void del(Size index) {
         if (index >= len) throw IndexOutOfRangeError(len, index);
 
         for (Size i = index; i < len - 1; i++) {
             data[i].~T();
-            new (&data[i]) T(std::move(data[i + 1]));
+            std::construct_at(&data[i], std::move(data[i + 1]));
         }
 
         data[len - 1].~T();
@@ -915,15 +956,15 @@ class alignas(VaListRawView<T>) VaList {
      * @throws IndexOutOfRangeError If start or end are out of bounds.
      * @throws ValueError If start is greater than end.
      */
-    void delRange(Size start, Size end) {
-        if (start > end) throw ValueError("delRange(): start index cannot be greater than end index");
+    constexpr void delRange(Size start, Size end) {
+        if (start > end) throw ValueError(VaStaticMessage("delRange(): start index cannot be greater than end index"));
         if (end > len) throw IndexOutOfRangeError(len, end);
         if (start >= len) throw IndexOutOfRangeError(len, start);
 
         Size rangeSize = end - start;
         for (Size i = start; i < len - rangeSize; i++) {
             data[i].~T();
-            new (&data[i]) T(std::move(data[i + rangeSize]));
+            std::construct_at(&data[i], std::move(data[i + rangeSize]));
         }
 
         for (Size i = len - rangeSize; i < len; i++) {
@@ -939,9 +980,9 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws ValueError If the list is empty.
      */
-    T pop() {
+    constexpr T pop() {
         if (len == 0) {
-            throw ValueError("pop() on empty list");
+            throw ValueError(VaStaticMessage("pop() on empty list"));
         }
 
         T value = std::move(data[len - 1]);
@@ -950,6 +991,20 @@ class alignas(VaListRawView<T>) VaList {
         return value;
     }
 
+    /**
+     * @brief Removes the last element and moves it into out, without throwing.
+     * @param out Receives the removed element.
+     * @return True if an element was removed, false if the list is empty.
+     */
+    constexpr bool tryPop(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&>) {
+        if (len == 0) return false;
+
+        out = std::move(data[len - 1]);
+        data[len - 1].~T();
+        len--;
+        return true;
+    }
+
     /**
      * @brief Removes and returns the element at the specified index.
      * @param index Index of the element to remove.
@@ -957,13 +1012,13 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    T pop(Size index) {
+    constexpr T pop(Size index) {
         if (index >= len) throw IndexOutOfRangeError(len, index);
         T value = std::move(data[index]);
         data[index].~T();
 
         for (Size i = index; i < len - 1; i++) {
-            new (&data[i]) T(std::move(data[i + 1]));
+            std::construct_at(&data[i], std::move(data[i + 1]));
             data[i + 1].~T();
         }
 
@@ -978,7 +1033,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method does not handle negative indices. It only checks if the index is between 0 and len - 1.
      */
-    inline bool isIndexValid(Size index) const {
+    constexpr bool isIndexValid(Size index) const {
         return index < len;
     }
 
@@ -989,7 +1044,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method accounts for negative indices by wrapping them to the valid range [0, len - 1].
      */
-    inline bool isIndexValidWrapped(int32 index) const {
+    constexpr bool isIndexValidWrapped(int32 index) const {
         if (index < 0) index += len;
         return index >= 0 && static_cast<Size>(index) < len;
     }
@@ -999,28 +1054,28 @@ class alignas(VaListRawView<T>) VaList {
      * @param index Index of the element.
      * @return Reference to the element.
      */
-    inline T& get(Size index) { return data[index]; }
+    constexpr T& get(Size index) { return data[index]; }
 
     /**
      * @brief Accesses an element by index (unchecked).
      * @param index Index of the element.
      * @return Const reference to the element.
      */
-    inline const T& get(Size index) const { return data[index]; }
+    constexpr const T& get(Size index) const { return data[index]; }
 
     /**
      * @brief Accesses an element by index (unchecked).
      * @param index Index of the element.
      * @return Reference to the element.
      */
-    inline T& operator[](Size index) { return data[index]; }
+    constexpr T& operator[](Size index) { return data[index]; }
 
     /**
      * @brief Accesses an element by index (unchecked).
      * @param index Index of the element.
      * @return Const reference to the element.
      */
-    inline const T& operator[](Size index) const { return data[index]; }
+    constexpr const T& operator[](Size index) const { return data[index]; }
 
     /**
      * @brief Accesses an element by index with bounds checking.
@@ -1029,7 +1084,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    inline T& at(int32 index) {
+    constexpr T& at(int32 index) {
         if (index < 0) index += len; // handle negative indices
         if (index < 0 || static_cast<Size>(index) >= len) throw IndexOutOfRangeError(len, index);
         return data[static_cast<Size>(index)];
@@ -1042,12 +1097,30 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    inline const T& at(int32 index) const {
+    constexpr const T& at(int32 index) const {
         if (index < 0) index += len; // handle negative indices
         if (index < 0 || static_cast<Size>(index) >= len) throw IndexOutOfRangeError(len, index);
         return data[static_cast<Size>(index)];
     }
 
+    /**
+     * @brief Accesses an element by index with bounds checking, without throwing.
+     * @param index Index of the element (can be negative).
+     * @return Pointer to the element, or nullptr if index is out of bounds.
+     */
+    // @{
+    constexpr T* tryAt(int32 index) noexcept {
+        if (index < 0) index += len; // handle negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &data[static_cast<Size>(index)];
+    }
+    constexpr const T* tryAt(int32 index) const noexcept {
+        if (index < 0) index += len; // handle negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &data[static_cast<Size>(index)];
+    }
+    // @}
+
     /**
      * @brief Sets the value at the specified index.
      * @param index Index of the element to set (can be negative).
@@ -1055,11 +1128,11 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    void set(int32 index, const T& value) {
+    constexpr void set(int32 index, const T& value) {
         if (index < 0) index += len; // handle negative indices
         if (index < 0 || static_cast<Size>(index) >= len) throw IndexOutOfRangeError(len, index);
         data[static_cast<Size>(index)].~T();
-        new (&data[static_cast<Size>(index)]) T(value);
+        std::construct_at(&data[static_cast<Size>(index)], value);
     }
 
     /**
@@ -1069,11 +1142,11 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If index is out of bounds.
      */
-    void set(int32 index, T&& value) {
+    constexpr void set(int32 index, T&& value) {
         if (index < 0) index += len; // handle negative indices
         if (index < 0 || static_cast<Size>(index) >= len) throw IndexOutOfRangeError(len, index);
         data[static_cast<Size>(index)].~T();
-        new (&data[static_cast<Size>(index)]) T(std::move(value));
+        std::construct_at(&data[static_cast<Size>(index)], std::move(value));
     }
 
     /**
@@ -1082,8 +1155,8 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws ValueError If the list is empty.
      */
-    inline T& front() {
-        if (len <= 0) throw ValueError("front() on empty list");
+    constexpr T& front() {
+        if (len <= 0) throw ValueError(VaStaticMessage("front() on empty list"));
         return data[0];
     }
 
@@ -1093,8 +1166,8 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws ValueError If the list is empty.
      */
-    inline const T& front() const {
-        if (len <= 0) throw ValueError("front() on empty list");
+    constexpr const T& front() const {
+        if (len <= 0) throw ValueError(VaStaticMessage("front() on empty list"));
         return data[0];
     }
 
@@ -1104,8 +1177,8 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws ValueError If the list is empty.
      */
-    inline T& back() {
-        if (len <= 0) throw ValueError("back() on empty list");
+    constexpr T& back() {
+        if (len <= 0) throw ValueError(VaStaticMessage("back() on empty list"));
         return data[len - 1];
     }
 
@@ -1115,18 +1188,36 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws ValueError If the list is empty.
      */
-    inline const T& back() const {
-        if (len <= 0) throw ValueError("back() on empty list");
+    constexpr const T& back() const {
+        if (len <= 0) throw ValueError(VaStaticMessage("back() on empty list"));
         return data[len - 1];
     }
 
+    /**
+     * @brief Returns the first element without throwing.
+     * @return Pointer to the first element, or nullptr if the list is empty.
+     */
+    // @{
+    constexpr T* tryFront() noexcept { return len ? &data[0] : nullptr; }
+    constexpr const T* tryFront() const noexcept { return len ? &data[0] : nullptr; }
+    // @}
+
+    /**
+     * @brief Returns the last element without throwing.
+     * @return Pointer to the last element, or nullptr if the list is empty.
+     */
+    // @{
+    constexpr T* tryBack() noexcept { return len ? &data[len - 1] : nullptr; }
+    constexpr const T* tryBack() const noexcept { return len ? &data[len - 1] : nullptr; }
+    // @}
+
     /**
      * @brief Returns a reference to the first element in the list without bounds checking.
      * @return Reference to the first element.
      *
      * @note This method does not perform any size checks. The behavior is undefined if the list is empty.
      */
-    inline T& frontUnchecked() noexcept {
+    constexpr T& frontUnchecked() noexcept {
         return data[0];
     }
 
@@ -1136,7 +1227,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method does not perform any size checks. The behavior is undefined if the list is empty.
      */
-    inline const T& frontUnchecked() const noexcept {
+    constexpr const T& frontUnchecked() const noexcept {
         return data[0];
     }
 
@@ -1146,7 +1237,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method does not perform any size checks. The behavior is undefined if the list is empty.
      */
-    inline T& backUnchecked() noexcept {
+    constexpr T& backUnchecked() noexcept {
         return data[len - 1];
     }
 
@@ -1156,14 +1247,14 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method does not perform any size checks. The behavior is undefined if the list is empty.
      */
-    inline const T& backUnchecked() const noexcept {
+    constexpr const T& backUnchecked() const noexcept {
         return data[len - 1];
     }
 
     /**
      * @brief Shrinks the internal capacity to fit the current size.
      */
-    inline void shrink() { resize(len); }
+    constexpr void shrink() { resize(len); }
 
     /**
      * @brief Fills the list with the specified value.
@@ -1171,7 +1262,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method replaces all elements in the list with the given value. The size of the list remains unchanged.
      */
-    inline void fill(const T& val) {
+    constexpr void fill(const T& val) {
         for (Size i = 0; i < len; i++) {
             data[i] = val;
         }
@@ -1188,8 +1279,8 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @note This method replaces all elements in the specified range with the given value.
      */
-    void fill(const T& val, Size start, Size end) {
-        if (start > end) throw ValueError("fill(): start index cannot be greater than end index");
+    constexpr void fill(const T& val, Size start, Size end) {
+        if (start > end) throw ValueError(VaStaticMessage("fill(): start index cannot be greater than end index"));
         if (end > len) throw IndexOutOfRangeError(len, end);
         if (start >= len) throw IndexOutOfRangeError(len, start);
 
@@ -1205,7 +1296,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If start is out of bounds.
      */
-    VaList sliceFrom(int32 start) const {
+    constexpr VaList sliceFrom(int32 start) const {
         if (start < 0) start += len; // handle negative indices
         if (start < 0 || start >= len) throw IndexOutOfRangeError(len, start);
 
@@ -1224,7 +1315,7 @@ class alignas(VaListRawView<T>) VaList {
      *
      * @throws IndexOutOfRangeError If end is out of bounds.
      */
-    VaList sliceTo(int32 end) const {
+    constexpr VaList sliceTo(int32 end) const {
         if (end < 0) end += len; // handle negative indices
         if (end < 0 || static_cast<Size>(end) > len) throw IndexOutOfRangeError(len, end);
 
@@ -1247,8 +1338,8 @@ class alignas(VaListRawView<T>) VaList {
      * @throws IndexOutOfRangeError If indices are invalid or out of bounds.
      * @throws ValueError If step is zero.
      */
-    VaList slice(int32 start, int32 end, int32 step = 1) const {
-        if (step == 0) throw ValueError("slice(): step cannot be zero");
+    constexpr VaList slice(int32 start, int32 end, int32 step = 1) const {
+        if (step == 0) throw ValueError(VaStaticMessage("slice(): step cannot be zero"));
 
         if (start < 0) start += len;
         if (end < 0) end += len;
@@ -1281,7 +1372,7 @@ class alignas(VaListRawView<T>) VaList {
 
 #ifdef VaLib_USE_CONCEPTS
     template <va::Addable A = T>
-    A sum() const {
+    constexpr A sum() const {
         if (len <= 0) return A{};
         A v = at(0);
         for (Size i = 1; i < len; i++) {
@@ -1298,7 +1389,7 @@ class alignas(VaListRawView<T>) VaList {
      * @return Concatenated string.
      */
     template <typename U = T>
-    tt::EnableIf<tt::IsSame<U, VaString>, VaString> join(const VaString& sep = "") const {
+    constexpr tt::EnableIf<tt::IsSame<U, VaString>, VaString> join(const VaString& sep = "") const {
         if (len == 0) return VaString();
         VaString result = data[0];
         for (Size i = 1; i < len; i++) {
@@ -1308,7 +1399,7 @@ class alignas(VaListRawView<T>) VaList {
     }
 
     template <typename U = T>
-    tt::EnableIf<tt::IsConvertible<bool, U>, bool> all() const {
+    constexpr tt::EnableIf<tt::IsConvertible<bool, U>, bool> all() const {
         for (int i = 0; i < len; i++) {
             if (!static_cast<bool>(data[i])) {
                 return false;
@@ -1319,7 +1410,7 @@ class alignas(VaListRawView<T>) VaList {
     }
 
     template <typename U = T>
-    tt::EnableIf<tt::IsConvertible<bool, U>, bool> any() const {
+    constexpr tt::EnableIf<tt::IsConvertible<bool, U>, bool> any() const {
         for (int i = 0; i < len; i++) {
             if (static_cast<bool>(data[i])) {
                 return true;
@@ -1332,7 +1423,7 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Returns the number of elements currently stored in the list.
      * @return The current length of the list.
      */
-    inline Size getLength() const noexcept {
+    constexpr Size getLength() const noexcept {
         return this->len;
     }
 
@@ -1340,7 +1431,7 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Returns the total capacity of the list's internal buffer.
      * @return The current capacity of the list.
      */
-    inline Size getCapacity() const noexcept {
+    constexpr Size getCapacity() const noexcept {
         return this->cap;
     }
 
@@ -1348,32 +1439,32 @@ class alignas(VaListRawView<T>) VaList {
      * @brief Returns a pointer to the internal data array.
      * @return Pointer to the data.
      */
-    inline T* dataPtr() { return data; }
+    constexpr T* dataPtr() { return data; }
 
     /**
      * @brief Returns a const pointer to the internal data array.
      * @return Const pointer to the data.
      */
-    inline const T* dataPtr() const { return data; }
+    constexpr const T* dataPtr() const { return data; }
 
     /**
      * @brief Checks if the list is empty.
      * @return True if the list has no elements, false otherwise.
      */
-    inline bool isEmpty() const { return len <= 0; }
+    constexpr bool isEmpty() const { return len <= 0; }
 
     /**
      * @brief Converts the list to a boolean.
      * @return True if the list is not empty.
      */
-    inline explicit operator bool() const { return len > 0; }
+    constexpr explicit operator bool() const { return len > 0; }
 
     /**
      * @brief Clears the list, destroying all elements and releasing memory.
      */
-    void clear() {
+    constexpr void clear() {
         deleteObjects();
-        std::free(data);
+        deallocate(data, cap);
         data = nullptr;
         len = cap = 0;
     }
@@ -1434,15 +1525,14 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to concatenate.
      * @return New combined list.
      */
-    friend VaList operator+(const VaList& lhs, const VaList& rhs) {
+    friend constexpr VaList operator+(const VaList& lhs, const VaList& rhs) {
         VaList result;
         result.resize(lhs.len + rhs.len);
-        result.len = lhs.len + rhs.len;
         for (Size i = 0; i < lhs.len; i++) {
-            result.data[i] = lhs.data[i];
+            std::construct_at(&result.data[result.len++], lhs.data[i]);
         }
         for (Size i = 0; i < rhs.len; i++) {
-            result.data[lhs.len + i] = rhs.data[i];
+            std::construct_at(&result.data[result.len++], rhs.data[i]);
         }
 
         return result;
@@ -1453,12 +1543,12 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to append.
      * @return Reference to this list.
      */
-    friend VaList& operator+=(VaList& lhs, const VaList& rhs) {
-        lhs.resize(lhs.len + rhs.len);
-        for (Size i = 0; i < rhs.len; i++) {
-            lhs.data[lhs.len + i] = rhs.data[i];
+    friend constexpr VaList& operator+=(VaList& lhs, const VaList& rhs) {
+        const Size count = rhs.len;
+        lhs.reserve(lhs.len + count);
+        for (Size i = 0; i < count; i++) {
+            std::construct_at(&lhs.data[lhs.len++], rhs.data[i]);
         }
-        lhs.len += rhs.len;
         return lhs;
     }
 
@@ -1467,7 +1557,7 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to compare with.
      * @return True if the lists are equal, false otherwise.
      */
-    friend bool operator==(const VaList& lhs, const VaList& rhs) {
+    friend constexpr bool operator==(const VaList& lhs, const VaList& rhs) {
         if (lhs.len != rhs.len) return false;
         if constexpr (!tt::HasEqualityOperator_v<T>) {
             return std::memcmp(lhs.data, rhs.data, lhs.len * sizeof(T)) == 0;
@@ -1484,14 +1574,14 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to compare with.
      * @return True if the lists are not equal, false otherwise.
      */
-    friend bool operator!=(const VaList& lhs, const VaList& rhs) { return !(lhs == rhs); }
+    friend constexpr bool operator!=(const VaList& lhs, const VaList& rhs) { return !(lhs == rhs); }
 
     /**
      * @brief Compares two lists for less-than.
      * @param other The list to compare with.
      * @return True if this list is lexicographically less than the other.
      */
-    friend bool operator<(const VaList& lhs, const VaList& rhs) {
+    friend constexpr bool operator<(const VaList& lhs, const VaList& rhs) {
         Size minLen = std::min(lhs.len, rhs.len);
         for (Size i = 0; i < minLen; i++) {
             if (lhs.data[i] < rhs.data[i]) return true;
@@ -1505,7 +1595,7 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to compare with.
      * @return True if this list is lexicographically greater than the other.
      */
-    friend bool operator>(const VaList& lhs, const VaList& rhs) {
+    friend constexpr bool operator>(const VaList& lhs, const VaList& rhs) {
         return rhs < lhs;
     }
 
@@ -1514,7 +1604,7 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to compare with.
      * @return True if this list is lexicographically less than or equal to the other.
      */
-    friend bool operator<=(const VaList& lhs, const VaList& rhs) {
+    friend constexpr bool operator<=(const VaList& lhs, const VaList& rhs) {
         return !(rhs < lhs);
     }
 
@@ -1523,12 +1613,12 @@ class alignas(VaListRawView<T>) VaList {
      * @param other The list to compare with.
      * @return True if this list is lexicographically greater than or equal to the other.
      */
-    friend bool operator>=(const VaList& lhs, const VaList& rhs) {
+    friend constexpr bool operator>=(const VaList& lhs, const VaList& rhs) {
         return !(lhs < rhs);
     }
 
     template < typename Iterable, typename = tt::EnableIf<!tt::IsSame<tt::RemoveReference<tt::RemoveCV<Iterable>>, VaList>> >
-    friend bool operator==(const VaList& lhs, const Iterable& rhs) {
+    friend constexpr bool operator==(const VaList& lhs, const Iterable& rhs) {
         auto leftIt = lhs.begin();
         auto rightIt = std::begin(rhs);
         auto rhsEnd = std::end(rhs);
@@ -1543,12 +1633,12 @@ class alignas(VaListRawView<T>) VaList {
     }
 
     template < typename Iterable, typename = tt::EnableIf<!tt::IsSame<tt::RemoveReference<tt::RemoveCV<Iterable>>, VaList>> >
-    friend bool operator!=(const VaList& lhs, const Iterable& rhs) {
+    friend constexpr bool operator!=(const VaList& lhs, const Iterable& rhs) {
         return !(lhs == rhs);
     }
 
     template < typename Iterable, typename = tt::EnableIf<!tt::IsSame<tt::RemoveReference<tt::RemoveCV<Iterable>>, VaList>> >
-    friend bool operator<(const VaList& lhs, const Iterable& rhs) {
+    friend constexpr bool operator<(const VaList& lhs, const Iterable& rhs) {
         auto leftIt = lhs.begin();
         auto rightIt = std::begin(rhs);
         auto rhsEnd = std::end(rhs);
@@ -1564,17 +1654,17 @@ class alignas(VaListRawView<T>) VaList {
     }
 
     template < typename Iterable, typename = tt::EnableIf<!tt::IsSame<tt::RemoveReference<tt::RemoveCV<Iterable>>, VaList>> >
-    friend bool operator>(const VaList& lhs, const Iterable& rhs) {
+    friend constexpr bool operator>(const VaList& lhs, const Iterable& rhs) {
         return rhs < lhs;
     }
 
     template < typename Iterable, typename = tt::EnableIf<!tt::IsSame<tt::RemoveReference<tt::RemoveCV<Iterable>>, VaList>> >
-    friend bool operator<=(const VaList& lhs, const Iterable& rhs) {
+    friend constexpr bool operator<=(const VaList& lhs, const Iterable& rhs) {
         return !(rhs < lhs);
     }
 
     template < typename Iterable, typename = tt::EnableIf<!tt::IsSame<tt::RemoveReference<tt::RemoveCV<Iterable>>, VaList>> >
-    friend bool operator>=(const VaList& lhs, const Iterable& rhs) {
+    friend constexpr bool operator>=(const VaList& lhs, const Iterable& rhs) {
         return !(lhs < rhs);
     }
 
@@ -1584,14 +1674,14 @@ class alignas(VaListRawView<T>) VaList {
      * @param list The list to query.
      * @return Size of the list.
      */
-    friend inline Size len(const VaList& list) noexcept { return list.len; }
+    friend constexpr Size len(const VaList& list) noexcept { return list.len; }
 
     /**
      * @brief Returns the capacity of the list.
      * @param list The list to query.
      * @return Capacity of the list.
      */
-    friend inline Size cap(const VaList& list) noexcept { return list.cap; }
+    friend constexpr Size cap(const VaList& list) noexcept { return list.cap; }
 
   public iterators:
     using Iterator = T*;
@@ -1599,23 +1689,23 @@ class alignas(VaListRawView<T>) VaList {
     using ReverseIterator = std::reverse_iterator<Iterator>;
     using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
 
-    inline Iterator begin() { return data; }
-    inline Iterator end() { return data + len; }
+    constexpr Iterator begin() { return data; }
+    constexpr Iterator end() { return data + len; }
 
-    inline ConstIterator begin() const { return data; }
-    inline ConstIterator end() const { return data + len; }
+    constexpr ConstIterator begin() const { return data; }
+    constexpr ConstIterator end() const { return data + len; }
 
-    inline ConstIterator cbegin() const { return data; }
-    inline ConstIterator cend() const { return data + len; }
+    constexpr ConstIterator cbegin() const { return data; }
+    constexpr ConstIterator cend() const { return data + len; }
 
-    inline ReverseIterator rbegin() { return ReverseIterator(end()); }
-    inline ReverseIterator rend() { return ReverseIterator(begin()); }
+    constexpr ReverseIterator rbegin() { return ReverseIterator(end()); }
+    constexpr ReverseIterator rend() { return ReverseIterator(begin()); }
 
-    inline ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); }
-    inline ConstReverseIterator rend() const { return ConstReverseIterator(begin()); }
+    constexpr ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); }
+    constexpr ConstReverseIterator rend() const { return ConstReverseIterator(begin()); }
 
-    inline ConstReverseIterator crbegin() const { return ConstReverseIterator(cend()); }
-    inline ConstReverseIterator crend() const { return ConstReverseIterator(cbegin()); }
+    constexpr ConstReverseIterator crbegin() const { return ConstReverseIterator(cend()); }
+    constexpr ConstReverseIterator crend() const { return ConstReverseIterator(cbegin()); }
 };
 
 namespace va {
@@ -1652,6 +1742,24 @@ VaList<New> map(VaFunc<Old(const New&)> mod, const VaList<Old>& data) {
 
     return result;
 }
+
+/**
+ * @brief map() for any callable (lambda, functor, function pointer); the result type is deduced.
+ *
+ * @note The callable is invoked directly, without being wrapped into a VaFunc, so passing a lambda
+ *       neither copies nor allocates.
+ */
+template <typename Old, typename Fn, typename New = tt::Decay<std::invoke_result_t<Fn&, const Old&>>>
+constexpr VaList<New> map(Fn&& mod, const VaList<Old>& data) {
+    VaList<New> result;
+    result.reserve(len(data));
+
+    for (Size i = 0; i < len(data); i++) {
+        result.append(mod(data[i]));
+    }
+
+    return result;
+}
 // @}
 
 /**
@@ -1685,6 +1793,19 @@ VaList<T> filter(VaFunc<bool(T)> predicate, const VaList<T>& data) {
 
     return result;
 }
+
+/// @brief filter() for any callable; invoked directly, without a VaFunc.
+template <typename T, typename Fn, typename = tt::EnableIf<std::is_invocable_r_v<bool, Fn&, const T&>>>
+constexpr VaList<T> filter(Fn&& predicate, const VaList<T>& data) {
+    VaList<T> result;
+    for (Size i = 0; i < len(data); i++) {
+        if (predicate(data[i])) {
+            result.append(data[i]);
+        }
+    }
+
+    return result;
+}
 // @}
 
 /**
@@ -1696,6 +1817,7 @@ VaList<T> filter(VaFunc<bool(T)> predicate, const VaList<T>& data) {
  * @param initial Initial value for the accumulator.
  * @return The final reduced value.
  */
+// @{
 template <typename T, typename R>
 R reduce(VaFunc<R(R, T)> reducer, const VaList<T>& data, R initial) {
     R acc = initial;
@@ -1705,6 +1827,17 @@ R reduce(VaFunc<R(R, T)> reducer, const VaList<T>& data, R initial) {
     return acc;
 }
 
+/// @brief reduce() for any callable; invoked directly, without a VaFunc.
+template <typename T, typename R, typename Fn, typename = tt::EnableIf<std::is_invocable_r_v<R, Fn&, R, const T&>>>
+constexpr R reduce(Fn&& reducer, const VaList<T>& data, R initial) {
+    R acc = initial;
+    for (Size i = 0; i < len(data); i++) {
+        acc = reducer(acc, data[i]);
+    }
+    return acc;
+}
+// @}
+
 /**
  * @brief Returns a new list of (index, element) pairs.
  * @tparam T Element type.
@@ -1752,11 +1885,11 @@ VaList<VaPair<T1, T2>> zip(const VaList<T1>& a, const VaList<T2>& b) {
  * @return A new VaList with elements in reverse order.
  */
 template <typename T>
-VaList<T> reversed(const VaList<T>& data) {
+constexpr VaList<T> reversed(const VaList<T>& data) {
     VaList<T> result;
     result.reserve(len(data));
     for (Size i = len(data); i > 0; i--) {
-        result.append(data[i]);
+        result.append(data[i - 1]);
     }
     return result;
 }
@@ -0,0 +1,258 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/CacheStats.hpp>
+#include <VaLib/Types/Dict.hpp>
+
+#include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <utility>
+
+namespace va::detail {
+
+/// @brief Cost of an entry of a cache without a weigher: the size of the key and the value.
+template <typename K, typename V>
+inline constexpr Size cacheDefaultCost = sizeof(K) + sizeof(V);
+
+} // namespace va::detail
+
+/**
+ * @class VaLruCache A bounded key-value cache that evicts the least recently used entry first.
+ *
+ * @tparam K The key type (must support equality comparison and hashing).
+ * @tparam V The value type.
+ * @tparam Hash The hash function type (defaults to `VaHash<K>`).
+ *
+ * The entries live in a VaDict whose insertion order is the recency order: the front is the least
+ * recently used entry, the back the most recently used one. get() and put() move an entry to the
+ * back in O(1); eviction removes it from the front in O(1).
+ *
+ * The cache can be bounded by a number of entries, by a total cost in bytes, or both. The cost of
+ * an entry is given by a weigher function (defaulting to sizeof(K) + sizeof(V)) and computed once,
+ * when the entry is stored; getBytes() is their sum.
+ *
+ * @code
+ * VaLruCache<VaString, Page> pages(1000);
+ * pages.setEvictionCallback([](const VaString& url, Page& page) { page.flush(); });
+ *
+ * if (Page* page = pages.get(url)) return *page;
+ * @endcode
+ *
+ * @warning Not thread-safe; use VaConcurrentLruCache for a cache shared between threads.
+ */
+template <typename K, typename V, typename Hash = VaHash<K>>
+class VaLruCache {
+  public:
+    using KeyType = K;
+    using ValueType = V;
+    using HashType = Hash;
+    using Weigher = VaFunc<Size(const K&, const V&)>;
+    using EvictionCallback = VaFunc<void(const K&, V&)>;
+
+  protected:
+    struct Slot {
+        V value;
+        Size cost;
+    };
+
+    VaDict<K, Slot, Hash> entries;
+    Size maxEntries;
+    Size maxBytes;
+    Size bytes = 0;
+    Weigher weigher;
+    EvictionCallback onEvict;
+    VaCacheStats stats;
+
+    inline Size costOf(const K& key, const V& value) const {
+        return weigher ? weigher(key, value) : va::detail::cacheDefaultCost<K, V>;
+    }
+
+    /**
+     * @brief Evicts the least recently used entry and reports it to the eviction callback.
+     */
+    void evictOne() {
+        Slot& slot = entries.valueAtFront();
+        if (onEvict) onEvict(entries.keyAtFront(), slot.value);
+
+        bytes -= slot.cost;
+        entries.del(entries.keyAtFront());
+        stats.evictions++;
+    }
+
+    /**
+     * @brief Evicts entries until an entry of the given cost fits.
+     * @param extraEntries Number of entries about to be added (0 or 1).
+     * @param extraBytes Cost of the entries about to be added.
+     */
+    void makeRoom(Size extraEntries, Size extraBytes) {
+        while (!entries.isEmpty() && (
+            (maxEntries && entries.getSize() + extraEntries > maxEntries) || (maxBytes && bytes + extraBytes > maxBytes)
+        )) {
+            evictOne();
+        }
+    }
+
+    inline void reserveFor(Size count) {
+        if (count) entries.reserve(count + count / 3 + 2); // Never rehashes once full
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty cache.
+     * @param maxEntries Maximum number of entries; 0 means no entry limit.
+     * @param maxBytes Maximum total cost of the entries; 0 means no byte limit.
+     * @param weigher Computes the cost of an entry; defaults to sizeof(K) + sizeof(V).
+     */
+    explicit VaLruCache(Size maxEntries, Size maxBytes = 0, Weigher weigher = nullptr)
+        : maxEntries(maxEntries), maxBytes(maxBytes), weigher(std::move(weigher)) {
+        reserveFor(maxEntries);
+    }
+
+    /**
+     * @brief Looks up an entry and marks it as the most recently used one.
+     * @param key The key to look up.
+     * @return Pointer to the value, or nullptr on a miss. Valid until the cache is next modified.
+     *
+     * @note Counts a hit or a miss.
+     */
+    V* get(const K& key) {
+        Slot* slot = entries.moveToBack(key);
+        if (!slot) {
+            stats.misses++;
+            return nullptr;
+        }
+
+        stats.hits++;
+        return &slot->value;
+    }
+
+    /**
+     * @brief Looks up an entry without changing its recency or the statistics.
+     * @param key The key to look up.
+     * @return Pointer to the value, or nullptr if the key is not cached.
+     */
+    // @{
+    V* peek(const K& key) {
+        Slot* slot = entries.find(key);
+        return slot ? &slot->value : nullptr;
+    }
+    const V* peek(const K& key) const {
+        const Slot* slot = entries.find(key);
+        return slot ? &slot->value : nullptr;
+    }
+    // @}
+
+    /**
+     * @brief Inserts or replaces an entry and marks it as the most recently used one.
+     * @param key The key.
+     * @param value The value.
+     * @return true if the entry was stored; false if it alone exceeds the byte limit,
+     *         in which case an older entry under the same key is removed as well.
+     *
+     * @note Evicts least recently used entries until the new entry fits.
+     */
+    bool put(const K& key, const V& value) {
+        Size cost = costOf(key, value);
+        if (maxBytes && cost > maxBytes) {
+            del(key);
+            return false;
+        }
+
+        if (Slot* slot = entries.moveToBack(key)) {
+            slot->value = value;
+            bytes = bytes - slot->cost + cost;
+            slot->cost = cost;
+            makeRoom(0, 0); // The updated entry is at the back and fits alone, so it is never evicted
+            return true;
+        }
+
+        makeRoom(1, cost);
+        entries.putAtBack(key, Slot{value, cost});
+        bytes += cost;
+        return true;
+    }
+
+    /**
+     * @brief Returns the cached value for key, computing and storing it on a miss.
+     * @param key The key.
+     * @param make Callable returning the value for key; only called on a miss.
+     * @return The cached or computed value.
+     */
+    template <typename Fn>
+    V getOrCompute(const K& key, Fn&& make) {
+        if (V* value = get(key)) return *value;
+
+        V value = make(key);
+        put(key, value);
+        return value;
+    }
+
+    /**
+     * @brief Removes an entry. The eviction callback is not called.
+     * @param key The key to remove.
+     * @return true if the key was cached.
+     */
+    bool del(const K& key) {
+        Slot* slot = entries.find(key);
+        if (!slot) return false;
+
+        bytes -= slot->cost;
+        entries.del(key);
+        return true;
+    }
+
+    /**
+     * @brief Checks whether a key is cached, without changing its recency or the statistics.
+     */
+    inline bool contains(const K& key) const { return entries.contains(key); }
+
+    /**
+     * @brief Removes every entry. The eviction callback is not called; the statistics are kept.
+     */
+    void clear() {
+        entries.clear();
+        bytes = 0;
+    }
+
+    /**
+     * @brief Changes the limits, evicting least recently used entries until the cache fits.
+     * @param maxEntries New maximum number of entries; 0 means no entry limit.
+     * @param maxBytes New maximum total cost; 0 means no byte limit.
+     */
+    void setCapacity(Size maxEntries, Size maxBytes = 0) {
+        this->maxEntries = maxEntries;
+        this->maxBytes = maxBytes;
+        reserveFor(maxEntries);
+        makeRoom(0, 0);
+    }
+
+    /**
+     * @brief Sets the function called with every entry evicted to make room, right before it is destroyed.
+     *
+     * @warning The callback must not modify the cache.
+     */
+    inline void setEvictionCallback(EvictionCallback callback) { onEvict = std::move(callback); }
+
+    inline void resetStats() noexcept { stats = VaCacheStats(); }
+
+    inline const VaCacheStats& getStats() const noexcept { return stats; }
+    inline Size getSize() const noexcept { return entries.getSize(); }
+    inline Size getBytes() const noexcept { return bytes; }
+    inline Size getMaxEntries() const noexcept { return maxEntries; }
+    inline Size getMaxBytes() const noexcept { return maxBytes; }
+    inline bool isEmpty() const noexcept { return entries.isEmpty(); }
+
+    /**
+     * @brief Key of the entry that would be evicted next.
+     * @throws IndexOutOfRangeError If the cache is empty.
+     */
+    inline const K& leastRecentKey() const { return entries.keyAtFront(); }
+
+  public friends:
+    friend inline Size len(const VaLruCache& cache) { return cache.getSize(); }
+};
@@ -0,0 +1,367 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @class VaMpmcQueue A bounded, lock-free FIFO queue for any number of producer and consumer threads.
+ *        Based on Dmitry Vyukov's bounded MPMC queue: every slot carries a sequence number that tells
+ *        producers and consumers whose turn it is, so a push or pop costs one CAS on the shared position
+ *        and one release store on the slot.
+ *
+ * @tparam T Type of the stored elements. Must be nothrow move constructible.
+ *
+ * @note A slot claimed by a thread must always be filled or emptied, so elements are only moved
+ *       into and out of claimed slots. Pushing a copy of a type whose copy constructor may throw
+ *       makes the copy before claiming a slot.
+ * @note Blocking operations spin with exponential backoff and then yield; they never sleep in the kernel.
+ */
+template <typename T>
+class alignas(va::detail::cacheLineSize) VaMpmcQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "VaMpmcQueue requires a nothrow move constructible type");
+
+  protected:
+    static constexpr Size lineSize = va::detail::cacheLineSize;
+
+    struct Cell {
+        std::atomic<Size> seq; ///< Position expected by the next producer (== pos) or consumer (== pos + 1)
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        inline T* value() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    Cell* cells; ///< Ring of slots
+    Size mask;   ///< Number of slots - 1 (slots are a power of two)
+
+    alignas(lineSize) std::atomic<Size> enqueuePos; ///< Next position to push to
+    alignas(lineSize) std::atomic<Size> dequeuePos; ///< Next position to pop from
+
+    /// Largest power of two whose slots still fit in the address space
+    static constexpr Size maxCapacity = std::bit_floor(Size(-1) / sizeof(Cell));
+
+    static Size roundCapacity(Size minCap) {
+        if (minCap == 0) throw ValueError(VaStaticMessage("VaMpmcQueue capacity must be greater than 0"));
+        if (minCap > maxCapacity) throw ValueError(VaStaticMessage("VaMpmcQueue capacity is too large"));
+        Size result = 2;
+        while (result < minCap) result <<= 1;
+        return result;
+    }
+
+    static inline std::ptrdiff_t distance(Size seq, Size pos) noexcept {
+        return static_cast<std::ptrdiff_t>(seq - pos);
+    }
+
+    /**
+     * @brief Claims the next free slot.
+     * @return The cell to fill, or nullptr if the queue is full.
+     */
+    Cell* claimPush(Size& pos) noexcept {
+        pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell* cell = &cells[pos & mask];
+            std::ptrdiff_t diff = distance(cell->seq.load(std::memory_order_acquire), pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return cell;
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Claims the next filled slot.
+     * @return The cell to empty, or nullptr if the queue is empty.
+     */
+    Cell* claimPop(Size& pos) noexcept {
+        pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell* cell = &cells[pos & mask];
+            std::ptrdiff_t diff = distance(cell->seq.load(std::memory_order_acquire), pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return cell;
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    inline void publishPush(Cell* cell, Size pos) noexcept { cell->seq.store(pos + 1, std::memory_order_release); }
+    inline void publishPop(Cell* cell, Size pos) noexcept { cell->seq.store(pos + mask + 1, std::memory_order_release); }
+
+    /**
+     * @brief Moves the element out of a claimed cell and releases the cell.
+     */
+    inline T take(Cell* cell, Size pos) noexcept {
+        T value(std::move(*cell->value()));
+        cell->value()->~T();
+        publishPop(cell, pos);
+        return value;
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty queue.
+     * @param minCap Minimum number of elements the queue can hold; rounded up to a power of two (at least 2).
+     *
+     * @throws ValueError If minCap is 0, or if its power of two slots would not fit in memory.
+     */
+    explicit VaMpmcQueue(Size minCap) : enqueuePos(0), dequeuePos(0) {
+        Size capacity = roundCapacity(minCap);
+        mask = capacity - 1;
+        cells = new Cell[capacity];
+        for (Size i = 0; i < capacity; i++) cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    VaMpmcQueue(const VaMpmcQueue&) = delete;
+    VaMpmcQueue& operator=(const VaMpmcQueue&) = delete;
+
+    /**
+     * @brief Destroys the elements still in the queue.
+     *
+     * @warning No thread may use the queue during destruction.
+     */
+    ~VaMpmcQueue() {
+        Size end = enqueuePos.load(std::memory_order_relaxed);
+        for (Size pos = dequeuePos.load(std::memory_order_relaxed); pos != end; pos++) {
+            cells[pos & mask].value()->~T();
+        }
+        delete[] cells;
+    }
+
+    /**
+     * @brief Constructs an element and pushes it if there is room.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return true if the element was pushed, false if the queue is full.
+     *
+     * @note If T is not nothrow constructible from args, the element is constructed before a slot is claimed.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            Size pos;
+            Cell* cell = claimPush(pos);
+            if (!cell) return false;
+
+            new (cell->storage) T(std::forward<Args>(args)...);
+            publishPush(cell, pos);
+            return true;
+        } else {
+            T value(std::forward<Args>(args)...);
+            return tryEmplace(std::move(value));
+        }
+    }
+
+    /**
+     * @brief Pushes an element if there is room.
+     * @param value The value to push.
+     * @return true if the element was pushed, false if the queue is full.
+     */
+    inline bool tryPush(const T& value) { return tryEmplace(value); }
+    inline bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    /**
+     * @brief Constructs an element and pushes it, waiting while the queue is full.
+     * @param args Arguments forwarded to the constructor of T.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            Size pos;
+            Cell* cell;
+            va::detail::Backoff backoff;
+            while (!(cell = claimPush(pos))) backoff.wait();
+
+            new (cell->storage) T(std::forward<Args>(args)...);
+            publishPush(cell, pos);
+        } else {
+            T value(std::forward<Args>(args)...);
+            emplace(std::move(value));
+        }
+    }
+
+    /**
+     * @brief Pushes an element, waiting while the queue is full.
+     * @param value The value to push.
+     */
+    inline void push(const T& value) { emplace(value); }
+    inline void push(T&& value) { emplace(std::move(value)); }
+
+    /**
+     * @brief Pushes as many of the given elements as currently fit, claiming their slots with a single CAS.
+     * @param items Pointer to the elements to copy.
+     * @param count Number of elements.
+     * @return Number of elements pushed (a prefix of items).
+     *
+     * @note For types whose copy constructor may throw, elements are pushed one at a time.
+     */
+    Size tryPushBatch(const T* items, Size count) {
+        if constexpr (!std::is_nothrow_copy_constructible_v<T>) {
+            Size done = 0;
+            while (done < count && tryPush(items[done])) done++;
+            return done;
+        } else {
+            if (count == 0) return 0;
+
+            Size pos = enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                Size n = 0;
+                std::ptrdiff_t diff = 0;
+                while (n < count) {
+                    diff = distance(cells[(pos + n) & mask].seq.load(std::memory_order_acquire), pos + n);
+                    if (diff != 0) break;
+                    n++;
+                }
+
+                if (n == 0) {
+                    if (diff < 0) return 0;
+                    pos = enqueuePos.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (enqueuePos.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                    for (Size i = 0; i < n; i++) {
+                        Cell* cell = &cells[(pos + i) & mask];
+                        new (cell->storage) T(items[i]);
+                        publishPush(cell, pos + i);
+                    }
+                    return n;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Pushes all given elements, waiting for room as needed.
+     * @param items Pointer to the elements to copy.
+     * @param count Number of elements.
+     */
+    void pushBatch(const T* items, Size count) {
+        va::detail::Backoff backoff;
+        while (count > 0) {
+            Size n = tryPushBatch(items, count);
+            if (n == 0) {
+                backoff.wait();
+                continue;
+            }
+            backoff.reset();
+            items += n;
+            count -= n;
+        }
+    }
+
+    /**
+     * @brief Pops the front element if there is one.
+     * @param out Receives the popped element.
+     * @return true if an element was popped, false if the queue is empty.
+     */
+    bool tryPop(T& out) {
+        Size pos;
+        Cell* cell = claimPop(pos);
+        if (!cell) return false;
+
+        out = take(cell, pos);
+        return true;
+    }
+
+    /**
+     * @brief Pops the front element, waiting while the queue is empty.
+     * @return The popped element.
+     */
+    T pop() {
+        Size pos;
+        Cell* cell;
+        va::detail::Backoff backoff;
+        while (!(cell = claimPop(pos))) backoff.wait();
+
+        return take(cell, pos);
+    }
+
+    /**
+     * @brief Pops up to maxCount elements that are currently available, claiming their slots with a single CAS.
+     * @param out Array receiving the popped elements (move-assigned).
+     * @param maxCount Maximum number of elements to pop.
+     * @return Number of elements popped.
+     *
+     * @note If a move assignment into out throws, the remaining claimed elements are destroyed.
+     */
+    Size tryPopBatch(T* out, Size maxCount) {
+        if (maxCount == 0) return 0;
+
+        Size pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Size n = 0;
+            std::ptrdiff_t diff = 0;
+            while (n < maxCount) {
+                diff = distance(cells[(pos + n) & mask].seq.load(std::memory_order_acquire), pos + n + 1);
+                if (diff != 0) break;
+                n++;
+            }
+
+            if (n == 0) {
+                if (diff < 0) return 0;
+                pos = dequeuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (dequeuePos.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                Size i = 0;
+                try {
+                    for (; i < n; i++) out[i] = take(&cells[(pos + i) & mask], pos + i);
+                } catch (...) {
+                    for (i++; i < n; i++) take(&cells[(pos + i) & mask], pos + i);
+                    throw;
+                }
+                return n;
+            }
+        }
+    }
+
+    /**
+     * @brief Waits until at least one element is available, then pops up to maxCount elements.
+     * @param out Array receiving the popped elements (move-assigned).
+     * @param maxCount Maximum number of elements to pop.
+     * @return Number of elements popped (at least 1 if maxCount > 0).
+     */
+    Size popBatch(T* out, Size maxCount) {
+        if (maxCount == 0) return 0;
+
+        va::detail::Backoff backoff;
+        Size n;
+        while ((n = tryPopBatch(out, maxCount)) == 0) backoff.wait();
+        return n;
+    }
+
+    /**
+     * @brief Returns the number of elements in the queue.
+     *
+     * @note The value is only a snapshot while other threads are active.
+     */
+    inline Size getLength() const noexcept {
+        Size dequeued = dequeuePos.load(std::memory_order_acquire);
+        Size enqueued = enqueuePos.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    inline Size getCapacity() const noexcept { return mask + 1; }
+    inline bool isEmpty() const noexcept { return getLength() == 0; }
+
+  public friends:
+    friend inline Size len(const VaMpmcQueue& queue) { return queue.getLength(); }
+    friend inline Size cap(const VaMpmcQueue& queue) { return queue.mask + 1; }
+};
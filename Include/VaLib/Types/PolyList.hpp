@@ -0,0 +1,239 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/Any.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+
+#include <VaLib/FuncTools/FuncRef.hpp>
+#include <VaLib/Mem/UniquePtr.hpp>
+
+#include <utility>
+
+/**
+ * @class VaPolyList A container of objects of different types derived from Base, stored by value
+ *        with one contiguous segment per concrete type.
+ *
+ * @tparam Base The common base class.
+ *
+ * Compared with a VaList<VaUniquePtr<Base>>, there is no allocation per element, the objects of a
+ * type are adjacent in memory, and iterating visits all objects of one type before the next type,
+ * so virtual calls keep hitting the same target and stay well predicted.
+ *
+ * forEach<Ts...>() goes one step further: for the listed types the callback receives the concrete
+ * type (`Derived&` instead of `Base&`), so calls through it are resolved statically and can be
+ * inlined (fully so when the types are `final`). Objects of unlisted types are passed as `Base&`.
+ *
+ * @code
+ * VaPolyList<Shape> shapes;
+ * shapes.emplace<Circle>(1.0);
+ * shapes.emplace<Square>(2.0);
+ *
+ * float64 total = 0;
+ * shapes.forEach<Circle, Square>([&total](const auto& shape) { total += shape.area(); });
+ * for (Circle& circle: shapes.segment<Circle>()) circle.radius *= 2;
+ * @endcode
+ *
+ * @note Iteration order is by segment (in order of the first insertion of each type), then by
+ *       insertion within a segment; the overall insertion order is not kept.
+ * @warning An object is stored as exactly the type it was inserted as. Like in a VaList, adding an
+ *          object may move the others of its type, invalidating references to them.
+ */
+template <typename Base>
+class VaPolyList {
+  protected:
+    struct Segment {
+        VaTypeId type;
+
+        explicit Segment(VaTypeId type) : type(type) {}
+        virtual ~Segment() = default;
+
+        virtual Size getLength() const noexcept = 0;
+        virtual void clear() noexcept = 0;
+        virtual void forEach(VaFuncRef<void(Base&)> fn) = 0;
+        virtual void forEach(VaFuncRef<void(const Base&)> fn) const = 0;
+    };
+
+    template <typename T>
+    struct TypedSegment final: Segment {
+        VaList<T> items;
+
+        TypedSegment() : Segment(va::typeId<T>()) {}
+
+        Size getLength() const noexcept override { return items.getLength(); }
+        void clear() noexcept override { items.clear(); }
+
+        void forEach(VaFuncRef<void(Base&)> fn) override {
+            for (T& item: items) fn(item);
+        }
+        void forEach(VaFuncRef<void(const Base&)> fn) const override {
+            for (const T& item: items) fn(item);
+        }
+    };
+
+    VaList<VaUniquePtr<Segment>> segments;
+    Size size = 0;
+
+    template <typename T>
+    static constexpr void checkType() {
+        static_assert(tt::IsBaseOf<Base, T>, "VaPolyList: the type must derive from Base");
+        static_assert(!tt::IsConst<T> && !tt::IsReference<T>, "VaPolyList: the type must be a plain object type");
+    }
+
+    template <typename T>
+    TypedSegment<T>* findSegment() const noexcept {
+        for (const VaUniquePtr<Segment>& segment: segments) {
+            if (segment->type == va::typeId<T>()) return static_cast<TypedSegment<T>*>(segment.get());
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    TypedSegment<T>& segmentFor() {
+        if (TypedSegment<T>* found = findSegment<T>()) return *found;
+
+        TypedSegment<T>* created = new TypedSegment<T>();
+        segments.append(VaUniquePtr<Segment>(created));
+        return *created;
+    }
+
+    /**
+     * @brief Calls fn on every object of the segment, as the first of Ts matching its type or as Base.
+     */
+    template <typename Self, typename F, typename T, typename... Rest>
+    static void forEachIn(Self& segment, F& fn) {
+        if (segment.type == va::typeId<T>()) {
+            using Typed = tt::Conditional<tt::IsConst<Self>, const TypedSegment<T>, TypedSegment<T>>;
+            for (auto& item: static_cast<Typed&>(segment).items) fn(item);
+        } else if constexpr (sizeof...(Rest) > 0) {
+            forEachIn<Self, F, Rest...>(segment, fn);
+        } else {
+            segment.forEach(fn);
+        }
+    }
+
+  public:
+    VaPolyList() = default;
+
+    VaPolyList(const VaPolyList&) = delete;
+    VaPolyList& operator=(const VaPolyList&) = delete;
+
+    VaPolyList(VaPolyList&& other) noexcept : segments(std::move(other.segments)), size(other.size) { other.size = 0; }
+
+    VaPolyList& operator=(VaPolyList&& other) noexcept {
+        if (this != &other) {
+            segments = std::move(other.segments);
+            size = other.size;
+            other.size = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Constructs an object of type T at the end of its segment.
+     * @tparam T The concrete type, derived from Base.
+     * @param args The constructor arguments.
+     * @return A reference to the new object.
+     */
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args) {
+        checkType<T>();
+        T& item = segmentFor<T>().items.appendEmplace(std::forward<Args>(args)...);
+        size++;
+        return item;
+    }
+
+    /**
+     * @brief Appends a copy of value (or moves it), stored as its own type.
+     * @return A reference to the stored object.
+     */
+    template <typename T>
+    tt::Decay<T>& append(T&& value) {
+        return emplace<tt::Decay<T>>(std::forward<T>(value));
+    }
+
+    /**
+     * @brief Reserves room for count objects of type T.
+     */
+    template <typename T>
+    void reserve(Size count) {
+        checkType<T>();
+        segmentFor<T>().items.reserve(count);
+    }
+
+    /**
+     * @brief Calls fn on every object, segment by segment.
+     * @tparam Ts Concrete types passed to fn as themselves; objects of other types are passed as Base.
+     * @param fn A callable taking `Base&` and each of `Ts&`; typically a generic lambda.
+     */
+    // @{
+    template <typename... Ts, typename F>
+    void forEach(F&& fn) {
+        for (VaUniquePtr<Segment>& segment: segments) {
+            if constexpr (sizeof...(Ts) == 0) {
+                segment->forEach(fn);
+            } else {
+                forEachIn<Segment, F, Ts...>(*segment.get(), fn);
+            }
+        }
+    }
+    template <typename... Ts, typename F>
+    void forEach(F&& fn) const {
+        for (const VaUniquePtr<Segment>& segment: segments) {
+            if constexpr (sizeof...(Ts) == 0) {
+                static_cast<const Segment&>(*segment.get()).forEach(fn);
+            } else {
+                forEachIn<const Segment, F, Ts...>(*segment.get(), fn);
+            }
+        }
+    }
+    // @}
+
+    /**
+     * @brief The objects of type T, contiguous in memory.
+     * @return A slice over the segment of T; empty if there is none.
+     */
+    // @{
+    template <typename T>
+    VaSlice<T> segment() noexcept {
+        TypedSegment<T>* found = findSegment<T>();
+        return found ? VaSlice<T>(found->items.dataPtr(), found->items.getLength()) : VaSlice<T>(nullptr, Size(0));
+    }
+    template <typename T>
+    VaSlice<const T> segment() const noexcept {
+        const TypedSegment<T>* found = findSegment<T>();
+        return found ? VaSlice<const T>(found->items.dataPtr(), found->items.getLength()) : VaSlice<const T>(nullptr, Size(0));
+    }
+    // @}
+
+    /**
+     * @brief Number of objects of type T.
+     */
+    template <typename T>
+    Size count() const noexcept {
+        const TypedSegment<T>* found = findSegment<T>();
+        return found ? found->items.getLength() : 0;
+    }
+
+    /**
+     * @brief Destroys every object. The segments are kept, with their capacity.
+     */
+    void clear() noexcept {
+        for (VaUniquePtr<Segment>& segment: segments) segment->clear();
+        size = 0;
+    }
+
+    inline Size getSize() const noexcept { return size; }
+    inline bool isEmpty() const noexcept { return size == 0; }
+
+    /// @brief Number of segments, i.e. of distinct types inserted so far.
+    inline Size getSegmentCount() const noexcept { return segments.getLength(); }
+
+  public friends:
+    friend inline Size len(const VaPolyList& list) { return list.getSize(); }
+};
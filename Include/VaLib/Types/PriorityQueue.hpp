@@ -0,0 +1,336 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/Heap.hpp>
+#include <VaLib/Types/List.hpp>
+
+#include <functional>
+#include <utility>
+
+/**
+ * @class VaPriorityQueue An indexed d-ary heap whose entries can be re-prioritised through handles.
+ *
+ * @tparam T Type of the stored values.
+ * @tparam Priority Type of the priorities.
+ * @tparam Compare Strict weak ordering on priorities; top() is an entry whose priority nothing
+ *         compares before. The default std::less gives a min-queue, as used by Dijkstra or A*.
+ * @tparam Arity Number of children per node (4 by default, see VaHeap).
+ *
+ * push() returns a Handle that stays valid until its entry leaves the queue. Through it the
+ * priority of the entry can be changed in O(log n) with decreaseKey(), increaseKey() or
+ * update(), and the entry can be removed with erase(). Handles of removed entries are detected
+ * (a generation counter guards against reuse of the slot) and rejected with KeyNotFoundError.
+ *
+ * @note "Decrease" and "increase" are meant in the order given by Compare: decreaseKey() moves an
+ *       entry towards the top, increaseKey() away from it.
+ * @note The comparator must not throw.
+ */
+template <typename T, typename Priority = T, typename Compare = std::less<Priority>, Size Arity = 4>
+class VaPriorityQueue {
+    static_assert(Arity >= 2, "VaPriorityQueue arity must be at least 2");
+
+  public:
+    /**
+     * @brief Identifies an entry of the queue.
+     */
+    class Handle {
+      protected:
+        Size slot = Size(-1);
+        uint32 gen = 0;
+
+        Handle(Size slot, uint32 gen) : slot(slot), gen(gen) {}
+
+        friend class VaPriorityQueue;
+
+      public:
+        /// @brief Constructs a handle that refers to no entry.
+        Handle() = default;
+
+        friend inline bool operator==(const Handle& lhs, const Handle& rhs) {
+            return lhs.slot == rhs.slot && lhs.gen == rhs.gen;
+        }
+        friend inline bool operator!=(const Handle& lhs, const Handle& rhs) { return !(lhs == rhs); }
+    };
+
+  protected:
+    static constexpr Size npos = Size(-1);
+
+    struct Entry {
+        Priority priority;
+        Size slot; ///< Index into slots, which records where this entry is in the heap
+        T value;
+    };
+
+    struct Slot {
+        Size pos;   ///< Index of the entry in the heap, or npos if the slot is free
+        uint32 gen; ///< Incremented whenever the slot is freed
+    };
+
+    /// @brief Orders heap entries by priority.
+    struct EntryCompare {
+        Compare* comp;
+        inline bool operator()(const Entry& lhs, const Entry& rhs) const { return (*comp)(lhs.priority, rhs.priority); }
+    };
+
+    /// @brief Keeps the slot table in sync while entries move through the heap.
+    struct TrackSlot {
+        Slot* slots;
+        inline void operator()(const Entry& entry, Size pos) const noexcept { slots[entry.slot].pos = pos; }
+    };
+
+    VaList<Entry> heap;
+    VaList<Slot> slots;
+    VaList<Size> freeSlots;
+    [[no_unique_address]] Compare comp;
+
+    inline EntryCompare entryCompare() noexcept { return EntryCompare{&comp}; }
+    inline TrackSlot tracker() noexcept { return TrackSlot{slots.dataPtr()}; }
+
+    inline void siftUp(Size pos) {
+        EntryCompare ec = entryCompare();
+        va::detail::heapSiftUp<Arity>(heap.dataPtr(), pos, ec, tracker());
+    }
+
+    inline void siftDown(Size pos) {
+        EntryCompare ec = entryCompare();
+        va::detail::heapSiftDown<Arity>(heap.dataPtr(), len(heap), pos, ec, tracker());
+    }
+
+    /**
+     * @brief Returns the heap position of the entry the handle refers to.
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     */
+    Size positionOf(const Handle& handle) const {
+        if (handle.slot >= len(slots)) throw KeyNotFoundError(VaStaticMessage("handle does not belong to this queue"));
+
+        const Slot& slot = slots[handle.slot];
+        if (slot.pos == npos || slot.gen != handle.gen) throw KeyNotFoundError(VaStaticMessage("handle refers to a removed entry"));
+        return slot.pos;
+    }
+
+    /**
+     * @brief Removes the entry at pos from the heap and frees its slot.
+     */
+    T removeAt(Size pos) {
+        freeSlots.append(heap[pos].slot);
+        Entry removed = heap.pop();
+
+        if (pos < len(heap)) {
+            std::swap(removed, heap[pos]);
+            slots[heap[pos].slot].pos = pos;
+
+            EntryCompare ec = entryCompare();
+            if (pos > 0 && ec(heap[pos], heap[(pos - 1) / Arity])) {
+                siftUp(pos);
+            } else {
+                siftDown(pos);
+            }
+        }
+
+        Slot& slot = slots[removed.slot];
+        slot.pos = npos;
+        slot.gen++;
+        return std::move(removed.value);
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty queue.
+     * @param comp The comparator.
+     */
+    explicit VaPriorityQueue(Compare comp = Compare()) : comp(std::move(comp)) {}
+
+    /**
+     * @brief Adds a value with the given priority in O(log n).
+     * @param value The value to add.
+     * @param priority Its priority.
+     * @return A handle to the new entry.
+     */
+    Handle push(T value, Priority priority) {
+        bool reuse = !freeSlots.isEmpty();
+        Size slotIndex = reuse ? freeSlots.back() : len(slots);
+        if (!reuse) slots.append(Slot{npos, 0});
+
+        heap.append(Entry{std::move(priority), slotIndex, std::move(value)});
+        if (reuse) freeSlots.pop();
+
+        siftUp(len(heap) - 1);
+        return Handle(slotIndex, slots[slotIndex].gen);
+    }
+
+    /**
+     * @brief Returns the value with the top priority.
+     * @throws ValueError If the queue is empty.
+     */
+    const T& top() const {
+        if (heap.isEmpty()) throw ValueError(VaStaticMessage("top() on empty priority queue"));
+        return heap[0].value;
+    }
+
+    /**
+     * @brief Returns the top priority.
+     * @throws ValueError If the queue is empty.
+     */
+    const Priority& topPriority() const {
+        if (heap.isEmpty()) throw ValueError(VaStaticMessage("topPriority() on empty priority queue"));
+        return heap[0].priority;
+    }
+
+    /**
+     * @brief Returns the handle of the top entry.
+     * @throws ValueError If the queue is empty.
+     */
+    Handle topHandle() const {
+        if (heap.isEmpty()) throw ValueError(VaStaticMessage("topHandle() on empty priority queue"));
+        Size slot = heap[0].slot;
+        return Handle(slot, slots[slot].gen);
+    }
+
+    /**
+     * @brief Removes the top entry in O(log n).
+     * @return Its value.
+     *
+     * @throws ValueError If the queue is empty.
+     */
+    T pop() {
+        if (heap.isEmpty()) throw ValueError(VaStaticMessage("pop() on empty priority queue"));
+        return removeAt(0);
+    }
+
+    /**
+     * @brief Returns the value with the top priority, or nullptr if the queue is empty.
+     */
+    const T* tryTop() const noexcept { return heap.isEmpty() ? nullptr : &heap[0].value; }
+
+    /**
+     * @brief Removes the top entry and moves its value into out, without throwing if the queue is empty.
+     * @param out Receives the value.
+     * @return True if an entry was removed, false if the queue is empty.
+     */
+    bool tryPop(T& out) {
+        if (heap.isEmpty()) return false;
+
+        out = removeAt(0);
+        return true;
+    }
+
+    /**
+     * @brief Removes the entry the handle refers to in O(log n).
+     * @param handle Handle returned by push().
+     * @return Its value.
+     *
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     */
+    T erase(const Handle& handle) { return removeAt(positionOf(handle)); }
+
+    /**
+     * @brief Moves an entry towards the top by giving it a priority that compares before (or equal to) its current one.
+     * @param handle Handle returned by push().
+     * @param priority The new priority.
+     *
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     * @throws ValueError If the new priority compares after the current one.
+     */
+    void decreaseKey(const Handle& handle, Priority priority) {
+        Size pos = positionOf(handle);
+        if (comp(heap[pos].priority, priority)) throw ValueError(VaStaticMessage("decreaseKey(): new priority is worse than the current one"));
+
+        heap[pos].priority = std::move(priority);
+        siftUp(pos);
+    }
+
+    /**
+     * @brief Moves an entry away from the top by giving it a priority that compares after (or equal to) its current one.
+     * @param handle Handle returned by push().
+     * @param priority The new priority.
+     *
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     * @throws ValueError If the new priority compares before the current one.
+     */
+    void increaseKey(const Handle& handle, Priority priority) {
+        Size pos = positionOf(handle);
+        if (comp(priority, heap[pos].priority)) throw ValueError(VaStaticMessage("increaseKey(): new priority is better than the current one"));
+
+        heap[pos].priority = std::move(priority);
+        siftDown(pos);
+    }
+
+    /**
+     * @brief Changes the priority of an entry in either direction.
+     * @param handle Handle returned by push().
+     * @param priority The new priority.
+     *
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     */
+    void update(const Handle& handle, Priority priority) {
+        Size pos = positionOf(handle);
+        bool up = comp(priority, heap[pos].priority);
+
+        heap[pos].priority = std::move(priority);
+        if (up) {
+            siftUp(pos);
+        } else {
+            siftDown(pos);
+        }
+    }
+
+    /**
+     * @brief Checks whether the handle refers to an entry that is still in the queue.
+     */
+    bool contains(const Handle& handle) const noexcept {
+        return handle.slot < len(slots) && slots[handle.slot].pos != npos && slots[handle.slot].gen == handle.gen;
+    }
+
+    /**
+     * @brief Returns the value of an entry.
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     */
+    T& get(const Handle& handle) { return heap[positionOf(handle)].value; }
+    const T& get(const Handle& handle) const { return heap[positionOf(handle)].value; }
+
+    /**
+     * @brief Returns the value of an entry, or nullptr if the handle does not refer to an entry of this queue.
+     */
+    // @{
+    T* tryGet(const Handle& handle) noexcept { return contains(handle) ? &heap[slots[handle.slot].pos].value : nullptr; }
+    const T* tryGet(const Handle& handle) const noexcept { return contains(handle) ? &heap[slots[handle.slot].pos].value : nullptr; }
+    // @}
+
+    /**
+     * @brief Returns the priority of an entry.
+     * @throws KeyNotFoundError If the handle does not refer to an entry of this queue.
+     */
+    const Priority& priorityOf(const Handle& handle) const { return heap[positionOf(handle)].priority; }
+
+    /**
+     * @brief Reserves room for minCap entries.
+     */
+    void reserve(Size minCap) {
+        heap.reserve(minCap);
+        slots.reserve(minCap);
+    }
+
+    /**
+     * @brief Removes all entries. Every outstanding handle becomes invalid.
+     */
+    void clear() {
+        for (const Entry& entry: heap) {
+            Slot& slot = slots[entry.slot];
+            slot.pos = npos;
+            slot.gen++;
+            freeSlots.append(entry.slot);
+        }
+        heap.clear();
+    }
+
+    inline bool isEmpty() const noexcept { return heap.isEmpty(); }
+    inline Size getLength() const noexcept { return len(heap); }
+
+  public friends:
+    friend inline Size len(const VaPriorityQueue& queue) noexcept { return len(queue.heap); }
+};
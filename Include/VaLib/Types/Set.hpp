@@ -7,6 +7,7 @@
 
 #include <VaLib/Types/BasicTypedef.hpp>
 #include <VaLib/Types/Pair.hpp>
+#include <VaLib/Utils/Hash.hpp>
 
 #include <functional>
 
@@ -124,6 +125,31 @@ class VaSet {
 
     Size len;
 
+    va::detail::HashSum keysHash; ///< Running hash of the keys, see enableHashTracking().
+    bool hashTracked;             ///< Whether keysHash is kept up to date.
+
+    static Size keyHash(const T& key) {
+        if constexpr (va::detail::IsHashable<T>) {
+            return VaHash<T>{}(key);
+        } else {
+            return 0;
+        }
+    }
+
+    va::detail::HashSum computeHash() const {
+        va::detail::HashSum sum;
+        for (const T& key: *this) sum.add(keyHash(key));
+        return sum;
+    }
+
+    void hashInsert(const T& key) {
+        if (hashTracked) keysHash.add(keyHash(key));
+    }
+
+    void hashErase(const T& key) {
+        if (hashTracked) keysHash.remove(keyHash(key));
+    }
+
     void leftRotate(Node* x) {
         Node* y = x->right;
         x->right = y->left;
@@ -311,7 +337,7 @@ class VaSet {
     }
 
   public:
-    VaSet() : root(nullptr), len(0) {}
+    VaSet() : root(nullptr), len(0), hashTracked(false) {}
     VaSet(std::initializer_list<T> init) : VaSet() {
         for (const T& val: init) {
             add(val);
@@ -354,6 +380,7 @@ class VaSet {
 
         insertFixup(z);
         len++;
+        hashInsert(z->key);
         return {Iterator(z), true};
     }
 
@@ -383,6 +410,7 @@ class VaSet {
 
         insertFixup(z);
         len++;
+        hashInsert(z->key);
     }
 
     VaPair<Iterator, bool> insert(NodeHandle&& nh) {
@@ -418,6 +446,7 @@ class VaSet {
         insertFixup(z);
         nh.node = nullptr;
         len++;
+        hashInsert(z->key);
         return {Iterator(z), true};
     }
 
@@ -440,6 +469,8 @@ class VaSet {
         std::swap(root, other.root);
         std::swap(len, other.len);
         std::swap(comp, other.comp);
+        std::swap(keysHash, other.keysHash);
+        std::swap(hashTracked, other.hashTracked);
     }
 
     void merge(VaSet& other) {
@@ -484,6 +515,7 @@ class VaSet {
             y->left->parent = y;
             y->color = z->color;
         }
+        hashErase(z->key);
         delete z;
         if (yOriginalClr == Color::Black && x) deleteFixup(x);
 
@@ -524,6 +556,7 @@ class VaSet {
         if (yOriginalClr == Color::Black && x) deleteFixup(x);
 
         len--;
+        hashErase(z->key);
 
         // detach the node from tree context
         z->left = z->right = z->parent = nullptr;
@@ -534,12 +567,51 @@ class VaSet {
 
     bool isEmpty() const { return len == 0; }
 
+    /**
+     * @brief Returns a hash of the keys, so that equal sets hash the same.
+     *
+     * @note O(n), or O(1) while hash tracking is on.
+     * @see enableHashTracking()
+     */
+    Size hash() const {
+        static_assert(va::detail::IsHashable<T>, "VaSet::hash() requires VaHash for the keys");
+        return (hashTracked ? keysHash : computeHash()).value(len);
+    }
+
+    /**
+     * @brief Makes the set maintain its hash as keys are inserted and erased, so that hash()
+     *        is O(1) and operator== tells most unequal sets apart in O(1).
+     *
+     * The hash is kept as a sum of the mixed hashes of the keys; each insertion or removal
+     * costs one more hash of the key. As keys can't be changed in place, the hash never goes stale.
+     */
+    void enableHashTracking() {
+        static_assert(va::detail::IsHashable<T>, "hash tracking requires VaHash for the keys");
+
+        keysHash = computeHash();
+        hashTracked = true;
+    }
+
+    /**
+     * @brief Stops maintaining the hash; hash() is O(n) again.
+     */
+    void disableHashTracking() noexcept { hashTracked = false; }
+
+    /**
+     * @brief Checks whether the set maintains its hash.
+     */
+    bool isHashTracked() const noexcept { return hashTracked; }
+
   public friends:
     friend inline Size len(const VaSet& set) { return set.len; }
 
   public operators:
     friend bool operator==(const VaSet& lhs, const VaSet& rhs) {
         if (lhs.len != rhs.len) return false;
+        if constexpr (va::detail::IsHashable<T>) {
+            if (lhs.hashTracked && rhs.hashTracked && lhs.hash() != rhs.hash()) return false;
+        }
+
         auto it1 = lhs.begin();
         auto it2 = rhs.begin();
 
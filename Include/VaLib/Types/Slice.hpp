@@ -161,6 +161,24 @@ class VaSlice {
         return get(index);
     }
 
+    /**
+     * @brief Access element with bounds checking, without throwing
+     * @param index Position of the element (can be negative)
+     * @return Pointer to the element, or nullptr if index is out of bounds
+     */
+    // @{
+    inline T* tryAt(int32 index) noexcept {
+        if (index < 0) index += len; // wrap negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &data[index];
+    }
+    inline const T* tryAt(int32 index) const noexcept {
+        if (index < 0) index += len; // wrap negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &data[index];
+    }
+    // @}
+
     /**
      * @brief Set element at specified index
      * @param index Position of the element
@@ -223,7 +241,7 @@ class VaSlice {
      * @note Equivalent to slice[0] when not empty
      */
     T& front() {
-        if (isEmpty()) throw ValueError("front() called on empty slice");
+        if (isEmpty()) throw ValueError(VaStaticMessage("front() called on empty slice"));
         return data[0];
     }
 
@@ -234,7 +252,7 @@ class VaSlice {
      * @throws ValueError if slice is empty
      */
     T& back() {
-        if (isEmpty()) throw ValueError("back() called on empty slice");
+        if (isEmpty()) throw ValueError(VaStaticMessage("back() called on empty slice"));
         return data[len - 1];
     }
 
@@ -245,7 +263,7 @@ class VaSlice {
      * @throws ValueError if slice is empty
      */
     const T& front() const {
-        if (isEmpty()) throw ValueError("front() called on empty slice");
+        if (isEmpty()) throw ValueError(VaStaticMessage("front() called on empty slice"));
         return data[0];
     }
 
@@ -256,10 +274,21 @@ class VaSlice {
      * @throws ValueError if slice is empty
      */
     const T& back() const {
-        if (isEmpty()) throw ValueError("back() called on empty slice");
+        if (isEmpty()) throw ValueError(VaStaticMessage("back() called on empty slice"));
         return data[len - 1];
     }
 
+    /**
+     * @brief Access first or last element, without throwing
+     * @return Pointer to the element, or nullptr if slice is empty
+     */
+    // @{
+    T* tryFront() noexcept { return len ? &data[0] : nullptr; }
+    T* tryBack() noexcept { return len ? &data[len - 1] : nullptr; }
+    const T* tryFront() const noexcept { return len ? &data[0] : nullptr; }
+    const T* tryBack() const noexcept { return len ? &data[len - 1] : nullptr; }
+    // @}
+
     /**
      * @brief Create subslice with specified offset and count
      * @param offset Starting position of subslice
@@ -271,7 +300,7 @@ class VaSlice {
      */
     VaSlice subslice(Size offset, Size count) {
         if (offset + count > len) {
-            throw IndexOutOfRangeError("subslice(offset, count) out of range");
+            throw IndexOutOfRangeError(VaStaticMessage("subslice(offset, count) out of range"));
         }
         return VaSlice(data + offset, count);
     }
@@ -285,7 +314,7 @@ class VaSlice {
       */
     VaSlice subslice(Size offset) {
         if (offset > len) {
-            throw IndexOutOfRangeError("subslice(offset) out of range");
+            throw IndexOutOfRangeError(VaStaticMessage("subslice(offset) out of range"));
         }
         return VaSlice(data + offset, len - offset);
     }
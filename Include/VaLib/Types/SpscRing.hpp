@@ -0,0 +1,280 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+
+#include <atomic>
+#include <bit>
+#include <new>
+#include <utility>
+
+/**
+ * @class VaSpscRing A bounded, lock-free ring buffer for exactly one producer thread and one consumer thread.
+ *
+ * @tparam T Type of the stored elements.
+ *
+ * @note The producer only writes the tail index and the consumer only writes the head index.
+ *       Each index lives on its own cache line together with a cached copy of the other index,
+ *       so in the common case a push or pop touches no cache line written by the other thread.
+ * @note Blocking operations spin with exponential backoff and then yield; they never sleep in the kernel.
+ * @warning Calling push operations from more than one thread (or pop operations from more than one
+ *          thread) at a time is undefined behavior. Use VaMpmcQueue for that.
+ */
+template <typename T>
+class alignas(va::detail::cacheLineSize) VaSpscRing {
+  protected:
+    static constexpr Size lineSize = va::detail::cacheLineSize;
+
+    T* slots;      ///< Uninitialized storage for the elements
+    Size capacity; ///< Number of slots (a power of two)
+    Size mask;     ///< capacity - 1, maps a position to a slot
+
+    alignas(lineSize) std::atomic<Size> head; ///< Position of the next element to pop (written by the consumer)
+    Size cachedTail;                          ///< Consumer's last observed tail
+
+    alignas(lineSize) std::atomic<Size> tail; ///< Position of the next free slot (written by the producer)
+    Size cachedHead;                          ///< Producer's last observed head
+
+    /**
+     * @brief Number of free slots as seen by the producer, refreshing the cached head if fewer than wanted.
+     */
+    inline Size freeSlots(Size t, Size wanted) noexcept {
+        Size free = capacity - (t - cachedHead);
+        if (free < wanted) {
+            cachedHead = head.load(std::memory_order_acquire);
+            free = capacity - (t - cachedHead);
+        }
+        return free;
+    }
+
+    /**
+     * @brief Number of readable elements as seen by the consumer, refreshing the cached tail if fewer than wanted.
+     */
+    inline Size readySlots(Size h, Size wanted) noexcept {
+        Size ready = cachedTail - h;
+        if (ready < wanted) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            ready = cachedTail - h;
+        }
+        return ready;
+    }
+
+    /// Largest power of two whose slots still fit in the address space
+    static constexpr Size maxCapacity = std::bit_floor(Size(-1) / sizeof(T));
+
+    static Size roundCapacity(Size minCap) {
+        if (minCap == 0) throw ValueError(VaStaticMessage("VaSpscRing capacity must be greater than 0"));
+        if (minCap > maxCapacity) throw ValueError(VaStaticMessage("VaSpscRing capacity is too large"));
+        Size result = 1;
+        while (result < minCap) result <<= 1;
+        return result;
+    }
+
+  public:
+    /**
+     * @brief Constructs an empty ring.
+     * @param minCap Minimum number of elements the ring can hold; rounded up to a power of two.
+     *
+     * @throws ValueError If minCap is 0, or if its power of two slots would not fit in memory.
+     */
+    explicit VaSpscRing(Size minCap)
+        : capacity(roundCapacity(minCap)), mask(capacity - 1), head(0), cachedTail(0), tail(0), cachedHead(0) {
+        slots = static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    VaSpscRing(const VaSpscRing&) = delete;
+    VaSpscRing& operator=(const VaSpscRing&) = delete;
+
+    /**
+     * @brief Destroys the elements still in the ring.
+     *
+     * @warning No thread may use the ring during destruction.
+     */
+    ~VaSpscRing() {
+        Size t = tail.load(std::memory_order_relaxed);
+        for (Size h = head.load(std::memory_order_relaxed); h != t; h++) slots[h & mask].~T();
+        ::operator delete(slots, std::align_val_t(alignof(T)));
+    }
+
+    /**
+     * @brief Constructs an element in place at the back if there is room. Producer only.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return true if the element was pushed, false if the ring is full.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        Size t = tail.load(std::memory_order_relaxed);
+        if (freeSlots(t, 1) == 0) return false;
+
+        new (&slots[t & mask]) T(std::forward<Args>(args)...);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pushes an element if there is room. Producer only.
+     * @param value The value to push.
+     * @return true if the element was pushed, false if the ring is full.
+     */
+    inline bool tryPush(const T& value) { return tryEmplace(value); }
+    inline bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+    /**
+     * @brief Constructs an element in place at the back, waiting while the ring is full. Producer only.
+     * @param args Arguments forwarded to the constructor of T.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        Size t = tail.load(std::memory_order_relaxed);
+        va::detail::Backoff backoff;
+        while (freeSlots(t, 1) == 0) backoff.wait();
+
+        new (&slots[t & mask]) T(std::forward<Args>(args)...);
+        tail.store(t + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pushes an element, waiting while the ring is full. Producer only.
+     * @param value The value to push.
+     */
+    inline void push(const T& value) { emplace(value); }
+    inline void push(T&& value) { emplace(std::move(value)); }
+
+    /**
+     * @brief Pushes as many of the given elements as currently fit, publishing them at once. Producer only.
+     * @param items Pointer to the elements to copy.
+     * @param count Number of elements.
+     * @return Number of elements pushed (a prefix of items).
+     */
+    Size tryPushBatch(const T* items, Size count) {
+        Size t = tail.load(std::memory_order_relaxed);
+        Size free = freeSlots(t, count);
+        Size n = count < free ? count : free;
+
+        Size done = 0;
+        try {
+            for (; done < n; done++) new (&slots[(t + done) & mask]) T(items[done]);
+        } catch (...) {
+            tail.store(t + done, std::memory_order_release);
+            throw;
+        }
+
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Pushes all given elements, waiting for room as needed. Producer only.
+     * @param items Pointer to the elements to copy.
+     * @param count Number of elements.
+     */
+    void pushBatch(const T* items, Size count) {
+        va::detail::Backoff backoff;
+        while (count > 0) {
+            Size n = tryPushBatch(items, count);
+            if (n == 0) {
+                backoff.wait();
+                continue;
+            }
+            backoff.reset();
+            items += n;
+            count -= n;
+        }
+    }
+
+    /**
+     * @brief Pops the front element if there is one. Consumer only.
+     * @param out Receives the popped element.
+     * @return true if an element was popped, false if the ring is empty.
+     */
+    bool tryPop(T& out) {
+        Size h = head.load(std::memory_order_relaxed);
+        if (readySlots(h, 1) == 0) return false;
+
+        T& slot = slots[h & mask];
+        out = std::move(slot);
+        slot.~T();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the front element, waiting while the ring is empty. Consumer only.
+     * @return The popped element.
+     */
+    T pop() {
+        Size h = head.load(std::memory_order_relaxed);
+        va::detail::Backoff backoff;
+        while (readySlots(h, 1) == 0) backoff.wait();
+
+        T& slot = slots[h & mask];
+        T value(std::move(slot));
+        slot.~T();
+        head.store(h + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Pops up to maxCount elements that are currently available, releasing their slots at once. Consumer only.
+     * @param out Array receiving the popped elements (move-assigned).
+     * @param maxCount Maximum number of elements to pop.
+     * @return Number of elements popped.
+     */
+    Size tryPopBatch(T* out, Size maxCount) {
+        Size h = head.load(std::memory_order_relaxed);
+        Size ready = readySlots(h, maxCount);
+        Size n = maxCount < ready ? maxCount : ready;
+
+        Size done = 0;
+        try {
+            for (; done < n; done++) {
+                T& slot = slots[(h + done) & mask];
+                out[done] = std::move(slot);
+                slot.~T();
+            }
+        } catch (...) {
+            head.store(h + done, std::memory_order_release);
+            throw;
+        }
+
+        head.store(h + n, std::memory_order_release);
+        return n;
+    }
+
+    /**
+     * @brief Waits until at least one element is available, then pops up to maxCount elements. Consumer only.
+     * @param out Array receiving the popped elements (move-assigned).
+     * @param maxCount Maximum number of elements to pop.
+     * @return Number of elements popped (at least 1 if maxCount > 0).
+     */
+    Size popBatch(T* out, Size maxCount) {
+        if (maxCount == 0) return 0;
+
+        va::detail::Backoff backoff;
+        Size n;
+        while ((n = tryPopBatch(out, maxCount)) == 0) backoff.wait();
+        return n;
+    }
+
+    /**
+     * @brief Returns the number of elements in the ring.
+     *
+     * @note The value is only a snapshot when the other thread is active.
+     */
+    inline Size getLength() const noexcept {
+        Size h = head.load(std::memory_order_acquire);
+        return tail.load(std::memory_order_acquire) - h;
+    }
+
+    inline Size getCapacity() const noexcept { return capacity; }
+    inline bool isEmpty() const noexcept { return getLength() == 0; }
+
+  public friends:
+    friend inline Size len(const VaSpscRing& ring) { return ring.getLength(); }
+    friend inline Size cap(const VaSpscRing& ring) { return ring.capacity; }
+};
@@ -53,7 +53,7 @@ class StackBase<T, Container> {
 
     void pop() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
 
         container.pop();
@@ -61,18 +61,33 @@ class StackBase<T, Container> {
 
     T& top() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return container[len(container) - 1];
     }
 
     const T& top() const {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return container[len(container) - 1];
     }
 
+    /// @brief Like top(), but returns nullptr instead of throwing if the stack is empty.
+    // @{
+    T* tryTop() noexcept { return isEmpty() ? nullptr : &container[len(container) - 1]; }
+    const T* tryTop() const noexcept { return isEmpty() ? nullptr : &container[len(container) - 1]; }
+    // @}
+
+    /// @brief Like pop(), but moves the top element into out and returns false instead of throwing if the stack is empty.
+    bool tryPop(T& out) {
+        if (isEmpty()) return false;
+
+        out = std::move(container[len(container) - 1]);
+        container.pop();
+        return true;
+    }
+
     inline bool isEmpty() const { return len(container) == 0; }
 };
 
@@ -90,7 +105,7 @@ class StackBase<T, Container> {
 
     void pop() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
 
         container.pop_back();
@@ -98,18 +113,33 @@ class StackBase<T, Container> {
 
     T& top() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return container[container.size() - 1];
     }
 
     const T& top() const {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return container[container.size() - 1];
     }
 
+    /// @brief Like top(), but returns nullptr instead of throwing if the stack is empty.
+    // @{
+    T* tryTop() noexcept { return isEmpty() ? nullptr : &container[container.size() - 1]; }
+    const T* tryTop() const noexcept { return isEmpty() ? nullptr : &container[container.size() - 1]; }
+    // @}
+
+    /// @brief Like pop(), but moves the top element into out and returns false instead of throwing if the stack is empty.
+    bool tryPop(T& out) {
+        if (isEmpty()) return false;
+
+        out = std::move(container[container.size() - 1]);
+        container.pop_back();
+        return true;
+    }
+
     inline bool isEmpty() const { return container.size() == 0; }
 };
 
@@ -128,25 +158,40 @@ class StackBase {
 
     void pop() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         container.pop();
     }
 
     T& top() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return container[len(container) - 1];
     }
 
     const T& top() const {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return container[len(container) - 1];
     }
 
+    /// @brief Like top(), but returns nullptr instead of throwing if the stack is empty.
+    // @{
+    T* tryTop() noexcept { return isEmpty() ? nullptr : &container[len(container) - 1]; }
+    const T* tryTop() const noexcept { return isEmpty() ? nullptr : &container[len(container) - 1]; }
+    // @}
+
+    /// @brief Like pop(), but moves the top element into out and returns false instead of throwing if the stack is empty.
+    bool tryPop(T& out) {
+        if (isEmpty()) return false;
+
+        out = std::move(container[len(container) - 1]);
+        container.pop();
+        return true;
+    }
+
     inline bool isEmpty() const { return len(container) == 0; }
 };
 
@@ -234,7 +279,7 @@ class StackBase<T, void> {
 
     void pop() {
         if (len <= 0) {
-            throw ValueError("pop() on empty stack");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
 
         data[len - 1].~T();
@@ -243,18 +288,34 @@ class StackBase<T, void> {
 
     T& top() {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return data[len - 1];
     }
 
     const T& top() const {
         if (isEmpty()) {
-            throw IndexOutOfRangeError("Stack is empty");
+            throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
         }
         return data[len - 1];
     }
 
+    /// @brief Like top(), but returns nullptr instead of throwing if the stack is empty.
+    // @{
+    T* tryTop() noexcept { return len ? &data[len - 1] : nullptr; }
+    const T* tryTop() const noexcept { return len ? &data[len - 1] : nullptr; }
+    // @}
+
+    /// @brief Like pop(), but moves the top element into out and returns false instead of throwing if the stack is empty.
+    bool tryPop(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&>) {
+        if (len == 0) return false;
+
+        out = std::move(data[len - 1]);
+        data[len - 1].~T();
+        len--;
+        return true;
+    }
+
     bool isEmpty() const { return len == 0; }
 };
 
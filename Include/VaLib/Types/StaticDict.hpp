@@ -0,0 +1,226 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Meta/ConstexprStrings.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <utility>
+
+namespace va::detail {
+
+/// @brief A (key, value) pair given to va::mkStaticDict().
+template <typename V>
+struct StaticDictItem {
+    const char* key;
+    V value;
+};
+
+/**
+ * @brief A minimal perfect hash of N string keys, built at compile time (hash and displace).
+ *
+ * A key's hash picks one of the buckets, and the seed stored for that bucket mixes the hash into
+ * the key's slot. Seeds are chosen bucket by bucket, the largest first, until every key of the
+ * bucket lands in a free slot. As there are exactly N slots, every slot ends up holding one key.
+ */
+template <Size N>
+struct StaticDictLayout {
+    static constexpr Size bucketCount = N / 2 + 1;
+    static constexpr uint32 maxSeed = 1u << 20;
+
+    Size itemAt[N];            ///< Index of the item placed in each slot.
+    uint32 seeds[bucketCount]; ///< Seed of each bucket.
+
+    static constexpr Size bucketOf(Size hash) noexcept { return hash % bucketCount; }
+
+    static constexpr Size slotOf(Size hash, uint32 seed) noexcept {
+        uint64 x = uint64(hash) ^ (uint64(seed) * 0x9e3779b97f4a7c15ull);
+        x ^= x >> 31;
+        x *= 0xbf58476d1ce4e5b9ull;
+        x ^= x >> 32;
+        return Size(x % N);
+    }
+
+    template <typename V>
+    static consteval StaticDictLayout build(const StaticDictItem<V> (&items)[N]) {
+        Size hashes[N] = {};
+        for (Size i = 0; i < N; i++) hashes[i] = va::constexprStrHash(items[i].key);
+
+        for (Size i = 0; i < N; i++) {
+            for (Size j = i + 1; j < N; j++) {
+                if (hashes[i] != hashes[j]) continue;
+                if (va::constexprStrEq(items[i].key, items[j].key)) throw ValueError(VaStaticMessage("VaStaticDict has a duplicate key"));
+                throw ValueError(VaStaticMessage("two keys of a VaStaticDict have the same hash"));
+            }
+        }
+
+        Size bucketSizes[bucketCount] = {};
+        for (Size i = 0; i < N; i++) bucketSizes[bucketOf(hashes[i])]++;
+
+        StaticDictLayout layout = {};
+        bool taken[N] = {};
+        bool placed[bucketCount] = {};
+
+        for (Size round = 0; round < bucketCount; round++) {
+            Size bucket = 0;
+            for (Size b = 0; b < bucketCount; b++) {
+                if (!placed[b] && (placed[bucket] || bucketSizes[b] > bucketSizes[bucket])) bucket = b;
+            }
+            placed[bucket] = true;
+            if (bucketSizes[bucket] == 0) continue;
+
+            Size members[N] = {};
+            Size count = 0;
+            for (Size i = 0; i < N; i++) {
+                if (bucketOf(hashes[i]) == bucket) members[count++] = i;
+            }
+
+            Size slots[N] = {};
+            for (uint32 seed = 0;; seed++) {
+                if (seed == maxSeed) throw ValueError(VaStaticMessage("no perfect hash was found for the keys of a VaStaticDict"));
+
+                bool fits = true;
+                for (Size m = 0; m < count && fits; m++) {
+                    slots[m] = slotOf(hashes[members[m]], seed);
+                    if (taken[slots[m]]) fits = false;
+                    for (Size k = 0; k < m && fits; k++) fits = slots[k] != slots[m];
+                }
+                if (!fits) continue;
+
+                for (Size m = 0; m < count; m++) {
+                    taken[slots[m]] = true;
+                    layout.itemAt[slots[m]] = members[m];
+                }
+                layout.seeds[bucket] = seed;
+                break;
+            }
+        }
+
+        return layout;
+    }
+};
+
+} // namespace va::detail
+
+/**
+ * @class VaStaticDict A read-only string-keyed dictionary built at compile time.
+ *
+ * @tparam V Type of the values. Must be usable in constant expressions.
+ * @tparam N Number of entries.
+ *
+ * The dictionary is made by va::mkStaticDict() from a list of (literal key, value) pairs, which
+ * computes a minimal perfect hash of the keys at compile time. Declared constexpr, it is
+ * constant-initialized into read-only memory and needs no initialization at startup.
+ *
+ * A lookup hashes the key once, reads one seed and one entry, and compares the key with the one
+ * stored in that entry. The hash is the VaHash of the key as a VaString.
+ *
+ * @code
+ * constexpr auto methods = va::mkStaticDict<int>({{"GET", 1}, {"HEAD", 2}, {"POST", 3}});
+ *
+ * static_assert(methods.at("HEAD") == 2);
+ * if (const int* method = methods.tryAt(request.method)) handle(*method);
+ * @endcode
+ *
+ * @note Iteration visits the entries in slot order, not in the order they were given.
+ */
+template <typename V, Size N>
+class VaStaticDict {
+    static_assert(N > 0, "VaStaticDict needs at least one entry");
+
+  public:
+    struct Entry {
+        const char* key;
+        Size len;
+        Size hash;
+        V value;
+    };
+
+    using Layout = va::detail::StaticDictLayout<N>;
+    using Item = va::detail::StaticDictItem<V>;
+
+  protected:
+    Entry entries[N];
+    uint32 seeds[Layout::bucketCount];
+
+    template <Size... I, Size... B>
+    constexpr VaStaticDict(const Item (&items)[N], const Layout& layout, std::index_sequence<I...>, std::index_sequence<B...>)
+        : entries{Entry{
+              items[layout.itemAt[I]].key,
+              va::constexprStrLen(items[layout.itemAt[I]].key),
+              va::constexprStrHash(items[layout.itemAt[I]].key),
+              items[layout.itemAt[I]].value,
+          }...},
+          seeds{layout.seeds[B]...} {}
+
+  public:
+    /**
+     * @brief Builds the dictionary and its perfect hash at compile time.
+     * @param items The (key, value) pairs. Keys must be unique.
+     */
+    static consteval VaStaticDict Make(const Item (&items)[N]) {
+        return VaStaticDict(items, Layout::build(items), std::make_index_sequence<N>{}, std::make_index_sequence<Layout::bucketCount>{});
+    }
+
+    /**
+     * @brief Returns a pointer to the value of key, or nullptr if there is none.
+     * @param key The key, of len characters.
+     */
+    constexpr const V* tryAt(const char* key, Size len) const noexcept {
+        const Size hash = va::constexprStrHash(key, len);
+        const Entry& entry = entries[Layout::slotOf(hash, seeds[Layout::bucketOf(hash)])];
+
+        if (entry.hash == hash && entry.len == len && va::constexprStrEq(entry.key, key, len)) return &entry.value;
+        return nullptr;
+    }
+
+    constexpr const V* tryAt(const char* key) const noexcept { return tryAt(key, va::constexprStrLen(key)); }
+    const V* tryAt(const VaString& key) const noexcept { return tryAt(key.begin(), len(key)); }
+
+    /**
+     * @brief Returns the value of key.
+     * @throws KeyNotFoundError if there is none.
+     */
+    // @{
+    constexpr const V& at(const char* key, Size len) const {
+        const V* value = tryAt(key, len);
+        if (!value) throw KeyNotFoundError();
+        return *value;
+    }
+
+    constexpr const V& at(const char* key) const { return at(key, va::constexprStrLen(key)); }
+    const V& at(const VaString& key) const { return at(key.begin(), len(key)); }
+
+    constexpr const V& operator[](const char* key) const { return at(key); }
+    const V& operator[](const VaString& key) const { return at(key); }
+    // @}
+
+    constexpr bool contains(const char* key) const noexcept { return tryAt(key) != nullptr; }
+    bool contains(const VaString& key) const noexcept { return tryAt(key) != nullptr; }
+
+    constexpr const Entry* begin() const noexcept { return entries; }
+    constexpr const Entry* end() const noexcept { return entries + N; }
+
+  public friends:
+    friend constexpr Size len(const VaStaticDict&) noexcept { return N; }
+};
+
+namespace va {
+
+/**
+ * @brief Makes a VaStaticDict from (literal key, value) pairs, at compile time.
+ *
+ * @code
+ * constexpr auto opcodes = va::mkStaticDict<uint8>({{"nop", 0x00}, {"jmp", 0xEB}, {"ret", 0xC3}});
+ * @endcode
+ */
+template <typename V, Size N>
+consteval VaStaticDict<V, N> mkStaticDict(const va::detail::StaticDictItem<V> (&items)[N]) {
+    return VaStaticDict<V, N>::Make(items);
+}
+
+} // namespace va
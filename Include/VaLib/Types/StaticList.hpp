@@ -0,0 +1,521 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace va::detail {
+
+/// @brief Whether VaStaticList can keep its elements in a plain array (and be fully constexpr) for T.
+template <typename T>
+inline constexpr bool IsPlainStaticStorage = tt::IsTriviallyDefaultConstructible<T> && tt::IsTriviallyCopyable<T>;
+
+/**
+ * @brief Inline element storage of VaStaticList.
+ *
+ * Trivial types live in a plain array, so every operation on them can run in constant expressions.
+ * Other types live in raw aligned bytes and are constructed and destroyed explicitly.
+ */
+template <typename T, Size N, bool Plain = IsPlainStaticStorage<T>>
+struct StaticStorage {
+    T items[N];
+
+    constexpr StaticStorage() noexcept {
+        // Constant evaluation rejects reads of uninitialized objects, even when copying the whole array.
+        if (std::is_constant_evaluated()) {
+            for (Size i = 0; i < N; i++) items[i] = T();
+        }
+    }
+
+    constexpr T* ptr() noexcept { return items; }
+    constexpr const T* ptr() const noexcept { return items; }
+
+    template <typename... Args>
+    constexpr void construct(Size index, Args&&... args) {
+        items[index] = T(std::forward<Args>(args)...);
+    }
+
+    constexpr void destroy(Size) noexcept {}
+};
+
+template <typename T, Size N>
+struct StaticStorage<T, N, false> {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+
+    inline T* ptr() noexcept { return std::launder(reinterpret_cast<T*>(bytes)); }
+    inline const T* ptr() const noexcept { return std::launder(reinterpret_cast<const T*>(bytes)); }
+
+    template <typename... Args>
+    inline void construct(Size index, Args&&... args) {
+        new (bytes + index * sizeof(T)) T(std::forward<Args>(args)...);
+    }
+
+    inline void destroy(Size index) noexcept(tt::IsNoexceptDestructible<T>) { ptr()[index].~T(); }
+};
+
+} // namespace va::detail
+
+/**
+ * @class VaStaticList A list that stores up to N elements inline, without any heap allocation.
+ *
+ * @tparam T Type of the stored elements.
+ * @tparam N Maximum number of elements.
+ *
+ * The interface follows VaList, so code templated on the list type works with both. The difference is
+ * that the capacity never grows: append(), prepend() and insert() report a full list through a
+ * VaResult holding a CapacityError instead of reallocating.
+ *
+ * @note For trivially copyable, trivially default constructible types the whole class is constexpr
+ *       and itself trivially copyable. Other types are stored in raw inline bytes.
+ * @note appendEmplace(), prependEmplace() and insertEmplace() return a reference to the new element,
+ *       which a VaResult cannot carry, so they throw CapacityError instead.
+ */
+template <typename T, Size N>
+class VaStaticList {
+    static_assert(N > 0, "VaStaticList capacity must be greater than 0");
+
+  protected:
+    using Storage = va::detail::StaticStorage<T, N>;
+    static constexpr bool plain = va::detail::IsPlainStaticStorage<T>;
+
+    Storage storage;
+    Size len = 0;
+
+    /**
+     * @brief Moves the element at index src into the empty slot dst.
+     *
+     * @note A move that throws halfway through shifting the elements would leave an empty slot
+     *       inside the list, so inserting and deleting in the middle require a noexcept move.
+     */
+    constexpr void relocate(Size dst, Size src) {
+        static_assert(tt::IsNoexceptMoveConstructible<T>, "VaStaticList shifts elements with their move constructor, which must not throw");
+        storage.construct(dst, std::move(storage.ptr()[src]));
+        storage.destroy(src);
+    }
+
+    /**
+     * @brief Opens a gap of one slot at index by shifting the tail right. Requires len < N.
+     */
+    constexpr void openGap(Size index) {
+        for (Size i = len; i > index; i--) relocate(i, i - 1);
+    }
+
+    /**
+     * @brief Closes the gap of count empty slots at index by shifting the tail left.
+     */
+    constexpr void closeGap(Size index, Size count) {
+        for (Size i = index; i + count < len; i++) relocate(i, i + count);
+        len -= count;
+    }
+
+    constexpr void copyFrom(const VaStaticList& other) {
+        for (Size i = 0; i < other.len; i++) {
+            storage.construct(i, other.storage.ptr()[i]);
+            len = i + 1;
+        }
+    }
+
+    constexpr void moveFrom(VaStaticList& other) {
+        for (Size i = 0; i < other.len; i++) {
+            storage.construct(i, std::move(other.storage.ptr()[i]));
+            len = i + 1;
+        }
+        other.clear();
+    }
+
+    static inline CapacityError overflow() noexcept { return CapacityError(VaStaticMessage("VaStaticList is full")); }
+
+  public:
+    /**
+     * @brief Constructs an empty list.
+     */
+    constexpr VaStaticList() noexcept = default;
+
+    /**
+     * @brief Constructs a list from an initializer list.
+     * @param init Initial elements.
+     *
+     * @throws CapacityError If init has more than N elements.
+     */
+    constexpr VaStaticList(std::initializer_list<T> init) {
+        if (init.size() > N) throw overflow();
+        for (const T& value: init) storage.construct(len++, value);
+    }
+
+    constexpr VaStaticList(const VaStaticList&) requires plain = default;
+    constexpr VaStaticList(const VaStaticList& other) { copyFrom(other); }
+
+    constexpr VaStaticList(VaStaticList&&) requires plain = default;
+    constexpr VaStaticList(VaStaticList&& other) noexcept(tt::IsNoexceptMoveConstructible<T>) { moveFrom(other); }
+
+    constexpr VaStaticList& operator=(const VaStaticList&) requires plain = default;
+    constexpr VaStaticList& operator=(const VaStaticList& other) {
+        if (this == &other) return *this;
+        clear();
+        copyFrom(other);
+        return *this;
+    }
+
+    constexpr VaStaticList& operator=(VaStaticList&&) requires plain = default;
+    constexpr VaStaticList& operator=(VaStaticList&& other) noexcept(tt::IsNoexceptMoveConstructible<T>) {
+        if (this == &other) return *this;
+        clear();
+        moveFrom(other);
+        return *this;
+    }
+
+    constexpr ~VaStaticList() requires plain = default;
+    constexpr ~VaStaticList() { clear(); }
+
+    /**
+     * @brief Appends an element to the end of the list.
+     * @param elm The element to append.
+     * @return An error result holding a CapacityError if the list is full.
+     */
+    constexpr VaResult<void, CapacityError> append(const T& elm) {
+        if (len >= N) return overflow();
+        storage.construct(len, elm);
+        len++;
+        return {};
+    }
+
+    constexpr VaResult<void, CapacityError> append(T&& elm) {
+        if (len >= N) return overflow();
+        storage.construct(len, std::move(elm));
+        len++;
+        return {};
+    }
+
+    /**
+     * @brief Constructs an element in place at the end of the list.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return Reference to the new element.
+     *
+     * @throws CapacityError If the list is full.
+     */
+    template <typename... Args>
+    constexpr T& appendEmplace(Args&&... args) {
+        if (len >= N) throw overflow();
+        storage.construct(len, std::forward<Args>(args)...);
+        return storage.ptr()[len++];
+    }
+
+    /**
+     * @brief Inserts an element at the beginning of the list.
+     * @param elm The element to insert.
+     * @return An error result holding a CapacityError if the list is full.
+     */
+    constexpr VaResult<void, CapacityError> prepend(const T& elm) { return insert(0, elm); }
+    constexpr VaResult<void, CapacityError> prepend(T&& elm) { return insert(0, std::move(elm)); }
+
+    /**
+     * @brief Constructs an element in place at the beginning of the list.
+     * @param args Arguments forwarded to the constructor of T.
+     * @return Reference to the new element.
+     *
+     * @throws CapacityError If the list is full.
+     */
+    template <typename... Args>
+    constexpr T& prependEmplace(Args&&... args) {
+        return insertEmplace(0, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts an element at the specified index.
+     * @param index Index to insert at (0 to len).
+     * @param value The element to insert.
+     * @return An error result holding a CapacityError if the list is full.
+     *
+     * @throws IndexOutOfRangeError If index is greater than the length.
+     */
+    constexpr VaResult<void, CapacityError> insert(Size index, T value) {
+        if (index > len) throw IndexOutOfRangeError(len, index);
+        if (len >= N) return overflow();
+
+        openGap(index);
+        storage.construct(index, std::move(value));
+        len++;
+        return {};
+    }
+
+    /**
+     * @brief Constructs an element in place at the specified index.
+     * @param index Index to insert at (0 to len).
+     * @param args Arguments forwarded to the constructor of T.
+     * @return Reference to the new element.
+     *
+     * @throws IndexOutOfRangeError If index is greater than the length.
+     * @throws CapacityError If the list is full.
+     */
+    template <typename... Args>
+    constexpr T& insertEmplace(Size index, Args&&... args) {
+        if (index > len) throw IndexOutOfRangeError(len, index);
+        if (len >= N) throw overflow();
+
+        T value(std::forward<Args>(args)...);
+        openGap(index);
+        storage.construct(index, std::move(value));
+        len++;
+        return storage.ptr()[index];
+    }
+
+    /**
+     * @brief Deletes the element at the specified index.
+     * @param index Index of the element to delete.
+     *
+     * @throws IndexOutOfRangeError If index is out of bounds.
+     */
+    constexpr void del(Size index) {
+        if (index >= len) throw IndexOutOfRangeError(len, index);
+        storage.destroy(index);
+        closeGap(index, 1);
+    }
+
+    /**
+     * @brief Deletes a range of elements from the list.
+     * @param start The starting index of the range (inclusive).
+     * @param end The ending index of the range (exclusive).
+     *
+     * @throws IndexOutOfRangeError If start or end are out of bounds.
+     * @throws ValueError If start is greater than end.
+     * @note An empty range (start == end) is valid anywhere up to the length, and deletes nothing.
+     */
+    constexpr void delRange(Size start, Size end) {
+        if (start > end) throw ValueError(VaStaticMessage("delRange(): start index cannot be greater than end index"));
+        if (end > len) throw IndexOutOfRangeError(len, end);
+        if (start == end) return;
+
+        for (Size i = start; i < end; i++) storage.destroy(i);
+        closeGap(start, end - start);
+    }
+
+    /**
+     * @brief Removes and returns the last element of the list.
+     * @return The removed element.
+     *
+     * @throws ValueError If the list is empty.
+     */
+    constexpr T pop() {
+        if (len == 0) throw ValueError(VaStaticMessage("pop() on empty list"));
+
+        T value = std::move(storage.ptr()[len - 1]);
+        storage.destroy(--len);
+        return value;
+    }
+
+    /**
+     * @brief Removes the last element and moves it into out, without throwing.
+     * @param out Receives the removed element.
+     * @return True if an element was removed, false if the list is empty.
+     */
+    constexpr bool tryPop(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&>) {
+        if (len == 0) return false;
+
+        out = std::move(storage.ptr()[len - 1]);
+        storage.destroy(--len);
+        return true;
+    }
+
+    /**
+     * @brief Removes and returns the element at the specified index.
+     * @param index Index of the element to remove.
+     * @return The removed element.
+     *
+     * @throws IndexOutOfRangeError If index is out of bounds.
+     */
+    constexpr T pop(Size index) {
+        if (index >= len) throw IndexOutOfRangeError(len, index);
+
+        T value = std::move(storage.ptr()[index]);
+        storage.destroy(index);
+        closeGap(index, 1);
+        return value;
+    }
+
+    /**
+     * @brief Checks if the given index is within [0, len).
+     */
+    constexpr bool isIndexValid(Size index) const noexcept { return index < len; }
+
+    /**
+     * @brief Checks if the given index, which may be negative, is valid after wrapping.
+     */
+    constexpr bool isIndexValidWrapped(int32 index) const noexcept {
+        if (index < 0) index += len;
+        return index >= 0 && static_cast<Size>(index) < len;
+    }
+
+    /**
+     * @brief Accesses an element by index (unchecked).
+     * @param index Index of the element.
+     * @return Reference to the element.
+     */
+    constexpr T& get(Size index) { return storage.ptr()[index]; }
+    constexpr const T& get(Size index) const { return storage.ptr()[index]; }
+
+    constexpr T& operator[](Size index) { return storage.ptr()[index]; }
+    constexpr const T& operator[](Size index) const { return storage.ptr()[index]; }
+
+    /**
+     * @brief Accesses an element by index with bounds checking.
+     * @param index Index of the element (can be negative).
+     * @return Reference to the element.
+     *
+     * @throws IndexOutOfRangeError If index is out of bounds.
+     */
+    constexpr T& at(int32 index) {
+        if (index < 0) index += len; // handle negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) throw IndexOutOfRangeError(len, index);
+        return storage.ptr()[static_cast<Size>(index)];
+    }
+
+    constexpr const T& at(int32 index) const {
+        if (index < 0) index += len; // handle negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) throw IndexOutOfRangeError(len, index);
+        return storage.ptr()[static_cast<Size>(index)];
+    }
+
+    /**
+     * @brief Accesses an element by index with bounds checking, without throwing.
+     * @param index Index of the element (can be negative).
+     * @return Pointer to the element, or nullptr if index is out of bounds.
+     */
+    constexpr T* tryAt(int32 index) noexcept {
+        if (index < 0) index += len; // handle negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &storage.ptr()[static_cast<Size>(index)];
+    }
+
+    constexpr const T* tryAt(int32 index) const noexcept {
+        if (index < 0) index += len; // handle negative indices
+        if (index < 0 || static_cast<Size>(index) >= len) return nullptr;
+        return &storage.ptr()[static_cast<Size>(index)];
+    }
+
+    /**
+     * @brief Sets the value at the specified index.
+     * @param index Index of the element to set (can be negative).
+     * @param value The value to set.
+     *
+     * @throws IndexOutOfRangeError If index is out of bounds.
+     */
+    constexpr void set(int32 index, const T& value) { at(index) = value; }
+    constexpr void set(int32 index, T&& value) { at(index) = std::move(value); }
+
+    /**
+     * @brief Returns the first element.
+     * @throws ValueError If the list is empty.
+     */
+    constexpr T& front() {
+        if (len == 0) throw ValueError(VaStaticMessage("front() on empty list"));
+        return storage.ptr()[0];
+    }
+
+    constexpr const T& front() const {
+        if (len == 0) throw ValueError(VaStaticMessage("front() on empty list"));
+        return storage.ptr()[0];
+    }
+
+    /**
+     * @brief Returns the last element.
+     * @throws ValueError If the list is empty.
+     */
+    constexpr T& back() {
+        if (len == 0) throw ValueError(VaStaticMessage("back() on empty list"));
+        return storage.ptr()[len - 1];
+    }
+
+    constexpr const T& back() const {
+        if (len == 0) throw ValueError(VaStaticMessage("back() on empty list"));
+        return storage.ptr()[len - 1];
+    }
+
+    /**
+     * @brief Returns the first/last element, or nullptr if the list is empty.
+     */
+    constexpr T* tryFront() noexcept { return len ? &storage.ptr()[0] : nullptr; }
+    constexpr const T* tryFront() const noexcept { return len ? &storage.ptr()[0] : nullptr; }
+    constexpr T* tryBack() noexcept { return len ? &storage.ptr()[len - 1] : nullptr; }
+    constexpr const T* tryBack() const noexcept { return len ? &storage.ptr()[len - 1] : nullptr; }
+
+    /**
+     * @brief Returns the first/last element without checking that the list is not empty.
+     */
+    constexpr T& frontUnchecked() noexcept { return storage.ptr()[0]; }
+    constexpr const T& frontUnchecked() const noexcept { return storage.ptr()[0]; }
+    constexpr T& backUnchecked() noexcept { return storage.ptr()[len - 1]; }
+    constexpr const T& backUnchecked() const noexcept { return storage.ptr()[len - 1]; }
+
+    /**
+     * @brief Assigns val to every element of the list.
+     * @param val The value to fill with.
+     */
+    constexpr void fill(const T& val) {
+        for (Size i = 0; i < len; i++) storage.ptr()[i] = val;
+    }
+
+    constexpr T* dataPtr() noexcept { return storage.ptr(); }
+    constexpr const T* dataPtr() const noexcept { return storage.ptr(); }
+
+    constexpr bool isEmpty() const noexcept { return len == 0; }
+    constexpr bool isFull() const noexcept { return len == N; }
+
+    constexpr Size getLength() const noexcept { return len; }
+    static constexpr Size getCapacity() noexcept { return N; }
+
+    /**
+     * @brief Destroys all elements. The capacity stays N.
+     */
+    constexpr void clear() noexcept(tt::IsNoexceptDestructible<T>) {
+        if constexpr (!tt::IsTriviallyDestructible<T>) {
+            for (Size i = 0; i < len; i++) storage.destroy(i);
+        }
+        len = 0;
+    }
+
+  public operators:
+    friend constexpr bool operator==(const VaStaticList& lhs, const VaStaticList& rhs) {
+        if (lhs.len != rhs.len) return false;
+        for (Size i = 0; i < lhs.len; i++) {
+            if (!(lhs[i] == rhs[i])) return false;
+        }
+        return true;
+    }
+
+    friend constexpr bool operator!=(const VaStaticList& lhs, const VaStaticList& rhs) { return !(lhs == rhs); }
+
+  public friends:
+    friend constexpr Size len(const VaStaticList& list) noexcept { return list.len; }
+    friend constexpr Size cap(const VaStaticList&) noexcept { return N; }
+
+  public iterators:
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    constexpr Iterator begin() noexcept { return storage.ptr(); }
+    constexpr Iterator end() noexcept { return storage.ptr() + len; }
+
+    constexpr ConstIterator begin() const noexcept { return storage.ptr(); }
+    constexpr ConstIterator end() const noexcept { return storage.ptr() + len; }
+
+    constexpr ConstIterator cbegin() const noexcept { return storage.ptr(); }
+    constexpr ConstIterator cend() const noexcept { return storage.ptr() + len; }
+
+    constexpr ReverseIterator rbegin() noexcept { return ReverseIterator(end()); }
+    constexpr ReverseIterator rend() noexcept { return ReverseIterator(begin()); }
+
+    constexpr ConstReverseIterator rbegin() const noexcept { return ConstReverseIterator(end()); }
+    constexpr ConstReverseIterator rend() const noexcept { return ConstReverseIterator(begin()); }
+};
@@ -0,0 +1,82 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/StaticList.hpp>
+
+#include <utility>
+
+/**
+ * @class VaStaticStack A stack that stores up to N elements inline, built on VaStaticList.
+ *
+ * @tparam T Type of the stored elements.
+ * @tparam N Maximum number of elements.
+ *
+ * Offers the same push()/pop()/top()/isEmpty() interface as VaStack, so both can be passed to the
+ * same templates. push() reports a full stack through a VaResult holding a CapacityError.
+ */
+template <typename T, Size N>
+class VaStaticStack {
+  protected:
+    VaStaticList<T, N> container;
+
+    constexpr Size size() const noexcept { return container.getLength(); }
+    static constexpr Size capacity() noexcept { return N; }
+
+  public:
+    /**
+     * @brief Pushes an element onto the stack.
+     * @param elm The element to push.
+     * @return An error result holding a CapacityError if the stack is full.
+     */
+    constexpr VaResult<void, CapacityError> push(const T& elm) { return container.append(elm); }
+    constexpr VaResult<void, CapacityError> push(T&& elm) { return container.append(std::move(elm)); }
+
+    /**
+     * @brief Removes the top element.
+     *
+     * @throws IndexOutOfRangeError If the stack is empty.
+     */
+    constexpr void pop() {
+        if (container.isEmpty()) throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
+        container.pop();
+    }
+
+    /**
+     * @brief Returns the top element.
+     *
+     * @throws IndexOutOfRangeError If the stack is empty.
+     */
+    constexpr T& top() {
+        if (container.isEmpty()) throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
+        return container.backUnchecked();
+    }
+
+    constexpr const T& top() const {
+        if (container.isEmpty()) throw IndexOutOfRangeError(VaStaticMessage("Stack is empty"));
+        return container.backUnchecked();
+    }
+
+    /**
+     * @brief Returns the top element, or nullptr if the stack is empty.
+     */
+    constexpr T* tryTop() noexcept { return container.tryBack(); }
+    constexpr const T* tryTop() const noexcept { return container.tryBack(); }
+
+    /**
+     * @brief Removes the top element and moves it into out, without throwing.
+     * @return True if an element was removed, false if the stack is empty.
+     */
+    constexpr bool tryPop(T& out) noexcept(tt::IsNoexceptAssignable<T&, T&&>) { return container.tryPop(out); }
+
+    constexpr bool isEmpty() const noexcept { return container.isEmpty(); }
+    constexpr bool isFull() const noexcept { return container.isFull(); }
+
+  public friends:
+    friend constexpr Size len(const VaStaticStack& stack) noexcept { return stack.size(); }
+    friend constexpr Size cap(const VaStaticStack&) noexcept { return N; }
+};
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Meta/ConstexprStrings.hpp>
 #include <VaLib/Types/BasicTypedef.hpp>
 
 #include <cstring>
@@ -17,9 +18,6 @@
 class VaImmutableString;
 class VaString;
 
-bool operator==(const VaString& lhs, const VaString& rhs) noexcept;
-bool operator!=(const VaString& lhs, const VaString& rhs) noexcept;
-
 /**
  * @brief String implementation for VaLib
  * A dynamic string class for managing and manipulating character strings.
@@ -44,7 +42,24 @@ class VaString {
      * @brief Resizes the string buffer to a new capacity.
      * @param newCap The new capacity for the string buffer.
      */
-    void resize(Size newCap);
+    constexpr void resize(Size newCap) {
+        if (newCap <= cap) return;
+
+        char* newData = new char[newCap];
+        if (data) {
+            va::constexprStrCopy(newData, data, len);
+            delete[] data;
+        }
+        data = newData;
+        cap = newCap;
+    }
+
+    /**
+     * @brief Makes room for newLen characters, at least doubling the capacity when it grows.
+     */
+    constexpr void expand(Size newLen) {
+        if (newLen > cap) resize(newLen > cap * 2 ? newLen : cap * 2);
+    }
 
   protected friends:
     friend class VaImmutableString;
@@ -53,7 +68,7 @@ class VaString {
     /**
      * @brief Default constructor. Initializes an empty string.
      */
-    VaString() noexcept;
+    constexpr VaString() noexcept : len(0), cap(0), data(nullptr) {}
 
     /**
      * @brief Constructs a VaString from a std::string.
@@ -65,23 +80,30 @@ class VaString {
      * @brief Constructs a VaString from a C-style string.
      * @param str The C-style string to initialize from.
      */
-    VaString(const char* str) noexcept;
+    constexpr VaString(const char* str) noexcept : VaString(str, va::constexprStrLen(str)) {}
 
     /**
      * @brief Constructs a VaString from a C-style string with a specified size
      * @param str The C-style string to initialize from
      * @param size The number of characters to copy
      */
-    VaString(const char* str, Size size) noexcept;
+    constexpr VaString(const char* str, Size size) noexcept : len(size), cap(size), data(size ? new char[size] : nullptr) {
+        va::constexprStrCopy(data, str, size);
+    }
+
+    constexpr VaString(Size count, char c) noexcept : len(count), cap(count), data(new char[count]) {
+        for (Size i = 0; i < len; i++) data[i] = c;
+    }
 
-    VaString(Size count, char c) noexcept;
-    VaString(char ch) noexcept;
+    constexpr VaString(char ch) noexcept : len(1), cap(1), data(new char[1]) { data[0] = ch; }
 
     /**
      * @brief Copy constructor. Creates a copy of another VaString
      * @param other The VaString to copy from
      */
-    VaString(const VaString& other) noexcept;
+    constexpr VaString(const VaString& other) noexcept : len(other.len), cap(other.cap), data(other.cap ? new char[other.cap] : nullptr) {
+        va::constexprStrCopy(data, other.data, len);
+    }
 
     /**
      * @brief Constructs a VaString from a VaImmutableString
@@ -93,12 +115,16 @@ class VaString {
      * @brief Move constructor. Transfers ownership from another VaString
      * @param other The VaString to move from
      */
-    VaString(VaString&& other) noexcept;
+    constexpr VaString(VaString&& other) noexcept : len(other.len), cap(other.cap), data(other.data) {
+        other.data = nullptr;
+        other.len = 0;
+        other.cap = 0;
+    }
 
     /**
      * @brief Destructor. Releases the allocated memory.
      */
-    ~VaString() noexcept;
+    constexpr ~VaString() noexcept { delete[] data; }
 
     /**
      * @brief Creates a VaString object from a given C-style string.
@@ -122,57 +148,78 @@ class VaString {
      *
      * @param minCap The minimum capacity to reserve for the string.
      */
-    inline void reserve(Size minCap) {
+    constexpr void reserve(Size minCap) {
         if (minCap > cap) resize(minCap);
     }
 
-    Size hash() const {
-        constexpr int64 fnvOffset = 14695981039346656037ull;
-        constexpr int64 fnvPrime = 1099511628211ull;
-
-        Size h = fnvOffset;
-        for (Size i = 0; i < len; ++i) {
-            h ^= static_cast<uint64>(static_cast<uint8>(data[i]));
-            h *= fnvPrime;
-        }
-
-        return h;
-    }
+    constexpr Size hash() const { return va::constexprStrHash(data, len); }
 
     /**
      * @brief Copy assignment operator. Copies the content of another VaString.
      * @param other The VaString to copy from.
      * @return Reference to the current object.
      */
-    VaString& operator=(const VaString& other);
+    constexpr VaString& operator=(const VaString& other) {
+        if (this != &other) {
+            delete[] data;
+            len = other.len;
+            cap = other.cap;
+            data = cap ? new char[cap] : nullptr;
+            va::constexprStrCopy(data, other.data, len);
+        }
+        return *this;
+    }
 
     /**
      * @brief Move assignment operator. Transfers ownership from another VaString
      * @param other The VaString to move from
      * @return Reference to the current object
      */
-    VaString& operator=(VaString&& other) noexcept;
+    constexpr VaString& operator=(VaString&& other) noexcept {
+        if (this != &other) {
+            delete[] data;
+            data = other.data;
+            len = other.len;
+            cap = other.cap;
+            other.data = nullptr;
+            other.len = 0;
+            other.cap = 0;
+        }
+        return *this;
+    }
 
     /**
      * @brief Concatenates two VaStrings.
      * @param other The VaString to concatenate
      * @return A new VaString containing the concatenated result.
      */
-    VaString operator+(const VaString& other) const;
+    constexpr VaString operator+(const VaString& other) const {
+        VaString result(*this);
+        result += other;
+        return result;
+    }
 
     /**
      * @brief Concatenates a VaString with a C-style string.
      * @param str The C-style string to concatenate.
      * @return A new VaString containing the concatenated result.
      */
-    VaString operator+(const char* str) const;
+    constexpr VaString operator+(const char* str) const {
+        VaString result(*this);
+        result += str;
+        return result;
+    }
 
     /**
      * @brief Concatenates a VaString with a single character.
      * @param ch The character to concatenate.
      * @return A new VaString containing the concatenated result.
      */
-    VaString operator+(char ch) const;
+    constexpr VaString operator+(char ch) const {
+        VaString result(*this);
+        result += ch;
+        return result;
+    }
 
     /**
      * @brief Appends a substring to the current VaString object.
@@ -187,41 +234,53 @@ class VaString {
      *
      * @return A reference to the modified VaString object.
      */
-    VaString& append(const char* str, Size strLen) noexcept;
+    constexpr VaString& append(const char* str, Size strLen) noexcept {
+        expand(len + strLen);
+        va::constexprStrCopy(data + len, str, strLen);
+        len += strLen;
+        return *this;
+    }
 
     /**
      * @brief Appends a C-style string to the current VaString object.
      *
      * This function appends the provided null-terminated C-style string (`str`)
      * to the current VaString object. The length of the string is determined
-     * using `std::strlen`.
+     * using va::constexprStrLen().
      *
      * @param str A pointer to the null-terminated C-style string to append.
      * @return VaString& A reference to the current VaString object after the
      *         string has been appended.
      */
-    inline VaString& append(const char* str) { return append(str, std::strlen(str)); }
+    constexpr VaString& append(const char* str) { return append(str, va::constexprStrLen(str)); }
 
     /**
      * @brief Appends another VaString to the current string.
      * @param other The VaString to append.
      * @return Reference to the current object.
      */
-    VaString& operator+=(const VaString& other) noexcept;
+    constexpr VaString& operator+=(const VaString& other) noexcept {
+        if (this == &other) return *this;
+        return append(other.data, other.len);
+    }
 
     /**
      * @brief Appends a C-style string to the current string.
      * @param str The C-style string to append.
      * @return Reference to the current object.
      */
-    inline VaString& operator+=(const char* str) { return append(str); }
+    constexpr VaString& operator+=(const char* str) { return append(str); }
 
     /**
      * @brief Appends a single character to the current string.
      * @param ch The character to append.
      * @return Reference to the current object.
      */
-    VaString& operator+=(char ch) noexcept;
+    constexpr VaString& operator+=(char ch) noexcept {
+        expand(len + 1);
+        data[len++] = ch;
+        return *this;
+    }
 
     /**
      * @brief Provides access to a character at a specific index.
@@ -230,7 +289,7 @@ class VaString {
      *
      * @note No bounds checking is performed. Accessing an out-of-bounds index results in undefined behavior.
      */
-    char& operator[](Size index) noexcept;
+    constexpr char& operator[](Size index) noexcept { return data[index]; }
 
     /**
      * @brief Provides read-only access to a character at a specific index.
@@ -239,7 +298,7 @@ class VaString {
      *
      * @note No bounds checking is performed. Accessing an out-of-bounds index results in undefined behavior.
      */
-    const char& operator[](Size index) const noexcept;
+    constexpr const char& operator[](Size index) const noexcept { return data[index]; }
 
     /**
      * @brief Provides access to a character at a specific index with bounds checking.
@@ -280,7 +339,7 @@ class VaString {
      * @note The returned pointer is not null-terminated and points to the internal data of the string.
      *       Modifying the data through this pointer will affect the VaString object.
      */
-    inline char* dataPtr() noexcept {
+    constexpr char* dataPtr() noexcept {
         return this->data;
     }
 
@@ -290,7 +349,7 @@ class VaString {
      *
      * @note The returned pointer isn't null-terminated and must not be modified.
      */
-    inline const char* dataPtr() const noexcept {
+    constexpr const char* dataPtr() const noexcept {
         return this->data;
     }
 
@@ -303,14 +362,21 @@ class VaString {
      * @brief Checks if the string is empty.
      * @return True if the string is empty, false otherwise.
      */
-    bool isEmpty() const;
+    constexpr bool isEmpty() const { return len == 0; }
 
     /**
      * @brief Finds the first occurrence of a substring within the string.
      * @param substr The substring to search for.
      * @return The starting index of the substring if found, or npos if not found.
      */
-    Size find(const VaString& substr) const;
+    constexpr Size find(const VaString& substr) const {
+        if (substr.len == 0 || len < substr.len) return npos;
+
+        for (Size i = 0; i <= len - substr.len; i++) {
+            if (va::constexprStrEq(data + i, substr.data, substr.len)) return i;
+        }
+        return npos;
+    }
 
     /**
      * @brief Extracts a substring from the string.
@@ -318,7 +384,12 @@ class VaString {
      * @param length The length of the substring. Defaults to npos, which extracts to the end of the string.
      * @return A VaString containing the extracted substring.
      */
-    VaString substr(Size start, Size length = npos) const;
+    constexpr VaString substr(Size start, Size length = npos) const {
+        if (start >= len) return VaString();
+        if (length == npos || start + length > len) length = len - start;
+
+        return VaString(data + start, length);
+    }
 
     /**
      * @brief Clears the content of the string.
@@ -326,7 +397,7 @@ class VaString {
      * @note this function resets the length of the string to zero and resizes
      * the internal buffer to zero capacity, effectively clearing the string.
      */
-    inline void clear() {
+    constexpr void clear() {
         len = 0;
         resize(0);
     }
@@ -371,7 +442,7 @@ class VaString {
      * @brief Returns the number of chars currently stored in the string.
      * @return The current length of the string.
      */
-    inline Size getLength() {
+    constexpr Size getLength() const {
         return this->len;
     }
 
@@ -379,7 +450,7 @@ class VaString {
      * @brief Returns the total capacity of the string's internal buffer.
      * @return The current capacity of the string.
      */
-    inline Size getCapacity() {
+    constexpr Size getCapacity() const {
         return this->cap;
     }
 
@@ -394,14 +465,14 @@ class VaString {
      * @param str The VaString to query.
      * @return The length of the string.
      */
-    friend inline Size len(const VaString& str) { return str.len; }
+    friend constexpr Size len(const VaString& str) { return str.len; }
 
     /**
      * @brief Retrieves the capacity of the string buffer.
      * @param str The VaString to query.
      * @return The capacity of the string buffer.
      */
-    friend inline Size cap(const VaString& str) { return str.cap; }
+    friend constexpr Size cap(const VaString& str) { return str.cap; }
 
   public operators:
     /**
@@ -409,37 +480,38 @@ class VaString {
      * @param other The VaString to compare with.
      * @return True if the strings are equal, false otherwise.
      */
-    friend bool operator==(const VaString& lhs, const VaString& rhs) noexcept;
+    friend constexpr bool operator==(const VaString& lhs, const VaString& rhs) noexcept {
+        if (&lhs == &rhs) return true;
+        return lhs.len == rhs.len && va::constexprStrEq(lhs.data, rhs.data, lhs.len);
+    }
 
     bool operator==(const VaImmutableString& other) const noexcept;
     bool operator!=(const VaImmutableString& other) const noexcept;
 
     friend inline VaString operator+(const std::string& lhs, const VaString& rhs) { return VaString(lhs) + rhs; }
     friend inline bool operator==(const VaString& lhs, const std::string& rhs) {
-        if (lhs.len != rhs.size()) return false;
-        return std::memcmp(lhs.data, rhs.data(), lhs.len) == 0;
-    }
-    friend inline bool operator!=(const VaString& lhs, const std::string& rhs) {
-        if (lhs.len != rhs.size()) return false;
-        return std::memcmp(lhs.data, rhs.data(), lhs.len) != 0;
+        return lhs.len == rhs.size() && va::constexprStrEq(lhs.data, rhs.data(), lhs.len);
     }
+    friend inline bool operator!=(const VaString& lhs, const std::string& rhs) { return !(lhs == rhs); }
 
     friend inline bool operator==(const std::string& lhs, const VaString& rhs) { return rhs == lhs; }
     friend inline bool operator!=(const std::string& lhs, const VaString& rhs) { return rhs != lhs; }
 
-    friend inline VaString operator+(const char* lhs, const VaString& rhs) { return VaString(lhs) + rhs; }
-    friend inline bool operator==(VaString lhs, const char* rhs) { return lhs == VaString(rhs); }
-    friend inline bool operator==(const char* lhs, const VaString& rhs) { return VaString(lhs) == rhs; }
+    friend constexpr VaString operator+(const char* lhs, const VaString& rhs) { return VaString(lhs) + rhs; }
+    friend constexpr bool operator==(const VaString& lhs, const char* rhs) {
+        return lhs.len == va::constexprStrLen(rhs) && va::constexprStrEq(lhs.data, rhs, lhs.len);
+    }
+    friend constexpr bool operator==(const char* lhs, const VaString& rhs) { return rhs == lhs; }
 
-    friend inline bool operator!=(const VaString& lhs, const char* rhs) noexcept { return !(lhs == VaString(rhs)); }
-    friend inline bool operator!=(const char* lhs, const VaString& rhs) noexcept { return !(VaString(lhs) == rhs); }
+    friend constexpr bool operator!=(const VaString& lhs, const char* rhs) noexcept { return !(lhs == rhs); }
+    friend constexpr bool operator!=(const char* lhs, const VaString& rhs) noexcept { return !(rhs == lhs); }
 
     /**
      * @brief Compares two VaStrings for inequality.
      * @param other The VaString to compare with.
      * @return True if the strings are not equal, false otherwise.
      */
-    friend inline bool operator!=(const VaString& lhs, const VaString& rhs) noexcept {
+    friend constexpr bool operator!=(const VaString& lhs, const VaString& rhs) noexcept {
         return !(lhs == rhs);
     }
 
@@ -448,13 +520,30 @@ class VaString {
      * @param other The VaString to compare with.
      * @return True if the lhs is less than rhs, false otherwise.
      */
-    friend bool operator<(const VaString& lhs, const VaString& rhs);
+    friend constexpr bool operator<(const VaString& lhs, const VaString& rhs) {
+        Size minLen = lhs.len < rhs.len ? lhs.len : rhs.len;
 
-    friend inline bool operator>(const VaString& lhs, const VaString& rhs) { return rhs < lhs; }
-    friend inline bool operator<=(const VaString& lhs, const VaString& rhs) { return !(lhs > rhs); }
-    friend inline bool operator>=(const VaString& lhs, const VaString& rhs) { return !(lhs < rhs); }
+        for (Size i = 0; i < minLen; i++) {
+            if (lhs.data[i] < rhs.data[i]) return true;
+            if (lhs.data[i] > rhs.data[i]) return false;
+        }
+        return lhs.len < rhs.len;
+    }
+
+    friend constexpr bool operator>(const VaString& lhs, const VaString& rhs) { return rhs < lhs; }
+    friend constexpr bool operator<=(const VaString& lhs, const VaString& rhs) { return !(lhs > rhs); }
+    friend constexpr bool operator>=(const VaString& lhs, const VaString& rhs) { return !(lhs < rhs); }
 
-    VaString& operator+=(VaString&& other) noexcept;
+    constexpr VaString& operator+=(VaString&& other) noexcept {
+        if (this == &other) return *this;
+        append(other.data, other.len);
+
+        delete[] other.data;
+        other.data = nullptr;
+        other.len = 0;
+        other.cap = 0;
+        return *this;
+    }
 
   public iterators:
     using Iterator = char*;
@@ -462,23 +551,23 @@ class VaString {
     using ReverseIterator = std::reverse_iterator<Iterator>;
     using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
 
-    inline Iterator begin() noexcept { return data; }
-    inline Iterator end() noexcept { return data + len; }
+    constexpr Iterator begin() noexcept { return data; }
+    constexpr Iterator end() noexcept { return data + len; }
 
-    inline ConstIterator begin() const noexcept { return data; }
-    inline ConstIterator end() const noexcept { return data + len; }
+    constexpr ConstIterator begin() const noexcept { return data; }
+    constexpr ConstIterator end() const noexcept { return data + len; }
 
-    inline ConstIterator cbegin() const noexcept { return data; }
-    inline ConstIterator cend() const noexcept { return data + len; }
+    constexpr ConstIterator cbegin() const noexcept { return data; }
+    constexpr ConstIterator cend() const noexcept { return data + len; }
 
-    inline ReverseIterator rbegin() { return ReverseIterator(end()); }
-    inline ReverseIterator rend() { return ReverseIterator(begin()); }
+    constexpr ReverseIterator rbegin() { return ReverseIterator(end()); }
+    constexpr ReverseIterator rend() { return ReverseIterator(begin()); }
 
-    inline ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); }
-    inline ConstReverseIterator rend() const { return ConstReverseIterator(begin()); }
+    constexpr ConstReverseIterator rbegin() const { return ConstReverseIterator(end()); }
+    constexpr ConstReverseIterator rend() const { return ConstReverseIterator(begin()); }
 
-    inline ConstReverseIterator crbegin() const { return ConstReverseIterator(cend()); }
-    inline ConstReverseIterator crend() const { return ConstReverseIterator(cbegin()); }
+    constexpr ConstReverseIterator crbegin() const { return ConstReverseIterator(cend()); }
+    constexpr ConstReverseIterator crend() const { return ConstReverseIterator(cbegin()); }
 };
 
 inline VaString operator"" _Vs(const char* str, Size size) { return VaString(str, size); }
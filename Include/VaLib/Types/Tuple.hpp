@@ -8,112 +8,157 @@
 
 #include <VaLib/Types/TypeTraits.hpp>
 
-#include <utility>
 #include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace va {
+namespace detail {
 
 /**
- * @class VaTuple Variadic tuple class template.
- *
- * @note This class supports variadic storage and provides methods for element access,
- * iteration, and functional operations.
+ * @brief Storage of one VaTuple element.
+ * @tparam I Index of the element, keeps leaves of equal types distinct.
+ * @tparam T Type of the element.
  */
-template <typename... Types>
-class VaTuple;
+template <Size I, typename T, bool Ebo = tt::IsEmpty<T> && !std::is_final_v<T>>
+class TupleLeaf {
+  protected:
+    T value;
+
+  public:
+    constexpr TupleLeaf() : value() {}
+
+    template <typename Arg>
+    constexpr TupleLeaf(std::in_place_t, Arg&& arg) : value(std::forward<Arg>(arg)) {}
+
+    constexpr T& get() noexcept { return value; }
+    constexpr const T& get() const noexcept { return value; }
+};
 
 /**
- * @brief Specialization of VaTuple for an empty tuple.
- *
- * @note This is the recursion base case used for inheritance chaining.
+ * @brief Storage of an empty element: derives from it so that it takes no space.
  */
-template <>
-class VaTuple<> {
+template <Size I, typename T>
+class TupleLeaf<I, T, true>: private T {
   public:
-    /**
-     * @brief Constructs a VaTuple from arguments.
-     * @tparam Args Argument types.
-     * @param args Arguments to construct the tuple from.
-     * @return VaTuple of decayed types.
-     *
-     * @note This method deduces and decays argument types to form a new tuple.
-     */
-    template <typename... Args>
-    static auto Make(Args&&... args) {
-        return VaTuple<tt::Decay<Args>...>(std::forward<Args>(args)...);
-    }
+    constexpr TupleLeaf() : T() {}
 
-    /**
-     * @brief Applies a function to each element (no-op for empty tuple).
-     * @tparam Func Callable type.
-     * @param func Function to apply.
-     *
-     * @note This overload is a no-op because the tuple is empty.
-     */
-    template <typename Func>
-    void forEach(Func&&) {}
+    template <typename Arg>
+    constexpr TupleLeaf(std::in_place_t, Arg&& arg) : T(std::forward<Arg>(arg)) {}
 
-    /**
-     * @brief Applies a function to each element (const version).
-     * @tparam Func Callable type.
-     * @param func Function to apply.
-     *
-     * @note This overload is a no-op because the tuple is empty.
-     */
-    template <typename Func>
-    void forEach(Func&&) const {}
+    constexpr T& get() noexcept { return *this; }
+    constexpr const T& get() const noexcept { return *this; }
+};
 
-    /**
-     * @brief Applies a function to each element with index (no-op for empty tuple).
-     * @tparam Func Callable type.
-     * @tparam I Start index (default 0).
-     * @param func Function to apply with index.
-     *
-     * @note This overload is a no-op because the tuple is empty.
-     */
-    template <typename Func, Size I = 0>
-    void forEachIndexed(Func&&) {}
+/**
+ * @brief Flat storage of a VaTuple: one base class per element, in order.
+ */
+template <typename Indices, typename... Types>
+class TupleStorage;
 
-    /**
-     * @brief Applies a function to each element with index (const version).
-     *
+template <Size... I, typename... Types>
+class TupleStorage<std::index_sequence<I...>, Types...>: public TupleLeaf<I, Types>... {
+  public:
+    constexpr TupleStorage() = default;
 
-     * @tparam Func Callable type.
-     * @tparam I Start index (default 0).
-     * @param func Function to apply with index.
-     *
-     * @note This overload is a no-op because the tuple is empty.
-     */
-    template <typename Func, Size I = 0>
-    void forEachIndexed(Func&&) const {}
+    template <typename... Args>
+    constexpr TupleStorage(std::in_place_t, Args&&... args)
+        : TupleLeaf<I, Types>(std::in_place, std::forward<Args>(args))... {}
 };
 
 /**
- * @brief Variadic recursive tuple implementation.
- * @tparam Head Type of the current head element.
- * @tparam Tail Types of the remaining elements.
+ * @brief Finds the leaf of index I among the bases of a TupleStorage.
+ *
+ * @note The leaf is deduced from the derived-to-base conversion, so the lookup does
+ * not instantiate anything per preceding element.
+ */
+// @{
+template <Size I, typename T, bool Ebo>
+constexpr TupleLeaf<I, T, Ebo>& tupleLeaf(TupleLeaf<I, T, Ebo>& leaf) noexcept {
+    return leaf;
+}
+
+template <Size I, typename T, bool Ebo>
+constexpr const TupleLeaf<I, T, Ebo>& tupleLeaf(const TupleLeaf<I, T, Ebo>& leaf) noexcept {
+    return leaf;
+}
+// @}
+
+/**
+ * @brief Type of the leaf of index I. Only used in unevaluated contexts.
+ */
+template <Size I, typename T, bool Ebo>
+std::type_identity<T> tupleElement(const TupleLeaf<I, T, Ebo>&);
+
+/**
+ * @brief Index of the only leaf of type T. Only used in unevaluated contexts.
+ *
+ * @note Deduction fails if T is missing or repeated.
+ */
+template <typename T, Size I, bool Ebo>
+std::integral_constant<Size, I> tupleTypeIndex(const TupleLeaf<I, T, Ebo>&);
+
+/**
+ * @brief Index of the first T in Types, or sizeof...(Types) if there is none.
+ */
+template <typename T, typename... Types>
+constexpr Size tupleIndexOf() {
+    constexpr bool matches[] = {tt::IsSame<T, Types>..., false};
+
+    Size index = 0;
+    while (index < sizeof...(Types) && !matches[index]) index++;
+    return index;
+}
+
+} // namespace detail
+} // namespace va
+
+/**
+ * @class VaTuple Variadic tuple class template.
  *
- * @note This implementation recursively inherits from VaTuple<Tail...>.
+ * @note The elements are stored side by side, in order, as bases of a flat storage class.
+ * Empty element types take no space. Element access does not recurse, so get<I>,
+ * forEach and forEachIndexed cost the same to instantiate for any element.
  */
-template <typename Head, typename... Tail>
-class VaTuple<Head, Tail...>: protected VaTuple<Tail...> {
+template <typename... Types>
+class VaTuple: protected va::detail::TupleStorage<std::index_sequence_for<Types...>, Types...> {
   protected:
-    Head head;
+    using Storage = va::detail::TupleStorage<std::index_sequence_for<Types...>, Types...>;
+    using Indices = std::index_sequence_for<Types...>;
+
+    // One argument per element, and a single VaTuple argument is left to the copy and move constructors.
+    template <typename... Args>
+    static constexpr bool IsForwardable = sizeof...(Args) == sizeof...(Types) && sizeof...(Types) > 0 &&
+                                          (sizeof...(Args) > 1 || (!tt::IsSame<tt::Decay<Args>, VaTuple> && ...));
 
   public:
     /**
-     * @brief Constructs a VaTuple from const references.
-     * @param head First element.
-     * @param tail Remaining elements.
+     * @brief Alias for the type of the I-th element.
+     * @tparam I Index of the element.
      */
-    VaTuple(const Head& head, const Tail&... tail) : VaTuple<Tail...>(tail...), head(head) {}
+    template <Size I>
+    using Element = typename decltype(va::detail::tupleElement<I>(std::declval<const Storage&>()))::type;
 
     /**
-     * @brief Constructs a VaTuple from rvalue references.
-     * @param head First element.
-     * @param tail Remaining elements.
+     * @brief Value-initializes every element.
      */
-    VaTuple(Head&& head, Tail&&... tail) : VaTuple<Tail...>(
-        std::forward<Tail>(tail)...), head(std::forward<Head>(head)
-    ) {}
+    constexpr VaTuple() = default;
+
+    /**
+     * @brief Constructs a VaTuple by copying the elements.
+     * @param values Elements of the tuple.
+     */
+    constexpr VaTuple(const Types&... values)
+        requires(sizeof...(Types) > 0)
+        : Storage(std::in_place, values...) {}
+
+    /**
+     * @brief Constructs a VaTuple by forwarding one argument to each element.
+     * @param args Arguments to construct the elements from.
+     */
+    template <typename... Args>
+        requires(IsForwardable<Args...> && (tt::IsConstructible<Types, Args&&> && ...))
+    constexpr VaTuple(Args&&... args) : Storage(std::in_place, std::forward<Args>(args)...) {}
 
     /**
      * @brief Creates a VaTuple by decaying and forwarding arguments.
@@ -122,220 +167,165 @@ class VaTuple<Head, Tail...>: protected VaTuple<Tail...> {
      * @return New VaTuple with decayed argument types.
      */
     template <typename... Args>
-    static auto Make(Args&&... args) {
-        return VaTuple<std::decay_t<Args>...>(std::forward<Args>(args)...);
+    static constexpr auto Make(Args&&... args) {
+        return VaTuple<tt::Decay<Args>...>(std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Returns a reference to the first element.
-     * @return Reference to the first element.
+     * @brief Retrieves the element at index I.
+     * @tparam I Index of the element.
+     * @return Reference to the element at index I, an rvalue reference on rvalue tuples.
      */
-    auto& first() { return head; }
+    // @{
+    template <Size I>
+    constexpr Element<I>& get() & noexcept {
+        return va::detail::tupleLeaf<I>(*this).get();
+    }
+
+    template <Size I>
+    constexpr const Element<I>& get() const& noexcept {
+        return va::detail::tupleLeaf<I>(*this).get();
+    }
+
+    template <Size I>
+    constexpr Element<I>&& get() && noexcept {
+        return static_cast<Element<I>&&>(va::detail::tupleLeaf<I>(*this).get());
+    }
+
+    template <Size I>
+    constexpr const Element<I>&& get() const&& noexcept {
+        return static_cast<const Element<I>&&>(va::detail::tupleLeaf<I>(*this).get());
+    }
+    // @}
 
     /**
-     * @brief Returns a const reference to the first element.
-     * @return Const reference to the first element.
+     * @brief Retrieves the first element of type T in the tuple.
+     * @tparam T Type to search for.
+     * @return Reference to the element of type T.
      */
-    const auto& first() const { return head; }
+    // @{
+    template <typename T>
+    constexpr T& get() & noexcept {
+        return get<indexOf<T>()>();
+    }
+
+    template <typename T>
+    constexpr const T& get() const& noexcept {
+        return get<indexOf<T>()>();
+    }
+
+    template <typename T>
+    constexpr T&& get() && noexcept {
+        return std::move(*this).template get<indexOf<T>()>();
+    }
+
+    template <typename T>
+    constexpr const T&& get() const&& noexcept {
+        return std::move(*this).template get<indexOf<T>()>();
+    }
+    // @}
 
     /**
-     * @brief Returns a reference to the second element.
-     * @return Reference to the second element.
-     *
-     * @warning Asserts at compile time if the tuple has fewer than two elements.
+     * @brief Returns the first element.
      */
-    auto& second() {
-        static_assert(sizeof...(Tail) >= 1, "Tuple does not have a second element.");
-        return VaTuple<Tail...>::template get<0>();
+    // @{
+    constexpr decltype(auto) first() noexcept {
+        static_assert(sizeof...(Types) >= 1, "Tuple does not have a first element.");
+        return get<0>();
     }
 
+    constexpr decltype(auto) first() const noexcept {
+        static_assert(sizeof...(Types) >= 1, "Tuple does not have a first element.");
+        return get<0>();
+    }
+    // @}
+
     /**
-     * @brief Returns a const reference to the second element.
-     * @return Const reference to the second element.
-     *
+     * @brief Returns the second element.
      * @warning Asserts at compile time if the tuple has fewer than two elements.
      */
-    const auto& second() const {
-        static_assert(sizeof...(Tail) >= 1, "Tuple does not have a second element.");
-        return VaTuple<Tail...>::template get<0>();
+    // @{
+    constexpr decltype(auto) second() noexcept {
+        static_assert(sizeof...(Types) >= 2, "Tuple does not have a second element.");
+        return get<1>();
     }
 
-    /**
-     * @brief Returns a reference to the third element.
-     * @return Reference to the third element.
-     *
-     * @warning Asserts at compile time if the tuple has fewer than three elements.
-     */
-    auto& third() {
-        static_assert(sizeof...(Tail) >= 2, "Tuple does not have a third element.");
-        return VaTuple<Tail...>::template get<1>();
+    constexpr decltype(auto) second() const noexcept {
+        static_assert(sizeof...(Types) >= 2, "Tuple does not have a second element.");
+        return get<1>();
     }
+    // @}
 
     /**
-     * @brief Returns a const reference to the third element.
-     * @return Const reference to the third element.
-     *
+     * @brief Returns the third element.
      * @warning Asserts at compile time if the tuple has fewer than three elements.
      */
-    const auto& third() const {
-        static_assert(sizeof...(Tail) >= 2, "Tuple does not have a third element.");
-        return VaTuple<Tail...>::template get<1>();
+    // @{
+    constexpr decltype(auto) third() noexcept {
+        static_assert(sizeof...(Types) >= 3, "Tuple does not have a third element.");
+        return get<2>();
     }
 
+    constexpr decltype(auto) third() const noexcept {
+        static_assert(sizeof...(Types) >= 3, "Tuple does not have a third element.");
+        return get<2>();
+    }
+    // @}
+
     /**
      * @brief Applies a function to each element in order.
      * @tparam Func Callable type.
      * @param func Function to apply.
      */
+    // @{
     template <typename Func>
-    void forEach(Func&& func) {
-        func(head);
-        VaTuple<Tail...>::forEach(std::forward<Func>(func));
+    constexpr void forEach(Func&& func) {
+        [&]<Size... I>(std::index_sequence<I...>) {
+            (static_cast<void>(func(get<I>())), ...);
+        }(Indices{});
     }
 
-    /**
-     * @brief Applies a function to each element in order (const version).
-     * @tparam Func Callable type.
-     * @param func Function to apply.
-     */
     template <typename Func>
-    void forEach(Func&& func) const {
-        func(head);
-        VaTuple<Tail...>::forEach(std::forward<Func>(func));
+    constexpr void forEach(Func&& func) const {
+        [&]<Size... I>(std::index_sequence<I...>) {
+            (static_cast<void>(func(get<I>())), ...);
+        }(Indices{});
     }
+    // @}
 
     /**
-     * @brief Applies a function to each element with index.
+     * @brief Applies a function to each element in order, along with its index.
      * @tparam Func Callable type.
-     * @tparam I Start index (default 0).
-     * @param func Function to apply with index.
+     * @param func Function called as func(std::integral_constant<Size, I>{}, element).
      */
-    template <typename Func, Size I = 0>
-    void forEachIndexed(Func&& func) {
-        func(std::integral_constant<Size, I>{}, head);
-        VaTuple<Tail...>::template forEachIndexed<Func, I + 1>(std::forward<Func>(func));
+    // @{
+    template <typename Func>
+    constexpr void forEachIndexed(Func&& func) {
+        [&]<Size... I>(std::index_sequence<I...>) {
+            (static_cast<void>(func(std::integral_constant<Size, I>{}, get<I>())), ...);
+        }(Indices{});
     }
 
-    /**
-     * @brief Applies a function to each element with index (const version).
-     * @tparam Func Callable type.
-     * @tparam I Start index (default 0).
-     * @param func Function to apply with index.
-     */
-    template <typename Func, Size I = 0>
-    void forEachIndexed(Func&& func) const {
-        func(std::integral_constant<Size, I>{}, head);
-        VaTuple<Tail...>::template forEachIndexed<Func, I + 1>(std::forward<Func>(func));
+    template <typename Func>
+    constexpr void forEachIndexed(Func&& func) const {
+        [&]<Size... I>(std::index_sequence<I...>) {
+            (static_cast<void>(func(std::integral_constant<Size, I>{}, get<I>())), ...);
+        }(Indices{});
     }
+    // @}
 
-    #if __cplusplus >= CPP17
-        /**
-         * @brief Retrieves the element at index I.
-         * @tparam I Index of the element.
-         * @return Reference to the element at index I.
-         *
-         * @note This function uses recursion and constexpr evaluation.
-         */
-        template <Size I>
-        auto& get() {
-            if constexpr (I == 0) {
-                return head;
-            } else {
-                return VaTuple<Tail...>::template get<I - 1>();
-            }
-        }
-
-        /**
-         * @brief Retrieves the element at index I (const version).
-         * @tparam I Index of the element.
-         * @return Const reference to the element at index I.
-         */
-        template <Size I>
-        const auto& get() const {
-            if constexpr (I == 0) {
-                return head;
-            } else {
-                return VaTuple<Tail...>::template get<I - 1>();
-            }
-        }
-
-        /**
-         * @brief Retrieves the first element of type T in the tuple.
-         * @tparam T Type to search for.
-         * @return Reference to the element of type T.
-         *
-         * @note This function will return the first occurrence of type T.
-         */
-        template <typename T>
-        T& get() {
-            if constexpr (tt::IsSame<T, Head>) {
-                return head;
-            } else {
-                return VaTuple<Tail...>::template get<T>();
-            }
-        }
-
-        /**
-         * @brief Retrieves the first element of type T in the tuple (const version).
-         * @tparam T Type to search for.
-         * @return Const reference to the element of type T.
-         */
-        template <typename T>
-        const T& get() const {
-            if constexpr (tt::IsSame<T, Head>) {
-                return head;
-            } else {
-                return VaTuple<Tail...>::template get<T>();
-            }
-        }
-    #else
-        template <Size I>
-        typename tt::EnableIf<I == 0, Head&> get() {
-            return head;
-        }
-
-        template <Size I>
-        tt::EnableIf<I != 0, decltype(std::declval<VaTuple<Tail...>&>().template get<I - 1>())> get() {
-            return VaTuple<Tail...>::template get<I - 1>();
-        }
-
-        template <Size I>
-        tt::EnableIf<I == 0, const Head&> get() const {
-            return head;
-        }
-
-        template <Size I>
-        tt::EnableIf<I != 0, decltype(std::declval<const VaTuple<Tail...>&>().template get<I - 1>())> get() const {
-            return VaTuple<Tail...>::template get<I - 1>();
-        }
-
-        template <typename T>
-        typename tt::EnableIf<tt::IsSame<T, Head>, T&> get() {
-            return head;
-        }
-
-        template <typename T>
-        typename tt::EnableIf<!tt::IsSame<T, Head>, T&> get() {
-            return VaTuple<Tail...>::template get<T>();
-        }
-
-        template <typename T>
-        typename tt::EnableIf<tt::IsSame<T, Head>, const T&> get() const {
-            return head;
-        }
-
-        template <typename T>
-        typename tt::EnableIf<!tt::IsSame<T, Head>, const T&> get() const {
-            return VaTuple<Tail...>::template get<T>();
+  protected:
+    template <typename T>
+    static constexpr Size indexOf() {
+        if constexpr (requires { va::detail::tupleTypeIndex<T>(std::declval<const Storage&>()); }) {
+            return decltype(va::detail::tupleTypeIndex<T>(std::declval<const Storage&>()))::value;
+        } else {
+            // T is missing or repeated: scan for its first occurrence
+            constexpr Size index = va::detail::tupleIndexOf<T, Types...>();
+            static_assert(index < sizeof...(Types), "Type not found in the tuple.");
+            return index;
         }
-    #endif
-
-    /**
-     * @brief Alias for the type of the I-th element.
-     * @tparam I Index of the element.
-     */
-    template <Size I>
-    using Element = typename std::tuple_element<I, VaTuple>::type;
+    }
 };
 
 #if __cplusplus >= CPP17
@@ -377,17 +367,30 @@ inline auto operator+(const VaTuple<Types1...>& lhs, const VaTuple<Types2...>& r
         std::make_index_sequence<sizeof...(Types2)>{});
 }
 
+/**
+ * @brief Element-wise equality of two VaTuples of the same types.
+ * @note Compares in order and stops at the first unequal element.
+ */
+template <typename... Types>
+inline bool operator==(const VaTuple<Types...>& lhs, const VaTuple<Types...>& rhs) {
+    return [&]<Size... I>(std::index_sequence<I...>) {
+        return (... && (lhs.template get<I>() == rhs.template get<I>()));
+    }(std::make_index_sequence<sizeof...(Types)>{});
+}
+
+template <typename... Types>
+inline bool operator!=(const VaTuple<Types...>& lhs, const VaTuple<Types...>& rhs) {
+    return !(lhs == rhs);
+}
+
 namespace std {
 
 template <Size I, typename T>
 struct tuple_element;
 
-template <Size I, typename Head, typename... Tail>
-struct tuple_element<I, VaTuple<Head, Tail...>>: tuple_element<I - 1, VaTuple<Tail...>> {};
-
-template <typename Head, typename... Tail>
-struct tuple_element<0, VaTuple<Head, Tail...>> {
-    using type = Head;
+template <Size I, typename... Types>
+struct tuple_element<I, VaTuple<Types...>> {
+    using type = typename VaTuple<Types...>::template Element<I>;
 };
 
 template <typename... Ts>
@@ -416,6 +419,26 @@ decltype(auto) get(const VaTuple<Types...>&& tuple) {
     return std::move(tuple).template get<I>();
 }
 
+template <typename T, typename... Types>
+decltype(auto) get(VaTuple<Types...>& tuple) {
+    return tuple.template get<T>();
+}
+
+template <typename T, typename... Types>
+decltype(auto) get(const VaTuple<Types...>& tuple) {
+    return tuple.template get<T>();
+}
+
+template <typename T, typename... Types>
+decltype(auto) get(VaTuple<Types...>&& tuple) {
+    return std::move(tuple).template get<T>();
+}
+
+template <typename T, typename... Types>
+decltype(auto) get(const VaTuple<Types...>&& tuple) {
+    return std::move(tuple).template get<T>();
+}
+
 } // namespace std
 
 #if __cplusplus >= CPP17
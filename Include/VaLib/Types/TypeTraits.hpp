@@ -204,11 +204,11 @@ struct ResultOfType {
 };
 
 template <typename T>
-using RemoveCVRef = tt::RemoveReference<tt::RemoveCV<T>>;
+using RemoveCVRef = tt::RemoveCV<tt::RemoveReference<T>>;
 
 template <typename T>
 struct RemoveCVRefType {
-    using Type = tt::RemoveReference<tt::RemoveCV<T>>;
+    using Type = tt::RemoveCV<tt::RemoveReference<T>>;
 };
 
 // Traits
@@ -0,0 +1,514 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Meta/TemplateAt.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace va::detail {
+
+/// @brief Smallest unsigned type able to hold every alternative index plus the valueless marker.
+template <Size Count>
+using VariantIndexType = tt::Conditional<(Count < 0xff), uint8, tt::Conditional<(Count < 0xffff), uint16, uint32>>;
+
+template <typename T, typename... Ts>
+inline constexpr Size variantCount = (Size(0) + ... + Size(tt::IsSame<T, Ts>));
+
+/**
+ * @brief Index of the first alternative of type T, or sizeof...(Ts) if there is none.
+ */
+template <typename T, typename... Ts>
+constexpr Size variantFind() {
+    constexpr bool same[] = {tt::IsSame<T, Ts>..., false};
+    Size i = 0;
+    while (i < sizeof...(Ts) && !same[i]) i++;
+    return i;
+}
+
+/**
+ * @brief Index of the alternative a value of type T converts to: the alternative of the same type
+ *        if there is one, else the only alternative constructible from T.
+ * @return The index, or sizeof...(Ts) if there is no such alternative or the choice is ambiguous.
+ */
+template <typename T, typename... Ts>
+constexpr Size variantSelect() {
+    using U = tt::Decay<T>;
+    constexpr Size count = sizeof...(Ts);
+    constexpr bool constructible[] = {tt::IsConstructible<Ts, T>..., false};
+
+    if constexpr (variantCount<U, Ts...> == 1) {
+        return variantFind<U, Ts...>();
+    } else if constexpr (variantCount<U, Ts...> == 0) {
+        Size found = count;
+        for (Size i = 0; i < count; i++) {
+            if (!constructible[i]) continue;
+            if (found != count) return count; // Ambiguous
+            found = i;
+        }
+        return found;
+    }
+    return count;
+}
+
+template <typename T>
+inline T* variantPtr(void* storage) noexcept {
+    return std::launder(static_cast<T*>(storage));
+}
+
+template <typename T>
+inline const T* variantPtr(const void* storage) noexcept {
+    return std::launder(static_cast<const T*>(storage));
+}
+
+// Entries of the dispatch tables of VaVariant, one instance per alternative.
+
+template <typename T>
+void variantDestroy(void* storage) noexcept {
+    variantPtr<T>(storage)->~T();
+}
+
+template <typename T>
+void variantCopy(void* dest, const void* src) {
+    new (dest) T(*variantPtr<T>(src));
+}
+
+template <typename T>
+void variantMove(void* dest, void* src) {
+    new (dest) T(std::move(*variantPtr<T>(src)));
+}
+
+template <typename T>
+void variantCopyAssign(void* dest, const void* src) {
+    *variantPtr<T>(dest) = *variantPtr<T>(src);
+}
+
+template <typename T>
+void variantMoveAssign(void* dest, void* src) {
+    *variantPtr<T>(dest) = std::move(*variantPtr<T>(src));
+}
+
+template <typename T>
+bool variantEqual(const void* a, const void* b) {
+    return *variantPtr<T>(a) == *variantPtr<T>(b);
+}
+
+/**
+ * @brief Calls fn with the alternative stored at storage, as Q (`T&`, `const T&` or `T&&`).
+ */
+template <typename R, typename F, typename Q>
+R variantInvoke(F& fn, void* storage) {
+    using T = tt::RemoveReference<Q>;
+    return std::invoke(fn, static_cast<Q>(*std::launder(static_cast<T*>(storage))));
+}
+
+template <Size A, Size... Rest>
+inline constexpr Size variantMax = A > variantMax<Rest...> ? A : variantMax<Rest...>;
+
+template <Size A>
+inline constexpr Size variantMax<A> = A;
+
+} // namespace va::detail
+
+/**
+ * @class VaVariant A type-safe union holding exactly one value out of a closed set of types.
+ *
+ * @tparam Ts The alternatives. Each type may appear only once if it is to be accessed by type.
+ *
+ * The value lives inline, in a buffer sized and aligned for the largest alternative, next to the
+ * smallest integer able to hold the index of the current alternative (a byte for up to 254
+ * alternatives). Nothing is ever heap-allocated, and since the set of types is known at compile
+ * time holds<T>() is a single integer compare, with no type_info involved as in VaAny.
+ *
+ * visit() dispatches on the stored index through a jump table, so its cost does not depend on the
+ * number of alternatives or on which one is held.
+ *
+ * Copy, move and destruction are trivial when they are trivial for every alternative, so e.g.
+ * `VaVariant<int, float64>` is trivially copyable.
+ *
+ * @code
+ * VaVariant<int, VaString> v = 42;
+ * v.emplace<VaString>(3, 'x'); // Built in place: "xxx"
+ *
+ * if (v.holds<VaString>()) print(v.get<VaString>());
+ * Size length = v.visit([](const auto& value) { return sizeof(value); });
+ * @endcode
+ *
+ * @note A variant becomes valueless only if constructing a new alternative throws after the old one
+ *       was destroyed. get() and visit() throw on a valueless variant, holds<T>() is false for every T.
+ */
+template <typename... Ts>
+class VaVariant {
+    static_assert(sizeof...(Ts) > 0, "VaVariant requires at least one alternative");
+    static_assert(((!tt::IsReference<Ts> && !tt::IsSame<Ts, void>) && ...), "VaVariant alternatives must be object types");
+
+  public:
+    /// @brief Type of the stored index.
+    using IndexType = va::detail::VariantIndexType<sizeof...(Ts)>;
+
+    /// @brief The alternative at index I.
+    template <Size I>
+    using TypeAt = VaTemplateTypeAt_t<I, Ts...>;
+
+    /// @brief Number of alternatives.
+    static constexpr Size count = sizeof...(Ts);
+
+    /// @brief Index returned by getIndex() when the variant is valueless.
+    static constexpr Size npos = Size(-1);
+
+    /// @brief Index of the alternative T, which must appear exactly once in Ts.
+    template <typename T>
+    static constexpr Size indexOf = va::detail::variantFind<T, Ts...>();
+
+  protected:
+    /// @brief Alternative selected for a value of type T, or count if there is none.
+    template <typename T>
+    static constexpr Size selectFor = va::detail::variantSelect<T, Ts...>();
+
+    static constexpr IndexType valueless = IndexType(-1);
+
+    static constexpr bool trivialDestructor = (tt::IsTriviallyDestructible<Ts> && ...);
+    static constexpr bool copyable = (tt::IsCopyConstructible<Ts> && ...);
+    static constexpr bool movable = (tt::IsMoveConstructible<Ts> && ...);
+    static constexpr bool trivialCopy = trivialDestructor && (tt::IsTriviallyCopyConstructible<Ts> && ...);
+    static constexpr bool trivialMove = trivialDestructor && (tt::IsTriviallyMoveConstructible<Ts> && ...);
+    static constexpr bool trivialCopyAssign = trivialCopy && (tt::IsTriviallyCopyAssignable<Ts> && ...);
+    static constexpr bool trivialMoveAssign = trivialMove && (tt::IsTriviallyMoveAssignable<Ts> && ...);
+    static constexpr bool noexceptMove = (tt::IsNoexceptMoveConstructible<Ts> && ...);
+
+    template <typename T>
+    static constexpr void checkAlternative() {
+        static_assert(va::detail::variantCount<T, Ts...> == 1, "T must appear exactly once in the alternatives of the VaVariant");
+    }
+
+    alignas(Ts...) byte storage[va::detail::variantMax<sizeof(Ts)...>];
+    IndexType index = valueless;
+
+    void destroy() noexcept {
+        if constexpr (!trivialDestructor) {
+            static constexpr void (*table[])(void*) noexcept = {&va::detail::variantDestroy<Ts>...};
+            if (index != valueless) table[index](storage);
+        }
+        index = valueless;
+    }
+
+    void copyFrom(const VaVariant& other) {
+        static constexpr void (*table[])(void*, const void*) = {&va::detail::variantCopy<Ts>...};
+        if (other.index == valueless) return;
+        table[other.index](storage, other.storage);
+        index = other.index;
+    }
+
+    void moveFrom(VaVariant& other) {
+        static constexpr void (*table[])(void*, void*) = {&va::detail::variantMove<Ts>...};
+        if (other.index == valueless) return;
+        table[other.index](storage, other.storage);
+        index = other.index;
+    }
+
+    template <Size I, typename... Args>
+    TypeAt<I>& construct(Args&&... args) {
+        TypeAt<I>* value = new (storage) TypeAt<I>(std::forward<Args>(args)...);
+        index = IndexType(I);
+        return *value;
+    }
+
+    /**
+     * @brief Calls fn with the current value as the matching Q.
+     *
+     * The first alternatives are dispatched by a switch, which the compiler turns into a jump table
+     * with the calls inlined; any further ones go through a table of function pointers.
+     */
+    template <typename R, typename F, typename... Qs>
+    R dispatch(F& fn, const void* data) const {
+        static_assert((tt::IsSame<std::invoke_result_t<F&, Qs>, R> && ...), "visit() requires the same return type for every alternative");
+        void* p = const_cast<void*>(data);
+
+#define VA_VARIANT_CASE(I)                                                                                   \
+    case I:                                                                                                  \
+        if constexpr (I < sizeof...(Qs)) return va::detail::variantInvoke<R, F, VaTemplateTypeAt_t<I, Qs...>>(fn, p); \
+        break;
+
+        switch (index) {
+            VA_VARIANT_CASE(0)
+            VA_VARIANT_CASE(1)
+            VA_VARIANT_CASE(2)
+            VA_VARIANT_CASE(3)
+            VA_VARIANT_CASE(4)
+            VA_VARIANT_CASE(5)
+            VA_VARIANT_CASE(6)
+            VA_VARIANT_CASE(7)
+        default:
+            if constexpr (sizeof...(Qs) > 8) {
+                static constexpr R (*table[])(F&, void*) = {&va::detail::variantInvoke<R, F, Qs>...};
+                if (index != valueless) return table[index](fn, p);
+            }
+            break;
+        }
+
+#undef VA_VARIANT_CASE
+
+        throw InvalidVariantCastError(VaStaticMessage("visit() of a valueless variant"));
+    }
+
+    template <Size I>
+    inline void checkIndex() const {
+        if (index != IndexType(I)) throw InvalidVariantCastError();
+    }
+
+  public:
+    /**
+     * @brief Constructs a variant holding a value-initialized first alternative.
+     */
+    VaVariant() noexcept(tt::IsNoexceptDefaultConstructible<TypeAt<0>>)
+        requires tt::IsDefaultConstructible<TypeAt<0>>
+    {
+        construct<0>();
+    }
+
+    /**
+     * @brief Constructs a variant holding value.
+     *
+     * The alternative is the one of type `Decay<T>` if there is one, otherwise the only alternative
+     * constructible from value. The constructor does not take part in overload resolution if no
+     * alternative or more than one qualifies, e.g. a string literal for `VaVariant<bool, VaString>`.
+     */
+    template <typename T, Size I = selectFor<T>, typename = tt::EnableIf<!tt::IsSame<tt::Decay<T>, VaVariant> && (I < count)>>
+    VaVariant(T&& value) noexcept(tt::IsNoexceptConstructible<TypeAt<I>, T>) {
+        construct<I>(std::forward<T>(value));
+    }
+
+    /**
+     * @brief Constructs the alternative T in place from args.
+     */
+    template <typename T, typename... Args>
+    explicit VaVariant(std::in_place_type_t<T>, Args&&... args) {
+        checkAlternative<T>();
+        construct<indexOf<T>>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs the alternative at index I in place from args.
+     */
+    template <Size I, typename... Args>
+    explicit VaVariant(std::in_place_index_t<I>, Args&&... args) {
+        construct<I>(std::forward<Args>(args)...);
+    }
+
+    VaVariant(const VaVariant&) requires trivialCopy = default;
+    VaVariant(const VaVariant& other) requires (copyable && !trivialCopy) { copyFrom(other); }
+
+    VaVariant(VaVariant&&) requires trivialMove = default;
+    VaVariant(VaVariant&& other) noexcept(noexceptMove) requires (movable && !trivialMove) { moveFrom(other); }
+
+    ~VaVariant() requires trivialDestructor = default;
+    ~VaVariant() requires (!trivialDestructor) { destroy(); }
+
+    VaVariant& operator=(const VaVariant&) requires trivialCopyAssign = default;
+
+    /**
+     * @brief Copy-assigns the value of other: assigns if both hold the same alternative, otherwise
+     *        destroys the current value and copy-constructs the other one.
+     */
+    VaVariant& operator=(const VaVariant& other) requires (copyable && !trivialCopyAssign) {
+        static constexpr void (*assign[])(void*, const void*) = {&va::detail::variantCopyAssign<Ts>...};
+        if (this == &other) return *this;
+
+        if (index == other.index && index != valueless) {
+            assign[index](storage, other.storage);
+        } else {
+            destroy();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    VaVariant& operator=(VaVariant&&) requires trivialMoveAssign = default;
+
+    /**
+     * @brief Move-assigns the value of other, like the copy assignment.
+     */
+    VaVariant& operator=(VaVariant&& other) noexcept(noexceptMove) requires (movable && !trivialMoveAssign) {
+        static constexpr void (*assign[])(void*, void*) = {&va::detail::variantMoveAssign<Ts>...};
+        if (this == &other) return *this;
+
+        if (index == other.index && index != valueless) {
+            assign[index](storage, other.storage);
+        } else {
+            destroy();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Assigns value, selecting the alternative like the converting constructor.
+     *        Assigns in place if that alternative is already held.
+     */
+    template <typename T, Size I = selectFor<T>, typename = tt::EnableIf<!tt::IsSame<tt::Decay<T>, VaVariant> && (I < count)>>
+    VaVariant& operator=(T&& value) {
+        if (index == IndexType(I)) {
+            *va::detail::variantPtr<TypeAt<I>>(storage) = std::forward<T>(value);
+        } else {
+            destroy();
+            construct<I>(std::forward<T>(value));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destroys the current value and constructs the alternative T in place from args.
+     * @return A reference to the new value.
+     *
+     * @note If the constructor throws, the variant is left valueless.
+     */
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args) {
+        checkAlternative<T>();
+        destroy();
+        return construct<indexOf<T>>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroys the current value and constructs the alternative at index I in place from args.
+     * @return A reference to the new value.
+     *
+     * @note If the constructor throws, the variant is left valueless.
+     */
+    template <Size I, typename... Args>
+    TypeAt<I>& emplace(Args&&... args) {
+        static_assert(I < count, "VaVariant index out of range");
+        destroy();
+        return construct<I>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether the variant currently holds the alternative T.
+     * @note A single compare of the stored index against a constant.
+     */
+    template <typename T>
+    inline bool holds() const noexcept {
+        checkAlternative<T>();
+        return index == IndexType(indexOf<T>);
+    }
+
+    /// @brief Index of the current alternative, or npos if the variant is valueless.
+    inline Size getIndex() const noexcept { return index == valueless ? npos : Size(index); }
+
+    inline bool isValueless() const noexcept { return index == valueless; }
+
+    /**
+     * @brief Accesses the value as the alternative T.
+     * @throws InvalidVariantCastError If the variant does not hold T.
+     */
+    // @{
+    template <typename T>
+    T& get() & {
+        checkAlternative<T>();
+        return get<indexOf<T>>();
+    }
+    template <typename T>
+    const T& get() const& {
+        checkAlternative<T>();
+        return get<indexOf<T>>();
+    }
+    template <typename T>
+    T&& get() && {
+        checkAlternative<T>();
+        return std::move(*this).template get<indexOf<T>>();
+    }
+    // @}
+
+    /**
+     * @brief Accesses the value as the alternative at index I.
+     * @throws InvalidVariantCastError If the variant does not hold that alternative.
+     */
+    // @{
+    template <Size I>
+    TypeAt<I>& get() & {
+        checkIndex<I>();
+        return *va::detail::variantPtr<TypeAt<I>>(storage);
+    }
+    template <Size I>
+    const TypeAt<I>& get() const& {
+        checkIndex<I>();
+        return *va::detail::variantPtr<TypeAt<I>>(storage);
+    }
+    template <Size I>
+    TypeAt<I>&& get() && {
+        checkIndex<I>();
+        return std::move(*va::detail::variantPtr<TypeAt<I>>(storage));
+    }
+    // @}
+
+    /**
+     * @brief Accesses the value as the alternative T without throwing.
+     * @return A pointer to the value, or nullptr if the variant does not hold T.
+     */
+    // @{
+    template <typename T>
+    T* tryGet() noexcept {
+        return holds<T>() ? va::detail::variantPtr<T>(storage) : nullptr;
+    }
+    template <typename T>
+    const T* tryGet() const noexcept {
+        return holds<T>() ? va::detail::variantPtr<T>(storage) : nullptr;
+    }
+    // @}
+
+    /**
+     * @brief Calls fn with the current value.
+     * @param fn A callable accepting every alternative (a generic lambda, or an overload set), with
+     *        the same return type for all of them.
+     * @return What fn returns.
+     * @throws InvalidVariantCastError If the variant is valueless.
+     *
+     * @note The value is passed as an lvalue, a const lvalue or an rvalue, following the variant.
+     */
+    // @{
+    template <typename F>
+    decltype(auto) visit(F&& fn) & {
+        using R = std::invoke_result_t<F&, TypeAt<0>&>;
+        return dispatch<R, F, Ts&...>(fn, storage);
+    }
+    template <typename F>
+    decltype(auto) visit(F&& fn) const& {
+        using R = std::invoke_result_t<F&, const TypeAt<0>&>;
+        return dispatch<R, F, const Ts&...>(fn, storage);
+    }
+    template <typename F>
+    decltype(auto) visit(F&& fn) && {
+        using R = std::invoke_result_t<F&, TypeAt<0>&&>;
+        return dispatch<R, F, Ts&&...>(fn, storage);
+    }
+    // @}
+
+    /**
+     * @brief Swaps the values of two variants.
+     */
+    void swap(VaVariant& other) noexcept(noexceptMove) {
+        VaVariant temp = std::move(other);
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+  public operators:
+    /**
+     * @brief Two variants are equal if they hold the same alternative with equal values,
+     *        or are both valueless.
+     */
+    friend bool operator==(const VaVariant& a, const VaVariant& b) requires (tt::HasEqualityOperator_v<Ts> && ...) {
+        static constexpr bool (*table[])(const void*, const void*) = {&va::detail::variantEqual<Ts>...};
+        if (a.index != b.index) return false;
+        return a.index == valueless || table[a.index](a.storage, b.storage);
+    }
+
+    friend bool operator!=(const VaVariant& a, const VaVariant& b) requires (tt::HasEqualityOperator_v<Ts> && ...) { return !(a == b); }
+};
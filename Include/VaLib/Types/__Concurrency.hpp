@@ -0,0 +1,109 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#endif
+
+namespace va::detail {
+
+/// @brief Assumed size of a cache line, used to keep independently written atomics apart (avoids false sharing).
+inline constexpr Size cacheLineSize = 64;
+
+/// @brief Hints the CPU that the calling thread is spinning.
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief Exponential backoff for spin loops: spins with pause hints first,
+ *        then yields the time slice once the wait gets long.
+ */
+class Backoff {
+  protected:
+    static constexpr uint32 spinLimit = 6; ///< Spin rounds (2^n pauses each) before yielding
+
+    uint32 step = 0;
+
+  public:
+    void wait() noexcept {
+        if (step <= spinLimit) {
+            for (uint32 i = 0; i < (1u << step); i++) cpuRelax();
+            step++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    inline void reset() noexcept { step = 0; }
+};
+
+/**
+ * @brief Decides how many threads a parallel algorithm should use.
+ * @param requested Requested number of threads; 0 means one per hardware thread.
+ * @param work Number of work items.
+ * @param minPerThread Minimum number of items that makes starting another thread worthwhile.
+ * @return A thread count between 1 and requested (or the hardware concurrency).
+ */
+inline Size resolveThreadCount(Size requested, Size work, Size minPerThread) noexcept {
+    if (requested == 0) requested = std::thread::hardware_concurrency();
+    if (requested == 0) requested = 1;
+
+    Size useful = work / (minPerThread ? minPerThread : 1);
+    if (useful < requested) requested = useful;
+    return requested ? requested : 1;
+}
+
+/**
+ * @brief Number of index bits needed for a shard count, rounded up to a power of two.
+ * @param shardCount Requested number of shards (at least 1).
+ */
+inline constexpr Size shardBits(Size shardCount) noexcept {
+    Size bits = 0;
+    while ((Size(1) << bits) < shardCount) bits++;
+    return bits;
+}
+
+/**
+ * @brief Lowers a number of shard index bits until every shard gets at least one unit of a limit.
+ * @param bits Number of index bits, as returned by shardBits().
+ * @param limit Total limit to split between the shards; 0 means no limit.
+ */
+inline constexpr Size fitShardBits(Size bits, Size limit) noexcept {
+    while (limit && bits > 0 && (Size(1) << bits) > limit) bits--;
+    return bits;
+}
+
+/**
+ * @brief Part of a total limit given to one shard. The remainder of the division goes to the
+ *        first shards, one unit each, so the parts add up to exactly the total.
+ * @param limit Total limit; 0 means no limit, which every shard inherits.
+ * @param shard Index of the shard.
+ * @param count Number of shards (at most limit, see fitShardBits()).
+ */
+inline constexpr Size shardLimit(Size limit, Size shard, Size count) noexcept {
+    return limit / count + (shard < limit % count ? 1 : 0);
+}
+
+/**
+ * @brief Picks one of 2^bits shards for a key hash.
+ *
+ * The shard comes from the top bits of the mixed hash, so that the hash table inside the shard,
+ * which uses the low bits of the same hash, still gets to use all of its buckets.
+ */
+inline constexpr Size shardIndex(Size hash, Size bits) noexcept {
+    if (bits == 0) return 0;
+    return (hash * Size(0x9e3779b97f4a7c15ull)) >> (sizeof(Size) * 8 - bits);
+}
+
+} // namespace va::detail
@@ -4,6 +4,9 @@
 #pragma once
 
 #include <VaLib/Utils/Make.hpp>
+#include <VaLib/Utils/ParallelSort.hpp>
+#include <VaLib/Utils/RadixSort.hpp>
+#include <VaLib/Utils/Select.hpp>
 #include <VaLib/Utils/ToString.hpp>
 #include <VaLib/Utils/format.hpp>
 
@@ -9,11 +9,18 @@
 #endif
 
 #include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Pair.hpp>
+#include <VaLib/Types/Slice.hpp>
 #include <VaLib/Types/String.hpp>
+#include <VaLib/Types/Tuple.hpp>
 
 #include <VaLib/Types/TypeTraits.hpp>
 
+#include <cstring>
 #include <functional>
+#include <type_traits>
 
 TODO(maqi-x, "Implement VaHash without using std::hash");
 template <typename T>
@@ -24,6 +31,118 @@ struct VaHash<VaString> {
     Size operator()(const VaString& str) const { return str.hash(); }
 };
 
+namespace va::detail {
+
+/// @brief Spreads every bit of hash over the whole result (the MurmurHash3 finalizer).
+inline constexpr Size hashMix(Size hash) noexcept {
+    uint64 x = uint64(hash);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return Size(x);
+}
+
+/**
+ * @brief Mixes the hash of the next element into seed.
+ *
+ * The boost::hash_combine step, followed by hashMix(). On its own the boost step is weak for
+ * poorly distributed element hashes, such as the identity std::hash of integers: small tuples
+ * like (1, 2) and (2, 1), or (0, 1) and (1, 0), land next to each other. The final mix makes
+ * every bit of the seed and of the element hash affect every bit of the result.
+ */
+inline constexpr Size hashCombine(Size seed, Size hash) noexcept {
+    return hashMix(seed ^ (hash + Size(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2)));
+}
+
+/**
+ * @brief Hashes length bytes, 8 at a time (MurmurHash64A).
+ */
+inline Size hashBytes(const void* data, Size length) noexcept {
+    constexpr uint64 m = 0xc6a4a7935bd1e995ull;
+    constexpr int r = 47;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    const unsigned char* wordsEnd = bytes + (length & ~Size(7));
+    uint64 h = uint64(length) * m;
+
+    for (; bytes != wordsEnd; bytes += 8) {
+        uint64 k;
+        std::memcpy(&k, bytes, 8);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    switch (length & 7) {
+        case 7: h ^= uint64(bytes[6]) << 48; [[fallthrough]];
+        case 6: h ^= uint64(bytes[5]) << 40; [[fallthrough]];
+        case 5: h ^= uint64(bytes[4]) << 32; [[fallthrough]];
+        case 4: h ^= uint64(bytes[3]) << 24; [[fallthrough]];
+        case 3: h ^= uint64(bytes[2]) << 16; [[fallthrough]];
+        case 2: h ^= uint64(bytes[1]) << 8; [[fallthrough]];
+        case 1: h ^= uint64(bytes[0]); h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return Size(h);
+}
+
+/**
+ * @brief Order-independent hash of a collection, kept up to date as elements come and go.
+ *
+ * The hashes of the elements are mixed and summed. A sum doesn't depend on the order of the
+ * elements and an element can be taken out of it again, so a container can maintain the hash
+ * in O(1) per insertion or removal. Mixing first keeps equal or related element hashes from
+ * cancelling out, as they would with a plain xor.
+ */
+struct HashSum {
+    Size sum = 0;
+
+    constexpr void add(Size hash) noexcept { sum += hashMix(hash); }
+    constexpr void remove(Size hash) noexcept { sum -= hashMix(hash); }
+
+    /// @brief Returns the hash of the count elements summed so far.
+    constexpr Size value(Size count) const noexcept { return hashCombine(count, sum); }
+};
+
+} // namespace va::detail
+
+/**
+ * @brief Hashes a VaTuple by combining the VaHash of each element in order,
+ *        so that tuples can be used as keys of VaDict and VaSet.
+ *
+ * @note A VaPair hashes the same as the VaTuple of its two elements.
+ */
+template <typename... Types>
+struct VaHash<VaTuple<Types...>> {
+    Size operator()(const VaTuple<Types...>& tuple) const {
+        Size seed = sizeof...(Types);
+        tuple.forEach([&seed](const auto& element) {
+            seed = va::detail::hashCombine(seed, VaHash<tt::Decay<decltype(element)>>{}(element));
+        });
+        return seed;
+    }
+};
+
+/**
+ * @brief Hashes a VaPair by combining the VaHash of both elements,
+ *        so that pairs can be used as keys of VaDict and VaSet.
+ */
+template <typename T1, typename T2>
+struct VaHash<VaPair<T1, T2>> {
+    Size operator()(const VaPair<T1, T2>& pair) const {
+        Size seed = va::detail::hashCombine(2, VaHash<tt::Decay<T1>>{}(pair.first));
+        return va::detail::hashCombine(seed, VaHash<tt::Decay<T2>>{}(pair.second));
+    }
+};
+
 #ifdef VaLib_USE_CONCEPTS
 template <typename T>
 concept HasHashMethod = requires(T t) {
@@ -39,8 +158,72 @@ struct VaHash<T> {
 
 #elif __cplusplus >= CPP20
 template <typename T>
-    requires HasHashMethod<T>
+    requires tt::HasHashMethod<T>
 struct VaHash<T> {
     Size operator()(const T& value) { return value.hash(); }
 };
 #endif
+
+namespace va::detail {
+
+/// @brief Whether VaHash<T> can hash a T.
+template <typename T>
+constexpr bool IsHashable = std::is_invocable_r_v<Size, VaHash<T>, const T&>;
+
+/**
+ * @brief Whether a range of T can be hashed as raw bytes.
+ *
+ * That takes two things: equal values must have equal bytes (no padding, no float with two
+ * zeros or many NaNs), and VaHash<T> must not be specialized, as a specialization may define
+ * equality otherwise.
+ */
+template <typename T>
+constexpr bool IsBytewiseHashable = std::has_unique_object_representations_v<T> && std::is_base_of_v<std::hash<T>, VaHash<T>>;
+
+/**
+ * @brief Hashes count contiguous elements in order.
+ *
+ * Ranges of IsBytewiseHashable elements are hashed as raw bytes, 8 at a time; any other
+ * range combines the VaHash of each element. Lists, arrays and slices of equal elements
+ * all hash the same.
+ */
+template <typename T>
+Size hashRange(const T* data, Size count) {
+    if constexpr (IsBytewiseHashable<T>) {
+        return hashBytes(data, count * sizeof(T));
+    } else {
+        Size seed = count;
+        for (Size i = 0; i < count; i++) seed = hashCombine(seed, VaHash<T>{}(data[i]));
+        return seed;
+    }
+}
+
+} // namespace va::detail
+
+/**
+ * @brief Hashes the elements of a VaList in order, so that lists can be used as keys
+ *        of VaDict and VaSet.
+ * @see va::detail::hashRange()
+ */
+template <typename T>
+struct VaHash<VaList<T>> {
+    Size operator()(const VaList<T>& list) const { return va::detail::hashRange(list.dataPtr(), len(list)); }
+};
+
+/**
+ * @brief Hashes the elements of a VaArray in order, the same as a VaList of them.
+ */
+template <typename T, Size N>
+struct VaHash<VaArray<T, N>> {
+    Size operator()(const VaArray<T, N>& array) const { return va::detail::hashRange(array.dataPtr(), N); }
+};
+
+/**
+ * @brief Hashes the elements a VaSlice views in order, the same as a VaList of them.
+ */
+template <typename T>
+struct VaHash<VaSlice<T>> {
+    Size operator()(const VaSlice<T>& slice) const {
+        return va::detail::hashRange(static_cast<const tt::RemoveCV<T>*>(slice.dataPtr()), len(slice));
+    }
+};
@@ -0,0 +1,384 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+#include <VaLib/Utils/Select.hpp>
+#include <VaLib/Utils/__ScratchBuffer.hpp>
+#include <VaLib/Utils/__Workers.hpp>
+
+#include <barrier>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// @file ParallelSort.hpp
+/// @brief Comparison sorts that use several threads: sample sort (va::par::sort) and merge sort (va::par::stableSort).
+
+namespace va {
+namespace detail {
+
+/// @brief Minimum number of elements per thread in the parallel comparison sorts.
+inline constexpr Size sortParallelMinPerThread = Size(1) << 15;
+
+/// @brief Sample sort draws this many samples per bucket to choose the splitters.
+inline constexpr Size sampleSortOversampling = 32;
+
+/// @brief Merge sort starts with runs of this length, sorted by insertion sort.
+inline constexpr Size mergeSortRunLength = 32;
+
+/**
+ * @brief Introsort: quicksort with median-of-3 pivots, heap sort once 2 * log2(n) levels are exceeded,
+ *        insertion sort for short ranges. Not stable, does not allocate.
+ */
+template <typename T, typename Compare>
+void introSort(T* first, T* last, Compare& comp) {
+    Size depth = 0;
+    for (Size n = Size(last - first); n > 1; n >>= 1) depth += 2;
+
+    while (Size(last - first) > selectInsertionThreshold) {
+        if (depth == 0) {
+            heapSortRange(first, last, comp);
+            return;
+        }
+        depth--;
+
+        // Recurse into the smaller side, loop on the larger one: O(log n) stack.
+        T* pivot = partitionMedianOf3(first, last, comp);
+        if (pivot - first < last - pivot) {
+            introSort(first, pivot, comp);
+            first = pivot + 1;
+        } else {
+            introSort(pivot + 1, last, comp);
+            last = pivot;
+        }
+    }
+
+    insertionSort(first, last, comp);
+}
+
+/// @brief Moves value into slot, constructing it if slot is raw memory.
+template <typename T>
+inline void sortPlace(T* slot, T& value, bool construct) noexcept {
+    if (construct && !tt::IsTriviallyCopyable<T>) {
+        new (slot) T(std::move(value));
+    } else {
+        *slot = std::move(value);
+    }
+}
+
+/**
+ * @brief Bucket of the element at index pos of n: the index of the first splitter that compares after it.
+ *
+ * An element equal to one or more splitters may go to any bucket those splitters bound, so it is
+ * spread over them by its position. Heavily repeated keys are picked as several splitters, and
+ * their elements then fill several buckets instead of piling up in one.
+ */
+template <typename T, typename Compare>
+inline Size sampleBucket(const T& value, Size pos, Size n, const T* splitters, Size count, Compare& comp) {
+    Size lo = 0;
+    Size hi = count;
+    while (lo < hi) {
+        Size mid = (lo + hi) / 2;
+        if (comp(value, splitters[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    if (lo == 0 || comp(splitters[lo - 1], value)) return lo;
+
+    // value equals splitters[first, lo): buckets first to lo may all hold it
+    Size first = 0;
+    hi = lo - 1;
+    while (first < hi) {
+        Size mid = (first + hi) / 2;
+        if (comp(splitters[mid], value)) {
+            first = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return first + pos * (lo - first + 1) / n;
+}
+
+/**
+ * @brief Parallel sample sort.
+ *
+ * Splitters are picked from a sorted random sample, so every thread gets a bucket of about
+ * n / threads elements. Each thread classifies its chunk, the counts are turned into bucket
+ * offsets, each thread scatters its chunk into the scratch buffer and finally sorts one bucket
+ * there and moves it back. Elements equal to a splitter are spread over the buckets it bounds
+ * (see sampleBucket()), and a bucket between two equal splitters holds equal elements only, so it
+ * is not sorted at all.
+ */
+template <typename T, typename Compare>
+void sampleSort(T* data, Size n, Compare& comp, Size threads) {
+    static_assert(std::is_copy_constructible_v<T>, "sampleSort() copies its splitters");
+
+    Size buckets = threads;
+    Size sampleCount = buckets * sampleSortOversampling;
+    if (sampleCount > n) sampleCount = n;
+
+    VaList<T> sample;
+    sample.reserve(sampleCount);
+    uint64 state = uint64(n) * 0x9E3779B97F4A7C15ull + 1; // splitmix64
+    for (Size i = 0; i < sampleCount; i++) {
+        uint64 z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        sample.append(data[Size((z ^ (z >> 31)) % n)]);
+    }
+    introSort(sample.dataPtr(), sample.dataPtr() + sampleCount, comp);
+
+    VaList<T> splitters;
+    splitters.reserve(buckets - 1);
+    for (Size b = 1; b < buckets; b++) splitters.append(sample[b * sampleCount / buckets]);
+    const T* split = splitters.dataPtr();
+    Size splitCount = buckets - 1;
+
+    VaList<Size> counters = VaList<Size>::Filled(2 * threads * buckets + buckets + 1, 0);
+    Size* counts = counters.dataPtr();
+    Size* offsets = counts + threads * buckets;
+    Size* starts = offsets + threads * buckets;
+
+    ScratchBuffer<T> buffer(n);
+    bool scattered = false;
+
+    auto completion = [&]() noexcept {
+        if (!scattered) {
+            Size sum = 0;
+            for (Size b = 0; b < buckets; b++) {
+                starts[b] = sum;
+                for (Size t = 0; t < threads; t++) {
+                    offsets[t * buckets + b] = sum;
+                    sum += counts[t * buckets + b];
+                }
+            }
+            starts[buckets] = sum;
+            scattered = true;
+        } else {
+            buffer.live = true;
+        }
+    };
+
+    std::barrier sync(std::ptrdiff_t(threads), completion);
+
+    auto worker = [&](Size t) {
+        Size lo = n * t / threads;
+        Size hi = n * (t + 1) / threads;
+
+        Size* mine = &counts[t * buckets];
+        for (Size i = lo; i < hi; i++) mine[sampleBucket(data[i], i, n, split, splitCount, comp)]++;
+        sync.arrive_and_wait();
+
+        Size* next = &offsets[t * buckets];
+        for (Size i = lo; i < hi; i++) {
+            Size b = sampleBucket(data[i], i, n, split, splitCount, comp);
+            sortPlace(&buffer.ptr[next[b]++], data[i], true);
+        }
+        sync.arrive_and_wait();
+
+        T* first = buffer.ptr + starts[t];
+        T* last = buffer.ptr + starts[t + 1];
+        bool allEqual = t > 0 && t < splitCount && !comp(split[t - 1], split[t]);
+        if (!allEqual) introSort(first, last, comp);
+        for (T* it = first; it < last; it++) data[it - buffer.ptr] = std::move(*it);
+    };
+
+    if (!runWorkers(threads, worker)) introSort(data, data + n, comp);
+}
+
+/**
+ * @brief Number of elements of a that come before the k-th element of the stable merge of a and b.
+ *
+ * Binary search along the merge path; ties are taken from a first, which keeps the merge stable.
+ */
+template <typename T, typename Compare>
+inline Size mergeCoRank(const T* a, Size aLen, const T* b, Size bLen, Size k, Compare& comp) {
+    Size lo = k > bLen ? k - bLen : 0;
+    Size hi = k < aLen ? k : aLen;
+    while (lo < hi) {
+        Size mid = (lo + hi) / 2;
+        if (!comp(b[k - mid - 1], a[mid])) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/// @brief Stable merge of a and b into out.
+template <typename T, typename Compare>
+inline void mergeInto(T* a, T* aEnd, T* b, T* bEnd, T* out, Compare& comp, bool construct) {
+    while (a < aEnd && b < bEnd) {
+        if (comp(*b, *a)) {
+            sortPlace(out++, *b++, construct);
+        } else {
+            sortPlace(out++, *a++, construct);
+        }
+    }
+    while (a < aEnd) sortPlace(out++, *a++, construct);
+    while (b < bEnd) sortPlace(out++, *b++, construct);
+}
+
+/**
+ * @brief Parallel bottom-up merge sort. Stable.
+ *
+ * Runs of mergeSortRunLength elements are insertion-sorted, then merged pairwise between the
+ * input and one scratch buffer, doubling the run length each round. In every round each thread
+ * produces one contiguous n / threads slice of the output; when a slice cuts through a merge,
+ * its bounds are found by co-ranking, so late rounds with only a few long merges stay balanced.
+ */
+template <typename T, typename Compare>
+void mergeSort(T* data, Size n, Compare& comp, Size threads) {
+    if (n <= mergeSortRunLength) {
+        insertionSort(data, data + n, comp);
+        return;
+    }
+
+    ScratchBuffer<T> buffer(n);
+    T* src = data;
+    T* dst = buffer.ptr;
+    Size width = mergeSortRunLength;
+
+    // splits[t]: how many elements of the first run precede output position n * t / threads
+    // within its merge. All are computed before anything is moved out of src.
+    VaList<Size> splitList = VaList<Size>::Filled(threads, 0);
+    Size* splits = splitList.dataPtr();
+
+    // The phase that ends at the next barrier.
+    enum class Stage { Runs, Split, Merged } stage = Stage::Runs;
+
+    auto completion = [&]() noexcept {
+        switch (stage) {
+        case Stage::Runs:
+            stage = Stage::Split;
+            break;
+        case Stage::Split:
+            stage = Stage::Merged;
+            break;
+        case Stage::Merged:
+            if (dst == buffer.ptr) buffer.live = true;
+            std::swap(src, dst);
+            width *= 2;
+            stage = Stage::Split;
+            break;
+        }
+    };
+    std::barrier sync(std::ptrdiff_t(threads), completion);
+
+    auto worker = [&](Size t) {
+        Size runs = (n + mergeSortRunLength - 1) / mergeSortRunLength;
+        for (Size r = runs * t / threads; r < runs * (t + 1) / threads; r++) {
+            Size lo = r * mergeSortRunLength;
+            Size hi = lo + mergeSortRunLength < n ? lo + mergeSortRunLength : n;
+            insertionSort(data + lo, data + hi, comp);
+        }
+        sync.arrive_and_wait();
+
+        Size outLo = n * t / threads;
+        Size outHi = n * (t + 1) / threads;
+
+        while (width < n) {
+            Size first = outLo - outLo % (2 * width);
+            Size firstMid = first + width < n ? first + width : n;
+            Size firstEnd = firstMid + width < n ? firstMid + width : n;
+            splits[t] = mergeCoRank(src + first, firstMid - first, src + firstMid, firstEnd - firstMid, outLo - first, comp);
+            sync.arrive_and_wait();
+
+            bool construct = dst == buffer.ptr && !buffer.live;
+            for (Size start = first; start < outHi; start += 2 * width) {
+                Size mid = start + width < n ? start + width : n;
+                Size end = mid + width < n ? mid + width : n;
+
+                Size k0 = outLo > start ? outLo - start : 0;
+                Size k1 = outHi < end ? outHi - start : end - start;
+                Size i0 = outLo > start ? splits[t] : 0;
+                Size i1 = outHi < end ? splits[t + 1] : mid - start;
+
+                mergeInto(src + start + i0, src + start + i1, src + mid + (k0 - i0), src + mid + (k1 - i1),
+                          dst + start + k0, comp, construct);
+            }
+            sync.arrive_and_wait();
+        }
+
+        if (src != data) {
+            for (Size i = outLo; i < outHi; i++) data[i] = std::move(src[i]);
+        }
+    };
+
+    if (!runWorkers(threads, worker)) mergeSort(data, n, comp, 1);
+}
+
+template <typename T>
+inline void requireParallelSortable() {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                  "parallel sorts require nothrow move operations");
+}
+
+} // namespace detail
+
+namespace par {
+
+/**
+ * @brief Sorts a slice using several threads (parallel sample sort). Not stable.
+ * @param slice The elements to sort (in place).
+ * @param comp Strict weak ordering. Called concurrently from several threads; must not throw.
+ * @param threads Number of threads; 0 uses one per hardware thread. Small inputs use fewer.
+ *
+ * @note Allocates one scratch buffer of n elements (plus a small sample). Element types that
+ *       cannot be copied (the splitters are copies) are sorted with va::par::stableSort() instead.
+ */
+template <typename T, typename Compare = std::less<T>>
+void sort(VaSlice<T> slice, Compare comp = Compare(), Size threads = 0) {
+    detail::requireParallelSortable<T>();
+
+    Size n = len(slice);
+    threads = detail::resolveThreadCount(threads, n, detail::sortParallelMinPerThread);
+
+    if (threads <= 1) {
+        detail::introSort(slice.begin(), slice.begin() + n, comp);
+    } else if constexpr (std::is_copy_constructible_v<T>) {
+        detail::sampleSort(slice.begin(), n, comp, threads);
+    } else {
+        detail::mergeSort(slice.begin(), n, comp, threads);
+    }
+}
+
+template <typename T, typename Compare = std::less<T>>
+void sort(VaList<T>& list, Compare comp = Compare(), Size threads = 0) {
+    par::sort(VaSlice<T>(list), std::move(comp), threads);
+}
+
+/**
+ * @brief Sorts a slice using several threads, keeping equal elements in their original order (parallel merge sort).
+ * @param slice The elements to sort (in place).
+ * @param comp Strict weak ordering. Called concurrently from several threads; must not throw.
+ * @param threads Number of threads; 0 uses one per hardware thread. Small inputs use fewer.
+ *
+ * @note Allocates one scratch buffer of n elements.
+ */
+template <typename T, typename Compare = std::less<T>>
+void stableSort(VaSlice<T> slice, Compare comp = Compare(), Size threads = 0) {
+    detail::requireParallelSortable<T>();
+
+    Size n = len(slice);
+    threads = detail::resolveThreadCount(threads, n, detail::sortParallelMinPerThread);
+    detail::mergeSort(slice.begin(), n, comp, threads);
+}
+
+template <typename T, typename Compare = std::less<T>>
+void stableSort(VaList<T>& list, Compare comp = Compare(), Size threads = 0) {
+    par::stableSort(VaSlice<T>(list), std::move(comp), threads);
+}
+
+} // namespace par
+} // namespace va
@@ -0,0 +1,482 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/ImmutableString.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+#include <VaLib/Types/__Concurrency.hpp>
+#include <VaLib/Utils/Select.hpp>
+#include <VaLib/Utils/__ScratchBuffer.hpp>
+#include <VaLib/Utils/__Workers.hpp>
+
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// @file RadixSort.hpp
+/// @brief Radix sorts: LSD for integer and floating-point keys, MSD for strings, plus parallel variants.
+
+namespace va {
+namespace detail {
+
+/// @brief Below this many elements the sorts fall back to insertion sort.
+inline constexpr Size radixSmallThreshold = 64;
+
+/// @brief Minimum number of elements per thread in the parallel sorts.
+inline constexpr Size radixParallelMinPerThread = Size(1) << 16;
+
+template <Size Bytes>
+struct RadixUnsigned;
+
+template <> struct RadixUnsigned<1> { using Type = uint8; };
+template <> struct RadixUnsigned<2> { using Type = uint16; };
+template <> struct RadixUnsigned<4> { using Type = uint32; };
+template <> struct RadixUnsigned<8> { using Type = uint64; };
+
+/**
+ * @brief Maps a key to an unsigned integer with the same order.
+ *
+ * Signed integers get their sign bit flipped. Floating-point numbers get the sign bit set if
+ * positive and all bits inverted if negative, so -inf < negative < -0.0 < +0.0 < positive < +inf.
+ * NaNs end up below -inf (negative NaNs) or above +inf (positive NaNs).
+ */
+template <typename K>
+inline auto radixBits(K key) noexcept {
+    static_assert(std::is_arithmetic_v<K>, "radixSort keys must be integers or floating-point numbers");
+    static_assert(sizeof(K) <= 8, "radixSort keys must be at most 64 bits wide");
+
+    using U = typename RadixUnsigned<sizeof(K)>::Type;
+    constexpr U sign = U(U(1) << (sizeof(U) * 8 - 1));
+
+    if constexpr (std::is_floating_point_v<K>) {
+        U bits = std::bit_cast<U>(key);
+        return (bits & sign) ? U(~bits) : U(bits | sign);
+    } else if constexpr (std::is_signed_v<K>) {
+        return U(U(key) ^ sign);
+    } else {
+        return U(key);
+    }
+}
+
+/// @brief Key extractor used when the elements are the keys.
+struct RadixIdentity {
+    template <typename T>
+    inline const T& operator()(const T& value) const noexcept { return value; }
+};
+
+template <typename T, typename KeyFn>
+using RadixBitsOf = decltype(radixBits(std::declval<KeyFn&>()(std::declval<const T&>())));
+
+template <typename Bits>
+inline Size radixDigit(Bits bits, Size shift) noexcept {
+    return Size(bits >> shift) & 0xFF;
+}
+
+/// @brief A digit is constant if every key falls into the same bucket; its pass can be skipped.
+inline bool isConstantDigit(const Size* counts, Size n) noexcept {
+    for (Size b = 0; b < 256; b++) {
+        if (counts[b] != 0) return counts[b] == n;
+    }
+    return true;
+}
+
+template <typename T, typename KeyFn>
+void radixInsertionSort(T* data, Size n, KeyFn& keyOf) {
+    auto less = [&keyOf](const T& lhs, const T& rhs) { return radixBits(keyOf(lhs)) < radixBits(keyOf(rhs)); };
+    insertionSort(data, data + n, less);
+}
+
+/**
+ * @brief Moves every element of src[lo, hi) to dst[offsets[digit]++].
+ * @param construct Whether the destination slots are raw memory that has to be constructed.
+ */
+template <typename T, typename KeyFn>
+inline void radixScatter(T* src, T* dst, Size lo, Size hi, Size shift, Size* offsets, KeyFn& keyOf, bool construct) {
+    if (construct && !tt::IsTriviallyCopyable<T>) {
+        for (Size i = lo; i < hi; i++) {
+            Size digit = radixDigit(radixBits(keyOf(src[i])), shift);
+            new (&dst[offsets[digit]++]) T(std::move(src[i]));
+        }
+    } else {
+        for (Size i = lo; i < hi; i++) {
+            Size digit = radixDigit(radixBits(keyOf(src[i])), shift);
+            dst[offsets[digit]++] = std::move(src[i]);
+        }
+    }
+}
+
+/**
+ * @brief Stable LSD radix sort with 8-bit digits.
+ *
+ * All digit histograms are built in a single pass; passes over digits that are equal for all
+ * keys are skipped, so e.g. small values in a 64-bit type cost only as many passes as they have
+ * significant bytes.
+ */
+template <typename T, typename KeyFn>
+void lsdRadixSort(T* data, Size n, KeyFn& keyOf) {
+    using Bits = RadixBitsOf<T, KeyFn>;
+    constexpr Size digits = sizeof(Bits);
+
+    if (n < radixSmallThreshold) {
+        radixInsertionSort(data, n, keyOf);
+        return;
+    }
+
+    Size counts[digits][256] = {};
+    for (Size i = 0; i < n; i++) {
+        Bits bits = radixBits(keyOf(data[i]));
+        for (Size d = 0; d < digits; d++) counts[d][radixDigit(bits, d * 8)]++;
+    }
+
+    Size passes[digits];
+    Size passCount = 0;
+    for (Size d = 0; d < digits; d++) {
+        if (!isConstantDigit(counts[d], n)) passes[passCount++] = d;
+    }
+    if (passCount == 0) return;
+
+    ScratchBuffer<T> buffer(n);
+    T* src = data;
+    T* dst = buffer.ptr;
+
+    for (Size p = 0; p < passCount; p++) {
+        Size offsets[256];
+        Size sum = 0;
+        for (Size b = 0; b < 256; b++) {
+            offsets[b] = sum;
+            sum += counts[passes[p]][b];
+        }
+
+        radixScatter(src, dst, 0, n, passes[p] * 8, offsets, keyOf, dst == buffer.ptr && !buffer.live);
+        if (dst == buffer.ptr) buffer.live = true;
+        std::swap(src, dst);
+    }
+
+    if (src != data) {
+        for (Size i = 0; i < n; i++) data[i] = std::move(src[i]);
+    }
+}
+
+/**
+ * @brief Parallel stable LSD radix sort.
+ *
+ * The input is split into one chunk per thread. For every non-constant digit each thread builds
+ * the histogram of its chunk, the histograms are combined into per-thread bucket offsets (chunk
+ * order within each bucket keeps the sort stable), and each thread scatters its chunk.
+ */
+template <typename T, typename KeyFn>
+void parallelLsdRadixSort(T* data, Size n, KeyFn& keyOf, Size threads) {
+    threads = resolveThreadCount(threads, n, radixParallelMinPerThread);
+    if (threads <= 1) {
+        lsdRadixSort(data, n, keyOf);
+        return;
+    }
+
+    using Bits = RadixBitsOf<T, KeyFn>;
+    constexpr Size digits = sizeof(Bits);
+
+    VaList<Size> counters = VaList<Size>::Filled(threads * (digits + 2) * 256, 0);
+    Size* digitCounts = counters.dataPtr();
+    Size* histograms = digitCounts + threads * digits * 256;
+    Size* offsets = histograms + threads * 256;
+    ScratchBuffer<T> buffer(n);
+
+    Size passes[digits];
+    Size passCount = 0;
+    Size passIndex = 0;
+    T* src = data;
+    T* dst = buffer.ptr;
+
+    enum class Stage { Counted, Histogram, Scattered } stage = Stage::Counted;
+
+    auto completion = [&]() noexcept {
+        switch (stage) {
+        case Stage::Counted:
+            for (Size d = 0; d < digits; d++) {
+                Size total[256] = {};
+                for (Size t = 0; t < threads; t++) {
+                    for (Size b = 0; b < 256; b++) total[b] += digitCounts[(t * digits + d) * 256 + b];
+                }
+                if (!isConstantDigit(total, n)) passes[passCount++] = d;
+            }
+            stage = Stage::Histogram;
+            break;
+
+        case Stage::Histogram: {
+            Size sum = 0;
+            for (Size b = 0; b < 256; b++) {
+                for (Size t = 0; t < threads; t++) {
+                    offsets[t * 256 + b] = sum;
+                    sum += histograms[t * 256 + b];
+                }
+            }
+            stage = Stage::Scattered;
+            break;
+        }
+
+        case Stage::Scattered:
+            if (dst == buffer.ptr) buffer.live = true;
+            std::swap(src, dst);
+            passIndex++;
+            stage = Stage::Histogram;
+            break;
+        }
+    };
+
+    std::barrier sync(std::ptrdiff_t(threads), completion);
+
+    auto worker = [&](Size t) {
+        Size lo = n * t / threads;
+        Size hi = n * (t + 1) / threads;
+
+        Size* mine = &digitCounts[t * digits * 256];
+        for (Size i = lo; i < hi; i++) {
+            Bits bits = radixBits(keyOf(data[i]));
+            for (Size d = 0; d < digits; d++) mine[d * 256 + radixDigit(bits, d * 8)]++;
+        }
+        sync.arrive_and_wait();
+
+        while (passIndex < passCount) {
+            Size shift = passes[passIndex] * 8;
+
+            Size* hist = &histograms[t * 256];
+            for (Size b = 0; b < 256; b++) hist[b] = 0;
+            for (Size i = lo; i < hi; i++) hist[radixDigit(radixBits(keyOf(src[i])), shift)]++;
+            sync.arrive_and_wait();
+
+            radixScatter(src, dst, lo, hi, shift, &offsets[t * 256], keyOf, dst == buffer.ptr && !buffer.live);
+            sync.arrive_and_wait();
+        }
+
+        if (src != data) {
+            for (Size i = lo; i < hi; i++) data[i] = std::move(src[i]);
+        }
+    };
+
+    if (!runWorkers(threads, worker)) lsdRadixSort(data, n, keyOf);
+}
+
+/// @brief Bucket of a string at the given depth: 0 if the string ends there, else byte + 1.
+template <typename S>
+inline Size radixCharAt(const S& str, Size depth) noexcept {
+    return depth < len(str) ? Size(static_cast<unsigned char>(str.begin()[depth])) + 1 : 0;
+}
+
+/// @brief Byte-wise (unsigned) comparison of two strings, ignoring their first depth bytes.
+template <typename S>
+inline bool radixStringLess(const S& lhs, const S& rhs, Size depth) noexcept {
+    Size lhsLen = len(lhs);
+    Size rhsLen = len(rhs);
+    Size common = lhsLen < rhsLen ? lhsLen : rhsLen;
+
+    if (common > depth) {
+        int cmp = std::memcmp(lhs.begin() + depth, rhs.begin() + depth, common - depth);
+        if (cmp != 0) return cmp < 0;
+    }
+    return lhsLen < rhsLen;
+}
+
+/**
+ * @brief Splits data[0, n) into 257 buckets by the byte at depth (American flag sort: in place, by swaps).
+ * @param starts Receives the first index of every bucket.
+ * @param counts Receives the size of every bucket.
+ * @return false if all strings fall into one bucket (nothing was moved).
+ */
+template <typename S>
+bool msdPartition(S* data, Size n, Size depth, Size* starts, Size* counts) {
+    for (Size b = 0; b < 257; b++) counts[b] = 0;
+    for (Size i = 0; i < n; i++) counts[radixCharAt(data[i], depth)]++;
+
+    for (Size b = 0; b < 257; b++) {
+        if (counts[b] == n) return false;
+    }
+
+    Size next[257];
+    Size sum = 0;
+    for (Size b = 0; b < 257; b++) {
+        starts[b] = next[b] = sum;
+        sum += counts[b];
+    }
+
+    for (Size b = 0; b < 257; b++) {
+        Size end = starts[b] + counts[b];
+        while (next[b] < end) {
+            Size c = radixCharAt(data[next[b]], depth);
+            if (c == b) {
+                next[b]++;
+            } else {
+                std::swap(data[next[b]], data[next[c]++]);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief MSD radix sort for strings (byte-wise, unsigned).
+ *
+ * Bytes shared by all strings of a bucket are skipped without moving anything. Only the
+ * smaller buckets are sorted recursively and the largest one iteratively, so the recursion
+ * depth stays below log2(n) even for strings with long common prefixes.
+ */
+template <typename S>
+void msdRadixSort(S* data, Size n, Size depth) {
+    Size starts[257];
+    Size counts[257];
+
+    while (n >= radixSmallThreshold) {
+        if (!msdPartition(data, n, depth, starts, counts)) {
+            if (radixCharAt(data[0], depth) == 0) return; // every string ends here, so all are equal
+            depth++;
+            continue;
+        }
+
+        // Bucket 0 holds strings that end at depth; they are all equal.
+        Size largest = 1;
+        for (Size b = 2; b < 257; b++) {
+            if (counts[b] > counts[largest]) largest = b;
+        }
+
+        for (Size b = 1; b < 257; b++) {
+            if (b != largest && counts[b] > 1) msdRadixSort(data + starts[b], counts[b], depth + 1);
+        }
+
+        data += starts[largest];
+        n = counts[largest];
+        depth++;
+    }
+
+    auto less = [depth](const S& lhs, const S& rhs) { return radixStringLess(lhs, rhs, depth); };
+    insertionSort(data, data + n, less);
+}
+
+/**
+ * @brief Parallel MSD radix sort: partitions by the first distinguishing byte, then sorts the buckets on a thread pool.
+ */
+template <typename S>
+void parallelMsdRadixSort(S* data, Size n, Size threads) {
+    threads = resolveThreadCount(threads, n, radixParallelMinPerThread);
+
+    Size starts[257];
+    Size counts[257];
+    Size depth = 0;
+
+    for (;;) {
+        if (threads <= 1) {
+            msdRadixSort(data, n, depth);
+            return;
+        }
+        if (msdPartition(data, n, depth, starts, counts)) break;
+        if (radixCharAt(data[0], depth) == 0) return;
+        depth++;
+    }
+
+    std::atomic<Size> nextBucket(1);
+    auto worker = [&](Size) {
+        for (Size b; (b = nextBucket.fetch_add(1, std::memory_order_relaxed)) < 257;) {
+            if (counts[b] > 1) msdRadixSort(data + starts[b], counts[b], depth + 1);
+        }
+    };
+
+    if (!runWorkers(threads, worker)) worker(Size(0));
+}
+
+template <typename T>
+inline constexpr bool IsRadixString = tt::IsSame<T, VaString> || tt::IsSame<T, VaImmutableString>;
+
+} // namespace detail
+
+/**
+ * @brief Sorts a slice with radix sort.
+ * @param slice The elements to sort (in place, ascending).
+ *
+ * Integers and floating-point numbers use a stable LSD radix sort with an O(n) scratch buffer;
+ * see detail::radixBits for the order of negative numbers, -0.0 and NaN.
+ * VaString and VaImmutableString use an in-place MSD radix sort that orders strings byte-wise as
+ * unsigned chars, like memcmp. For ASCII this is the order of operator<; for bytes >= 0x80 it
+ * differs, because operator< compares (signed) chars.
+ */
+template <typename T>
+void radixSort(VaSlice<T> slice) {
+    if constexpr (detail::IsRadixString<T>) {
+        detail::msdRadixSort(slice.begin(), len(slice), 0);
+    } else {
+        detail::RadixIdentity identity;
+        detail::lsdRadixSort(slice.begin(), len(slice), identity);
+    }
+}
+
+template <typename T>
+void radixSort(VaList<T>& list) {
+    radixSort(VaSlice<T>(list));
+}
+
+/**
+ * @brief Sorts records by an integer or floating-point key with a stable LSD radix sort.
+ * @param slice The records to sort (in place, ascending by key).
+ * @param keyOf Called as keyOf(const T&); returns the key. Called several times per element, so it should be cheap.
+ *
+ * @note T must be nothrow move constructible and assignable, and keyOf must not throw.
+ */
+template <typename T, typename KeyFn, typename = tt::EnableIf<std::is_invocable_v<KeyFn&, const T&>>>
+void radixSort(VaSlice<T> slice, KeyFn keyOf) {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                  "radixSort requires nothrow move operations");
+    detail::lsdRadixSort(slice.begin(), len(slice), keyOf);
+}
+
+template <typename T, typename KeyFn, typename = tt::EnableIf<std::is_invocable_v<KeyFn&, const T&>>>
+void radixSort(VaList<T>& list, KeyFn keyOf) {
+    radixSort(VaSlice<T>(list), std::move(keyOf));
+}
+
+namespace par {
+
+/**
+ * @brief Parallel radix sort; same results as va::radixSort().
+ * @param slice The elements to sort (in place, ascending).
+ * @param threads Number of threads; 0 uses one per hardware thread. Small inputs use fewer.
+ */
+template <typename T>
+void radixSort(VaSlice<T> slice, Size threads = 0) {
+    if constexpr (detail::IsRadixString<T>) {
+        detail::parallelMsdRadixSort(slice.begin(), len(slice), threads);
+    } else {
+        detail::RadixIdentity identity;
+        detail::parallelLsdRadixSort(slice.begin(), len(slice), identity, threads);
+    }
+}
+
+template <typename T>
+void radixSort(VaList<T>& list, Size threads = 0) {
+    radixSort(VaSlice<T>(list), threads);
+}
+
+/**
+ * @brief Parallel radix sort of records by key; same results as va::radixSort(slice, keyOf).
+ *
+ * @note keyOf is called concurrently from several threads.
+ */
+template <typename T, typename KeyFn, typename = tt::EnableIf<std::is_invocable_v<KeyFn&, const T&>>>
+void radixSort(VaSlice<T> slice, KeyFn keyOf, Size threads = 0) {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                  "radixSort requires nothrow move operations");
+    detail::parallelLsdRadixSort(slice.begin(), len(slice), keyOf, threads);
+}
+
+template <typename T, typename KeyFn, typename = tt::EnableIf<std::is_invocable_v<KeyFn&, const T&>>>
+void radixSort(VaList<T>& list, KeyFn keyOf, Size threads = 0) {
+    radixSort(VaSlice<T>(list), std::move(keyOf), threads);
+}
+
+} // namespace par
+} // namespace va
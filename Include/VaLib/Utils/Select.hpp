@@ -0,0 +1,320 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/Heap.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+
+#include <functional>
+#include <utility>
+
+/// @file Select.hpp
+/// @brief In-place selection and partial sorting: nthElement, partialSort, quantile(s).
+///        All of them run in expected O(n) (plus O(k log k) for partialSort) and never allocate.
+
+namespace va {
+namespace detail {
+
+/// @brief Ranges at most this long are finished with insertion sort.
+inline constexpr Size selectInsertionThreshold = 16;
+
+/// @brief Reverses a comparator, turning the min-heaps of Heap.hpp into max-heaps.
+template <typename Compare>
+struct ReverseCompare {
+    Compare& comp;
+
+    template <typename T>
+    inline bool operator()(const T& lhs, const T& rhs) const { return comp(rhs, lhs); }
+};
+
+template <typename T, typename Compare>
+void insertionSort(T* first, T* last, Compare& comp) {
+    for (T* it = first + 1; it < last; it++) {
+        T value = std::move(*it);
+        T* hole = it;
+        for (; hole > first && comp(value, *(hole - 1)); hole--) *hole = std::move(*(hole - 1));
+        *hole = std::move(value);
+    }
+}
+
+/**
+ * @brief Partitions [first, last) around the median of its first, middle and last element.
+ * @return Position of the pivot: everything before it does not compare after it, everything behind it does not compare before it.
+ *
+ * @note Requires at least 3 elements. Stops on elements equal to the pivot from both sides,
+ *       so ranges with many duplicates still split in the middle.
+ */
+template <typename T, typename Compare>
+T* partitionMedianOf3(T* first, T* last, Compare& comp) {
+    T* mid = first + (last - first) / 2;
+    T* back = last - 1;
+
+    if (comp(*mid, *first)) std::swap(*mid, *first);
+    if (comp(*back, *mid)) {
+        std::swap(*back, *mid);
+        if (comp(*mid, *first)) std::swap(*mid, *first);
+    }
+
+    // Pivot goes to the front; *back does not compare before it and stops the left scan.
+    std::swap(*first, *mid);
+    const T& pivot = *first;
+
+    T* lo = first + 1;
+    T* hi = back;
+    for (;;) {
+        while (comp(*lo, pivot)) lo++;
+        while (comp(pivot, *hi)) hi--;
+        if (lo >= hi) break;
+
+        std::swap(*lo, *hi);
+        lo++;
+        hi--;
+    }
+
+    std::swap(*first, *hi);
+    return hi;
+}
+
+/**
+ * @brief Heap-based selection, used when introselect runs out of depth. O(n log k).
+ */
+template <typename T, typename Compare>
+void heapSelect(T* first, T* nth, T* last, Compare& comp) {
+    ReverseCompare<Compare> rev{comp};
+    Size k = Size(nth - first) + 1;
+
+    heapify<2>(first, k, rev);
+    for (T* it = nth + 1; it < last; it++) {
+        if (comp(*it, *first)) {
+            std::swap(*it, *first);
+            heapSiftDown<2>(first, k, 0, rev);
+        }
+    }
+
+    std::swap(*first, *nth);
+}
+
+/**
+ * @brief Introselect: quickselect with median-of-3 pivots that falls back to heap selection
+ *        after 2 * log2(n) unproductive rounds, so the worst case stays O(n log n).
+ */
+template <typename T, typename Compare>
+void introSelect(T* first, T* nth, T* last, Compare& comp) {
+    Size depth = 0;
+    for (Size n = Size(last - first); n > 1; n >>= 1) depth += 2;
+
+    while (Size(last - first) > selectInsertionThreshold) {
+        if (depth == 0) {
+            heapSelect(first, nth, last, comp);
+            return;
+        }
+        depth--;
+
+        T* pivot = partitionMedianOf3(first, last, comp);
+        if (pivot == nth) return;
+
+        if (nth < pivot) {
+            last = pivot;
+        } else {
+            first = pivot + 1;
+        }
+    }
+
+    insertionSort(first, last, comp);
+}
+
+/**
+ * @brief Sorts [first, last) with heap sort. O(n log n), in place.
+ */
+template <typename T, typename Compare>
+void heapSortRange(T* first, T* last, Compare& comp) {
+    if (Size(last - first) <= selectInsertionThreshold) {
+        insertionSort(first, last, comp);
+        return;
+    }
+
+    ReverseCompare<Compare> rev{comp};
+    Size n = Size(last - first);
+    heapify<2>(first, n, rev);
+    heapSort<2>(first, n, rev);
+}
+
+template <typename T, typename Compare>
+void nthElement(T* data, Size n, Size nth, Compare& comp) {
+    if (nth >= n) throw IndexOutOfRangeError(n, nth);
+    introSelect(data, data + nth, data + n, comp);
+}
+
+template <typename T, typename Compare>
+void partialSort(T* data, Size n, Size k, Compare& comp) {
+    if (k > n) k = n;
+    if (k == 0) return;
+
+    if (k < n) introSelect(data, data + k - 1, data + n, comp);
+    heapSortRange(data, data + k, comp);
+}
+
+/**
+ * @brief Maps a quantile in [0, 1] to the index of the nearest rank.
+ */
+inline Size quantileIndex(double q, Size n) {
+    if (!(q >= 0.0 && q <= 1.0)) throw ValueError(VaStaticMessage("quantile must be in [0, 1]"));
+    return Size(q * double(n - 1) + 0.5);
+}
+
+template <typename T, typename Compare>
+const T& quantile(T* data, Size n, double q, Compare& comp) {
+    if (n == 0) throw ValueError(VaStaticMessage("quantile() of an empty range"));
+    Size index = quantileIndex(q, n);
+    introSelect(data, data + index, data + n, comp);
+    return data[index];
+}
+
+template <typename T, Size M, typename Compare>
+VaArray<T, M> quantiles(T* data, Size n, const double (&qs)[M], Compare& comp) {
+    if (n == 0) throw ValueError(VaStaticMessage("quantiles() of an empty range"));
+
+    Size indices[M];
+    Size order[M];
+    for (Size i = 0; i < M; i++) {
+        indices[i] = quantileIndex(qs[i], n);
+        order[i] = i;
+    }
+
+    // Select in increasing index order, each time only in the part behind the previous pick.
+    for (Size i = 1; i < M; i++) {
+        Size key = order[i];
+        Size j = i;
+        for (; j > 0 && indices[order[j - 1]] > indices[key]; j--) order[j] = order[j - 1];
+        order[j] = key;
+    }
+
+    VaArray<T, M> result = {};
+    Size start = 0;
+    for (Size i = 0; i < M; i++) {
+        Size index = indices[order[i]];
+        if (index >= start) {
+            introSelect(data + start, data + index, data + n, comp);
+            start = index + 1;
+        }
+        result[order[i]] = data[index];
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Rearranges a slice so that slice[nth] is the element that would be there after sorting,
+ *        nothing before it compares after it and nothing behind it compares before it.
+ * @param slice The elements to rearrange (in place).
+ * @param nth Index of the element to place.
+ * @param comp Strict weak ordering.
+ *
+ * @throws IndexOutOfRangeError If nth is out of range.
+ * @note Expected O(n), worst case O(n log n) (introselect). Does not allocate.
+ */
+template <typename T, typename Compare = std::less<T>>
+void nthElement(VaSlice<T> slice, Size nth, Compare comp = Compare()) {
+    detail::nthElement(slice.begin(), len(slice), nth, comp);
+}
+
+template <typename T, typename Compare = std::less<T>>
+void nthElement(VaList<T>& list, Size nth, Compare comp = Compare()) {
+    detail::nthElement(list.dataPtr(), len(list), nth, comp);
+}
+
+template <typename T, Size N, typename Compare = std::less<T>>
+void nthElement(VaArray<T, N>& array, Size nth, Compare comp = Compare()) {
+    detail::nthElement(array.dataPtr(), N, nth, comp);
+}
+
+/**
+ * @brief Sorts the k smallest elements of a slice into its front; the order of the rest is unspecified.
+ * @param slice The elements to rearrange (in place).
+ * @param k Number of elements to sort; clamped to the length.
+ * @param comp Strict weak ordering. Pass std::greater<T>() to get the k greatest, greatest first.
+ *
+ * @note Expected O(n + k log k): selects the first k with introselect, then heap-sorts only them. Does not allocate.
+ * @see va::topK() in Heap.hpp for a variant that leaves the input untouched.
+ */
+template <typename T, typename Compare = std::less<T>>
+void partialSort(VaSlice<T> slice, Size k, Compare comp = Compare()) {
+    detail::partialSort(slice.begin(), len(slice), k, comp);
+}
+
+template <typename T, typename Compare = std::less<T>>
+void partialSort(VaList<T>& list, Size k, Compare comp = Compare()) {
+    detail::partialSort(list.dataPtr(), len(list), k, comp);
+}
+
+template <typename T, Size N, typename Compare = std::less<T>>
+void partialSort(VaArray<T, N>& array, Size k, Compare comp = Compare()) {
+    detail::partialSort(array.dataPtr(), N, k, comp);
+}
+
+/**
+ * @brief Returns the q-quantile of a slice (nearest rank: the element at index round(q * (n - 1)) after sorting).
+ * @param slice The elements; partially reordered in place.
+ * @param q Quantile in [0, 1]; 0.5 is the median.
+ * @param comp Strict weak ordering.
+ * @return Reference to the quantile, which is placed at its sorted position in the slice.
+ *
+ * @throws ValueError If the slice is empty or q is outside [0, 1].
+ */
+template <typename T, typename Compare = std::less<T>>
+const T& quantile(VaSlice<T> slice, double q, Compare comp = Compare()) {
+    return detail::quantile(slice.begin(), len(slice), q, comp);
+}
+
+template <typename T, typename Compare = std::less<T>>
+const T& quantile(VaList<T>& list, double q, Compare comp = Compare()) {
+    return detail::quantile(list.dataPtr(), len(list), q, comp);
+}
+
+template <typename T, Size N, typename Compare = std::less<T>>
+const T& quantile(VaArray<T, N>& array, double q, Compare comp = Compare()) {
+    return detail::quantile(array.dataPtr(), N, q, comp);
+}
+
+/**
+ * @brief Returns several quantiles at once, e.g. va::quantiles(slice, {0.5, 0.9, 0.99}).
+ * @param slice The elements; partially reordered in place.
+ * @param qs Quantiles in [0, 1], in any order.
+ * @param comp Strict weak ordering.
+ * @return The quantiles, in the order of qs.
+ *
+ * @throws ValueError If the slice is empty or a quantile is outside [0, 1].
+ * @note Each selection only scans the part behind the previous one, so asking for M quantiles
+ *       costs far less than M separate calls. Does not allocate.
+ */
+template <typename T, Size M, typename Compare = std::less<T>>
+VaArray<T, M> quantiles(VaSlice<T> slice, const double (&qs)[M], Compare comp = Compare()) {
+    return detail::quantiles(slice.begin(), len(slice), qs, comp);
+}
+
+template <typename T, Size M, typename Compare = std::less<T>>
+VaArray<T, M> quantiles(VaList<T>& list, const double (&qs)[M], Compare comp = Compare()) {
+    return detail::quantiles(list.dataPtr(), len(list), qs, comp);
+}
+
+template <typename T, Size N, Size M, typename Compare = std::less<T>>
+VaArray<T, M> quantiles(VaArray<T, N>& array, const double (&qs)[M], Compare comp = Compare()) {
+    return detail::quantiles(array.dataPtr(), N, qs, comp);
+}
+
+/**
+ * @brief topK() for arrays; see topK(const VaList<T>&, Size, Compare) in Heap.hpp.
+ */
+template <typename T, Size N, typename Compare = std::less<T>>
+VaList<T> topK(const VaArray<T, N>& array, Size k, Compare comp = Compare()) {
+    return detail::topK(array.dataPtr(), N, k, comp);
+}
+
+} // namespace va
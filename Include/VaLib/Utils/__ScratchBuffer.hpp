@@ -0,0 +1,41 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/TypeTraits.hpp>
+
+#include <new>
+
+namespace va::detail {
+
+/**
+ * @brief Uninitialized temporary storage for n elements, used by the sorting algorithms.
+ *
+ * The owner constructs elements in it (in any order) and sets live once all n slots hold
+ * objects; the destructor then destroys them before releasing the memory.
+ */
+template <typename T>
+struct ScratchBuffer {
+    T* ptr;
+    Size size;
+    bool live = false; ///< True once all size slots hold constructed objects
+
+    explicit ScratchBuffer(Size n)
+        : ptr(static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))))), size(n) {}
+
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+    ~ScratchBuffer() {
+        if constexpr (!tt::IsTriviallyDestructible<T>) {
+            if (live) {
+                for (Size i = 0; i < size; i++) ptr[i].~T();
+            }
+        }
+        ::operator delete(ptr, std::align_val_t(alignof(T)));
+    }
+};
+
+} // namespace va::detail
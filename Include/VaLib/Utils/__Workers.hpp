@@ -0,0 +1,57 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+#pragma once
+
+#include <VaLib/Types/BasicTypedef.hpp>
+#include <VaLib/Types/List.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace va::detail {
+
+/**
+ * @brief Runs worker(0) ... worker(threads - 1) concurrently and waits for all of them.
+ *
+ * Worker 0 runs on the calling thread, so only threads - 1 threads are started.
+ * The workers must not throw.
+ *
+ * @return true if the workers ran; false if a thread could not be started, in which case
+ *         no worker ran at all and the caller has to do the work another way (e.g. serially).
+ *
+ * @note The started threads wait until all of them exist before calling their worker. Workers
+ *       sharing a barrier sized for every thread would otherwise wait forever for the threads
+ *       that failed to start.
+ */
+template <typename Worker>
+[[ nodiscard("the work is not done if the threads could not be started") ]]
+bool runWorkers(Size threads, Worker& worker) {
+    enum Gate : int { Starting, Run, Abort };
+    std::atomic<int> gate(Starting);
+
+    auto body = [&worker, &gate](Size t) {
+        gate.wait(Starting, std::memory_order_acquire);
+        if (gate.load(std::memory_order_acquire) == Run) worker(t);
+    };
+
+    VaList<std::thread> workers;
+    try {
+        workers.reserve(threads - 1); // append() below must not reallocate, or a started thread could be lost
+        for (Size t = 1; t < threads; t++) workers.append(std::thread(body, t));
+    } catch (...) {
+        gate.store(Abort, std::memory_order_release);
+        gate.notify_all();
+        for (std::thread& w: workers) w.join();
+        return false;
+    }
+
+    gate.store(Run, std::memory_order_release);
+    gate.notify_all();
+
+    worker(Size(0));
+    for (std::thread& w: workers) w.join();
+    return true;
+}
+
+} // namespace va::detail
@@ -7,7 +7,7 @@
 
 VaBaseError::VaBaseError(VaString m) : msg(m) {}
 
-VaString VaBaseError::what() const { return msg; }
+VaString VaBaseError::what() const { return staticMsg ? VaString(staticMsg) : msg; }
 
 IndexOutOfRangeError::IndexOutOfRangeError(VaString m) : IndexError(m) {}
 IndexOutOfRangeError::IndexOutOfRangeError(Size range, Size index) {
@@ -85,14 +85,10 @@ bool VaImmutableString::operator!=(const VaImmutableString& other) const noexcep
 }
 
 bool VaImmutableString::operator==(const VaString& other) const noexcept {
-    if (this->len != other.len) return false;
-    return std::memcmp(this->data, other.data, len) == 0;
+    return this->len == other.len && va::constexprStrEq(this->data, other.data, len);
 }
 
-bool VaImmutableString::operator!=(const VaString& other) const noexcept {
-    if (this->len != other.len) return false;
-    return std::memcmp(this->data, other.data, len) != 0;
-}
+bool VaImmutableString::operator!=(const VaString& other) const noexcept { return !(*this == other); }
 
 VaImmutableString& VaImmutableString::operator=(const VaImmutableString& other) {
     if (this != &other) {
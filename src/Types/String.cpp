@@ -7,15 +7,10 @@
 #include <VaLib/Types/ImmutableString.hpp>
 #include <VaLib/Types/String.hpp>
 
-#include <algorithm>
 #include <cstring>
 #include <istream>
 #include <string>
 
-#define GROWTH_SEQ ((Size)(cap * 2))
-
-VaString::VaString() noexcept : len(0), cap(0) { data = nullptr; }
-
 VaString::VaString(const std::string& str) noexcept : len(str.size()), cap(str.size()) {
     data = new char[cap];
     std::memcpy(data, str.data(), len);
@@ -26,171 +21,11 @@ VaString::VaString(const VaImmutableString& str) noexcept : len(str.len), cap(st
     std::memcpy(data, str.data, len);
 }
 
-VaString::VaString(const char* str) noexcept : len(std::strlen(str)), cap(len) {
-    data = new char[cap];
-    std::memcpy(data, str, len);
-}
-
-VaString::VaString(const char* str, Size size) noexcept : len(size), cap(size) {
-    data = new char[cap];
-    std::memcpy(data, str, len);
-}
-
-VaString::VaString(Size count, char c) noexcept : len(count), cap(count) {
-    data = new char[cap];
-    std::memset(data, c, len);
-}
-
-VaString::VaString(char ch) noexcept : len(1), cap(1) {
-    data = new char[cap];
-    data[0] = ch;
-}
-
-VaString::VaString(const VaString& other) noexcept : len(other.len), cap(other.cap) {
-    data = new char[cap];
-    std::memcpy(data, other.data, len);
-}
-
-VaString::VaString(VaString&& other) noexcept : len(other.len), cap(other.cap), data(other.data) {
-    other.data = nullptr;
-    other.len = 0;
-    other.cap = 0;
-}
-
-VaString::~VaString() noexcept {
-    delete[] data;
-}
-
-void VaString::resize(Size newCap) {
-    if (newCap <= cap) return;
-
-    char* newData = new char[newCap];
-    if (data) {
-        std::memcpy(newData, data, len);
-        delete[] data;
-    }
-    data = newData;
-    cap = newCap;
-}
-
-VaString& VaString::operator=(const VaString& other) {
-    if (this != &other) {
-        delete[] data;
-        len = other.len;
-        cap = other.cap;
-        data = new char[cap];
-        std::memcpy(data, other.data, len);
-    }
-    return *this;
-}
-
-VaString& VaString::operator=(VaString&& other) noexcept {
-    if (this != &other) {
-        delete[] data;
-        data = other.data;
-        len = other.len;
-        cap = other.cap;
-        other.data = nullptr;
-        other.len = 0;
-        other.cap = 0;
-    }
-    return *this;
-}
-
-VaString VaString::operator+(const VaString& other) const {
-    VaString result(*this);
-    result += other;
-    return result;
-}
-
-VaString VaString::operator+(const char* str) const {
-    VaString result(*this);
-    result += str;
-    return result;
-}
-
-VaString VaString::operator+(char ch) const {
-    VaString result(*this);
-    result += ch;
-    return result;
-}
-
-VaString& VaString::operator+=(const VaString& other) noexcept {
-    if (this == &other) return *this;
-    const Size newLen = len + other.len;
-    if (newLen > cap) {
-        resize(std::max(newLen, GROWTH_SEQ));
-    }
-    std::memcpy(data + len, other.data, other.len);
-    len = newLen;
-    return *this;
-}
-
-VaString& VaString::operator+=(VaString&& other) noexcept {
-    if (this == &other) return *this;
-    const Size newLen = len + other.len;
-    if (newLen > cap) {
-        resize(std::max(newLen, GROWTH_SEQ));
-    }
-    std::memcpy(data + len, other.data, other.len);
-    len = newLen;
-
-    delete[] other.data;
-    other.data = nullptr;
-    other.len = 0;
-    other.cap = 0;
-    return *this;
-}
-
-VaString& VaString::append(const char* str, Size strLen) noexcept {
-    const Size newLen = len + strLen;
-    if (newLen > cap) {
-        resize(std::max(newLen, GROWTH_SEQ));
-    }
-    std::memcpy(data + len, str, strLen);
-    len = newLen;
-    return *this;
-}
-
-VaString& VaString::operator+=(char ch) noexcept {
-    const Size newLen = len + 1;
-    if (newLen > cap) {
-        resize(std::max(newLen, GROWTH_SEQ));
-    }
-    data[len] = ch;
-    len = newLen;
-    return *this;
-}
-
 bool VaString::operator==(const VaImmutableString& other) const noexcept {
-    if (this->len != other.len) return false;
-    return std::memcmp(this->data, other.data, this->len) == 0;
-}
-
-bool VaString::operator!=(const VaImmutableString& other) const noexcept {
-    if (this->len != other.len) return false;
-    return std::memcmp(this->data, other.data, this->len) != 0;
+    return this->len == other.len && va::constexprStrEq(this->data, other.data, this->len);
 }
 
-bool operator==(const VaString& lhs, const VaString& rhs) noexcept {
-    if (&lhs == &rhs) return true;
-    if (lhs.len != rhs.len) return false;
-
-    return std::memcmp(lhs.data, rhs.data, lhs.len) == 0;
-}
-
-bool operator<(const VaString& lhs, const VaString& rhs) {
-    Size minLen = lhs.len < rhs.len ? lhs.len : rhs.len;
-
-    for (Size i = 0; i < minLen; i++) {
-        if (lhs.data[i] < rhs.data[i]) return true;
-        if (lhs.data[i] > rhs.data[i]) return false;
-    }
-    return lhs.len < rhs.len;
-}
-
-char& VaString::operator[](Size index) noexcept { return data[index]; }
-const char& VaString::operator[](Size index) const noexcept { return data[index]; }
+bool VaString::operator!=(const VaImmutableString& other) const noexcept { return !(*this == other); }
 
 char& VaString::at(Size index) {
     if (index >= len) throw IndexOutOfRangeError(len, index);
@@ -211,40 +46,6 @@ char* VaString::toCStyleString() const {
     return cstr;
 }
 
-bool VaString::isEmpty() const { return this->len == 0; }
-
-Size VaString::find(const VaString& substr) const {
-    if (substr.len == 0 || len < substr.len) {
-        return npos;
-    }
-
-    for (Size i = 0; i <= len - substr.len; ++i) {
-        bool match = true;
-        for (Size j = 0; j < substr.len; ++j) {
-            if (data[i + j] != substr.data[j]) {
-                match = false;
-                break;
-            }
-        }
-        if (match) {
-            return i;
-        }
-    }
-    return npos;
-}
-
-VaString VaString::substr(Size start, Size length) const {
-    if (start >= len) {
-        return "";
-    }
-
-    if (length == npos || start + length > len) {
-        length = len - start;
-    }
-
-    return VaString(data + start, length);
-}
-
 VaString& VaString::insert(Size pos, const char* str, Size strLen) {
     if (pos > len) {
         throw IndexOutOfRangeError("insert position is out of range.");
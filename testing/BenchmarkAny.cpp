@@ -0,0 +1,141 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Any.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <any>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size valueCount = 1'000'000;
+constexpr Size passCount = 20;
+
+struct Point3 {
+    float64 x, y, z;
+};
+
+// The values are a mix of int, float64, a short VaString and a 24-byte struct.
+template <typename Append>
+static void fill(Append&& append) {
+    for (Size i = 0; i < valueCount; i++) {
+        switch (i * 2654435761u % 4) {
+        case 0:
+            append(int(i));
+            break;
+        case 1:
+            append(float64(i) * 0.5);
+            break;
+        case 2:
+            append(VaString("value"));
+            break;
+        default:
+            append(Point3{float64(i), 1, 2});
+            break;
+        }
+    }
+}
+
+template <typename Any>
+static VaList<Any> makeList() {
+    VaList<Any> values;
+    fill([&values](auto value) { values.append(Any(std::move(value))); });
+    return values;
+}
+
+template <typename Any>
+static float64 sumVa(const VaList<Any>& values) {
+    float64 acc = 0;
+    for (const Any& value: values) {
+        if (const int* i = value.template tryGet<int>()) {
+            acc += *i;
+        } else if (const float64* f = value.template tryGet<float64>()) {
+            acc += *f;
+        } else if (const VaString* s = value.template tryGet<VaString>()) {
+            acc += float64(len(*s));
+        } else {
+            acc += value.template get<Point3>().x;
+        }
+    }
+    return acc;
+}
+
+static float64 sumStd(const VaList<std::any>& values) {
+    float64 acc = 0;
+    for (const std::any& value: values) {
+        if (const int* i = std::any_cast<int>(&value)) {
+            acc += *i;
+        } else if (const float64* f = std::any_cast<float64>(&value)) {
+            acc += *f;
+        } else if (const VaString* s = std::any_cast<VaString>(&value)) {
+            acc += float64(len(*s));
+        } else {
+            acc += std::any_cast<const Point3&>(value).x;
+        }
+    }
+    return acc;
+}
+
+template <typename Any>
+Time benchmarkBuild(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<Any> values = makeList<Any>();
+    benchmarking::escape(values);
+    return b.done();
+}
+
+template <typename Any>
+Time benchmarkScanVa(benchmarking::Benchmark& b) {
+    VaList<Any> values = makeList<Any>();
+
+    float64 acc = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) acc += sumVa(values);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkScanStd(benchmarking::Benchmark& b) {
+    VaList<std::any> values = makeList<std::any>();
+
+    float64 acc = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) acc += sumStd(values);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+template <typename Any>
+Time benchmarkCopy(benchmarking::Benchmark& b) {
+    VaList<Any> values = makeList<Any>();
+
+    b.start();
+    VaList<Any> copy = values;
+    benchmarking::escape(copy);
+    return b.done();
+}
+
+int main() {
+    auto build = benchmarking::BenchmarkGroup("Building a VaList of 1M mixed values", 3);
+    build.add("VaAny", benchmarkBuild<VaAny>);
+    build.add("VaUniqueAny", benchmarkBuild<VaUniqueAny>);
+    build.add("VaBasicAny<16> (VaString and the struct on the heap)", benchmarkBuild<VaBasicAny<16>>);
+    build.add("std::any", benchmarkBuild<std::any>);
+    build.run();
+
+    auto scan = benchmarking::BenchmarkGroup("20 passes of type checks over 1M mixed values", 3);
+    scan.add("VaAny::tryGet()", benchmarkScanVa<VaAny>);
+    scan.add("VaBasicAny<16>::tryGet()", benchmarkScanVa<VaBasicAny<16>>);
+    scan.add("std::any_cast()", benchmarkScanStd);
+    scan.run();
+
+    auto copy = benchmarking::BenchmarkGroup("Copying a VaList of 1M mixed values", 3);
+    copy.add("VaAny", benchmarkCopy<VaAny>);
+    copy.add("VaBasicAny<16>", benchmarkCopy<VaBasicAny<16>>);
+    copy.add("std::any", benchmarkCopy<std::any>);
+    copy.run();
+
+    return 0;
+}
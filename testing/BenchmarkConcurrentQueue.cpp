@@ -0,0 +1,224 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/LinkedList.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/MpmcQueue.hpp>
+#include <VaLib/Types/SpscRing.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <lib/benchmarking.hpp>
+
+constexpr uint64 itemCount = 2'000'000;
+constexpr int threadCount = 4;
+constexpr int roundTrips = 50'000;
+
+// what our pipelines used before: a mutex-guarded list with a condition variable
+template <typename T>
+class LockedQueue {
+  protected:
+    std::mutex mutex;
+    std::condition_variable ready;
+    VaLinkedList<T> items;
+
+  public:
+    void push(const T& value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            items.append(value);
+        }
+        ready.notify_one();
+    }
+
+    T pop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready.wait(lock, [this] { return len(items) > 0; });
+        return items.shift();
+    }
+};
+
+template <typename Queue>
+Time benchmarkOneToOne(benchmarking::Benchmark& b, Queue& queue) {
+    b.start();
+
+    std::thread producer([&queue] {
+        for (uint64 i = 0; i < itemCount; i++) queue.push(i);
+    });
+
+    uint64 sum = 0;
+    for (uint64 i = 0; i < itemCount; i++) sum += queue.pop();
+    producer.join();
+
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+template <typename Queue>
+Time benchmarkOneToOneBatch(benchmarking::Benchmark& b, Queue& queue) {
+    b.start();
+
+    std::thread producer([&queue] {
+        uint64 batch[64];
+        for (uint64 i = 0; i < itemCount; i += 64) {
+            for (uint64 j = 0; j < 64; j++) batch[j] = i + j;
+            queue.pushBatch(batch, 64);
+        }
+    });
+
+    uint64 sum = 0;
+    uint64 batch[64];
+    for (uint64 received = 0; received < itemCount;) {
+        Size n = queue.popBatch(batch, 64);
+        for (Size i = 0; i < n; i++) sum += batch[i];
+        received += n;
+    }
+    producer.join();
+
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkSpscRing(benchmarking::Benchmark& b) {
+    VaSpscRing<uint64> ring(4096);
+    return benchmarkOneToOne(b, ring);
+}
+
+Time benchmarkSpscRingBatch(benchmarking::Benchmark& b) {
+    VaSpscRing<uint64> ring(4096);
+    return benchmarkOneToOneBatch(b, ring);
+}
+
+Time benchmarkMpmcQueueOneToOne(benchmarking::Benchmark& b) {
+    VaMpmcQueue<uint64> queue(4096);
+    return benchmarkOneToOne(b, queue);
+}
+
+Time benchmarkLockedQueueOneToOne(benchmarking::Benchmark& b) {
+    LockedQueue<uint64> queue;
+    return benchmarkOneToOne(b, queue);
+}
+
+template <typename Queue>
+Time benchmarkManyToMany(benchmarking::Benchmark& b, Queue& queue) {
+    b.start();
+
+    VaList<std::thread> threads;
+    for (int p = 0; p < threadCount; p++) {
+        threads.append(std::thread([&queue] {
+            for (uint64 i = 0; i < itemCount / threadCount; i++) queue.push(i);
+        }));
+    }
+    for (int c = 0; c < threadCount; c++) {
+        threads.append(std::thread([&queue] {
+            uint64 sum = 0;
+            for (uint64 i = 0; i < itemCount / threadCount; i++) sum += queue.pop();
+            benchmarking::escape(sum);
+        }));
+    }
+    for (auto& thread : threads) thread.join();
+
+    return b.done();
+}
+
+Time benchmarkMpmcQueueManyToMany(benchmarking::Benchmark& b) {
+    VaMpmcQueue<uint64> queue(4096);
+    return benchmarkManyToMany(b, queue);
+}
+
+Time benchmarkMpmcQueueManyToManyBatch(benchmarking::Benchmark& b) {
+    VaMpmcQueue<uint64> queue(4096);
+    b.start();
+
+    VaList<std::thread> threads;
+    for (int p = 0; p < threadCount; p++) {
+        threads.append(std::thread([&queue] {
+            uint64 batch[32];
+            for (uint64 i = 0; i < itemCount / threadCount; i += 32) {
+                for (uint64 j = 0; j < 32; j++) batch[j] = i + j;
+                queue.pushBatch(batch, 32);
+            }
+        }));
+    }
+    for (int c = 0; c < threadCount; c++) {
+        threads.append(std::thread([&queue] {
+            uint64 sum = 0;
+            uint64 batch[32];
+            for (uint64 remaining = itemCount / threadCount; remaining > 0;) {
+                Size n = queue.popBatch(batch, remaining < 32 ? remaining : 32);
+                for (Size i = 0; i < n; i++) sum += batch[i];
+                remaining -= n;
+            }
+            benchmarking::escape(sum);
+        }));
+    }
+    for (auto& thread : threads) thread.join();
+
+    return b.done();
+}
+
+Time benchmarkLockedQueueManyToMany(benchmarking::Benchmark& b) {
+    LockedQueue<uint64> queue;
+    return benchmarkManyToMany(b, queue);
+}
+
+template <typename Queue>
+Time benchmarkPingPong(benchmarking::Benchmark& b, Queue& ping, Queue& pong) {
+    b.start();
+
+    std::thread echo([&ping, &pong] {
+        for (int i = 0; i < roundTrips; i++) pong.push(ping.pop());
+    });
+
+    uint64 sum = 0;
+    for (int i = 0; i < roundTrips; i++) {
+        ping.push(uint64(i));
+        sum += pong.pop();
+    }
+    echo.join();
+
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkSpscRingPingPong(benchmarking::Benchmark& b) {
+    VaSpscRing<uint64> ping(64), pong(64);
+    return benchmarkPingPong(b, ping, pong);
+}
+
+Time benchmarkMpmcQueuePingPong(benchmarking::Benchmark& b) {
+    VaMpmcQueue<uint64> ping(64), pong(64);
+    return benchmarkPingPong(b, ping, pong);
+}
+
+Time benchmarkLockedQueuePingPong(benchmarking::Benchmark& b) {
+    LockedQueue<uint64> ping, pong;
+    return benchmarkPingPong(b, ping, pong);
+}
+
+int main() {
+    auto bg = benchmarking::BenchmarkGroup("Queue throughput, 1 producer / 1 consumer", 10);
+
+    bg.add("VaSpscRing", benchmarkSpscRing);
+    bg.add("VaSpscRing (batch 64)", benchmarkSpscRingBatch);
+    bg.add("VaMpmcQueue", benchmarkMpmcQueueOneToOne);
+    bg.add("std::mutex + VaLinkedList", benchmarkLockedQueueOneToOne);
+    bg.run();
+
+    bg = benchmarking::BenchmarkGroup("Queue throughput, 4 producers / 4 consumers", 10);
+
+    bg.add("VaMpmcQueue", benchmarkMpmcQueueManyToMany);
+    bg.add("VaMpmcQueue (batch 32)", benchmarkMpmcQueueManyToManyBatch);
+    bg.add("std::mutex + VaLinkedList", benchmarkLockedQueueManyToMany);
+    bg.run();
+
+    bg = benchmarking::BenchmarkGroup("Queue latency, ping-pong round trips", 10);
+
+    bg.add("VaSpscRing", benchmarkSpscRingPingPong);
+    bg.add("VaMpmcQueue", benchmarkMpmcQueuePingPong);
+    bg.add("std::mutex + VaLinkedList", benchmarkLockedQueuePingPong);
+    bg.run();
+}
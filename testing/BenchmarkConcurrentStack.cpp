@@ -0,0 +1,83 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/ConcurrentStack.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Stack.hpp>
+
+#include <mutex>
+#include <thread>
+
+#include <lib/benchmarking.hpp>
+
+constexpr int operations = 1'000'000;
+
+class LockedStack {
+  protected:
+    std::mutex mutex;
+    VaStack<int> stack;
+
+  public:
+    void push(int value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        stack.push(value);
+    }
+
+    bool tryPop(int& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stack.isEmpty()) return false;
+        out = stack.top();
+        stack.pop();
+        return true;
+    }
+};
+
+template <typename Stack>
+Time benchmarkPushPop(benchmarking::Benchmark& b, int threads) {
+    Stack stack;
+    b.start();
+
+    VaList<std::thread> workers;
+    for (int w = 0; w < threads; w++) {
+        workers.append(std::thread([&stack, threads] {
+            int value = 0;
+            for (int i = 0; i < operations / threads; i++) {
+                stack.push(i);
+                stack.push(i);
+                stack.tryPop(value);
+                stack.tryPop(value);
+            }
+            benchmarking::escape(value);
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+
+    return b.done();
+}
+
+template <int Threads>
+Time benchmarkConcurrentStack(benchmarking::Benchmark& b) {
+    return benchmarkPushPop<VaConcurrentStack<int>>(b, Threads);
+}
+
+template <int Threads>
+Time benchmarkLockedStack(benchmarking::Benchmark& b) {
+    return benchmarkPushPop<LockedStack>(b, Threads);
+}
+
+template <int Threads>
+void runGroup(const char* name) {
+    auto bg = benchmarking::BenchmarkGroup(name, 10);
+
+    bg.add("VaConcurrentStack", benchmarkConcurrentStack<Threads>);
+    bg.add("std::mutex + VaStack", benchmarkLockedStack<Threads>);
+    bg.run();
+}
+
+int main() {
+    runGroup<1>("Stack push/pop scaling, 1 thread");
+    runGroup<2>("Stack push/pop scaling, 2 threads");
+    runGroup<4>("Stack push/pop scaling, 4 threads");
+    runGroup<8>("Stack push/pop scaling, 8 threads");
+}
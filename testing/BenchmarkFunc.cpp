@@ -0,0 +1,224 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/FuncTools/FuncRef.hpp>
+#include <VaLib/Types/List.hpp>
+
+#include <functional>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size callCount = 100'000'000;
+constexpr Size constructCount = 10'000'000;
+
+static int addOne(int x) { return x + 1; }
+
+// Called through a volatile pointer, so that none of the wrappers can be inlined away.
+static int (*volatile addOnePtr)(int) = addOne;
+
+Time benchmarkCallRawPointer(benchmarking::Benchmark& b) {
+    int (*fn)(int) = addOnePtr;
+    int acc = 0;
+
+    b.start();
+    for (Size i = 0; i < callCount; i++) acc = fn(acc);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkCallVaFunc(benchmarking::Benchmark& b) {
+    VaFunc<int(int)> fn = addOnePtr;
+    benchmarking::escape(fn);
+    int acc = 0;
+
+    b.start();
+    for (Size i = 0; i < callCount; i++) acc = fn(acc);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkCallStdFunction(benchmarking::Benchmark& b) {
+    std::function<int(int)> fn = addOnePtr;
+    benchmarking::escape(fn);
+    int acc = 0;
+
+    b.start();
+    for (Size i = 0; i < callCount; i++) acc = fn(acc);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkCallLambdaVaFunc(benchmarking::Benchmark& b) {
+    int step = 1;
+    VaFunc<int(int)> fn = [step](int x) { return x + step; };
+    benchmarking::escape(fn);
+    int acc = 0;
+
+    b.start();
+    for (Size i = 0; i < callCount; i++) acc = fn(acc);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkCallLambdaStdFunction(benchmarking::Benchmark& b) {
+    int step = 1;
+    std::function<int(int)> fn = [step](int x) { return x + step; };
+    benchmarking::escape(fn);
+    int acc = 0;
+
+    b.start();
+    for (Size i = 0; i < callCount; i++) acc = fn(acc);
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+// A capture of 40 bytes: inline in VaFunc, heap-allocated by libstdc++'s std::function (16 bytes inline).
+struct Captures {
+    long a, b, c, d, e;
+};
+
+Time benchmarkConstructVaFunc(benchmarking::Benchmark& b) {
+    Captures c = {1, 2, 3, 4, 5};
+    long acc = 0;
+
+    b.start();
+    for (Size i = 0; i < constructCount; i++) {
+        c.a = long(i);
+        VaFunc<long()> fn = [c]() { return c.a + c.e; };
+        VaFunc<long()> moved = std::move(fn);
+        benchmarking::escape(moved);
+        acc += moved();
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkConstructVaFunc16(benchmarking::Benchmark& b) {
+    Captures c = {1, 2, 3, 4, 5};
+    long acc = 0;
+
+    b.start();
+    for (Size i = 0; i < constructCount; i++) {
+        c.a = long(i);
+        VaFunc<long(), 16> fn = [c]() { return c.a + c.e; }; // Too small: heap-allocated
+        VaFunc<long(), 16> moved = std::move(fn);
+        benchmarking::escape(moved);
+        acc += moved();
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkConstructStdFunction(benchmarking::Benchmark& b) {
+    Captures c = {1, 2, 3, 4, 5};
+    long acc = 0;
+
+    b.start();
+    for (Size i = 0; i < constructCount; i++) {
+        c.a = long(i);
+        std::function<long()> fn = [c]() { return c.a + c.e; };
+        std::function<long()> moved = std::move(fn);
+        benchmarking::escape(moved);
+        acc += moved();
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+// A callback parameter that is only used during the call: the cost of passing the callable.
+
+constexpr Size passCount = 10'000'000;
+
+struct BigCaptures {
+    long values[8]; // 64 bytes: more than VaFunc's default inline capacity
+};
+
+[[gnu::noinline]] static long sumOverVaFunc(VaFunc<long(long)> fn) { return fn(1) + fn(2) + fn(3) + fn(4); }
+
+[[gnu::noinline]] static long sumOverFuncRef(VaFuncRef<long(long)> fn) { return fn(1) + fn(2) + fn(3) + fn(4); }
+
+Time benchmarkPassVaFunc(benchmarking::Benchmark& b) {
+    BigCaptures c = {{1, 2, 3, 4, 5, 6, 7, 8}};
+    long acc = 0;
+
+    b.start();
+    for (Size i = 0; i < passCount; i++) {
+        c.values[0] = long(i);
+        acc += sumOverVaFunc([c](long x) { return x * c.values[0] + c.values[7]; });
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkPassFuncRef(benchmarking::Benchmark& b) {
+    BigCaptures c = {{1, 2, 3, 4, 5, 6, 7, 8}};
+    long acc = 0;
+
+    b.start();
+    for (Size i = 0; i < passCount; i++) {
+        c.values[0] = long(i);
+        acc += sumOverFuncRef([c](long x) { return x * c.values[0] + c.values[7]; });
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+static const VaList<int> smallList = {5, 1, 8, 3, 9, 2, 7, 4};
+
+Time benchmarkFilterVaFunc(benchmarking::Benchmark& b) {
+    Size acc = 0;
+
+    b.start();
+    for (Size i = 0; i < passCount / 10; i++) {
+        int limit = int(i % 10);
+        VaFunc<bool(const int&)> predicate = [limit](const int& x) { return x > limit; };
+        acc += len(va::filter(predicate, smallList));
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkFilterLambda(benchmarking::Benchmark& b) {
+    Size acc = 0;
+
+    b.start();
+    for (Size i = 0; i < passCount / 10; i++) {
+        int limit = int(i % 10);
+        acc += len(va::filter([limit](const int& x) { return x > limit; }, smallList));
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+int main() {
+    auto call = benchmarking::BenchmarkGroup("100M calls of a function pointer", 3);
+    call.add("Raw function pointer", benchmarkCallRawPointer);
+    call.add("VaFunc", benchmarkCallVaFunc);
+    call.add("std::function", benchmarkCallStdFunction);
+    call.run();
+
+    auto lambda = benchmarking::BenchmarkGroup("100M calls of a capturing lambda", 3);
+    lambda.add("VaFunc", benchmarkCallLambdaVaFunc);
+    lambda.add("std::function", benchmarkCallLambdaStdFunction);
+    lambda.run();
+
+    auto construct = benchmarking::BenchmarkGroup("10M construct + move + call of a 40-byte lambda", 3);
+    construct.add("VaFunc (inline)", benchmarkConstructVaFunc);
+    construct.add("VaFunc<Sig, 16> (heap)", benchmarkConstructVaFunc16);
+    construct.add("std::function", benchmarkConstructStdFunction);
+    construct.run();
+
+    auto pass = benchmarking::BenchmarkGroup("10M calls of a function taking a 64-byte callback", 3);
+    pass.add("VaFunc parameter", benchmarkPassVaFunc);
+    pass.add("VaFuncRef parameter", benchmarkPassFuncRef);
+    pass.run();
+
+    auto filter = benchmarking::BenchmarkGroup("1M va::filter() calls on an 8-element list", 3);
+    filter.add("VaFunc predicate", benchmarkFilterVaFunc);
+    filter.add("Lambda predicate (template overload)", benchmarkFilterLambda);
+    filter.run();
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Pair.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size elementCount = 1'000'000;
+constexpr Size hashRounds = 20;
+constexpr Size gridSide = 1'000;
+
+// A uint32 with its own VaHash, which keeps its lists off the raw-bytes path.
+struct Element {
+    uint32 value;
+};
+
+template <>
+struct VaHash<Element> {
+    Size operator()(const Element& element) const { return element.value; }
+};
+
+static VaList<uint32> makeNumbers() {
+    VaList<uint32> numbers;
+    numbers.reserve(elementCount);
+    for (Size i = 0; i < elementCount; i++) numbers.append(uint32(i * 2654435761u));
+    return numbers;
+}
+
+static const VaList<uint32> numbers = makeNumbers();
+
+static VaList<Element> makeElements() {
+    VaList<Element> elements;
+    elements.reserve(elementCount);
+    for (uint32 number: numbers) elements.append(Element{number});
+    return elements;
+}
+
+static const VaList<Element> elements = makeElements();
+
+Time benchmarkBytes(benchmarking::Benchmark& b) {
+    Size sum = 0;
+
+    b.start();
+    for (Size i = 0; i < hashRounds; i++) sum += VaHash<VaList<uint32>>{}(numbers);
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkCombine(benchmarking::Benchmark& b) {
+    Size sum = 0;
+
+    b.start();
+    for (Size i = 0; i < hashRounds; i++) sum += VaHash<VaList<Element>>{}(elements);
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkPairKeys(benchmarking::Benchmark& b) {
+    VaDict<VaPair<int, int>, int> grid(gridSide * gridSide * 2);
+    long sum = 0;
+
+    b.start();
+    for (int i = 0; i < int(gridSide); i++) {
+        for (int j = 0; j < int(gridSide); j++) grid.put({i, j}, i ^ j);
+    }
+    for (int i = 0; i < int(gridSide); i++) {
+        for (int j = 0; j < int(gridSide); j++) sum += *grid.tryAt({j, i});
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+int main() {
+    auto list = benchmarking::BenchmarkGroup("Hashing a VaList of 1M uint32 20 times", 3);
+    list.add("raw bytes (VaHash<VaList<uint32>>)", benchmarkBytes);
+    list.add("element by element (uint32 with its own VaHash)", benchmarkCombine);
+    list.run();
+
+    auto dict = benchmarking::BenchmarkGroup("Putting and looking up a 1000x1000 grid in a VaDict keyed by VaPair<int, int>", 3);
+    dict.add("VaHash<VaPair<int, int>>", benchmarkPairKeys);
+    dict.run();
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/Set.hpp>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size entryCount = 1'000;
+constexpr Size updateCount = 100'000;
+constexpr Size putCount = 1'000'000;
+
+static VaDict<Size, Size> makeDict(bool tracked) {
+    VaDict<Size, Size> dict;
+    if (tracked) dict.enableHashTracking();
+    for (Size i = 0; i < entryCount; i++) dict.put(i, i * i);
+    return dict;
+}
+
+// Changes one value and hashes the whole dictionary, as a cache keyed by the dictionary would.
+template <bool Tracked>
+Time benchmarkUpdateAndHash(benchmarking::Benchmark& b) {
+    VaDict<Size, Size> dict = makeDict(Tracked);
+    Size sum = 0;
+
+    b.start();
+    for (Size i = 0; i < updateCount; i++) {
+        dict.set(i % entryCount, i);
+        sum += dict.hash();
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+template <bool Tracked>
+Time benchmarkSetUpdateAndHash(benchmarking::Benchmark& b) {
+    VaSet<Size> set;
+    if (Tracked) set.enableHashTracking();
+    for (Size i = 0; i < entryCount; i++) set.add(i);
+    Size sum = 0;
+
+    b.start();
+    for (Size i = 0; i < updateCount; i++) {
+        set.erase(set.find(i % entryCount));
+        set.add(i % entryCount);
+        sum += set.hash();
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+template <bool Tracked>
+Time benchmarkPut(benchmarking::Benchmark& b) {
+    VaDict<Size, Size> dict(putCount * 2);
+    if (Tracked) dict.enableHashTracking();
+
+    b.start();
+    for (Size i = 0; i < putCount; i++) dict.put(i, i);
+    benchmarking::escape(dict);
+    return b.done();
+}
+
+int main() {
+    auto dict = benchmarking::BenchmarkGroup("100K single-value updates of a 1K-entry VaDict, each followed by hash()", 3);
+    dict.add("VaDict::hash(), recomputed", benchmarkUpdateAndHash<false>);
+    dict.add("VaDict::hash(), tracked", benchmarkUpdateAndHash<true>);
+    dict.run();
+
+    auto set = benchmarking::BenchmarkGroup("100K key replacements in a 1K-key VaSet, each followed by hash()", 3);
+    set.add("VaSet::hash(), recomputed", benchmarkSetUpdateAndHash<false>);
+    set.add("VaSet::hash(), tracked", benchmarkSetUpdateAndHash<true>);
+    set.run();
+
+    auto put = benchmarking::BenchmarkGroup("Putting 1M entries into a VaDict", 3);
+    put.add("VaDict::put()", benchmarkPut<false>);
+    put.add("VaDict::put(), hash tracked", benchmarkPut<true>);
+    put.run();
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Heap.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/PriorityQueue.hpp>
+
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size count = 1'000'000;
+constexpr Size k = 100;
+
+static VaList<int> makeValues() {
+    std::mt19937 rng(12345);
+    VaList<int> values;
+    values.reserve(count);
+    for (Size i = 0; i < count; i++) values.append(int(rng()));
+    return values;
+}
+
+static const VaList<int> values = makeValues();
+
+Time benchmarkStdPriorityQueue(benchmarking::Benchmark& b) {
+    b.start();
+    std::priority_queue<int, std::vector<int>, std::greater<int>> queue;
+    for (int v: values) queue.push(v);
+
+    long long sum = 0;
+    while (!queue.empty()) {
+        sum += queue.top();
+        queue.pop();
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+template <Size Arity>
+Time benchmarkVaHeap(benchmarking::Benchmark& b) {
+    b.start();
+    VaMinHeap<int, Arity> heap;
+    for (int v: values) heap.push(v);
+
+    long long sum = 0;
+    while (!heap.isEmpty()) sum += heap.pop();
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkVaPriorityQueue(benchmarking::Benchmark& b) {
+    b.start();
+    VaPriorityQueue<int, int> queue;
+    for (int v: values) queue.push(v, v);
+
+    long long sum = 0;
+    while (!queue.isEmpty()) sum += queue.pop();
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkTopKHeap(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> top = va::topK(values, k);
+    benchmarking::escape(top.dataPtr());
+    return b.done();
+}
+
+Time benchmarkTopKStdPriorityQueue(benchmarking::Benchmark& b) {
+    b.start();
+    std::priority_queue<int, std::vector<int>, std::greater<int>> queue;
+    for (int v: values) {
+        if (queue.size() < k) {
+            queue.push(v);
+        } else if (queue.top() < v) {
+            queue.pop();
+            queue.push(v);
+        }
+    }
+    benchmarking::escape(queue.top());
+    return b.done();
+}
+
+Time benchmarkTopKFullSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> copy = values;
+    std::sort(copy.begin(), copy.end(), std::greater<int>());
+    benchmarking::escape(copy.dataPtr());
+    return b.done();
+}
+
+int main() {
+    auto heapGroup = benchmarking::BenchmarkGroup("Heap push all / pop all (1M ints)", 5);
+    heapGroup.add("std::priority_queue", benchmarkStdPriorityQueue);
+    heapGroup.add("VaHeap (binary)", benchmarkVaHeap<2>);
+    heapGroup.add("VaHeap (4-ary)", benchmarkVaHeap<4>);
+    heapGroup.add("VaPriorityQueue (4-ary, indexed)", benchmarkVaPriorityQueue);
+    heapGroup.run();
+
+    auto topGroup = benchmarking::BenchmarkGroup("Top 100 of 1M ints", 5);
+    topGroup.add("va::topK", benchmarkTopKHeap);
+    topGroup.add("std::priority_queue", benchmarkTopKStdPriorityQueue);
+    topGroup.add("Full sort", benchmarkTopKFullSort);
+    topGroup.run();
+
+    return 0;
+}
@@ -4,6 +4,7 @@
 
 #include <VaLib/Types/LinkedList.hpp>
 #include <VaLib/Utils.hpp>
+#include <VaLib/Utils/sort.hpp>
 
 #include <cstdarg>
 #include <list>
@@ -86,6 +87,99 @@ Time benchmarkReuseStdList(benchmarking::Benchmark& b) {
     return b.done();
 }
 
+Time benchmarkCursorVaLinkedList(benchmarking::Benchmark& b) {
+    VaLinkedList<int> list;
+    for (int i = 0; i < 200'000; ++i) {
+        list.append(i);
+    }
+
+    b.start();
+
+    // duplicate every even element and drop every odd one in a single pass
+    auto cur = list.cursorFront();
+    while (!cur.isEnd()) {
+        if (*cur % 2 == 0) {
+            cur.insertAfter(*cur);
+            cur.moveNext().moveNext();
+        } else {
+            cur.erase();
+        }
+    }
+
+    return b.done();
+}
+
+Time benchmarkIteratorStdList(benchmarking::Benchmark& b) {
+    std::list<int> list;
+    for (int i = 0; i < 200'000; ++i) {
+        list.push_back(i);
+    }
+
+    b.start();
+
+    auto it = list.begin();
+    while (it != list.end()) {
+        if (*it % 2 == 0) {
+            it = list.insert(std::next(it), *it);
+            ++it;
+        } else {
+            it = list.erase(it);
+        }
+    }
+
+    return b.done();
+}
+
+Time benchmarkSortVaLinkedList(benchmarking::Benchmark& b) {
+    VaLinkedList<int> list;
+    uint32 seed = 12345;
+    for (int i = 0; i < 300'000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.append(static_cast<int>(seed >> 8));
+    }
+
+    b.start();
+    list.sort();
+    benchmarking::escape(list.frontUnchecked());
+    return b.done();
+}
+
+Time benchmarkSortThroughVaList(benchmarking::Benchmark& b) {
+    VaLinkedList<int> list;
+    uint32 seed = 12345;
+    for (int i = 0; i < 300'000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.append(static_cast<int>(seed >> 8));
+    }
+
+    b.start();
+
+    // what sorting a linked list looked like before VaLinkedList::sort
+    VaList<int> tmp;
+    tmp.reserve(len(list));
+    for (int value : list) tmp.append(value);
+    VaSlice<int> slice(tmp);
+    va::sort::merge(slice);
+    list.clear();
+    for (int value : tmp) list.append(value);
+
+    benchmarking::escape(list.frontUnchecked());
+    return b.done();
+}
+
+Time benchmarkSortStdList(benchmarking::Benchmark& b) {
+    std::list<int> list;
+    uint32 seed = 12345;
+    for (int i = 0; i < 300'000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.push_back(static_cast<int>(seed >> 8));
+    }
+
+    b.start();
+    list.sort();
+    benchmarking::escape(list.front());
+    return b.done();
+}
 
 int main() {
     auto bg = benchmarking::BenchmarkGroup("Linked list append-prepend-insert benchmark", 50);
@@ -99,4 +193,17 @@ int main() {
     bg.add("VaLinkedList", benchmarkReuseVaLinkedList);
     bg.add("std::list", benchmarkReuseStdList);
     bg.run();
+
+    bg = benchmarking::BenchmarkGroup("Linked list single-pass cursor editing benchmark", 50);
+
+    bg.add("VaLinkedList::Cursor", benchmarkCursorVaLinkedList);
+    bg.add("std::list::iterator", benchmarkIteratorStdList);
+    bg.run();
+
+    bg = benchmarking::BenchmarkGroup("Linked list sort benchmark", 20);
+
+    bg.add("VaLinkedList::sort", benchmarkSortVaLinkedList);
+    bg.add("VaList + va::sort::merge", benchmarkSortThroughVaList);
+    bg.add("std::list::sort", benchmarkSortStdList);
+    bg.run();
 }
@@ -0,0 +1,161 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Mem/UniquePtr.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/PolyList.hpp>
+
+#include <random>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size shapeCount = 1'000'000;
+constexpr Size passCount = 20;
+
+struct Shape {
+    virtual ~Shape() = default;
+    virtual float64 area() const = 0;
+};
+
+struct Circle final: Shape {
+    float64 radius;
+    explicit Circle(float64 radius) : radius(radius) {}
+    float64 area() const override { return 3.14159 * radius * radius; }
+};
+
+struct Square final: Shape {
+    float64 side;
+    explicit Square(float64 side) : side(side) {}
+    float64 area() const override { return side * side; }
+};
+
+struct Triangle final: Shape {
+    float64 base, height;
+    Triangle(float64 base, float64 height) : base(base), height(height) {}
+    float64 area() const override { return 0.5 * base * height; }
+};
+
+// The same shapes in the same (random) order for every container.
+template <typename Add>
+static void fill(Add&& add) {
+    std::mt19937 rng(42);
+    for (Size i = 0; i < shapeCount; i++) add(rng() % 3, float64(i % 100));
+}
+
+static VaList<VaUniquePtr<Shape>> makePointers() {
+    VaList<VaUniquePtr<Shape>> shapes;
+    shapes.reserve(shapeCount);
+    fill([&shapes](unsigned kind, float64 x) {
+        switch (kind) {
+        case 0:
+            shapes.append(VaUniquePtr<Shape>(new Circle(x)));
+            break;
+        case 1:
+            shapes.append(VaUniquePtr<Shape>(new Square(x)));
+            break;
+        default:
+            shapes.append(VaUniquePtr<Shape>(new Triangle(x, 2)));
+            break;
+        }
+    });
+    return shapes;
+}
+
+static VaPolyList<Shape> makePoly() {
+    VaPolyList<Shape> shapes;
+    fill([&shapes](unsigned kind, float64 x) {
+        switch (kind) {
+        case 0:
+            shapes.emplace<Circle>(x);
+            break;
+        case 1:
+            shapes.emplace<Square>(x);
+            break;
+        default:
+            shapes.emplace<Triangle>(x, 2.0);
+            break;
+        }
+    });
+    return shapes;
+}
+
+Time benchmarkBuildPointers(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<VaUniquePtr<Shape>> shapes = makePointers();
+    benchmarking::escape(shapes);
+    return b.done();
+}
+
+Time benchmarkBuildPoly(benchmarking::Benchmark& b) {
+    b.start();
+    VaPolyList<Shape> shapes = makePoly();
+    benchmarking::escape(shapes);
+    return b.done();
+}
+
+Time benchmarkSumPointers(benchmarking::Benchmark& b) {
+    VaList<VaUniquePtr<Shape>> shapes = makePointers();
+
+    float64 total = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const VaUniquePtr<Shape>& shape: shapes) total += shape->area();
+    }
+    benchmarking::escape(total);
+    return b.done();
+}
+
+Time benchmarkSumPolyVirtual(benchmarking::Benchmark& b) {
+    VaPolyList<Shape> shapes = makePoly();
+
+    float64 total = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        shapes.forEach([&total](const Shape& shape) { total += shape.area(); });
+    }
+    benchmarking::escape(total);
+    return b.done();
+}
+
+Time benchmarkSumPolyStatic(benchmarking::Benchmark& b) {
+    VaPolyList<Shape> shapes = makePoly();
+
+    float64 total = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        shapes.forEach<Circle, Square, Triangle>([&total](const auto& shape) { total += shape.area(); });
+    }
+    benchmarking::escape(total);
+    return b.done();
+}
+
+Time benchmarkSumPolySegments(benchmarking::Benchmark& b) {
+    VaPolyList<Shape> shapes = makePoly();
+
+    float64 total = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const Circle& circle: shapes.segment<Circle>()) total += circle.area();
+        for (const Square& square: shapes.segment<Square>()) total += square.area();
+        for (const Triangle& triangle: shapes.segment<Triangle>()) total += triangle.area();
+    }
+    benchmarking::escape(total);
+    return b.done();
+}
+
+int main() {
+    auto build = benchmarking::BenchmarkGroup("Building 1M shapes of 3 types in random order", 3);
+    build.add("VaList<VaUniquePtr<Shape>>", benchmarkBuildPointers);
+    build.add("VaPolyList<Shape>", benchmarkBuildPoly);
+    build.run();
+
+    auto sum = benchmarking::BenchmarkGroup("20 passes summing the area of 1M shapes", 3);
+    sum.add("VaList<VaUniquePtr<Shape>>, virtual call", benchmarkSumPointers);
+    sum.add("VaPolyList::forEach(), virtual call", benchmarkSumPolyVirtual);
+    sum.add("VaPolyList::forEach<Circle, Square, Triangle>()", benchmarkSumPolyStatic);
+    sum.add("VaPolyList::segment<T>() loops", benchmarkSumPolySegments);
+    sum.run();
+
+    return 0;
+}
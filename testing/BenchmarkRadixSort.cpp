@@ -0,0 +1,132 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Utils/RadixSort.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size count = 10'000'000;
+constexpr Size stringCount = 1'000'000;
+
+template <typename T>
+static VaList<T> makeValues() {
+    std::mt19937_64 rng(2024);
+    VaList<T> values;
+    values.reserve(count);
+    for (Size i = 0; i < count; i++) values.append(T(rng()));
+    return values;
+}
+
+static VaList<double> makeDoubles() {
+    std::mt19937_64 rng(2024);
+    std::normal_distribution<double> dist(0.0, 1e3);
+    VaList<double> values;
+    values.reserve(count);
+    for (Size i = 0; i < count; i++) values.append(dist(rng));
+    return values;
+}
+
+static VaList<VaString> makeStrings() {
+    std::mt19937 rng(2024);
+    VaList<VaString> values;
+    values.reserve(stringCount);
+    for (Size i = 0; i < stringCount; i++) {
+        VaString str = "user-";
+        for (Size c = 0, length = 4 + rng() % 12; c < length; c++) str += char('a' + rng() % 26);
+        values.append(str);
+    }
+    return values;
+}
+
+static const VaList<uint32> uints = makeValues<uint32>();
+static const VaList<int64> int64s = makeValues<int64>();
+static const VaList<double> doubles = makeDoubles();
+static const VaList<VaString> strings = makeStrings();
+
+// Each benchmark works on a fresh copy; the copy is part of every measurement.
+
+template <typename T>
+Time benchmarkRadixSort(benchmarking::Benchmark& b, const VaList<T>& values) {
+    b.start();
+    VaList<T> data = values;
+    va::radixSort(data);
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+template <typename T>
+Time benchmarkParallelRadixSort(benchmarking::Benchmark& b, const VaList<T>& values) {
+    b.start();
+    VaList<T> data = values;
+    va::par::radixSort(data);
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+template <typename T>
+Time benchmarkStdSort(benchmarking::Benchmark& b, const VaList<T>& values) {
+    b.start();
+    VaList<T> data = values;
+    std::sort(data.begin(), data.end());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+template <typename T>
+Time benchmarkStdStableSort(benchmarking::Benchmark& b, const VaList<T>& values) {
+    b.start();
+    VaList<T> data = values;
+    std::stable_sort(data.begin(), data.end());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+Time benchmarkUintRadix(benchmarking::Benchmark& b) { return benchmarkRadixSort(b, uints); }
+Time benchmarkUintParallelRadix(benchmarking::Benchmark& b) { return benchmarkParallelRadixSort(b, uints); }
+Time benchmarkUintStdSort(benchmarking::Benchmark& b) { return benchmarkStdSort(b, uints); }
+Time benchmarkUintStdStableSort(benchmarking::Benchmark& b) { return benchmarkStdStableSort(b, uints); }
+
+Time benchmarkInt64Radix(benchmarking::Benchmark& b) { return benchmarkRadixSort(b, int64s); }
+Time benchmarkInt64ParallelRadix(benchmarking::Benchmark& b) { return benchmarkParallelRadixSort(b, int64s); }
+Time benchmarkInt64StdSort(benchmarking::Benchmark& b) { return benchmarkStdSort(b, int64s); }
+
+Time benchmarkDoubleRadix(benchmarking::Benchmark& b) { return benchmarkRadixSort(b, doubles); }
+Time benchmarkDoubleStdSort(benchmarking::Benchmark& b) { return benchmarkStdSort(b, doubles); }
+
+Time benchmarkStringRadix(benchmarking::Benchmark& b) { return benchmarkRadixSort(b, strings); }
+Time benchmarkStringParallelRadix(benchmarking::Benchmark& b) { return benchmarkParallelRadixSort(b, strings); }
+Time benchmarkStringStdSort(benchmarking::Benchmark& b) { return benchmarkStdSort(b, strings); }
+
+int main() {
+    auto uint32Group = benchmarking::BenchmarkGroup("Sort 10M uint32", 3);
+    uint32Group.add("va::radixSort", benchmarkUintRadix);
+    uint32Group.add("va::par::radixSort", benchmarkUintParallelRadix);
+    uint32Group.add("std::sort", benchmarkUintStdSort);
+    uint32Group.add("std::stable_sort", benchmarkUintStdStableSort);
+    uint32Group.run();
+
+    auto int64Group = benchmarking::BenchmarkGroup("Sort 10M int64", 3);
+    int64Group.add("va::radixSort", benchmarkInt64Radix);
+    int64Group.add("va::par::radixSort", benchmarkInt64ParallelRadix);
+    int64Group.add("std::sort", benchmarkInt64StdSort);
+    int64Group.run();
+
+    auto doubleGroup = benchmarking::BenchmarkGroup("Sort 10M normally distributed doubles", 3);
+    doubleGroup.add("va::radixSort", benchmarkDoubleRadix);
+    doubleGroup.add("std::sort", benchmarkDoubleStdSort);
+    doubleGroup.run();
+
+    auto stringGroup = benchmarking::BenchmarkGroup("Sort 1M strings", 3);
+    stringGroup.add("va::radixSort", benchmarkStringRadix);
+    stringGroup.add("va::par::radixSort", benchmarkStringParallelRadix);
+    stringGroup.add("std::sort", benchmarkStringStdSort);
+    stringGroup.run();
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/List.hpp>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size tokenCount = 1'000'000;
+
+enum class ParseErrc { empty = 1, badDigit };
+
+// Three of four tokens are malformed, so most of the time goes into the error path.
+static VaList<const char*> makeTokens() {
+    static const char* const pool[] = {"1234", "12x4", "", "abc", "99", "7-", "", "0x1f"};
+
+    VaList<const char*> tokens;
+    tokens.reserve(tokenCount);
+    for (Size i = 0; i < tokenCount; i++) tokens.append(pool[i * 2654435761u % 8]);
+    return tokens;
+}
+
+static const VaList<const char*> tokens = makeTokens();
+
+template <typename Fail>
+static VaResult<int> parseWith(const char* str, Fail fail) {
+    if (*str == '\0') return fail();
+
+    int value = 0;
+    for (; *str; str++) {
+        if (*str < '0' || *str > '9') return fail();
+        value = value * 10 + (*str - '0');
+    }
+    return value;
+}
+
+static VaResult<int> parseHeap(const char* str) {
+    return parseWith(str, [] { return VaResult<int>(new ValueError("invalid integer")); });
+}
+
+static VaResult<int> parseInline(const char* str) {
+    return parseWith(str, [] { return VaResult<int>(ValueError("invalid integer")); });
+}
+
+static VaResult<int> parseStatic(const char* str) {
+    return parseWith(str, [] { return VaResult<int>(ValueError(VaStaticMessage("invalid integer"))); });
+}
+
+static VaResult<int, ParseErrc> parseCode(const char* str) {
+    if (*str == '\0') return ParseErrc::empty;
+
+    int value = 0;
+    for (; *str; str++) {
+        if (*str < '0' || *str > '9') return ParseErrc::badDigit;
+        value = value * 10 + (*str - '0');
+    }
+    return value;
+}
+
+static int parseThrow(const char* str) {
+    VaResult<int> result = parseStatic(str);
+    if (result.isErr()) throw ValueError(VaStaticMessage("invalid integer"));
+    return result.unwrap();
+}
+
+template <auto Parse>
+Time benchmarkParse(benchmarking::Benchmark& b) {
+    Size failed = 0;
+    long sum = 0;
+
+    b.start();
+    for (const char* token: tokens) {
+        auto result = Parse(token);
+        if (result.isOk()) {
+            sum += result.unwrap();
+        } else {
+            failed++;
+        }
+    }
+    benchmarking::escape(sum);
+    benchmarking::escape(failed);
+    return b.done();
+}
+
+Time benchmarkParseThrow(benchmarking::Benchmark& b) {
+    Size failed = 0;
+    long sum = 0;
+
+    b.start();
+    for (const char* token: tokens) {
+        try {
+            sum += parseThrow(token);
+        } catch (const ValueError&) {
+            failed++;
+        }
+    }
+    benchmarking::escape(sum);
+    benchmarking::escape(failed);
+    return b.done();
+}
+
+static VaResult<int> checkRange(int x) {
+    if (x > 1000) return ValueError(VaStaticMessage("out of range"));
+    return x;
+}
+
+Time benchmarkChainTemporaries(benchmarking::Benchmark& b) {
+    long sum = 0;
+
+    b.start();
+    for (const char* token: tokens) {
+        VaResult<int> result = parseHeap(token).map([](int x) { return x * 2; }).andThen(checkRange);
+        sum += result.unwrapOr(-1);
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkChainNamed(benchmarking::Benchmark& b) {
+    long sum = 0;
+
+    b.start();
+    for (const char* token: tokens) {
+        const VaResult<int> parsed = parseHeap(token);
+        const VaResult<int> doubled = parsed.map([](int x) { return x * 2; });
+        const VaResult<int> result = doubled.andThen(checkRange);
+        sum += result.unwrapOr(-1);
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+int main() {
+    auto parse = benchmarking::BenchmarkGroup("Parsing 1M integer tokens, 75% malformed", 3);
+    parse.add("VaResult<int>, heap ValueError pointer", benchmarkParse<parseHeap>);
+    parse.add("VaResult<int>, inline ValueError with a VaString message", benchmarkParse<parseInline>);
+    parse.add("VaResult<int>, inline ValueError with a VaStaticMessage", benchmarkParse<parseStatic>);
+    parse.add("VaResult<int, ParseErrc>", benchmarkParse<parseCode>);
+    parse.add("throw ValueError", benchmarkParseThrow);
+    parse.run();
+
+    auto chain = benchmarking::BenchmarkGroup("parse().map().andThen() over 1M tokens, heap errors", 3);
+    chain.add("On temporaries (the error is moved along)", benchmarkChainTemporaries);
+    chain.add("On named const results (the error is copied)", benchmarkChainNamed);
+    chain.run();
+
+    return 0;
+}
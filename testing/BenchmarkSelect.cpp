@@ -0,0 +1,113 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Utils/Select.hpp>
+
+#include <algorithm>
+#include <random>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size count = 10'000'000;
+
+static VaList<int> makeValues() {
+    std::mt19937 rng(2024);
+    VaList<int> values;
+    values.reserve(count);
+    for (Size i = 0; i < count; i++) values.append(int(rng()));
+    return values;
+}
+
+static const VaList<int> values = makeValues();
+
+// Each benchmark works on a fresh copy; the copy is part of every measurement.
+
+Time benchmarkMedianNthElement(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    va::nthElement(data, count / 2);
+    benchmarking::escape(data[count / 2]);
+    return b.done();
+}
+
+Time benchmarkMedianStdNthElement(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    auto middle = data.begin() + count / 2;
+    std::nth_element(data.begin(), middle, data.end());
+    // escape the address: reading the element back after std::nth_element trips -Wmaybe-uninitialized in GCC
+    benchmarking::escape(&*middle);
+    return b.done();
+}
+
+Time benchmarkMedianFullSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    std::sort(data.begin(), data.end());
+    benchmarking::escape(data[count / 2]);
+    return b.done();
+}
+
+Time benchmarkTop100PartialSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    va::partialSort(data, 100, std::greater<int>());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+Time benchmarkTop100TopK(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    VaList<int> top = va::topK(data, 100);
+    benchmarking::escape(top[0]);
+    return b.done();
+}
+
+Time benchmarkTop100FullSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    std::sort(data.begin(), data.end(), std::greater<int>());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+Time benchmarkQuantiles(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    VaArray<int, 4> qs = va::quantiles(data, {0.5, 0.9, 0.99, 0.999});
+    benchmarking::escape(qs[0]);
+    return b.done();
+}
+
+Time benchmarkQuantilesFullSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    std::sort(data.begin(), data.end());
+    int q = data[count / 2] + data[count * 9 / 10] + data[count * 99 / 100] + data[count * 999 / 1000];
+    benchmarking::escape(q);
+    return b.done();
+}
+
+int main() {
+    auto median = benchmarking::BenchmarkGroup("Median of 10M ints", 3);
+    median.add("va::nthElement", benchmarkMedianNthElement);
+    median.add("std::nth_element", benchmarkMedianStdNthElement);
+    median.add("Full sort", benchmarkMedianFullSort);
+    median.run();
+
+    auto top = benchmarking::BenchmarkGroup("Top 100 of 10M ints", 3);
+    top.add("va::partialSort", benchmarkTop100PartialSort);
+    top.add("va::topK", benchmarkTop100TopK);
+    top.add("Full sort", benchmarkTop100FullSort);
+    top.run();
+
+    auto quantiles = benchmarking::BenchmarkGroup("p50/p90/p99/p999 of 10M ints", 3);
+    quantiles.add("va::quantiles", benchmarkQuantiles);
+    quantiles.add("Full sort", benchmarkQuantilesFullSort);
+    quantiles.run();
+
+    return 0;
+}
@@ -2,6 +2,113 @@
 // Licensed under GNU GPL v3 License. See LICENSE file.
 // (C) 2025 VaLibTeam
 
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Utils/ParallelSort.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <thread>
+
 #include <lib/benchmarking.hpp>
 
-int main() { return benchmarking::todo(); }
\ No newline at end of file
+constexpr Size count = 10'000'000;
+
+static VaList<int> makeValues() {
+    std::mt19937 rng(2024);
+    VaList<int> values;
+    values.reserve(count);
+    for (Size i = 0; i < count; i++) values.append(int(rng()));
+    return values;
+}
+
+static const VaList<int> values = makeValues();
+static const VaList<int> fewKeys = [] {
+    VaList<int> keys = values;
+    for (int& key: keys) key &= 3;
+    return keys;
+}();
+
+// Each benchmark works on a fresh copy; the copy is part of every measurement.
+
+template <Size Threads>
+Time benchmarkParallelSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    va::par::sort(data, std::less<int>(), Threads);
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+template <Size Threads>
+Time benchmarkParallelSortFewKeys(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = fewKeys;
+    va::par::sort(data, std::less<int>(), Threads);
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+Time benchmarkStdSortFewKeys(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = fewKeys;
+    std::sort(data.begin(), data.end());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+template <Size Threads>
+Time benchmarkParallelStableSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    va::par::stableSort(data, std::less<int>(), Threads);
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+Time benchmarkStdSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    std::sort(data.begin(), data.end());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+Time benchmarkStdStableSort(benchmarking::Benchmark& b) {
+    b.start();
+    VaList<int> data = values;
+    std::stable_sort(data.begin(), data.end());
+    benchmarking::escape(data[0]);
+    return b.done();
+}
+
+int main() {
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+    auto sortGroup = benchmarking::BenchmarkGroup("Sort 10M ints (sample sort)", 3);
+    sortGroup.add("va::par::sort, 1 thread", benchmarkParallelSort<1>);
+    sortGroup.add("va::par::sort, 2 threads", benchmarkParallelSort<2>);
+    sortGroup.add("va::par::sort, 4 threads", benchmarkParallelSort<4>);
+    sortGroup.add("va::par::sort, 8 threads", benchmarkParallelSort<8>);
+    sortGroup.add("va::par::sort, all threads", benchmarkParallelSort<0>);
+    sortGroup.add("std::sort", benchmarkStdSort);
+    sortGroup.run();
+
+    auto fewKeysGroup = benchmarking::BenchmarkGroup("Sort 10M ints with 4 distinct keys (sample sort)", 3);
+    fewKeysGroup.add("va::par::sort, 1 thread", benchmarkParallelSortFewKeys<1>);
+    fewKeysGroup.add("va::par::sort, 4 threads", benchmarkParallelSortFewKeys<4>);
+    fewKeysGroup.add("va::par::sort, all threads", benchmarkParallelSortFewKeys<0>);
+    fewKeysGroup.add("std::sort", benchmarkStdSortFewKeys);
+    fewKeysGroup.run();
+
+    auto stableGroup = benchmarking::BenchmarkGroup("Stable sort 10M ints (merge sort)", 3);
+    stableGroup.add("va::par::stableSort, 1 thread", benchmarkParallelStableSort<1>);
+    stableGroup.add("va::par::stableSort, 2 threads", benchmarkParallelStableSort<2>);
+    stableGroup.add("va::par::stableSort, 4 threads", benchmarkParallelStableSort<4>);
+    stableGroup.add("va::par::stableSort, 8 threads", benchmarkParallelStableSort<8>);
+    stableGroup.add("va::par::stableSort, all threads", benchmarkParallelStableSort<0>);
+    stableGroup.add("std::stable_sort", benchmarkStdStableSort);
+    stableGroup.run();
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/StaticDict.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size lookupCount = 1'000'000;
+
+constexpr auto headers = va::mkStaticDict<int>({
+    {"accept", 0}, {"accept-encoding", 1}, {"accept-language", 2}, {"authorization", 3}, {"cache-control", 4},
+    {"connection", 5}, {"content-encoding", 6}, {"content-length", 7}, {"content-type", 8}, {"cookie", 9},
+    {"date", 10}, {"etag", 11}, {"expires", 12}, {"host", 13}, {"if-modified-since", 14}, {"if-none-match", 15},
+    {"last-modified", 16}, {"location", 17}, {"origin", 18}, {"pragma", 19}, {"range", 20}, {"referer", 21},
+    {"server", 22}, {"set-cookie", 23}, {"transfer-encoding", 24}, {"upgrade", 25}, {"user-agent", 26},
+    {"vary", 27}, {"via", 28}, {"www-authenticate", 29}, {"x-forwarded-for", 30}, {"x-request-id", 31},
+});
+
+// The same table, filled at startup.
+static VaDict<VaString, int> makeDict() {
+    VaDict<VaString, int> dict;
+    for (const auto& entry: headers) dict.put(VaString(entry.key), entry.value);
+    return dict;
+}
+
+static const VaDict<VaString, int> dict = makeDict();
+
+// One name in eight is unknown.
+static VaList<VaString> makeNames() {
+    VaList<VaString> names;
+    names.reserve(lookupCount);
+    for (Size i = 0; i < lookupCount; i++) {
+        Size pick = i * 2654435761u % (len(headers) + len(headers) / 7);
+        names.append(pick < len(headers) ? VaString(headers.begin()[pick].key) : VaString("x-unknown"));
+    }
+    return names;
+}
+
+static const VaList<VaString> names = makeNames();
+
+Time benchmarkDict(benchmarking::Benchmark& b) {
+    long sum = 0;
+
+    b.start();
+    for (const VaString& name: names) {
+        if (const int* value = dict.tryAt(name)) sum += *value;
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkStaticDict(benchmarking::Benchmark& b) {
+    long sum = 0;
+
+    b.start();
+    for (const VaString& name: names) {
+        if (const int* value = headers.tryAt(name)) sum += *value;
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+int main() {
+    auto lookup = benchmarking::BenchmarkGroup("Looking up 1M header names among 32, 1 in 8 unknown", 3);
+    lookup.add("VaDict<VaString, int>::tryAt()", benchmarkDict);
+    lookup.add("VaStaticDict<int, 32>::tryAt()", benchmarkStaticDict);
+    lookup.run();
+
+    return 0;
+}
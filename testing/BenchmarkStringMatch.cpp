@@ -0,0 +1,105 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Meta/StringMatch.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size commandCount = 1'000'000;
+
+static const char* const names[] = {"help", "quit", "list", "show", "add", "remove", "rename", "move",
+                                    "copy", "open", "close", "save", "load", "undo", "redo", "find",
+                                    "replace", "select", "deselect", "zoom", "pan", "rotate", "export", "import"};
+
+constexpr Size nameCount = sizeof(names) / sizeof(*names);
+
+// One command in eight is unknown.
+static VaList<VaString> makeCommands() {
+    VaList<VaString> commands;
+    commands.reserve(commandCount);
+    for (Size i = 0; i < commandCount; i++) {
+        Size pick = i * 2654435761u % (nameCount + nameCount / 7);
+        commands.append(pick < nameCount ? VaString(names[pick]) : VaString("unknown"));
+    }
+    return commands;
+}
+
+static const VaList<VaString> commands = makeCommands();
+
+static int dispatchLiterals(const VaString& cmd) {
+    if (cmd == "help") return 0;
+    else if (cmd == "quit") return 1;
+    else if (cmd == "list") return 2;
+    else if (cmd == "show") return 3;
+    else if (cmd == "add") return 4;
+    else if (cmd == "remove") return 5;
+    else if (cmd == "rename") return 6;
+    else if (cmd == "move") return 7;
+    else if (cmd == "copy") return 8;
+    else if (cmd == "open") return 9;
+    else if (cmd == "close") return 10;
+    else if (cmd == "save") return 11;
+    else if (cmd == "load") return 12;
+    else if (cmd == "undo") return 13;
+    else if (cmd == "redo") return 14;
+    else if (cmd == "find") return 15;
+    else if (cmd == "replace") return 16;
+    else if (cmd == "select") return 17;
+    else if (cmd == "deselect") return 18;
+    else if (cmd == "zoom") return 19;
+    else if (cmd == "pan") return 20;
+    else if (cmd == "rotate") return 21;
+    else if (cmd == "export") return 22;
+    else if (cmd == "import") return 23;
+    return -1;
+}
+
+// The same chain against VaStrings built once, so that no comparison allocates.
+static int dispatchStrings(const VaString& cmd) {
+    static const VaList<VaString> keys = [] {
+        VaList<VaString> list;
+        for (const char* name: names) list.append(VaString(name));
+        return list;
+    }();
+
+    for (Size i = 0; i < nameCount; i++) {
+        if (cmd == keys[i]) return int(i);
+    }
+    return -1;
+}
+
+static int dispatchMatch(const VaString& cmd) {
+    return va::match(cmd,
+        va::on<"help">([] { return 0; }), va::on<"quit">([] { return 1; }), va::on<"list">([] { return 2; }),
+        va::on<"show">([] { return 3; }), va::on<"add">([] { return 4; }), va::on<"remove">([] { return 5; }),
+        va::on<"rename">([] { return 6; }), va::on<"move">([] { return 7; }), va::on<"copy">([] { return 8; }),
+        va::on<"open">([] { return 9; }), va::on<"close">([] { return 10; }), va::on<"save">([] { return 11; }),
+        va::on<"load">([] { return 12; }), va::on<"undo">([] { return 13; }), va::on<"redo">([] { return 14; }),
+        va::on<"find">([] { return 15; }), va::on<"replace">([] { return 16; }), va::on<"select">([] { return 17; }),
+        va::on<"deselect">([] { return 18; }), va::on<"zoom">([] { return 19; }), va::on<"pan">([] { return 20; }),
+        va::on<"rotate">([] { return 21; }), va::on<"export">([] { return 22; }), va::on<"import">([] { return 23; }),
+        va::otherwise([] { return -1; }));
+}
+
+template <int (*Dispatch)(const VaString&)>
+Time benchmarkDispatch(benchmarking::Benchmark& b) {
+    long sum = 0;
+
+    b.start();
+    for (const VaString& cmd: commands) sum += Dispatch(cmd);
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+int main() {
+    auto dispatch = benchmarking::BenchmarkGroup("Dispatching 1M commands over 24 names, 1 in 8 unknown", 3);
+    dispatch.add("if-else chain of operator== with literals", benchmarkDispatch<dispatchLiterals>);
+    dispatch.add("if-else chain of operator== with prebuilt VaStrings", benchmarkDispatch<dispatchStrings>);
+    dispatch.add("va::match()", benchmarkDispatch<dispatchMatch>);
+    dispatch.run();
+
+    return 0;
+}
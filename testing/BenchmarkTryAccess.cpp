@@ -0,0 +1,144 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Stack.hpp>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size elementCount = 10'000;
+constexpr Size lookupCount = 200'000;
+
+// Nine of ten lookups miss: the indices run 10x past the end of the list.
+static VaList<int32> makeIndices() {
+    VaList<int32> indices;
+    indices.reserve(lookupCount);
+    for (Size i = 0; i < lookupCount; i++) indices.append(int32(i * 2654435761u % (elementCount * 10)));
+    return indices;
+}
+
+static VaList<int> makeList() {
+    VaList<int> list;
+    for (Size i = 0; i < elementCount; i++) list.append(int(i));
+    return list;
+}
+
+static VaDict<int, int> makeDict() {
+    VaDict<int, int> dict;
+    for (Size i = 0; i < elementCount; i++) dict.put(int(i), int(i));
+    return dict;
+}
+
+static const VaList<int32> indices = makeIndices();
+
+Time benchmarkListAt(benchmarking::Benchmark& b) {
+    VaList<int> list = makeList();
+    long sum = 0;
+
+    b.start();
+    for (int32 index: indices) {
+        try {
+            sum += list.at(index);
+        } catch (const IndexOutOfRangeError&) {
+            sum--;
+        }
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkListTryAt(benchmarking::Benchmark& b) {
+    VaList<int> list = makeList();
+    long sum = 0;
+
+    b.start();
+    for (int32 index: indices) {
+        const int* found = list.tryAt(index);
+        sum += found ? *found : -1;
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkDictAt(benchmarking::Benchmark& b) {
+    VaDict<int, int> dict = makeDict();
+    long sum = 0;
+
+    b.start();
+    for (int32 key: indices) {
+        try {
+            sum += dict.at(key);
+        } catch (const KeyNotFoundError&) {
+            sum--;
+        }
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkDictTryAt(benchmarking::Benchmark& b) {
+    VaDict<int, int> dict = makeDict();
+    long sum = 0;
+
+    b.start();
+    for (int32 key: indices) {
+        const int* found = dict.tryAt(key);
+        sum += found ? *found : -1;
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+// A worker draining a stack that is refilled with one item every 10 polls.
+Time benchmarkStackPop(benchmarking::Benchmark& b) {
+    VaStack<int> stack;
+    long sum = 0;
+
+    b.start();
+    for (Size i = 0; i < lookupCount; i++) {
+        if (i % 10 == 0) stack.push(int(i));
+        try {
+            sum += stack.top();
+            stack.pop();
+        } catch (const VaBaseError&) {
+            sum--;
+        }
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+Time benchmarkStackTryPop(benchmarking::Benchmark& b) {
+    VaStack<int> stack;
+    long sum = 0;
+
+    b.start();
+    for (Size i = 0; i < lookupCount; i++) {
+        if (i % 10 == 0) stack.push(int(i));
+        int value;
+        sum += stack.tryPop(value) ? value : -1;
+    }
+    benchmarking::escape(sum);
+    return b.done();
+}
+
+int main() {
+    auto list = benchmarking::BenchmarkGroup("200k VaList lookups, 90% out of range", 3);
+    list.add("at() + catch", benchmarkListAt);
+    list.add("tryAt()", benchmarkListTryAt);
+    list.run();
+
+    auto dict = benchmarking::BenchmarkGroup("200k VaDict lookups, 90% missing", 3);
+    dict.add("at() + catch", benchmarkDictAt);
+    dict.add("tryAt()", benchmarkDictTryAt);
+    dict.run();
+
+    auto stack = benchmarking::BenchmarkGroup("200k VaStack polls, 90% on an empty stack", 3);
+    stack.add("top() + pop() + catch", benchmarkStackPop);
+    stack.add("tryPop()", benchmarkStackTryPop);
+    stack.run();
+
+    return 0;
+}
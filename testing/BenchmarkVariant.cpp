@@ -0,0 +1,209 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Types/Any.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Variant.hpp>
+
+#include <variant>
+
+#include <lib/benchmarking.hpp>
+
+constexpr Size valueCount = 1'000'000;
+constexpr Size passCount = 20;
+constexpr Size assignCount = 10'000'000;
+
+// 32 bytes: the largest value stored inline by VaAny.
+struct Point4 {
+    float64 x, y, z, w;
+};
+
+using Va = VaVariant<int64, float64, Point4>;
+using Std = std::variant<int64, float64, Point4>;
+
+struct Sum {
+    inline float64 operator()(int64 x) const { return float64(x); }
+    inline float64 operator()(float64 x) const { return x; }
+    inline float64 operator()(const Point4& p) const { return p.x + p.y + p.z + p.w; }
+};
+
+template <typename Make>
+static void fill(Make&& make) {
+    for (Size i = 0; i < valueCount; i++) {
+        switch (i * 2654435761u % 3) {
+        case 0:
+            make(int64(i));
+            break;
+        case 1:
+            make(float64(i) * 0.5);
+            break;
+        default:
+            make(Point4{float64(i), 1, 2, 3});
+            break;
+        }
+    }
+}
+
+Time benchmarkVisitVaVariant(benchmarking::Benchmark& b) {
+    VaList<Va> values;
+    values.reserve(valueCount);
+    fill([&values](auto value) { values.append(Va(value)); });
+
+    float64 acc = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const Va& value: values) acc += value.visit(Sum{});
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkVisitStdVariant(benchmarking::Benchmark& b) {
+    VaList<Std> values;
+    values.reserve(valueCount);
+    fill([&values](auto value) { values.append(Std(value)); });
+
+    float64 acc = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const Std& value: values) acc += std::visit(Sum{}, value);
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkVisitVaAny(benchmarking::Benchmark& b) {
+    VaList<VaAny> values;
+    values.reserve(valueCount);
+    fill([&values](auto value) { values.append(VaAny(value)); });
+
+    // VaAny has no visit: the usual chain of type checks
+    float64 acc = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const VaAny& value: values) {
+            if (value.isType<int64>()) {
+                acc += Sum{}(value.get<int64>());
+            } else if (value.isType<float64>()) {
+                acc += Sum{}(value.get<float64>());
+            } else {
+                acc += Sum{}(value.get<Point4>());
+            }
+        }
+    }
+    benchmarking::escape(acc);
+    return b.done();
+}
+
+Time benchmarkHoldsVaVariant(benchmarking::Benchmark& b) {
+    VaList<Va> values;
+    values.reserve(valueCount);
+    fill([&values](auto value) { values.append(Va(value)); });
+
+    Size points = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const Va& value: values) points += value.holds<Point4>();
+    }
+    benchmarking::escape(points);
+    return b.done();
+}
+
+Time benchmarkHoldsStdVariant(benchmarking::Benchmark& b) {
+    VaList<Std> values;
+    values.reserve(valueCount);
+    fill([&values](auto value) { values.append(Std(value)); });
+
+    Size points = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const Std& value: values) points += std::holds_alternative<Point4>(value);
+    }
+    benchmarking::escape(points);
+    return b.done();
+}
+
+Time benchmarkHoldsVaAny(benchmarking::Benchmark& b) {
+    VaList<VaAny> values;
+    values.reserve(valueCount);
+    fill([&values](auto value) { values.append(VaAny(value)); });
+
+    Size points = 0;
+    b.start();
+    for (Size pass = 0; pass < passCount; pass++) {
+        for (const VaAny& value: values) points += value.isType<Point4>();
+    }
+    benchmarking::escape(points);
+    return b.done();
+}
+
+Time benchmarkAssignVaVariant(benchmarking::Benchmark& b) {
+    Va value;
+    benchmarking::escape(value);
+
+    b.start();
+    for (Size i = 0; i < assignCount; i++) {
+        if (i % 2) {
+            value.emplace<Point4>(float64(i), 1.0, 2.0, 3.0);
+        } else {
+            value = int64(i);
+        }
+        benchmarking::escape(value);
+    }
+    return b.done();
+}
+
+Time benchmarkAssignStdVariant(benchmarking::Benchmark& b) {
+    Std value;
+    benchmarking::escape(value);
+
+    b.start();
+    for (Size i = 0; i < assignCount; i++) {
+        if (i % 2) {
+            value.emplace<Point4>(float64(i), 1.0, 2.0, 3.0);
+        } else {
+            value = int64(i);
+        }
+        benchmarking::escape(value);
+    }
+    return b.done();
+}
+
+Time benchmarkAssignVaAny(benchmarking::Benchmark& b) {
+    VaAny value;
+    benchmarking::escape(value);
+
+    b.start();
+    for (Size i = 0; i < assignCount; i++) {
+        if (i % 2) {
+            value.emplace(Point4{float64(i), 1.0, 2.0, 3.0});
+        } else {
+            value = int64(i);
+        }
+        benchmarking::escape(value);
+    }
+    return b.done();
+}
+
+int main() {
+    auto visit = benchmarking::BenchmarkGroup("20 passes visiting 1M mixed values", 3);
+    visit.add("VaVariant::visit()", benchmarkVisitVaVariant);
+    visit.add("std::visit()", benchmarkVisitStdVariant);
+    visit.add("VaAny + isType() chain", benchmarkVisitVaAny);
+    visit.run();
+
+    auto holds = benchmarking::BenchmarkGroup("20 passes counting one type among 1M mixed values", 3);
+    holds.add("VaVariant::holds()", benchmarkHoldsVaVariant);
+    holds.add("std::holds_alternative()", benchmarkHoldsStdVariant);
+    holds.add("VaAny::isType()", benchmarkHoldsVaAny);
+    holds.run();
+
+    auto assign = benchmarking::BenchmarkGroup("10M assignments alternating int64 and a 32-byte struct", 3);
+    assign.add("VaVariant", benchmarkAssignVaVariant);
+    assign.add("std::variant", benchmarkAssignStdVariant);
+    assign.add("VaAny", benchmarkAssignVaAny);
+    assign.run();
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <VaLib/Meta/FixedString.hpp>
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+
+// VaString
+
+constexpr bool stringBasics() {
+    VaString str = "Hello";
+    str += ", ";
+    str.append("world!!", 5);
+    str += '!';
+
+    VaString copy = str;
+    VaString moved = std::move(copy);
+
+    return str == "Hello, world!" && moved == str && len(copy) == 0 && str.find("world") == 7 && str.substr(7, 5) == "world" &&
+           str.substr(20) == "" && str[0] == 'H' && !str.isEmpty();
+}
+
+static_assert(stringBasics(), "VaString construction, append and lookups must work in constant expressions");
+
+static_assert(VaString("abc") < VaString("abd") && VaString("ab") < VaString("abc") && !(VaString("b") < VaString("a")));
+static_assert(VaString(3, 'x') + "y" + VaString('z') == "xxxyz" && "w" + VaString("v") == "wv");
+static_assert(VaString("key").hash() == va::constexprStrHash("key"));
+
+constexpr bool stringGrowth() {
+    VaString str;
+    for (int i = 0; i < 100; i++) str += char('a' + i % 26);
+
+    VaString other = "tail";
+    str += std::move(other);
+    return len(str) == 104 && cap(str) >= 104 && str[26] == 'a' && len(other) == 0 && str.substr(100) == "tail";
+}
+
+static_assert(stringGrowth(), "VaString reallocation must work in constant expressions");
+
+// VaList
+
+constexpr bool listBasics() {
+    VaList<int> list = {3, 4, 5};
+    list.append(6);
+    list.prepend(2);
+    list.insert(0, 1);
+    list.appendEach(VaList<int>{7, 8});
+    list.prependEach(VaList<int>{-1, 0});
+
+    if (list != VaList<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8}) return false;
+
+    list.del(0);
+    list.delRange(0, 1);
+    int last = list.pop();
+    int first = list.pop(0);
+
+    return last == 8 && first == 1 && list == VaList<int>{2, 3, 4, 5, 6, 7} && list.at(-1) == 7 && *list.tryAt(1) == 3;
+}
+
+static_assert(listBasics(), "VaList modifiers must work in constant expressions");
+
+constexpr bool listCopies() {
+    VaList<int> list = VaList<int>::Filled(3, 9);
+    VaList<int> copy = list;
+    copy.set(0, 1);
+
+    VaList<int> moved;
+    moved = std::move(copy);
+
+    VaList<int> joined = list + moved;
+    joined += joined;
+
+    return list == VaList<int>{9, 9, 9} && moved == VaList<int>{1, 9, 9} && len(joined) == 12 && joined[9] == 1 &&
+           joined.slice(0, 6, 2) == VaList<int>{9, 9, 9} && va::reversed(moved) == VaList<int>{9, 9, 1};
+}
+
+static_assert(listCopies(), "copying and moving a VaList must work in constant expressions");
+
+constexpr bool listOfStrings() {
+    VaList<VaString> words;
+    for (const char* word: {"alpha", "beta", "gamma", "delta", "epsilon"}) words.append(word);
+    words.insert(1, "alef");
+    words.del(3);
+
+    VaList<VaString> copy = words;
+    copy.clear();
+    copy = words;
+
+    return len(words) == 5 && words[1] == "alef" && words[3] == "delta" && copy == words && words.join(", ") == "alpha, alef, beta, delta, epsilon";
+}
+
+static_assert(listOfStrings(), "a VaList of VaStrings must work in constant expressions");
+
+constexpr bool listAlgorithms() {
+    VaList<int> numbers;
+    for (int i = 1; i <= 10; i++) numbers.append(i);
+
+    auto squares = va::map([](int n) { return n * n; }, numbers);
+    auto even = va::filter([](int n) { return n % 2 == 0; }, squares);
+    int sum = va::reduce([](int acc, int n) { return acc + n; }, even, 0);
+
+    return len(even) == 5 && sum == 4 + 16 + 36 + 64 + 100;
+}
+
+static_assert(listAlgorithms(), "va::map(), va::filter() and va::reduce() must work in constant expressions");
+
+// Tables
+
+constexpr auto makePrimes = [] {
+    VaList<int> list;
+    for (int n = 2; len(list) < 32; n++) {
+        bool prime = true;
+        for (int p: list) {
+            if (p * p > n) break;
+            if (n % p == 0) prime = false;
+        }
+        if (prime) list.append(n);
+    }
+    return list;
+};
+
+constexpr auto primes = va::toArray<makePrimes>();
+
+static_assert(len(primes) == 32 && primes[0] == 2 && primes[9] == 29 && primes[31] == 131, "va::toArray() must copy the whole VaList");
+
+constexpr auto hexDigits = va::toArray<[] {
+    VaString str;
+    for (char c = '0'; c <= '9'; c++) str += c;
+    return str + "abcdef";
+}>();
+
+static_assert(len(hexDigits) == 16 && hexDigits[10] == 'a' && hexDigits[15] == 'f', "va::toArray() must accept a VaString");
+
+constexpr auto csv = va::toFixedString<[] {
+    VaList<VaString> names = {"id", "name", "email"};
+    return names.join(",");
+}>();
+
+static_assert(csv == VaFixedString("id,name,email") && csv.len == 13 && csv.hash() == va::constexprStrHash("id,name,email"),
+              "va::toFixedString() must copy the whole VaString");
@@ -0,0 +1,97 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+// Compile-time benchmark of VaTuple: a wide tuple whose every element is read through
+// get<I>, get<T>, tuple_element, forEach and forEachIndexed. test.sh reports how long it
+// takes to compile. To count the get<> instantiations of sumFields() below:
+//
+//     g++ -std=c++20 -O0 -I../Include -I. -c MetaTestTupleCompileTime.cpp -o tuple.o
+//     nm tuple.o | grep -c 3getI
+//
+// The flat storage instantiates one get<> per element and access path (256 for 128
+// elements); the recursive VaTuple it replaced instantiated one per element and per
+// level below it (16512).
+
+#include <VaLib/Types/Tuple.hpp>
+
+#include <utility>
+
+#ifndef TUPLE_WIDTH
+    #define TUPLE_WIDTH 128
+#endif
+
+constexpr Size width = TUPLE_WIDTH;
+
+template <Size N>
+struct Field {
+    int value = int(N);
+};
+
+struct Tag {};
+
+template <typename Indices>
+struct WideTupleOf;
+
+template <Size... I>
+struct WideTupleOf<std::index_sequence<I...>> {
+    using Type = VaTuple<Field<I>...>;
+};
+
+using Wide = typename WideTupleOf<std::make_index_sequence<width>>::Type;
+
+// Elements are laid out in order, with nothing in between
+static_assert(sizeof(Wide) == width * sizeof(int));
+static_assert(std::tuple_size<Wide>::value == width);
+
+template <Size... I>
+constexpr bool readsEveryElement(std::index_sequence<I...>) {
+    Wide tuple;
+    const Wide& view = tuple;
+
+    ((tuple.template get<I>().value += int(I)), ...);
+
+    return ((view.template get<I>().value == 2 * int(I)) && ...) &&
+           ((tuple.template get<Field<I>>().value == 2 * int(I)) && ...) &&
+           (tt::IsSame<std::tuple_element_t<I, Wide>, Field<I>> && ...) &&
+           (tt::IsSame<decltype(std::move(tuple).template get<I>()), Field<I>&&> && ...);
+}
+
+static_assert(readsEveryElement(std::make_index_sequence<width>{}), "get<I>() or get<T>() of a wide tuple failed");
+
+constexpr Size sumIndexed() {
+    const Wide tuple;
+
+    Size sum = 0;
+    tuple.forEachIndexed([&sum](auto index, const auto& field) { sum += index + Size(field.value); });
+    return sum;
+}
+
+static_assert(sumIndexed() == width * (width - 1), "forEachIndexed() over a wide tuple failed");
+
+constexpr int sumValues() {
+    Wide tuple;
+
+    int sum = 0;
+    tuple.forEach([&sum](auto& field) { sum += field.value; });
+    return sum;
+}
+
+static_assert(sumValues() == int(width * (width - 1) / 2), "forEach() over a wide tuple failed");
+
+// Not constexpr, so that an unoptimized build emits every get<> it instantiates
+template <Size... I>
+int sumFields(Wide& tuple, std::index_sequence<I...>) {
+    return ((tuple.template get<I>().value + tuple.template get<Field<I>>().value) + ...);
+}
+
+int sumFields(Wide& tuple) { return sumFields(tuple, std::make_index_sequence<width>{}); }
+
+// Empty elements take no space
+static_assert(sizeof(VaTuple<Tag, int>) == sizeof(int));
+static_assert(sizeof(VaTuple<int, Tag, Field<0>, VaTuple<>>) == 2 * sizeof(int));
+static_assert(tt::IsEmpty<VaTuple<>> && tt::IsEmpty<VaTuple<Tag, VaTuple<>>>);
+static_assert(sizeof(VaTuple<Tag>) == 1);
+
+// A repeated type resolves to its first occurrence
+static_assert(VaTuple<int, Tag, int>(1, Tag(), 2).get<int>() == 1);
@@ -6,13 +6,32 @@
 
 #include <VaLib/Meta/BasicDefine.hpp>
 
+#include <VaLib/Mem/UniquePtr.hpp>
 #include <VaLib/Types/Any.hpp>
 #include <VaLib/Types/List.hpp>
 #include <VaLib/Types/String.hpp>
 
 #include <any>
+#include <type_traits>
 
-bool testAny(testing::Test& t) {
+static_assert(va::typeId<int>() == va::typeId<const int&>(), "typeId() must ignore cv-qualifiers and references");
+static_assert(VaAny::isStoredInline<VaString> && VaAny::isStoredInline<VaList<int>>);
+static_assert(!VaBasicAny<8>::isStoredInline<VaString>);
+static_assert(std::is_copy_constructible_v<VaAny> && !std::is_copy_constructible_v<VaUniqueAny>);
+static_assert(std::is_nothrow_move_constructible_v<VaAny> && std::is_nothrow_move_constructible_v<VaUniqueAny>);
+
+struct Tracked {
+    static inline int alive = 0;
+
+    long payload[8]; // 64 bytes: heap-allocated with the default inline size
+
+    Tracked() { alive++; }
+    Tracked(const Tracked&) { alive++; }
+    Tracked(Tracked&&) noexcept { alive++; }
+    ~Tracked() { alive--; }
+};
+
+bool testAnyBasics(testing::Test& t) {
     VaAny any = int(123);
     if (any.get<int>() != 123) {
         return t.fail("unexpected result");
@@ -28,7 +47,96 @@ bool testAny(testing::Test& t) {
         return t.fail("expected an exception");
     })
 
+    if (!any.isType<VaString>() || any.isType<int>() || any.typeId() != va::typeId<VaString>() || any.typeId() == va::typeId<int>()) return t.fail("isType() failed");
+    if (any.tryGet<int>() != nullptr || any.tryGet<VaString>() == nullptr) return t.fail("tryGet() failed");
+    if (any.isOnHeap()) return t.fail("a VaString must be stored inline");
+
+    // Copying a non-const VaAny copies it, rather than storing a VaAny inside a VaAny
+    VaAny copy = any;
+    if (!copy.isType<VaString>() || copy.get<VaString>() != "Hello") return t.fail("copy from a non-const lvalue failed");
+
+    VaString& built = any.emplace<VaString>(3, 'x');
+    if (&built != any.tryGet<VaString>() || built != "xxx") return t.fail("emplace() failed");
+    any.emplace(2.5);
+    if (any.get<float64>() != 2.5) return t.fail("emplace() with a deduced type failed");
+
+    any.reset();
+    if (any.hasValue() || any.typeId() != va::typeId<void>() || any.unsafePtr() != nullptr) return t.fail("reset() failed");
+
+#ifdef VA_ANY_HAS_RTTI
+    if (copy.currentType() != typeid(VaString)) return t.fail("currentType() failed");
+#endif
+
+    return t.success();
+}
+
+bool testAnyStorage(testing::Test& t) {
+    {
+        VaAny heap = Tracked();
+        if (!heap.isOnHeap() || Tracked::alive != 1) return t.fail("a large value must be heap-allocated");
+
+        VaAny copy = heap;
+        if (Tracked::alive != 2 || copy.unsafePtr() == heap.unsafePtr()) return t.fail("copy shared the heap value");
+
+        void* address = copy.unsafePtr();
+        VaAny moved = std::move(copy);
+        if (copy.hasValue() || moved.unsafePtr() != address || Tracked::alive != 2) return t.fail("move did not take the allocation over");
+
+        VaBasicAny<128> wide = Tracked();
+        if (wide.isOnHeap() || Tracked::alive != 3) return t.fail("a larger inline size must store the value inline");
+
+        VaBasicAny<128> wideMoved = std::move(wide);
+        if (wide.hasValue() || !wideMoved.isType<Tracked>() || Tracked::alive != 3) return t.fail("move of an inline value failed");
+
+        heap = VaString("replaced");
+        if (Tracked::alive != 2) return t.fail("assignment did not destroy the old value");
+
+        heap.swap(moved);
+        if (!heap.isType<Tracked>() || moved.get<VaString>() != "replaced") return t.fail("swap() failed");
+    }
+    if (Tracked::alive != 0) return t.fail("a value was leaked");
+
+    VaList<VaAny> mixed;
+    for (int i = 0; i < 100; i++) {
+        if (i % 2) {
+            mixed.append(VaAny(VaString("item")));
+        } else {
+            mixed.append(VaAny(i));
+        }
+    }
+    VaList<VaAny> mixedCopy = mixed;
+    for (Size i = 0; i < len(mixedCopy); i++) {
+        if (i % 2 ? mixedCopy[i].get<VaString>() != "item" : mixedCopy[i].get<int>() != int(i)) return t.fail("VaList<VaAny> failed");
+    }
+
+    return t.success();
+}
+
+bool testUniqueAny(testing::Test& t) {
+    VaUniqueAny owner = VaUniquePtr<int>(new int(7));
+    if (!owner.isType<VaUniquePtr<int>>() || *owner.get<VaUniquePtr<int>>() != 7) return t.fail("VaUniqueAny failed");
+
+    VaUniqueAny moved = std::move(owner);
+    if (owner.hasValue() || *moved.get<VaUniquePtr<int>>() != 7) return t.fail("move of a VaUniqueAny failed");
+
+    VaList<VaUniqueAny> list;
+    for (int i = 0; i < 50; i++) list.append(VaUniqueAny(VaUniquePtr<int>(new int(i))));
+    for (int i = 0; i < 50; i++) {
+        if (*list[Size(i)].get<VaUniquePtr<int>>() != i) return t.fail("VaList<VaUniqueAny> failed");
+    }
+
+    moved = 5; // Copyable values are accepted as well
+    if (moved.get<int>() != 5) return t.fail("VaUniqueAny assignment failed");
+
+    return t.success();
+}
+
+bool testAny(testing::Test& t) {
+    if (!t.helper(testAnyBasics)) return false;
+    if (!t.helper(testAnyStorage)) return false;
+    if (!t.helper(testUniqueAny)) return false;
+
     return t.success();
 }
 
-int main() { testing::run(testAny); }
+int main() { return testing::run(testAny); }
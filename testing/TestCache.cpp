@@ -0,0 +1,332 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Types/ConcurrentCache.hpp>
+#include <VaLib/Types/LfuCache.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/LruCache.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+bool testLruCacheOrder(testing::Test& t) {
+    VaLruCache<int, VaString> cache(3);
+    VaList<int> evicted;
+    cache.setEvictionCallback([&evicted](const int& key, VaString&) { evicted.append(key); });
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    if (cache.get(1) == nullptr || *cache.get(1) != "one") return t.fail("get() failed");
+
+    cache.put(4, "four"); // 2 is the least recently used
+    if (cache.contains(2) || !cache.contains(1) || len(cache) != 3) return t.fail("the least recently used entry was not evicted");
+    if (len(evicted) != 1 || evicted[0] != 2) return t.fail("eviction callback not called with the victim");
+
+    // peek() does not promote: 3 stays the least recently used
+    if (cache.peek(3) == nullptr || *cache.peek(3) != "three") return t.fail("peek() failed");
+    if (cache.leastRecentKey() != 3) return t.fail("peek() changed the recency");
+    cache.put(5, "five");
+    if (cache.contains(3) || evicted[1] != 3) return t.fail("peek() promoted the entry");
+
+    // Replacing promotes as well
+    cache.put(1, "uno");
+    cache.put(6, "six");
+    if (!cache.contains(1) || cache.contains(4) || *cache.peek(1) != "uno") return t.fail("put() of an existing key failed");
+
+    VaCacheStats stats = cache.getStats();
+    if (stats.hits != 2 || stats.misses != 0 || stats.evictions != 3) return t.fail("wrong statistics");
+    if (cache.get(42) != nullptr || cache.getStats().misses != 1) return t.fail("miss not counted");
+
+    int computed = 0;
+    auto make = [&computed](const int& key) {
+        computed++;
+        return VaString("computed ") + char('0' + key);
+    };
+    if (cache.getOrCompute(7, make) != "computed 7" || cache.getOrCompute(7, make) != "computed 7" || computed != 1) {
+        return t.fail("getOrCompute() failed");
+    }
+
+    if (!cache.del(7) || cache.del(7) || cache.contains(7)) return t.fail("del() failed");
+    if (len(evicted) != 4) return t.fail("del() called the eviction callback");
+
+    cache.setCapacity(1);
+    if (len(cache) != 1) return t.fail("setCapacity() did not evict");
+
+    cache.clear();
+    if (!cache.isEmpty() || cache.getBytes() != 0) return t.fail("clear() failed");
+
+    return t.success();
+}
+
+bool testLruCacheBytes(testing::Test& t) {
+    // Limited by the total length of the values only
+    VaLruCache<int, VaString> cache(0, 10, [](const int&, const VaString& value) { return len(value); });
+
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    if (cache.getBytes() != 8) return t.fail("wrong byte count");
+
+    cache.put(3, "cccc"); // 12 bytes: evicts 1
+    if (cache.contains(1) || cache.getBytes() != 8) return t.fail("byte limit not enforced");
+
+    cache.put(2, "bbbbbbbbb"); // Grows 2 to 9 bytes: evicts 3, never 2 itself
+    if (cache.contains(3) || !cache.contains(2) || cache.getBytes() != 9) return t.fail("growing an entry failed");
+
+    if (cache.put(4, "this value is too long")) return t.fail("an entry over the byte limit was stored");
+    if (cache.put(2, "this value is too long") || cache.contains(2) || cache.getBytes() != 0) {
+        return t.fail("replacing with an entry over the byte limit failed");
+    }
+
+    // Both limits, with the default cost
+    VaLruCache<int, int> both(100, 3 * va::detail::cacheDefaultCost<int, int>);
+    for (int i = 0; i < 10; i++) both.put(i, i);
+    if (len(both) != 3 || both.getBytes() != 3 * va::detail::cacheDefaultCost<int, int>) return t.fail("default cost failed");
+
+    return t.success();
+}
+
+bool testLfuCacheOrder(testing::Test& t) {
+    VaLfuCache<int, int> cache(3);
+    VaList<int> evicted;
+    cache.setEvictionCallback([&evicted](const int& key, int&) { evicted.append(key); });
+
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cache.get(1);
+    cache.get(1);
+    cache.get(3);
+    if (cache.getFrequency(1) != 3 || cache.getFrequency(2) != 1 || cache.getFrequency(3) != 2) return t.fail("wrong use counts");
+
+    cache.put(4, 40); // 2 is the least frequently used
+    if (cache.contains(2) || len(evicted) != 1 || evicted[0] != 2) return t.fail("the least frequently used entry was not evicted");
+
+    // Ties are broken by recency: 4 (one use) goes before 3 (two uses) and 5 is new
+    cache.put(5, 50);
+    if (cache.contains(4) || !cache.contains(3)) return t.fail("wrong eviction on a tie");
+
+    cache.get(5);
+    cache.get(3); // 3 now has 3 uses, 5 has 2
+    if (cache.leastFrequentKey() != 5) return t.fail("leastFrequentKey() failed");
+
+    // peek() does not count a use
+    if (cache.peek(5) == nullptr || *cache.peek(5) != 50 || cache.getFrequency(5) != 2) return t.fail("peek() counted a use");
+
+    VaCacheStats stats = cache.getStats();
+    if (stats.hits != 5 || stats.evictions != 2) return t.fail("wrong statistics");
+
+    if (!cache.del(5) || cache.contains(5) || len(cache) != 2) return t.fail("del() failed");
+    if (len(evicted) != 2) return t.fail("del() called the eviction callback");
+
+    cache.setCapacity(1);
+    if (len(cache) != 1 || !cache.contains(3)) return t.fail("setCapacity() evicted the wrong entry"); // 1 and 3 tie, 3 was used last
+
+    cache.clear();
+    if (!cache.isEmpty() || cache.getBytes() != 0 || cache.get(3) != nullptr) return t.fail("clear() failed");
+
+    return t.success();
+}
+
+bool testLfuCacheRandom(testing::Test& t) {
+    // Against a naive model: evict the lowest count, oldest use first
+    struct Model {
+        int key, value;
+        Size uses, lastUse;
+    };
+
+    constexpr Size capacity = 16;
+    VaLfuCache<int, int> cache(capacity);
+    VaList<Model> model;
+    std::mt19937 rng(7);
+
+    for (Size step = 1; step <= 20000; step++) {
+        int key = int(rng() % 40);
+        Model* entry = nullptr;
+        for (Model& m: model) {
+            if (m.key == key) entry = &m;
+        }
+
+        if (rng() % 2) {
+            int* value = cache.get(key);
+            if ((value == nullptr) != (entry == nullptr)) return t.fail("get() disagrees with the model");
+            if (entry) {
+                if (*value != entry->value) return t.fail("wrong value");
+                entry->uses++;
+                entry->lastUse = step;
+            }
+        } else {
+            int value = int(rng());
+            cache.put(key, value);
+            if (entry) {
+                entry->value = value;
+                entry->uses++;
+                entry->lastUse = step;
+            } else {
+                if (len(model) == capacity) {
+                    Size victim = 0;
+                    for (Size i = 1; i < len(model); i++) {
+                        const Model& m = model[i];
+                        const Model& v = model[victim];
+                        if (m.uses < v.uses || (m.uses == v.uses && m.lastUse < v.lastUse)) victim = i;
+                    }
+                    model.del(victim);
+                }
+                model.append(Model{key, value, 1, step});
+            }
+        }
+
+        if (len(cache) != len(model)) return t.fail("size disagrees with the model");
+    }
+
+    for (const Model& m: model) {
+        if (cache.getFrequency(m.key) != m.uses) return t.fail("use count disagrees with the model");
+    }
+
+    return t.success();
+}
+
+bool testLfuCacheBytes(testing::Test& t) {
+    VaLfuCache<int, VaString> cache(0, 10, [](const int&, const VaString& value) { return len(value); });
+
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    cache.get(1);
+    cache.put(3, "cccc"); // Evicts 2, the least used
+    if (cache.contains(2) || !cache.contains(1) || cache.getBytes() != 8) return t.fail("byte limit not enforced");
+
+    cache.put(3, "ccccccccc"); // 3 grows to 9 bytes: evicts 1 although 1 is used more
+    if (cache.contains(1) || !cache.contains(3) || cache.getBytes() != 9) return t.fail("growing an entry failed");
+
+    if (cache.put(4, "this value is too long") || cache.contains(4)) return t.fail("an entry over the byte limit was stored");
+
+    return t.success();
+}
+
+template <typename Cache>
+bool checkConcurrentCache(testing::Test& t) {
+    constexpr Size threadCount = 4;
+    constexpr int keyCount = 2000;
+
+    Cache cache(1024, 0, nullptr, 8);
+    if (cache.getShardCount() != 8) return t.fail("wrong shard count");
+
+    std::atomic<Size> evicted{0};
+    cache.setEvictionCallback([&evicted](const int&, long&) { evicted.fetch_add(1, std::memory_order_relaxed); });
+
+    std::atomic<bool> wrong{false};
+    VaList<std::thread> threads;
+    for (Size i = 0; i < threadCount; i++) {
+        threads.append(std::thread([&cache, &wrong, i]() {
+            std::mt19937 rng{unsigned(i)};
+            for (int step = 0; step < 20000; step++) {
+                int key = int(rng() % keyCount);
+                long value = 0;
+                switch (rng() % 4) {
+                case 0:
+                    cache.put(key, long(key) * 3);
+                    break;
+                case 1:
+                    if (cache.get(key, value) && value != long(key) * 3) wrong.store(true);
+                    break;
+                case 2:
+                    if (cache.getOrCompute(key, [](const int& k) { return long(k) * 3; }) != long(key) * 3) wrong.store(true);
+                    break;
+                default:
+                    if (rng() % 8 == 0) cache.del(key);
+                    break;
+                }
+            }
+        }));
+    }
+    for (std::thread& thread: threads) thread.join();
+
+    if (wrong.load()) return t.fail("wrong value from a concurrent cache");
+    if (cache.getSize() > 1024) return t.fail("capacity exceeded");
+    if (cache.getStats().evictions != evicted.load()) return t.fail("evictions and callbacks disagree");
+
+    long value = 0;
+    cache.put(1, 3);
+    if (!cache.peek(1, value) || value != 3 || !cache.contains(1)) return t.fail("peek() failed");
+
+    cache.clear();
+    if (cache.getSize() != 0 || cache.getBytes() != 0) return t.fail("clear() failed");
+
+    // The limits are totals, even when they do not divide evenly between the shards
+    Cache single(1);
+    for (int key = 0; key < 100; key++) single.put(key, key);
+    if (single.getShardCount() != 1 || single.getSize() != 1) return t.fail("an entry limit of 1 must keep exactly one entry");
+
+    Cache uneven(10, 0, nullptr, 4);
+    for (int key = 0; key < 1000; key++) uneven.put(key, key);
+    if (uneven.getShardCount() != 4 || uneven.getSize() > 10) return t.failf("entry limit 10 exceeded: %d entries", int(uneven.getSize()));
+
+    Cache fewBytes(0, 3, [](const int&, const long&) { return Size(1); });
+    for (int key = 0; key < 100; key++) fewBytes.put(key, key);
+    if (fewBytes.getShardCount() != 2 || fewBytes.getBytes() > 3) return t.fail("the byte limit must hold across the shards");
+
+    // Without a weigher, every shard must have room for at least one entry of the default cost
+    constexpr Size cost = sizeof(int) + sizeof(long);
+    Cache tight(0, cost + 1);
+    if (tight.getShardCount() != 1 || !tight.put(1, 1) || !tight.contains(1)) return t.fail("a byte limit of one entry must keep one entry");
+
+    Cache small(0, 100);
+    bool stored = true;
+    for (int key = 0; key < 1000; key++) stored = small.put(key, key) && stored;
+    if (!stored || small.getShardCount() != 100 / cost || small.getBytes() > 100) return t.fail("a shard was too small for an entry of the default cost");
+
+    return t.success();
+}
+
+// A shard cache whose third construction fails
+struct FailingCache: VaLruCache<int, long> {
+    static inline int built = 0;
+    static inline int alive = 0;
+
+    FailingCache(Size maxEntries, Size maxBytes, const Weigher& weigher) : VaLruCache(maxEntries, maxBytes, weigher) {
+        if (++built == 3) throw ValueError(VaStaticMessage("shard construction failed"));
+        alive++;
+    }
+
+    ~FailingCache() { alive--; }
+};
+
+bool testShardConstructionFailure(testing::Test& t) {
+    bool thrown = false;
+    try {
+        VaShardedCache<FailingCache> cache(0, 0, nullptr, 8);
+    } catch (const ValueError&) {
+        thrown = true;
+    }
+
+    if (!thrown) return t.fail("the failure of a shard constructor must propagate");
+    if (FailingCache::alive != 0) return t.failf("%d shards were left alive after a failed construction", FailingCache::alive);
+
+    return t.success();
+}
+
+bool testConcurrentCache(testing::Test& t) {
+    if (!checkConcurrentCache<VaConcurrentLruCache<int, long>>(t)) return false;
+    if (!checkConcurrentCache<VaConcurrentLfuCache<int, long>>(t)) return false;
+    if (!t.helper(testShardConstructionFailure)) return false;
+
+    return t.success();
+}
+
+bool testCache(testing::Test& t) {
+    if (!t.helper(testLruCacheOrder)) return false;
+    if (!t.helper(testLruCacheBytes)) return false;
+    if (!t.helper(testLfuCacheOrder)) return false;
+    if (!t.helper(testLfuCacheRandom)) return false;
+    if (!t.helper(testLfuCacheBytes)) return false;
+    if (!t.helper(testConcurrentCache)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testCache); }
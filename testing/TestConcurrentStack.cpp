@@ -0,0 +1,194 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/ConcurrentStack.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+// Exposes whether the shared free list of a stack holds nodes flushed from thread caches
+struct InspectedStack: VaConcurrentStack<int> {
+    bool hasSharedFreeNodes() const { return !storage->freeNodes.isEmpty(); }
+};
+
+bool testConcurrentStackThreads(testing::Test& t) {
+    constexpr int threads = 8;
+    constexpr uint64 perThread = 100'000;
+
+    VaConcurrentStack<uint64> stack;
+    std::atomic<uint64> poppedSum(0);
+    std::atomic<uint64> poppedCount(0);
+
+    VaList<std::thread> workers;
+    for (int w = 0; w < threads; w++) {
+        workers.append(std::thread([&, w] {
+            uint64 sum = 0;
+            uint64 count = 0;
+            uint64 value;
+            for (uint64 i = 0; i < perThread; i++) {
+                stack.push(w * perThread + i);
+                // pop roughly every other push so nodes are constantly recycled between threads
+                if (i % 2 == 1 && stack.tryPop(value)) {
+                    sum += value;
+                    count++;
+                }
+            }
+            poppedSum += sum;
+            poppedCount += count;
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+
+    uint64 value;
+    uint64 sum = poppedSum.load();
+    uint64 count = poppedCount.load();
+    while (stack.tryPop(value)) {
+        sum += value;
+        count++;
+    }
+
+    uint64 total = threads * perThread;
+    if (count != total || sum != total * (total - 1) / 2) {
+        return t.fail("elements were lost or duplicated");
+    }
+    if (!stack.isEmpty() || len(stack) != 0) {
+        return t.fail("stack should be empty");
+    }
+
+    return t.success();
+}
+
+bool testConcurrentStackLifetime(testing::Test& t) {
+    // a thread keeps nodes of a destroyed stack in its cache, then moves on to another stack
+    auto* first = new VaConcurrentStack<VaString>();
+    VaConcurrentStack<VaString> second;
+
+    std::thread worker([&] {
+        for (int i = 0; i < 100; i++) first->push("first");
+        for (int i = 0; i < 100; i++) first->pop();
+    });
+    worker.join();
+
+    std::thread other([&] {
+        first->push("left in the stack");
+    });
+    other.join();
+    delete first;
+
+    std::thread mover([&] {
+        for (int i = 0; i < 10; i++) second.push("second");
+        for (int i = 0; i < 5; i++) second.pop();
+    });
+    mover.join();
+
+    if (len(second) != 5 || second.pop() != "second") {
+        return t.fail("second stack is broken");
+    }
+
+    return t.success();
+}
+
+bool testTaggedPtr(testing::Test& t) {
+    using Tagged = va::detail::TaggedPtr<int>;
+
+    int node;
+    auto word = Tagged::pack(&node, 0);
+    if (!Tagged::fits(&node) || Tagged::pointer(word) != &node) {
+        return t.fail("a heap or stack address must survive packing");
+    }
+
+    auto later = word;
+    for (int i = 0; i < 65'536; i++) later = Tagged::next(later, &node);
+    if (Tagged::pointer(later) != &node) return t.fail("the tag overflowed into the pointer");
+    if (Tagged::pointerBits == 64 && later == word) return t.fail("a 64-bit tag must not wrap after 65,536 modifications");
+
+    if (Tagged::pointerBits == 48) {
+        // top-byte tagging (TBI, MTE, PAC) or a 57-bit address
+        if (Tagged::fits(reinterpret_cast<void*>(std::uintptr_t(0x5A) << 56)) || Tagged::fits(reinterpret_cast<void*>(std::uintptr_t(1) << 52))) {
+            return t.fail("an address above 48 bits must not fit");
+        }
+    }
+
+    return t.success();
+}
+
+bool testConcurrentStackThreadCaches(testing::Test& t) {
+    InspectedStack stacks[5];
+    bool keptWhileAlternating = true;
+    bool flushedOnFifth = false;
+
+    // a fresh thread, so that its caches start empty
+    std::thread worker([&] {
+        for (int round = 0; round < 100; round++) {
+            for (int i = 0; i < 2; i++) {
+                stacks[i].push(round);
+                stacks[i].pop();
+            }
+        }
+        keptWhileAlternating = !stacks[0].hasSharedFreeNodes() && !stacks[1].hasSharedFreeNodes();
+
+        for (int i = 2; i < 5; i++) stacks[i].push(i);
+        flushedOnFifth = stacks[0].hasSharedFreeNodes();
+    });
+    worker.join();
+
+    if (!keptWhileAlternating) return t.fail("alternating between two stacks flushed their thread caches");
+    if (!flushedOnFifth) return t.fail("binding a fifth stack must flush the cache of the first");
+    if (len(stacks[4]) != 1 || stacks[4].pop() != 4) return t.fail("the fifth stack is broken");
+
+    return t.success();
+}
+
+bool testConcurrentStack(testing::Test& t) {
+    VaConcurrentStack<VaString> stack;
+    if (!stack.isEmpty()) {
+        return t.fail("should be empty initially");
+    }
+
+    stack.push("a");
+    stack.push(VaString("b"));
+    stack.emplace("c");
+    if (len(stack) != 3 || stack.pop() != "c") {
+        return t.fail("push()/pop() failed");
+    }
+
+    VaString out;
+    if (!stack.tryPop(out) || out != "b" || !stack.tryPop(out) || out != "a") {
+        return t.fail("tryPop() failed");
+    }
+    if (stack.tryPop(out) || !stack.isEmpty()) {
+        return t.fail("tryPop() on an empty stack should fail");
+    }
+
+    try {
+        stack.pop();
+        return t.fail("pop() on an empty stack should throw");
+    } catch (const IndexOutOfRangeError&) {
+        // the same error as VaStack and VaStaticStack
+    } catch (...) {
+        return t.fail("pop() on an empty stack should throw IndexOutOfRangeError");
+    }
+
+    // many more elements than fit in one chunk
+    for (int i = 0; i < 10'000; i++) stack.push("x");
+    for (int i = 0; i < 5'000; i++) stack.pop();
+    if (len(stack) != 5'000) {
+        return t.fail("wrong length after many pushes");
+    }
+
+    if (!t.helper(testConcurrentStackThreads)) return false;
+    if (!t.helper(testConcurrentStackLifetime)) return false;
+    if (!t.helper(testTaggedPtr)) return false;
+    if (!t.helper(testConcurrentStackThreadCaches)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testConcurrentStack); }
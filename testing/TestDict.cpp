@@ -8,6 +8,11 @@
 #include <VaLib/Types.hpp>
 #include <VaLib/Utils.hpp>
 
+// Hashes integers by their last digit only, so that it can be told apart from VaHash<int>
+struct LastDigitHash {
+    Size operator()(int key) const { return Size(key % 10); }
+};
+
 bool testDict(testing::Test& t) {
     VaDict<VaString, int> dict;
 
@@ -170,6 +175,59 @@ bool testDict(testing::Test& t) {
 
     dict3.del(123);
 
+    // test find() and reordering
+    if (dict3.find(20) == nullptr || *dict3.find(20) != "World" || dict3.find(99) != nullptr) {
+        return t.fail("find() failed");
+    }
+    *dict3.find(20) = "Earth";
+    if (dict3.at(20) != "Earth") {
+        return t.fail("find() does not point into the dict");
+    }
+    dict3.at(20) = "World";
+
+    if (!dict3.moveToBack(20) || dict3.keyAtBack() != 20) {
+        return t.fail("moveToBack() failed");
+    }
+    if (!dict3.moveToFront(20) || dict3.keyAtFront() != 20 || dict3.keyAtBack() == 20) {
+        return t.fail("moveToFront() failed");
+    }
+    if (dict3.moveToBack(99) || dict3.getSize() != 3) {
+        return t.fail("moveToBack() of a missing key failed");
+    }
+
+    // test the functional helpers with lambdas
+    auto sizes = va::mapValues([](const VaString& s) { return len(s); }, dict3);
+    if (sizes.at(10) != 7 || sizes.at(30) != 1) {
+        return t.fail("mapValues() with a lambda failed");
+    }
+
+    auto small = va::filterByKey([](const int& k) { return k < 25; }, dict3);
+    if (small.getSize() != 2 || !small.contains(10) || small.contains(30)) {
+        return t.fail("filterByKey() with a lambda failed");
+    }
+
+    auto shifted = va::mapKeys([](const int& k) { return k + 1; }, dict3);
+    auto shortValues = va::filterByValue([](const VaString& v) { return len(v) < 6; }, dict3);
+    if (shifted.at(11) != "Goodbye" || shortValues.getSize() != 2) {
+        return t.fail("mapKeys()/filterByValue() with a lambda failed");
+    }
+
+    // the helpers keep a custom hash function as long as the key type does not change
+    VaDict<int, VaString, LastDigitHash> custom = {{1, "one"}, {12, "twelve"}};
+    auto customSizes = va::mapValues([](const VaString& s) { return len(s); }, custom);
+    auto customKeys = va::filterByKey([](const int& k) { return k > 5; }, custom);
+    auto customValues = va::filterByValue([](const VaString& v) { return len(v) > 3; }, custom);
+    auto customShifted = va::mapKeys([](const int& k) { return k + 1; }, custom);
+    auto customNames = va::mapKeys([](const int& k) { return va::toString(k); }, custom);
+    static_assert(tt::IsSame<decltype(customSizes), VaDict<int, Size, LastDigitHash>>);
+    static_assert(tt::IsSame<decltype(customKeys), VaDict<int, VaString, LastDigitHash>>);
+    static_assert(tt::IsSame<decltype(customValues), VaDict<int, VaString, LastDigitHash>>);
+    static_assert(tt::IsSame<decltype(customShifted), VaDict<int, VaString, LastDigitHash>>);
+    static_assert(tt::IsSame<decltype(customNames), VaDict<VaString, VaString, VaHash<VaString>>>);
+    if (customSizes.at(12) != 6 || len(customKeys) != 1 || len(customValues) != 1 || customShifted.at(13) != "twelve" || customNames.at("1") != "one") {
+        return t.fail("the functional helpers failed with a custom hash function");
+    }
+
     return t.success();
 }
 
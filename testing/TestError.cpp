@@ -7,7 +7,23 @@
 #include <VaLib/Types/Error.hpp>
 #include <VaLib/Types/String.hpp>
 
-bool testError(testing::Test& t) {
+static_assert(tt::IsNoexceptMoveConstructible<ValueError>, "errors must be nothrow movable to be stored inline");
+static_assert(sizeof(VaResult<int, int>) <= 4 * sizeof(void*), "a small error type must keep VaResult small");
+
+enum class ParseErrc { empty = 1, badDigit };
+
+struct DetailedError: ValueError { // Larger than VaBaseError: heap-allocated
+    static inline int alive = 0;
+    Size position;
+
+    explicit DetailedError(Size position) : ValueError(VaStaticMessage("detailed"), 7), position(position) { alive++; }
+    DetailedError(const DetailedError& other) : ValueError(other), position(other.position) { alive++; }
+    ~DetailedError() override { alive--; }
+
+    virtual void throwIt() const override { throw *this; }
+};
+
+bool testResultBasics(testing::Test& t) {
     VaResult<int> r = new ValueError("Kaboom");
 
     expect({
@@ -42,4 +58,135 @@ bool testError(testing::Test& t) {
     return t.success();
 }
 
+bool testErrorPayloads(testing::Test& t) {
+    ValueError plain(VaStaticMessage("static message"), 42);
+    if (plain.what() != "static message" || plain.getCode() != 42) return t.fail("static message or code lost");
+
+    ValueError copy = plain;
+    if (copy.what() != "static message" || copy.getCode() != 42) return t.fail("copy lost the static message");
+
+    if (KeyNotFoundError().what() != "key not found" || KeyNotFoundError("custom").what() != "custom") return t.fail("default messages changed");
+    if (ValueError("dynamic").getCode() != 0) return t.fail("code must default to 0");
+
+    return t.success();
+}
+
+bool testResultStorage(testing::Test& t) {
+    VaResult<int> inlined = ValueError(VaStaticMessage("bad digit"), 3);
+    if (!inlined.isErr() || !inlined.isErrInline()) return t.fail("a ValueError must be stored inline");
+    if (inlined.unwrapErr()->getCode() != 3 || inlined.unwrapErr()->what() != "bad digit") return t.fail("the inline error was damaged");
+
+    // The dynamic type survives copies and moves of an inline error
+    VaResult<int> copied = inlined;
+    VaResult<int> moved = std::move(copied);
+    try {
+        moved.throwErr();
+        return t.fail("expected exception");
+    } catch (ValueError& err) {
+        if (err.getCode() != 3) return t.fail("a moved error lost its payload");
+    }
+
+    VaResult<int> legacy = new ValueError("heap");
+    if (legacy.isErrInline() || legacy.unwrapErr()->what() != "heap") return t.fail("an adopted pointer must stay on the heap");
+
+    {
+        VaResult<int> heap = DetailedError(5);
+        if (heap.isErrInline() || DetailedError::alive != 1) return t.fail("a larger error must be heap-allocated");
+
+        VaResult<int> heapCopy = heap;
+        if (DetailedError::alive != 2) return t.fail("copy did not deep-copy the heap error");
+
+        const VaBaseError* address = heap.unwrapErr();
+        VaResult<int> heapMoved = std::move(heap);
+        if (heapMoved.unwrapErr() != address || DetailedError::alive != 2) return t.fail("move did not take the allocation over");
+
+        try {
+            heapCopy.throwErr();
+            return t.fail("expected exception");
+        } catch (DetailedError& err) {
+            if (err.position != 5 || err.getCode() != 7) return t.fail("the heap error was sliced");
+        }
+
+        heapMoved = 10;
+        if (DetailedError::alive != 1) return t.fail("assignment did not destroy the error");
+    }
+    if (DetailedError::alive != 0) return t.fail("an error was leaked");
+
+    VaResult<int, ParseErrc> coded = ParseErrc::badDigit;
+    if (!coded.isErrInline() || *coded.unwrapErr() != ParseErrc::badDigit) return t.fail("an enum error failed");
+
+    VaResult<void> failed = ValueError(VaStaticMessage("void"));
+    VaResult<void> failedCopy = failed;
+    if (!failedCopy.isErrInline() || failedCopy.unwrapErr()->what() != "void") return t.fail("VaResult<void> storage failed");
+
+    return t.success();
+}
+
+static VaResult<int, ParseErrc> parseDigit(char c) {
+    if (c < '0' || c > '9') return ParseErrc::badDigit;
+    return c - '0';
+}
+
+bool testResultCombinators(testing::Test& t) {
+    VaResult<int, ParseErrc> doubled = parseDigit('4').map([](int x) { return x * 2; });
+    if (doubled.unwrap() != 8) return t.fail("map() failed");
+
+    VaResult<VaString, ParseErrc> text = parseDigit('x').map([](int) { return VaString("unreachable"); });
+    if (!text.isErr() || *text.unwrapErr() != ParseErrc::badDigit) return t.fail("map() did not keep the error");
+
+    auto positive = [](int x) -> VaResult<int, ParseErrc> {
+        if (x == 0) return ParseErrc::empty;
+        return x;
+    };
+    if (parseDigit('7').andThen(positive).unwrap() != 7) return t.fail("andThen() failed");
+    if (*parseDigit('0').andThen(positive).unwrapErr() != ParseErrc::empty) return t.fail("andThen() did not return fn's error");
+    if (*parseDigit('?').andThen(positive).unwrapErr() != ParseErrc::badDigit) return t.fail("andThen() did not keep the error");
+
+    auto recover = [](ParseErrc) -> VaResult<int, ParseErrc> { return -1; };
+    if (parseDigit('?').orElse(recover).unwrap() != -1 || parseDigit('3').orElse(recover).unwrap() != 3) return t.fail("orElse() failed");
+
+    // Chaining on rvalues moves the heap error along instead of copying it
+    {
+        VaResult<int> source = DetailedError(9);
+        const VaBaseError* address = source.unwrapErr();
+
+        VaResult<VaString> chained = std::move(source)
+                                         .map([](int x) { return x + 1; })
+                                         .andThen([](int x) -> VaResult<VaString> { return VaString(x, 'x'); });
+        if (chained.unwrapErr() != address || DetailedError::alive != 1) return t.fail("a chain on rvalues copied the error");
+
+        const VaResult<int> constSource = DetailedError(1);
+        VaResult<int> mapped = constSource.map([](int x) { return x; });
+        if (mapped.unwrapErr() == constSource.unwrapErr() || DetailedError::alive != 3) return t.fail("map() on a const result must copy the error");
+
+        VaResult<VaString> moved = VaResult<VaString>(VaString("value")).map([](VaString&& s) { return std::move(s) + "!"; });
+        if (moved.unwrap() != "value!") return t.fail("map() on an rvalue failed");
+    }
+    if (DetailedError::alive != 0) return t.fail("an error was leaked");
+
+    VaResult<void> done;
+    int calls = 0;
+    VaResult<int> fromVoid = done.map([&calls] { return ++calls; });
+    VaResult<void> chainedVoid = fromVoid.map([&calls](int) { calls++; });
+    if (fromVoid.unwrap() != 1 || !chainedVoid.isOk() || calls != 2) return t.fail("map() with void failed");
+
+    VaResult<void> failed = ValueError(VaStaticMessage("failed"));
+    VaResult<void> recovered = failed.orElse([](const VaBaseError& err) -> VaResult<void> {
+        if (err.what() == "failed") return {};
+        return ValueError("other");
+    });
+    if (!recovered.isOk() || !failed.andThen([] { return VaResult<void>(); }).isErr()) return t.fail("VaResult<void> combinators failed");
+
+    return t.success();
+}
+
+bool testError(testing::Test& t) {
+    if (!t.helper(testResultBasics)) return false;
+    if (!t.helper(testErrorPayloads)) return false;
+    if (!t.helper(testResultStorage)) return false;
+    if (!t.helper(testResultCombinators)) return false;
+
+    return t.success();
+}
+
 int main() { return testing::run(testError); }
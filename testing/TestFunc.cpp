@@ -4,6 +4,7 @@
 
 #include <lib/testing.hpp>
 
+#include <VaLib/Mem/UniquePtr.hpp>
 #include <VaLib/Types/String.hpp>
 
 #include <VaLib/FuncTools.hpp>
@@ -88,6 +89,129 @@ bool testPartial(testing::Test& t) {
     bool testTypeWrapper(testing::Test& t) { return t.success(); }
 #endif
 
+// Counts live instances, to check that stored callables are destroyed exactly once.
+struct Counted {
+    static inline int alive = 0;
+    int value;
+    byte padding[200]; // Too large for the inline storage
+
+    Counted(int value) : value(value) { alive++; }
+    Counted(const Counted& other) noexcept : value(other.value) { alive++; }
+    ~Counted() { alive--; }
+
+    int operator()(int x) const { return value + x; }
+};
+
+bool testFuncStorage(testing::Test& t) {
+    VaFunc<int(int)> empty;
+    if (empty != nullptr || bool(empty)) return t.fail("Default-constructed VaFunc should be empty");
+    expect({
+        empty(1);
+        return t.fail("Calling an empty VaFunc should throw");
+    })
+
+    int (*nullPointer)(int) = nullptr;
+    VaFunc<int(int)> fromNull = nullPointer;
+    if (fromNull != nullptr) return t.fail("VaFunc from a null function pointer should be empty");
+
+    int offset = 10;
+    auto addOffset = [offset](int x) { return x + offset; };
+    if (!VaFunc<int(int)>::storesInline<decltype(addOffset)>()) return t.fail("A small lambda should be stored inline");
+    VaFunc<int(int)> small = addOffset;
+
+    VaFunc<int(int)> copy = small;
+    VaFunc<int(int)> moved = std::move(small);
+    if (copy(1) != 11 || moved(2) != 12) return t.fail("Copied or moved VaFunc returned a wrong result");
+    if (small != nullptr) return t.fail("A moved-from VaFunc should be empty");
+
+    {
+        if (VaFunc<int(int)>::storesInline<Counted>()) return t.fail("A 200-byte callable should not be stored inline");
+        if (!VaFunc<int(int), 256>::storesInline<Counted>()) return t.fail("VaFunc<Sig, 256> should store a 200-byte callable inline");
+
+        VaFunc<int(int)> heap = Counted(5);
+        VaFunc<int(int), 256> inlined = Counted(6);
+        VaFunc<int(int)> heapCopy = heap;
+        VaFunc<int(int), 256> inlinedMoved = std::move(inlined);
+        if (Counted::alive != 3) return t.fail("Unexpected number of live callables");
+        if (heap(1) != 6 || heapCopy(2) != 7 || inlinedMoved(3) != 9) return t.fail("Large callables returned a wrong result");
+
+        heap.swap(small);
+        if (heap != nullptr || small(1) != 6) return t.fail("swap() failed");
+
+        heapCopy = copy;
+        if (Counted::alive != 2 || heapCopy(0) != 10) return t.fail("Assignment did not destroy the old callable");
+
+        small.reset();
+        if (Counted::alive != 1) return t.fail("reset() did not destroy the callable");
+    }
+    if (Counted::alive != 0) return t.fail("Destroyed VaFunc leaked its callable");
+
+    if (sizeof(VaFunc<void()>) != 6 * sizeof(void*) + 2 * sizeof(void*)) return t.fail("VaFunc should be its inline storage plus two pointers");
+
+    return t.success();
+}
+
+bool testUniqueFunc(testing::Test& t) {
+    VaUniquePtr<int> owned = new int(42);
+    VaUniqueFunc<int()> fn = [p = std::move(owned)]() { return *p; };
+    if (fn() != 42) return t.fail("VaUniqueFunc returned a wrong result");
+
+    VaUniqueFunc<int()> moved = std::move(fn);
+    if (fn != nullptr || moved() != 42) return t.fail("Moving a VaUniqueFunc failed");
+
+    VaUniqueFunc<int(int), 16> mutating = [count = 0](int step) mutable { return count += step; };
+    mutating(1);
+    if (mutating(2) != 3) return t.fail("A mutable callable should keep its state between calls");
+
+    static_assert(!std::is_copy_constructible_v<VaUniqueFunc<int()>>);
+    static_assert(std::is_copy_constructible_v<VaFunc<int()>>);
+    static_assert(std::is_nothrow_move_constructible_v<VaFunc<int()>>);
+
+    return t.success();
+}
+
+static int applyTwice(VaFuncRef<int(int)> fn, int x) { return fn(fn(x)); }
+
+bool testFuncRef(testing::Test& t) {
+    static_assert(std::is_trivially_copyable_v<VaFuncRef<int(int)>>);
+    static_assert(sizeof(VaFuncRef<int(int)>) == 2 * sizeof(void*));
+
+    // Only callables matching the signature bind
+    static_assert(std::is_constructible_v<VaFuncRef<int(int, int)>, int (*)(int, int)>);
+    static_assert(!std::is_constructible_v<VaFuncRef<int(int)>, int (*)(int, int)>);
+    static_assert(!std::is_constructible_v<VaFuncRef<int(int)>, int (*)(int&)>);
+    static_assert(!std::is_constructible_v<VaFuncRef<int*(int)>, int (*)(int)>);
+
+    int calls = 0;
+    auto counting = [&calls](int x) { calls++; return x * 3; };
+    if (applyTwice(counting, 2) != 18 || calls != 2) return t.fail("VaFuncRef to a lambda failed");
+
+    // A reference to a mutable callable changes the original.
+    auto accumulate = [sum = 0](int x) mutable { return sum += x; };
+    VaFuncRef<int(int)> ref = accumulate;
+    ref(5);
+    if (accumulate(0) != 5) return t.fail("VaFuncRef should call the referenced object, not a copy");
+
+    if (applyTwice([](int x) { return x + 1; }, 0) != 2) return t.fail("VaFuncRef to a temporary lambda failed");
+    if (applyTwice(va::partial(add2, 10), 1) != 21) return t.fail("VaFuncRef to a VaPartial failed");
+
+    int (*pointer)(int&) = times2;
+    VaFuncRef<int(int&)> fromPointer = pointer;
+    pointer = nullptr; // The pointer is stored by value
+    int value = 21;
+    if (fromPointer(value) != 42) return t.fail("VaFuncRef to a function pointer failed");
+
+    VaFunc<int(int)> owning = [](int x) { return -x; };
+    VaFuncRef<int(int)> toFunc = owning;
+    VaFuncRef<int(int)> copy = toFunc;
+    if (copy(7) != -7) return t.fail("VaFuncRef to a VaFunc failed");
+
+    VaFuncRef<void()> noReturn = noReturnFunction;
+    noReturn();
+
+    return t.success();
+}
+
 bool testFunc(testing::Test& t) {
     VaFunc<int(int, int)> add = [](int a, int b) { return a + b; };
     if (add(2, 3) != 5) {
@@ -107,6 +231,9 @@ bool testFunc(testing::Test& t) {
     VaFunc<void()> fn3 = noReturnFunction;
     fn3();
 
+    if (!t.helper(testFuncStorage)) return false;
+    if (!t.helper(testUniqueFunc)) return false;
+    if (!t.helper(testFuncRef)) return false;
     if (!t.helper(testPartial)) return false;
     if (!t.helper(testTypeWrapper)) return false;
     return t.success();
@@ -0,0 +1,160 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Pair.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Types/Tuple.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <algorithm>
+#include <bit>
+
+struct Padded {
+    char tag;
+    int value;
+};
+
+static_assert(va::detail::IsBytewiseHashable<int> && va::detail::IsBytewiseHashable<uint8>);
+static_assert(!va::detail::IsBytewiseHashable<double> && !va::detail::IsBytewiseHashable<VaString>);
+static_assert(!va::detail::IsBytewiseHashable<Padded>, "padding bytes must not be hashed");
+static_assert(va::detail::IsHashable<VaPair<int, VaString>> && va::detail::IsHashable<VaList<VaList<int>>>);
+static_assert(va::detail::IsHashable<VaArray<double, 3>> && va::detail::IsHashable<VaSlice<const int>>);
+
+// Checks that no two hashes are equal, and that their low bits, which pick the bucket of a
+// VaDict, are spread over the buckets about as evenly as random values would be.
+static bool isWellSpread(VaList<Size>& hashes, Size bucketBits) {
+    VaList<Size> sorted = hashes;
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) return false;
+
+    const Size bucketCount = Size(1) << bucketBits;
+    VaList<Size> load = VaList<Size>::Filled(bucketCount, 0);
+    for (Size hash: hashes) load[hash & (bucketCount - 1)]++;
+
+    // For random hashes, the fullest bucket stays within a few standard deviations of the mean
+    const double mean = double(len(hashes)) / double(bucketCount);
+    const Size maxLoad = *std::max_element(load.begin(), load.end());
+    return double(maxLoad) < mean + 6 * __builtin_sqrt(mean) + 3;
+}
+
+bool testPairsAndTuples(testing::Test& t) {
+    VaList<Size> pairHashes, tupleHashes;
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            pairHashes.append(VaHash<VaPair<int, int>>{}(VaPair<int, int>(i, j)));
+            tupleHashes.append(VaHash<VaTuple<int, int, int>>{}(VaTuple<int, int, int>(i, j, i ^ j)));
+        }
+    }
+
+    if (!isWellSpread(pairHashes, 12)) return t.fail("the hashes of small integer pairs collide or cluster");
+    if (!isWellSpread(tupleHashes, 12)) return t.fail("the hashes of small integer tuples collide or cluster");
+
+    if (VaHash<VaPair<int, VaString>>{}({1, "a"}) != VaHash<VaTuple<int, VaString>>{}(VaTuple<int, VaString>(1, "a"))) {
+        return t.fail("a pair must hash the same as the tuple of its elements");
+    }
+
+    VaDict<VaPair<int, int>, int> grid;
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < 64; j++) grid.put({i, j}, i * 64 + j);
+    }
+    if (len(grid) != 64 * 64 || grid.at({3, 5}) != 3 * 64 + 5 || grid.at({5, 3}) != 5 * 64 + 3) {
+        return t.fail("a VaDict keyed by pairs failed");
+    }
+
+    VaDict<VaTuple<VaString, int>, int> named;
+    named.put(VaTuple<VaString, int>("x", 1), 1);
+    named.put(VaTuple<VaString, int>("x", 2), 2);
+    if (len(named) != 2 || named.at(VaTuple<VaString, int>("x", 2)) != 2) return t.fail("a VaDict keyed by tuples failed");
+
+    return t.success();
+}
+
+bool testRanges(testing::Test& t) {
+    // Every list of up to 3 elements out of 0..15: 1 + 16 + 256 + 4096 lists, the empty one included
+    VaList<Size> intHashes, stringHashes;
+    VaList<int> list;
+    VaList<VaString> strings;
+    for (int n = 0; n <= 3; n++) {
+        Size total = Size(1) << (4 * n);
+        for (Size code = 0; code < total; code++) {
+            list.clear();
+            strings.clear();
+            for (int k = 0; k < n; k++) {
+                list.append(int((code >> (4 * k)) & 15));
+                strings.append(VaString(1, char('a' + ((code >> (4 * k)) & 15))));
+            }
+            intHashes.append(VaHash<VaList<int>>{}(list));
+            stringHashes.append(VaHash<VaList<VaString>>{}(strings));
+        }
+    }
+
+    if (!isWellSpread(intHashes, 10)) return t.fail("the hashes of short integer lists collide or cluster");
+    if (!isWellSpread(stringHashes, 10)) return t.fail("the hashes of short string lists collide or cluster");
+
+    // Lists, arrays and slices of the same elements hash the same
+    VaList<int> numbers = {4, 8, 15, 16, 23, 42};
+    VaArray<int, 6> array = {4, 8, 15, 16, 23, 42};
+    const int raw[] = {4, 8, 15, 16, 23, 42};
+    Size listHash = VaHash<VaList<int>>{}(numbers);
+    if (VaHash<VaArray<int, 6>>{}(array) != listHash || VaHash<VaSlice<const int>>{}(VaSlice<const int>(raw)) != listHash) {
+        return t.fail("a list, an array and a slice of the same elements must hash the same");
+    }
+
+    VaList<double> zeros = {0.0, 1.5};
+    VaList<double> negativeZeros = {-0.0, 1.5};
+    if (zeros != negativeZeros || VaHash<VaList<double>>{}(zeros) != VaHash<VaList<double>>{}(negativeZeros)) {
+        return t.fail("equal lists of doubles must hash the same, however zero is signed");
+    }
+
+    VaDict<VaList<int>, VaString> byList;
+    byList.put({1, 2, 3}, "a");
+    byList.put({3, 2, 1}, "b");
+    byList.put({}, "empty");
+    if (len(byList) != 3 || byList.at({3, 2, 1}) != "b" || byList.at({}) != "empty") return t.fail("a VaDict keyed by lists failed");
+
+    return t.success();
+}
+
+bool testBytes(testing::Test& t) {
+    uint8 bytes[64];
+    for (Size i = 0; i < sizeof(bytes); i++) bytes[i] = uint8(i * 37 + 11);
+
+    // Every length, including each tail length, hashes differently
+    VaList<Size> prefixHashes;
+    for (Size n = 0; n <= sizeof(bytes); n++) prefixHashes.append(va::detail::hashBytes(bytes, n));
+    if (!isWellSpread(prefixHashes, 2)) return t.fail("prefixes of different lengths hash the same");
+
+    // Flipping any input bit flips about half of the output bits
+    const Size base = va::detail::hashBytes(bytes, 24);
+    Size flipped = 0, minFlipped = 64;
+    for (Size bit = 0; bit < 24 * 8; bit++) {
+        bytes[bit / 8] ^= uint8(1u << (bit % 8));
+        Size changed = Size(std::popcount(uint64(base ^ va::detail::hashBytes(bytes, 24))));
+        bytes[bit / 8] ^= uint8(1u << (bit % 8));
+
+        flipped += changed;
+        minFlipped = std::min(minFlipped, changed);
+    }
+
+    const double average = double(flipped) / (24 * 8);
+    if (average < 28 || average > 36 || minFlipped < 12) return t.failf("poor avalanche: %.1f bits flipped on average, %d at least", average, int(minFlipped));
+
+    return t.success();
+}
+
+bool testHash(testing::Test& t) {
+    if (!t.helper(testPairsAndTuples)) return false;
+    if (!t.helper(testRanges)) return false;
+    if (!t.helper(testBytes)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testHash); }
@@ -0,0 +1,181 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/Set.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+#include <utility>
+
+struct NotHashable {
+    int value;
+
+    bool operator==(const NotHashable& other) const { return value == other.value; }
+    bool operator!=(const NotHashable& other) const { return value != other.value; }
+    bool operator<(const NotHashable& other) const { return value < other.value; }
+};
+
+static_assert(!va::detail::IsHashable<NotHashable> && va::detail::IsHashable<VaString>);
+
+// Containers of types without a VaHash must still work as long as no hash is asked for
+bool testNotHashable(testing::Test& t) {
+    VaDict<int, NotHashable> dict;
+    dict.put(1, {10});
+    dict.set(1, {11});
+    dict.insert(0, 2, {20});
+    dict.del(2);
+
+    VaDict<int, NotHashable> copy = dict;
+    if (len(copy) != 1 || copy[1].value != 11) return t.fail("a dictionary of values without a VaHash failed");
+    if (copy != dict) return t.fail("comparing dictionaries of values without a VaHash failed");
+
+    copy.set(1, {12});
+    if (copy == dict) return t.fail("dictionaries of different values without a VaHash compared equal");
+
+    VaSet<NotHashable> set = {{3}, {1}, {2}};
+    VaSet<NotHashable> same = {{1}, {2}, {3}};
+    VaSet<NotHashable> other = {{1}, {2}, {4}};
+    if (set != same || set == other) return t.fail("comparing sets of keys without a VaHash failed");
+
+    return t.success();
+}
+
+bool testDictHash(testing::Test& t) {
+    VaDict<VaString, int> a;
+    a.enableHashTracking();
+    if (!a.isHashTracked()) return t.fail("enableHashTracking() did not enable tracking");
+
+    VaDict<VaString, int> b;
+    for (int i = 0; i < 100; i++) {
+        a.put(VaString("key") + char('a' + i % 26) + VaString(3, char('0' + i / 26)), i);
+    }
+    for (int i = 99; i >= 0; i--) {
+        b.putAtBack(VaString("key") + char('a' + i % 26) + VaString(3, char('0' + i / 26)), i);
+    }
+
+    if (a.hash() != b.hash()) return t.fail("a tracked hash must equal the computed one, whatever the insertion order");
+
+    // put(), set(), del() and insert() keep the tracked hash up to date
+    a.set("keya000", -1);
+    a.put("extra", 1);
+    a.putAtBack("keyb000", -2);
+    a.del("keyc000");
+    a.insert(3, "inserted", 7);
+    a.delIndex(0);
+
+    VaDict<VaString, int> fresh;
+    for (const auto& pair: static_cast<const VaDict<VaString, int>&>(a)) fresh.put(pair.key, pair.value);
+    if (a.hash() != fresh.hash()) return t.fail("the tracked hash went wrong after put, set, del or insert");
+
+    // A value changed through a reference makes the hash stale; the next hash() recomputes it
+    a["keyd000"] += 100;
+    *a.find("keye000") = 5;
+    for (auto pair: a) pair.value++;
+
+    fresh = VaDict<VaString, int>();
+    for (const auto& pair: static_cast<const VaDict<VaString, int>&>(a)) fresh.put(pair.key, pair.value);
+    if (a.hash() != fresh.hash()) return t.fail("the tracked hash was not recomputed after a change through a reference");
+
+    a.put("afterStale", 0);
+    fresh.put("afterStale", 0);
+    if (a.hash() != fresh.hash()) return t.fail("the tracked hash went wrong after being recomputed");
+
+    // Tracking follows the dictionary through copies and moves
+    VaDict<VaString, int> copy = a;
+    if (!copy.isHashTracked() || copy.hash() != a.hash()) return t.fail("the copy constructor lost the tracked hash");
+
+    VaDict<VaString, int> moved = std::move(copy);
+    if (!moved.isHashTracked() || moved.hash() != a.hash() || copy.hash() != VaDict<VaString, int>().hash()) {
+        return t.fail("the move constructor lost the tracked hash");
+    }
+
+    moved.del("afterStale");
+    if (moved.hash() == a.hash()) return t.fail("removing an entry did not change the hash");
+
+    a.clear();
+    if (a.hash() != VaDict<VaString, int>().hash()) return t.fail("clear() did not reset the tracked hash");
+
+    a.disableHashTracking();
+    if (a.isHashTracked()) return t.fail("disableHashTracking() did not disable tracking");
+
+    return t.success();
+}
+
+bool testDictEquality(testing::Test& t) {
+    VaDict<int, int> a = {{1, 10}, {2, 20}, {3, 30}};
+    VaDict<int, int> b = {{3, 30}, {2, 20}, {1, 10}};
+    a.enableHashTracking();
+    b.enableHashTracking();
+
+    if (a != b) return t.fail("tracked dictionaries with the same entries must be equal");
+
+    b.set(2, 21);
+    if (a == b) return t.fail("tracked dictionaries with different values must not be equal");
+
+    b[2] = 20;
+    if (a != b) return t.fail("a stale tracked hash made equal dictionaries unequal");
+
+    // Only one side tracked
+    VaDict<int, int> c = {{1, 10}, {2, 20}, {3, 31}};
+    if (a == c || c == a) return t.fail("dictionaries with different values must not be equal");
+
+    // The xor of the former hash() let swapped keys and values, or repeated pairs, cancel out
+    VaDict<int, int> swapped = {{10, 1}, {20, 2}, {30, 3}};
+    if (a.hash() == swapped.hash()) return t.fail("swapping keys and values must change the hash");
+
+    VaDict<int, int> x = {{1, 1}, {2, 2}};
+    VaDict<int, int> y = {{1, 2}, {2, 1}};
+    if (x.hash() == y.hash()) return t.fail("exchanging values between keys must change the hash");
+
+    return t.success();
+}
+
+bool testSetHash(testing::Test& t) {
+    VaSet<int> a = {5, 1, 4};
+    VaSet<int> b = {4, 5, 1};
+    a.enableHashTracking();
+
+    if (a.hash() != b.hash()) return t.fail("a tracked set hash must equal the computed one");
+    if (a != b) return t.fail("equal sets must be equal");
+
+    a.insert(9);
+    a.add(2);
+    a.erase(a.find(5));
+    auto node = a.extract(1);
+    VaSet<int> c = {4, 9, 2};
+    if (a.hash() != c.hash()) return t.fail("the tracked set hash went wrong after insert, erase or extract");
+
+    a.insert(std::move(node));
+    c.add(1);
+    c.enableHashTracking();
+    if (a.hash() != c.hash() || a != c) return t.fail("the tracked set hash went wrong after re-inserting a node");
+
+    c.erase(c.find(9));
+    c.add(8);
+    if (a == c) return t.fail("tracked sets with different keys must not be equal");
+
+    VaSet<int> other = {100};
+    other.enableHashTracking();
+    a.swap(other);
+    if (a.hash() != VaSet<int>{100}.hash() || !other.isHashTracked()) return t.fail("swap() did not exchange the tracked hashes");
+
+    // A set of sets, or a dict keyed by sets, hashes through VaSet::hash()
+    if (VaHash<VaSet<int>>{}(a) != a.hash()) return t.fail("VaHash of a set must use its hash()");
+
+    return t.success();
+}
+
+bool testHashTracking(testing::Test& t) {
+    if (!t.helper(testNotHashable)) return false;
+    if (!t.helper(testDictHash)) return false;
+    if (!t.helper(testDictEquality)) return false;
+    if (!t.helper(testSetHash)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testHashTracking); }
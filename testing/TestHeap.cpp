@@ -0,0 +1,119 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/Heap.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <algorithm>
+#include <random>
+
+template <Size Arity>
+bool testHeapArity(testing::Test& t) {
+    std::mt19937 rng(42);
+    VaList<int> values;
+    for (int i = 0; i < 1000; i++) values.append(int(rng() % 500));
+
+    VaMinHeap<int, Arity> minHeap;
+    VaMaxHeap<int, Arity> maxHeap;
+    for (int v: values) {
+        minHeap.push(v);
+        maxHeap.emplace(v);
+    }
+
+    VaList<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (Size i = 0; i < len(sorted); i++) {
+        if (minHeap.top() != sorted[i]) return t.fail("Min-heap top() out of order");
+        if (minHeap.pop() != sorted[i]) return t.fail("Min-heap pop() out of order");
+        if (maxHeap.pop() != sorted[len(sorted) - 1 - i]) return t.fail("Max-heap pop() out of order");
+    }
+
+    if (!minHeap.isEmpty() || len(maxHeap) != 0) return t.fail("Heaps should be empty");
+
+    expect({
+        minHeap.pop();
+        return t.fail("pop() on empty heap should throw");
+    })
+
+    expect({
+        minHeap.top();
+        return t.fail("top() on empty heap should throw");
+    })
+
+    VaHeap<int, std::less<int>, Arity> built(values);
+    VaList<int> drained = built.takeSorted();
+    if (drained != sorted || !built.isEmpty()) return t.fail("takeSorted() should return the elements in pop order");
+
+    return t.success();
+}
+
+bool testHeapPushPop(testing::Test& t) {
+    VaMinHeap<int> heap = {5, 3, 8};
+
+    if (heap.pushPop(1) != 1) return t.fail("pushPop() of a new minimum should return it directly");
+    if (len(heap) != 3) return t.fail("pushPop() must not change the size");
+
+    if (heap.pushPop(6) != 3 || heap.top() != 5) return t.fail("pushPop() should return the old top");
+    if (heap.replaceTop(1) != 5 || heap.top() != 1) return t.fail("replaceTop() should return the old top even if the new value is smaller");
+
+    VaMinHeap<int> empty;
+    if (empty.pushPop(7) != 7 || !empty.isEmpty()) return t.fail("pushPop() on an empty heap should return the value");
+
+    expect({
+        empty.replaceTop(1);
+        return t.fail("replaceTop() on empty heap should throw");
+    })
+
+    VaMaxHeap<VaString, 4> words = {"pear", "apple", "zucchini", "fig"};
+    if (words.pop() != "zucchini" || words.pop() != "pear") return t.fail("Heap of strings out of order");
+
+    return t.success();
+}
+
+bool testHeapFunctions(testing::Test& t) {
+    std::mt19937 rng(7);
+    VaList<int> values;
+    for (int i = 0; i < 500; i++) values.append(int(rng() % 10000));
+
+    VaList<int> heap = values;
+    va::heapify(VaSlice<int>(heap));
+    if (!va::isHeap(VaSlice<int>(heap))) return t.fail("heapify() should produce a heap");
+    if (va::isHeap(VaSlice<int>(heap), std::greater<int>())) return t.fail("isHeap() should reject the wrong order");
+
+    VaList<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+    VaList<int> top = va::topK(values, 10);
+    if (len(top) != 10) return t.fail("topK() returned a wrong number of elements");
+    for (Size i = 0; i < 10; i++) {
+        if (top[i] != sorted[i]) return t.fail("topK() returned wrong elements");
+    }
+
+    VaList<int> bottom = va::topK(VaSlice<int>(values), 5, std::greater<int>());
+    for (Size i = 0; i < 5; i++) {
+        if (bottom[i] != sorted[len(sorted) - 1 - i]) return t.fail("topK() with std::greater should return the smallest elements");
+    }
+
+    if (len(va::topK(values, 1000)) != len(values)) return t.fail("topK() with k > n should return all elements");
+    if (!va::topK(values, 0).isEmpty()) return t.fail("topK() with k == 0 should return nothing");
+
+    return t.success();
+}
+
+bool testHeap(testing::Test& t) {
+    if (!t.helper(testHeapArity<2>)) return false;
+    if (!t.helper(testHeapArity<4>)) return false;
+    if (!t.helper(testHeapArity<3>)) return false;
+    if (!t.helper(testHeapPushPop)) return false;
+    if (!t.helper(testHeapFunctions)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testHeap); }
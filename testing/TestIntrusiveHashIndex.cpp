@@ -0,0 +1,143 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/IntrusiveHashIndex.hpp>
+#include <VaLib/Types/IntrusiveList.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+
+struct Connection {
+    int fd;
+    VaString peer;
+    VaIntrusiveHashHook byFd;
+    VaIntrusiveHashHook byPeer;
+    VaIntrusiveListHook idle;
+
+    Connection(int fd, VaString peer) : fd(fd), peer(peer) {}
+
+    const VaString& getPeer() const { return peer; }
+};
+
+using FdIndex = VaIntrusiveHashIndex<Connection, &Connection::fd, &Connection::byFd>;
+using PeerIndex = VaIntrusiveHashIndex<Connection, &Connection::getPeer, &Connection::byPeer>;
+
+bool testIntrusiveHashIndex(testing::Test& t) {
+    FdIndex byFd(4);
+    PeerIndex byPeer;
+    VaIntrusiveList<Connection, &Connection::idle> idle;
+
+    VaList<Connection> storage;
+    storage.reserve(100);
+    for (int i = 0; i < 100; i++) {
+        storage.append(Connection(i * 3, VaString("peer") + VaString(std::to_string(i).c_str())));
+    }
+
+    for (Connection& conn : storage) {
+        if (!byFd.insert(conn) || !byPeer.insert(conn)) {
+            return t.fail("insert() failed");
+        }
+        if (conn.fd % 2 == 0) idle.append(conn);
+    }
+
+    if (len(byFd) != 100 || len(byPeer) != 100 || len(idle) != 50) {
+        return t.fail("wrong sizes after insert");
+    }
+    if (cap(byFd) * 3 < len(byFd) * 4) {
+        return t.fail("bucket array did not grow");
+    }
+
+    Connection* found = byFd.find(30);
+    if (!found || found->peer != "peer10" || &byPeer.at("peer10") != found) {
+        return t.fail("find()/at() failed");
+    }
+    if (byFd.find(31) || byFd.contains(31) || !byPeer.contains("peer99")) {
+        return t.fail("contains() failed");
+    }
+
+    expect({
+        byFd.at(31);
+        return t.fail("at() with a missing key should throw");
+    })
+
+    // a second object with the same key is refused
+    Connection duplicate(30, "other");
+    if (byFd.insert(duplicate) || duplicate.byFd.isLinked()) {
+        return t.fail("insert() of a duplicate key should fail");
+    }
+
+    expect({
+        byFd.insert(*found);
+        return t.fail("insert() of a linked object should throw");
+    })
+
+    // O(1) removal through the object, the other memberships stay intact
+    byFd.unlink(*found);
+    if (byFd.contains(30) || !byPeer.contains("peer10") || !idle.owns(*found) || len(byFd) != 99) {
+        return t.fail("unlink() failed");
+    }
+
+    Connection* removed = byPeer.del("peer11");
+    if (removed != &storage[11] || byPeer.contains("peer11") || !byFd.contains(33) || byPeer.del("missing")) {
+        return t.fail("del() failed");
+    }
+
+    storage[12].byFd.unlink();
+    if (byFd.contains(36) || len(byFd) != 98) {
+        return t.fail("hook unlink() failed");
+    }
+
+    // iteration visits every indexed object exactly once
+    Size count = 0;
+    int fdSum = 0;
+    for (Connection& conn : byFd) {
+        count++;
+        fdSum += conn.fd;
+    }
+    if (count != 98 || fdSum != 3 * 4950 - 30 - 36) {
+        return t.fail("iteration failed");
+    }
+
+    // objects destroyed while indexed leave the index
+    {
+        Connection temp(1000, "temp");
+        byFd.insert(temp);
+        byPeer.insert(temp);
+        idle.append(temp);
+        if (!byFd.contains(1000)) return t.fail("insert() of a temporary failed");
+    }
+    if (byFd.contains(1000) || byPeer.contains("temp") || len(byFd) != 98) {
+        return t.fail("destroyed object was not unlinked");
+    }
+
+    FdIndex moved(std::move(byFd));
+    if (len(byFd) != 0 || !moved.contains(3) || byFd.contains(3) || !moved.owns(storage[1])) {
+        return t.fail("move constructor failed");
+    }
+    if (!byFd.insert(duplicate) || !byFd.contains(30)) {
+        return t.fail("insert() into a moved-from index failed");
+    }
+
+    moved.clear();
+    if (!moved.isEmpty() || storage[1].byFd.isLinked() || !storage[1].byPeer.isLinked()) {
+        return t.fail("clear() failed");
+    }
+
+    PeerIndex reserved(0);
+    reserved.reserve(1000);
+    Size before = cap(reserved);
+    for (Connection& conn : storage) {
+        conn.byPeer.unlink();
+        reserved.insert(conn);
+    }
+    if (cap(reserved) != before || len(reserved) != 100) {
+        return t.fail("reserve() should prevent rehashing");
+    }
+
+    return t.success();
+}
+
+int main() { return testing::run(testIntrusiveHashIndex); }
@@ -0,0 +1,187 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/IntrusiveList.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <utility>
+
+struct Timer {
+    int deadline;
+    VaString name;
+    VaIntrusiveListHook byDeadline;
+    VaIntrusiveListHook byOwner;
+
+    Timer(int deadline, VaString name) : deadline(deadline), name(name) {}
+};
+
+using DeadlineList = VaIntrusiveList<Timer, &Timer::byDeadline>;
+using OwnerList = VaIntrusiveList<Timer, &Timer::byOwner>;
+
+static_assert(tt::IsSame<decltype(std::declval<const DeadlineList&>().front()), const Timer&>);
+static_assert(tt::IsSame<decltype(std::declval<DeadlineList&>().back()), Timer&>);
+static_assert(tt::IsSame<decltype(*std::declval<const DeadlineList&>().begin()), const Timer&>);
+static_assert(tt::IsSame<decltype(*std::declval<DeadlineList&>().begin()), Timer&>);
+
+// Not standard-layout, so offsetof could not locate its hook
+struct Task {
+    virtual ~Task() = default;
+    int id = 0;
+};
+
+struct Job: Task {
+    VaString label;
+    VaIntrusiveListHook hook;
+
+    explicit Job(VaString label) : label(label) {}
+};
+
+bool testNonStandardLayout(testing::Test& t) {
+    Job first("first"), second("second");
+    VaIntrusiveList<Job, &Job::hook> jobs;
+    jobs.append(first);
+    jobs.append(second);
+
+    const auto& view = jobs;
+    if (&view.front() != &first || &view.back() != &second || view.front().label != "first") {
+        return t.fail("the hook of a non-standard-layout type was not mapped back to its object");
+    }
+    if (&jobs.pop() != &second || jobs.nextOf(first) != nullptr) {
+        return t.fail("pop() on a list of a non-standard-layout type failed");
+    }
+
+    return t.success();
+}
+
+template <typename List>
+VaString names(const List& list) {
+    VaString result;
+    for (const Timer& timer : list) result += timer.name;
+    return result;
+}
+
+bool testIntrusiveList(testing::Test& t) {
+    Timer a(1, "a"), b(2, "b"), c(3, "c"), d(4, "d");
+
+    DeadlineList pending;
+    OwnerList owned;
+
+    pending.append(b);
+    pending.append(d);
+    pending.prepend(a);
+    pending.insertBefore(d, c);
+    if (names(pending) != "abcd" || len(pending) != 4) {
+        return t.fail("append/prepend/insertBefore failed");
+    }
+
+    // the same objects can sit in a second list through another hook
+    owned.append(d);
+    owned.append(a);
+    owned.insertAfter(d, c);
+    if (names(owned) != "dca" || len(owned) != 3 || !owned.owns(c) || owned.owns(b)) {
+        return t.fail("membership in a second list failed");
+    }
+
+    pending.unlink(b);
+    if (names(pending) != "acd" || b.byDeadline.isLinked() || len(pending) != 3) {
+        return t.fail("unlink() failed");
+    }
+
+    // unlinking through the hook keeps the length in sync
+    c.byDeadline.unlink();
+    if (names(pending) != "ad" || len(pending) != 2 || names(owned) != "dca") {
+        return t.fail("hook unlink() failed");
+    }
+
+    if (pending.nextOf(a) != &d || pending.prevOf(a) != nullptr || &pending.back() != &d) {
+        return t.fail("nextOf/prevOf/back failed");
+    }
+
+    expect({
+        pending.append(a);
+        return t.fail("linking an already linked object should throw");
+    })
+
+    expect({
+        pending.unlink(b);
+        return t.fail("unlinking a foreign object should throw");
+    })
+
+    // a destroyed object leaves every list it is in
+    {
+        Timer temp(5, "e");
+        pending.append(temp);
+        owned.prepend(temp);
+        if (names(pending) != "ade" || names(owned) != "edca") {
+            return t.fail("append of a temporary failed");
+        }
+    }
+    if (names(pending) != "ad" || names(owned) != "dca") {
+        return t.fail("destroyed object was not unlinked");
+    }
+
+    Timer& last = pending.pop();
+    Timer& first = owned.shift();
+    if (&last != &d || &first != &d || d.byDeadline.isLinked() || d.byOwner.isLinked()) {
+        return t.fail("pop/shift failed");
+    }
+
+    // moving the list moves the membership
+    DeadlineList moved(std::move(pending));
+    if (len(pending) != 0 || len(moved) != 1 || !moved.owns(a) || pending.owns(a)) {
+        return t.fail("move constructor failed");
+    }
+    a.byDeadline.unlink();
+    if (!moved.isEmpty()) {
+        return t.fail("hook unlink after move failed");
+    }
+
+    // iterating backwards
+    VaString reversed;
+    for (auto it = owned.end(); it != owned.begin();) {
+        --it;
+        reversed += it->name;
+    }
+    if (reversed != "ac") {
+        return t.fail("reverse iteration failed");
+    }
+
+    // a const list iterates both ways through a ConstIterator
+    const OwnerList& view = owned;
+    VaString forward, backward;
+    for (auto it = view.begin(); it != view.end(); ++it) forward += it->name;
+    for (auto it = view.cend(); it != view.cbegin();) backward += (*--it).name;
+    if (forward != "ca" || backward != "ac") {
+        return t.fail("const iteration failed");
+    }
+
+    // a copied object is not linked
+    Timer copy = c;
+    if (copy.byOwner.isLinked() || !c.byOwner.isLinked()) {
+        return t.fail("copying an object should not copy its membership");
+    }
+
+    owned.clear();
+    if (!owned.isEmpty() || a.byOwner.isLinked() || c.byOwner.isLinked()) {
+        return t.fail("clear() failed");
+    }
+
+    expect({
+        owned.front();
+        return t.fail("front() on empty list should throw");
+    })
+    expect({
+        static_cast<const OwnerList&>(owned).back();
+        return t.fail("back() on empty const list should throw");
+    })
+
+    if (!t.helper(testNonStandardLayout)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testIntrusiveList); }
@@ -4,9 +4,260 @@
 
 #include <lib/testing.hpp>
 
+#include <VaLib/Types/Pair.hpp>
 #include <VaLib/Types/String.hpp>
 #include <VaLib/Types/LinkedList.hpp>
 
+bool testLinkedListCursor(testing::Test& t) {
+    VaLinkedList<int> list = {1, 2, 3, 4, 5};
+
+    auto cur = list.cursorAt(2);
+    if (*cur != 3 || cur.index() != 2) {
+        return t.fail("cursorAt() failed");
+    }
+
+    cur.insertBefore(20);
+    cur.insertAfter(30);
+    if (list != VaLinkedList<int>{1, 2, 20, 3, 30, 4, 5} || cur.index() != 3 || *cur != 3) {
+        return t.fail("Cursor insertBefore/insertAfter failed");
+    }
+
+    cur.erase();
+    if (list != VaLinkedList<int>{1, 2, 20, 30, 4, 5} || *cur != 30 || cur.index() != 3) {
+        return t.fail("Cursor erase failed");
+    }
+
+    cur.moveNext().moveNext().moveNext();
+    if (!cur.isEnd() || cur.index() != len(list)) {
+        return t.fail("Cursor should be on the end position");
+    }
+
+    cur.moveNext();
+    if (*cur != 1 || cur.index() != 0) {
+        return t.fail("Cursor should wrap to the front");
+    }
+
+    cur.movePrev();
+    cur.insertBefore(6);
+    if (list.backUnchecked() != 6 || !cur.isEnd() || cur.index() != len(list)) {
+        return t.fail("Cursor insertBefore at end position failed");
+    }
+
+    // splice another list in the middle
+    VaLinkedList<int> other = {7, 8};
+    auto mid = list.cursorAt(1);
+    mid.spliceAfter(std::move(other));
+    if (list != VaLinkedList<int>{1, 2, 7, 8, 20, 30, 4, 5, 6} || len(other) != 0) {
+        return t.fail("Cursor spliceAfter failed");
+    }
+
+    mid.moveNext().moveNext().moveNext();
+    VaLinkedList<int> tail = mid.splitAfter();
+    if (list != VaLinkedList<int>{1, 2, 7, 8, 20} || tail != VaLinkedList<int>{30, 4, 5, 6}) {
+        return t.fail("Cursor splitAfter failed");
+    }
+
+    VaLinkedList<int> head = mid.splitBefore();
+    if (list != VaLinkedList<int>{20} || head != VaLinkedList<int>{1, 2, 7, 8} || mid.index() != 0) {
+        return t.fail("Cursor splitBefore failed");
+    }
+
+    // nodes moved between lists must stay valid after the source list is gone
+    {
+        VaLinkedList<VaString> a = {"a", "b"};
+        {
+            VaLinkedList<VaString> b = {"c", "d"};
+            a.cursorEnd().spliceBefore(std::move(b));
+            b.append("e");
+        }
+        a.append("f");
+        if (a != VaLinkedList<VaString>{"a", "b", "c", "d", "f"}) {
+            return t.fail("Nodes spliced from a destroyed list are broken");
+        }
+    }
+
+    VaLinkedList<int> big;
+    for (int i = 0; i < 1000; i++) big.append(i);
+    for (int i = 0; i < 1000; i++) big.pop();
+    big.shrink();
+    if (cap(big) != 0) {
+        return t.failf("shrink() should release unused slabs, capacity is %d", cap(big));
+    }
+
+    return t.success();
+}
+
+// Number of node slots held by the slab pool of a list, used or not
+template <typename T>
+static Size poolCapacity(const VaLinkedList<T>& list) {
+    auto* pool = list.getRawView()->pool;
+    return pool ? pool->resolve()->getCapacity() : 0;
+}
+
+bool testLinkedListSharedStorage(testing::Test& t) {
+    // splitting the whole list off and dropping it must not orphan its nodes in the shared pool
+    VaLinkedList<int> list;
+    for (int round = 0; round < 2000; round++) {
+        for (int i = 0; i < 100; i++) list.append(i);
+        VaLinkedList<int> dropped = list.cursorEnd().splitAfter();
+    }
+    if (len(list) != 0 || poolCapacity(list) > 256) {
+        return t.failf("split-off lists leaked their nodes into the shared pool, which holds %d slots", int(poolCapacity(list)));
+    }
+
+    list.shrink();
+    if (poolCapacity(list) != 0) return t.fail("shrink() should release the pool once the split-off lists are gone");
+
+    // nodes left unused by lists moved in are reused before a new slab is allocated
+    VaLinkedList<int> sink;
+    for (int round = 0; round < 2000; round++) {
+        VaLinkedList<int> tmp;
+        tmp.append(round);
+        sink.appendEach(std::move(tmp));
+    }
+    Size slots = poolCapacity(sink);
+    for (int i = 0; i < 2000; i++) sink.append(i);
+    if (len(sink) != 4000 || poolCapacity(sink) != slots) {
+        return t.fail("nodes handed back by moved-from lists were not reused");
+    }
+
+    sink.clear();
+    sink.shrink();
+    if (poolCapacity(sink) != 0) return t.fail("shrink() should release every slab of an empty list");
+
+    // a list splitting off and taking back its tail keeps using the same slabs
+    VaLinkedList<VaString> words;
+    for (int i = 0; i < 64; i++) words.append(VaString(1, char('a' + i % 26)));
+    Size wordSlots = poolCapacity(words);
+    for (int round = 0; round < 1000; round++) {
+        {
+            VaLinkedList<VaString> back = words.cursorAt(32).splitAfter();
+            back.pop();
+            words.appendEach(std::move(back));
+        }
+        words.append("z");
+    }
+    if (len(words) != 64 || poolCapacity(words) != wordSlots) {
+        return t.failf("splitting and splicing back grew the pool to %d slots", int(poolCapacity(words)));
+    }
+
+    return t.success();
+}
+
+bool testLinkedListSortMerge(testing::Test& t) {
+    VaLinkedList<int> list = {5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0};
+    list.sort();
+    if (list != VaLinkedList<int>{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9}) {
+        return t.fail("sort() failed");
+    }
+    if (list.frontUnchecked() != 0 || list.backUnchecked() != 9) {
+        return t.fail("sort() did not update head/tail");
+    }
+
+    // prev links must be rebuilt: walk backwards
+    VaLinkedList<int> reversed;
+    for (auto cur = list.cursorBack(); cur; cur.movePrev()) reversed.prepend(*cur);
+    if (reversed != list) {
+        return t.fail("sort() broke prev links");
+    }
+
+    list.sort([](int a, int b) { return a > b; });
+    if (list != VaLinkedList<int>{9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0}) {
+        return t.fail("sort() with comparator failed");
+    }
+
+    // stability: equal keys keep their order
+    VaLinkedList<VaPair<int, int>> pairs;
+    for (int i = 0; i < 1000; i++) pairs.append(VaPair<int, int>((i * 7919) % 13, i));
+    pairs.sort([](const VaPair<int, int>& a, const VaPair<int, int>& b) { return a.first < b.first; });
+    {
+        auto cur = pairs.cursorFront();
+        VaPair<int, int> last = *cur;
+        for (cur.moveNext(); cur; cur.moveNext()) {
+            if (cur->first < last.first || (cur->first == last.first && cur->second < last.second)) {
+                return t.fail("sort() is not stable");
+            }
+            last = *cur;
+        }
+    }
+
+    // nodes are relinked, not copied
+    VaLinkedList<VaString> strings = {"delta", "alpha", "charlie", "bravo"};
+    const VaString* alpha = &*strings.cursorAt(1);
+    strings.sort();
+    if (&strings.frontUnchecked() != alpha || strings != VaLinkedList<VaString>{"alpha", "bravo", "charlie", "delta"}) {
+        return t.fail("sort() should relink nodes in place");
+    }
+
+    // a throwing comparator must not lose elements
+    VaLinkedList<int> fragile;
+    for (int i = 0; i < 100; i++) fragile.append((i * 37) % 100);
+    int calls = 0;
+    try {
+        fragile.sort([&calls](int x, int y) {
+            if (++calls == 150) throw ValueError("comparator failed");
+            return x < y;
+        });
+    } catch (ValueError&) {}
+    int sum = 0;
+    for (int value : fragile) sum += value;
+    if (len(fragile) != 100 || sum != 4950) {
+        return t.fail("sort() lost elements when the comparator threw");
+    }
+
+    // merge two sorted lists, ties favour this list
+    VaLinkedList<VaPair<int, char>> a = {{1, 'a'}, {3, 'a'}, {5, 'a'}, {9, 'a'}};
+    VaLinkedList<VaPair<int, char>> b = {{0, 'b'}, {2, 'b'}, {3, 'b'}, {4, 'b'}, {10, 'b'}, {11, 'b'}};
+    a.merge(std::move(b), [](const auto& x, const auto& y) { return x.first < y.first; });
+    VaLinkedList<VaPair<int, char>> merged = {{0, 'b'}, {1, 'a'}, {2, 'b'}, {3, 'a'}, {3, 'b'}, {4, 'b'},
+                                              {5, 'a'}, {9, 'a'}, {10, 'b'}, {11, 'b'}};
+    if (a != merged || len(b) != 0 || a.backUnchecked().first != 11) {
+        return t.fail("merge() failed");
+    }
+
+    VaLinkedList<int> empty;
+    VaLinkedList<int> some = {1, 2};
+    empty.merge(std::move(some));
+    if (empty != VaLinkedList<int>{1, 2} || len(some) != 0) {
+        return t.fail("merge() into empty list failed");
+    }
+
+    // splice a range from another list
+    VaLinkedList<int> dst = {1, 2, 3};
+    {
+        VaLinkedList<int> src = {10, 11, 12, 13, 14};
+        dst.splice(dst.cursorAt(1), src, src.cursorAt(1), src.cursorAt(4));
+        if (dst != VaLinkedList<int>{1, 11, 12, 13, 2, 3} || src != VaLinkedList<int>{10, 14}) {
+            return t.fail("splice() of a range failed");
+        }
+
+        dst.splice(dst.cursorEnd(), src, src.cursorAt(1), src.cursorEnd());
+        if (dst != VaLinkedList<int>{1, 11, 12, 13, 2, 3, 14} || src != VaLinkedList<int>{10}) {
+            return t.fail("splice() of a tail range failed");
+        }
+    }
+    if (dst != VaLinkedList<int>{1, 11, 12, 13, 2, 3, 14} || dst.backUnchecked() != 14) {
+        return t.fail("spliced nodes should outlive their source list");
+    }
+
+    // splice within the same list
+    auto pos = dst.cursorAt(1);
+    pos.spliceBefore(dst, dst.cursorAt(4), dst.cursorEnd());
+    if (dst != VaLinkedList<int>{1, 2, 3, 14, 11, 12, 13} || *pos != 11 || pos.index() != 4) {
+        return t.fail("splice() within the same list failed");
+    }
+
+    bool thrown = false;
+    try {
+        dst.splice(dst.cursorAt(2), dst, dst.cursorAt(1), dst.cursorAt(4));
+    } catch (ValueError&) {
+        thrown = true;
+    }
+    if (!thrown) return t.fail("splice() into its own range should throw");
+
+    return t.success();
+}
+
 bool testLinkedList(testing::Test& t) {
     VaLinkedList<int> list;
     list.append(1);
@@ -119,6 +370,9 @@ bool testLinkedList(testing::Test& t) {
         return t.fail("insertEach with Iterable failed");
     }
 
+    if (!t.helper(testLinkedListCursor)) return false;
+    if (!t.helper(testLinkedListSortMerge)) return false;
+    if (!t.helper(testLinkedListSharedStorage)) return false;
     return t.success();
 }
 
@@ -227,6 +227,26 @@ bool testList(testing::Test& t) {
         return t.fail("Source list after move insertEach into an empty list should be empty");
     }
 
+    // test map/filter/reduce with lambdas and with VaFunc
+    VaList<int> source = {1, 2, 3, 4, 5};
+    VaList<VaString> strings = va::map([](const int& x) { return va::toString(x * 10); }, source);
+    if (strings != VaList<VaString>{"10", "20", "30", "40", "50"}) {
+        return t.fail("map() with a lambda failed");
+    }
+
+    int limit = 2;
+    if (va::filter([limit](int x) { return x > limit; }, source) != VaList<int>{3, 4, 5}) {
+        return t.fail("filter() with a lambda failed");
+    }
+    if (va::reduce([](long acc, int x) { return acc + x; }, source, 100L) != 115) {
+        return t.fail("reduce() with a lambda failed");
+    }
+
+    VaFunc<bool(const int&)> isOdd = [](const int& x) { return x % 2 != 0; };
+    if (va::filter(isOdd, source) != VaList<int>{1, 3, 5}) {
+        return t.fail("filter() with a VaFunc failed");
+    }
+
     return t.success();
 }
 
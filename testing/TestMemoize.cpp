@@ -0,0 +1,225 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/FuncTools/Memoize.hpp>
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Types/Tuple.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+static int squareCalls = 0;
+
+static int countedSquare(int x) {
+    squareCalls++;
+    return x * x;
+}
+
+bool testTupleKey(testing::Test& t) {
+    VaTuple<int, VaString> a(1, VaString("one"));
+    VaTuple<int, VaString> b(1, VaString("one"));
+    VaTuple<int, VaString> c(1, VaString("uno"));
+
+    if (!(a == b) || a != b) return t.fail("equal tuples compare unequal");
+    if (a == c) return t.fail("different tuples compare equal");
+    if (VaHash<VaTuple<int, VaString>>{}(a) != VaHash<VaTuple<int, VaString>>{}(b)) return t.fail("equal tuples hash differently");
+
+    // The order of the elements must matter
+    VaHash<VaTuple<int, int>> pairHash;
+    if (pairHash(VaTuple<int, int>(1, 2)) == pairHash(VaTuple<int, int>(2, 1))) return t.fail("tuple hash ignores element order");
+
+    VaDict<VaTuple<int, VaString>, int> dict;
+    dict.put(a, 10);
+    dict.put(c, 20);
+    if (dict.getSize() != 2 || dict.at(b) != 10) return t.fail("VaDict with tuple keys failed");
+
+    return t.success();
+}
+
+bool testMemoizeBasic(testing::Test& t) {
+    squareCalls = 0;
+    auto square = va::memoize(countedSquare);
+
+    if (square(4) != 16 || square(4) != 16 || square(5) != 25) return t.fail("wrong result");
+    if (squareCalls != 2) return t.fail("function called on a cache hit");
+
+    VaCacheStats stats = square.getStats();
+    if (stats.hits != 1 || stats.misses != 2 || stats.evictions != 0) return t.fail("wrong hit/miss counters");
+    if (!square.contains(4) || square.contains(6)) return t.fail("contains() failed");
+    if (square.getStats().hits != 1) return t.fail("contains() counted as a hit");
+
+    square.clear();
+    if (square.getSize() != 0 || square.contains(4)) return t.fail("clear() failed");
+    square(4);
+    if (squareCalls != 3) return t.fail("cleared result was not recomputed");
+
+    square.resetStats();
+    if (square.getStats().misses != 0 || square.getStats().hitRate() != 0.0) return t.fail("resetStats() failed");
+
+    // Several arguments of different types, passed by reference
+    int joinCalls = 0;
+    auto join = va::memoize([&joinCalls](const VaString& s, int n) {
+        joinCalls++;
+        VaString result;
+        for (int i = 0; i < n; i++) result += s;
+        return result;
+    });
+    if (join("ab", 3) != "ababab" || join("ab", 3) != "ababab" || join("ab", 2) != "abab") return t.fail("wrong result with two arguments");
+    if (joinCalls != 2) return t.fail("arguments are not compared as a tuple");
+
+    // No arguments at all
+    int answerCalls = 0;
+    auto answer = va::memoize([&answerCalls]() { return ++answerCalls * 42; });
+    if (answer() != 42 || answer() != 42 || answerCalls != 1) return t.fail("nullary function not cached");
+
+    // A generic lambda needs an explicit signature
+    auto twice = va::memoize<long(long)>([](auto x) { return x * 2; });
+    if (twice(21) != 42) return t.fail("explicit signature failed");
+
+    return t.success();
+}
+
+bool testMemoizeRecursive(testing::Test& t) {
+    int calls = 0;
+    VaFunc<unsigned long long(int)> fib;
+    fib = va::memoize([&fib, &calls](int n) -> unsigned long long {
+        calls++;
+        return n < 2 ? n : fib(n - 1) + fib(n - 2);
+    });
+
+    if (fib(90) != 2880067194370816120ull) return t.fail("wrong result of the recursive function");
+    if (calls != 91) return t.fail("recursive calls were not memoized");
+
+    return t.success();
+}
+
+bool testMemoizeLru(testing::Test& t) {
+    squareCalls = 0;
+    auto square = va::memoizeLru(countedSquare, 3);
+
+    square(1);
+    square(2);
+    square(3);
+    square(1); // 1 becomes the most recently used, 2 the least
+    square(4); // Evicts 2
+
+    if (square.getSize() != 3 || square.getCapacity() != 3) return t.fail("capacity not enforced");
+    if (square.contains(2)) return t.fail("the least recently used entry was not evicted");
+    if (!square.contains(1) || !square.contains(3) || !square.contains(4)) return t.fail("the wrong entry was evicted");
+    if (square.getStats().evictions != 1) return t.fail("eviction not counted");
+
+    square(2); // Evicts 3
+    if (square.contains(3) || squareCalls != 5) return t.fail("wrong eviction order");
+
+    // A long run over more keys than fit: size stays bounded and results stay correct
+    for (int i = 0; i < 1000; i++) {
+        if (square(i % 7) != (i % 7) * (i % 7)) return t.fail("wrong result after evictions");
+    }
+    if (square.getSize() != 3) return t.fail("capacity exceeded");
+
+    return t.success();
+}
+
+bool testMemoizeTtl(testing::Test& t) {
+    using namespace std::chrono_literals;
+
+    squareCalls = 0;
+    auto square = va::memoizeTtl(countedSquare, 50ms);
+
+    square(3);
+    square(3);
+    if (squareCalls != 1) return t.fail("fresh entry not used");
+
+    std::this_thread::sleep_for(80ms);
+    if (square.contains(3)) return t.fail("expired entry still reported");
+    if (square(3) != 9 || squareCalls != 2) return t.fail("expired entry not recomputed");
+    if (square(3) != 9 || squareCalls != 2) return t.fail("refreshed entry not used");
+
+    // Expired entries are dropped when new ones are added
+    square(4);
+    std::this_thread::sleep_for(80ms);
+    square(5);
+    if (square.getSize() != 1) return t.fail("expired entries were not dropped");
+    if (square.getStats().evictions != 3) return t.fail("expirations not counted"); // 3 once, then 3 and 4
+
+    // TTL together with a capacity
+    auto bounded = va::memoizeTtl(countedSquare, 1h, 2);
+    bounded(1);
+    bounded(2);
+    bounded(3);
+    if (bounded.getSize() != 2 || bounded.contains(1)) return t.fail("capacity ignored with a TTL");
+
+    return t.success();
+}
+
+bool testMemoizeConcurrent(testing::Test& t) {
+    constexpr Size threadCount = 4;
+    constexpr int keyCount = 500;
+
+    std::atomic<int> calls{0};
+    auto cube = va::memoizeConcurrent([&calls](int x) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        return long(x) * x * x;
+    });
+    if (cube.getShardCount() != va::detail::memoDefaultShards) return t.fail("wrong default shard count");
+
+    std::atomic<bool> wrong{false};
+    VaList<std::thread> threads;
+    for (Size i = 0; i < threadCount; i++) {
+        threads.append(std::thread([&cube, &wrong, i]() {
+            for (int round = 0; round < 4; round++) {
+                for (int k = 0; k < keyCount; k++) {
+                    int x = int((Size(k) * 7 + i * 131) % keyCount);
+                    if (cube(x) != long(x) * x * x) wrong.store(true);
+                }
+            }
+        }));
+    }
+    for (std::thread& thread: threads) thread.join();
+
+    if (wrong.load()) return t.fail("wrong result from a concurrent cache");
+    if (cube.getSize() != Size(keyCount)) return t.fail("wrong number of cached results");
+
+    VaCacheStats stats = cube.getStats();
+    if (stats.hits + stats.misses != threadCount * 4 * keyCount) return t.fail("lost a counter update");
+    // Concurrent misses of one key may both compute, but at most once per thread
+    if (calls.load() < keyCount || calls.load() > int(threadCount) * keyCount) return t.fail("function called too often");
+
+    // Bounded shards, rounded up to a power of two
+    auto bounded = va::memoizeConcurrent([](int x) { return x + 1; }, 8, 3);
+    if (bounded.getShardCount() != 4) return t.fail("shard count not rounded up");
+    for (int x = 0; x < 1000; x++) bounded(x);
+    if (bounded.getSize() > 8) return t.fail("capacity exceeded");
+    if (bounded(999) != 1000) return t.fail("wrong result from a bounded concurrent cache");
+
+    // The capacity is a total: the shards never hold more, even when it does not divide evenly
+    auto uneven = va::memoizeConcurrent([](int x) { return x * 2; }, 10, 4);
+    for (int x = 0; x < 1000; x++) uneven(x);
+    if (uneven.getSize() > 10) return t.failf("capacity 10 exceeded: %d results cached", int(uneven.getSize()));
+
+    auto single = va::memoizeConcurrent([](int x) { return x - 1; }, 1);
+    for (int x = 0; x < 100; x++) single(x);
+    if (single.getShardCount() != 1 || single.getSize() != 1) return t.fail("a capacity of 1 must cache exactly one result");
+
+    return t.success();
+}
+
+bool testMemoize(testing::Test& t) {
+    if (!t.helper(testTupleKey)) return false;
+    if (!t.helper(testMemoizeBasic)) return false;
+    if (!t.helper(testMemoizeRecursive)) return false;
+    if (!t.helper(testMemoizeLru)) return false;
+    if (!t.helper(testMemoizeTtl)) return false;
+    if (!t.helper(testMemoizeConcurrent)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testMemoize); }
@@ -0,0 +1,154 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/MpmcQueue.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <atomic>
+#include <thread>
+
+bool testMpmcQueueThreads(testing::Test& t) {
+    constexpr uint64 perProducer = 200'000;
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+
+    VaMpmcQueue<uint64> queue(256);
+    std::atomic<uint64> sum(0);
+    std::atomic<uint64> received(0);
+    std::atomic<bool> ordered(true);
+
+    VaList<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.append(std::thread([&queue, p] {
+            uint64 batch[16];
+            uint64 i = 0;
+            while (i < perProducer) {
+                // values encode the producer in the top bits so consumers can check per-producer order
+                if (i % 5 == 0) {
+                    queue.push((uint64(p) << 32) | i++);
+                    continue;
+                }
+                Size n = 0;
+                while (n < 16 && i + n < perProducer) {
+                    batch[n] = (uint64(p) << 32) | (i + n);
+                    n++;
+                }
+                queue.pushBatch(batch, n);
+                i += n;
+            }
+        }));
+    }
+
+    for (int c = 0; c < consumers; c++) {
+        threads.append(std::thread([&] {
+            uint64 last[producers];
+            for (int p = 0; p < producers; p++) last[p] = ~uint64(0);
+
+            auto check = [&](uint64 value) {
+                uint64 producer = value >> 32;
+                uint64 index = value & 0xffffffff;
+                if (last[producer] != ~uint64(0) && index <= last[producer]) ordered = false;
+                last[producer] = index;
+                sum.fetch_add(index, std::memory_order_relaxed);
+            };
+
+            uint64 batch[8];
+            uint64 value;
+            for (;;) {
+                Size n = queue.tryPopBatch(batch, 8);
+                for (Size i = 0; i < n; i++) check(batch[i]);
+                if (n == 0 && queue.tryPop(value)) {
+                    check(value);
+                    n = 1;
+                }
+                if (n == 0) {
+                    if (received.load() == producers * perProducer) return;
+                    std::this_thread::yield();
+                    continue;
+                }
+                received.fetch_add(n);
+            }
+        }));
+    }
+
+    for (auto& thread : threads) thread.join();
+
+    uint64 expectedSum = producers * (perProducer * (perProducer - 1) / 2);
+    if (received.load() != producers * perProducer || sum.load() != expectedSum) {
+        return t.fail("elements were lost or duplicated");
+    }
+    if (!ordered.load()) {
+        return t.fail("elements of one producer were reordered");
+    }
+
+    return t.success();
+}
+
+bool testMpmcQueue(testing::Test& t) {
+    expect({
+        VaMpmcQueue<int> invalid(0);
+        return t.fail("zero capacity should throw");
+    })
+    expect({
+        // no power of two above 2^63 fits in a Size
+        VaMpmcQueue<int> invalid((Size(1) << 63) + 1);
+        return t.fail("a capacity above 2^63 should throw");
+    })
+    expect({
+        VaMpmcQueue<uint64> invalid(Size(1) << 62);
+        return t.fail("a capacity whose slots overflow the address space should throw");
+    })
+
+    VaMpmcQueue<VaString> queue(3);
+    if (cap(queue) != 4 || !queue.isEmpty()) {
+        return t.fail("capacity should be rounded up to a power of two");
+    }
+
+    if (!queue.tryPush("one") || !queue.tryEmplace("two") || !queue.tryPush(VaString("three")) || !queue.tryPush("four")) {
+        return t.fail("tryPush() failed");
+    }
+    if (queue.tryPush("five") || len(queue) != 4) {
+        return t.fail("tryPush() on a full queue should fail");
+    }
+
+    VaString out;
+    if (!queue.tryPop(out) || out != "one" || queue.pop() != "two") {
+        return t.fail("tryPop()/pop() failed");
+    }
+
+    VaString items[] = {"a", "b", "c"};
+    if (queue.tryPushBatch(items, 3) != 2 || len(queue) != 4) {
+        return t.fail("tryPushBatch() should push what fits");
+    }
+
+    VaString popped[8];
+    if (queue.tryPopBatch(popped, 8) != 4 || popped[0] != "three" || popped[3] != "b") {
+        return t.fail("tryPopBatch() failed");
+    }
+    if (queue.tryPop(out) || queue.tryPopBatch(popped, 8) != 0) {
+        return t.fail("popping an empty queue should fail");
+    }
+
+    // wrap around several times
+    for (int round = 0; round < 10; round++) {
+        queue.pushBatch(items, 3);
+        if (queue.pop() != "a" || queue.popBatch(popped, 8) != 2 || popped[1] != "c") {
+            return t.fail("wrap-around failed");
+        }
+    }
+
+    // leftovers are destroyed by the queue
+    queue.push("left");
+    queue.push("over");
+
+    if (!t.helper(testMpmcQueueThreads)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testMpmcQueue); }
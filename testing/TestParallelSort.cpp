@@ -0,0 +1,212 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Mem/UniquePtr.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Utils/ParallelSort.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstdio>
+#include <random>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+// Large enough for the parallel sorts to really use several threads.
+constexpr Size parallelCount = 5 * va::detail::sortParallelMinPerThread + 123;
+
+static VaList<int> randomList(Size n, unsigned seed, int range) {
+    std::mt19937 rng(seed);
+    VaList<int> result;
+    result.reserve(n);
+    for (Size i = 0; i < n; i++) result.append(int(rng() % unsigned(range)));
+    return result;
+}
+
+static VaList<VaList<int>> inputs() {
+    VaList<VaList<int>> result;
+    result.append(randomList(parallelCount, 1, 1 << 30));
+    result.append(randomList(parallelCount, 2, 4)); // Heavy duplicates
+
+    VaList<int> ascending;
+    VaList<int> descending;
+    for (Size i = 0; i < parallelCount; i++) {
+        ascending.append(int(i));
+        descending.append(int(parallelCount - i));
+    }
+    result.append(ascending);
+    result.append(descending);
+
+    result.append(VaList<int>::Filled(parallelCount, 7));
+    result.append(randomList(1000, 3, 100)); // Too small for more than one thread
+    result.append(VaList<int>());
+    return result;
+}
+
+bool testParallelSortInts(testing::Test& t) {
+    for (const VaList<int>& input: inputs()) {
+        VaList<int> expected = input;
+        std::sort(expected.begin(), expected.end());
+
+        for (Size threads: {Size(0), Size(1), Size(2), Size(3), Size(5)}) {
+            VaList<int> data = input;
+            va::par::sort(data, std::less<int>(), threads);
+            if (data != expected) return t.fail("par::sort() failed");
+
+            data = input;
+            va::par::stableSort(data, std::less<int>(), threads);
+            if (data != expected) return t.fail("par::stableSort() failed");
+        }
+    }
+
+    VaList<int> descending = randomList(parallelCount, 4, 1000);
+    VaList<int> expected = descending;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    va::par::sort(VaSlice<int>(descending), std::greater<int>(), 4);
+    if (descending != expected) return t.fail("par::sort() ignored the comparator");
+
+    return t.success();
+}
+
+struct Record {
+    int key;
+    Size index;
+    VaString name; // Not trivially copyable: exercises the scratch buffer's construct/destroy path
+};
+
+bool testSampleBucketTies(testing::Test& t) {
+    std::less<int> less;
+    const int splitters[] = {1, 5, 5, 9};
+    constexpr Size n = 1000;
+
+    // Elements equal to splitters are spread over every bucket those splitters bound
+    Size counts[5] = {};
+    for (Size i = 0; i < n; i++) counts[va::detail::sampleBucket(5, i, n, splitters, 4, less)]++;
+    if (counts[0] != 0 || counts[4] != 0 || counts[1] < n / 4 || counts[2] < n / 4 || counts[3] < n / 4) {
+        return t.failf("ties went to buckets %d/%d/%d/%d/%d", int(counts[0]), int(counts[1]), int(counts[2]), int(counts[3]), int(counts[4]));
+    }
+    if (va::detail::sampleBucket(1, 0, n, splitters, 4, less) != 0 || va::detail::sampleBucket(1, n - 1, n, splitters, 4, less) != 1) {
+        return t.fail("an element equal to a single splitter must go to one of its two buckets");
+    }
+    if (va::detail::sampleBucket(3, n - 1, n, splitters, 4, less) != 1 || va::detail::sampleBucket(10, 0, n, splitters, 4, less) != 4) {
+        return t.fail("an element between splitters went to the wrong bucket");
+    }
+
+    // All-equal input fills every bucket evenly
+    const int same[] = {7, 7, 7};
+    Size sameCounts[4] = {};
+    for (Size i = 0; i < n; i++) sameCounts[va::detail::sampleBucket(7, i, n, same, 3, less)]++;
+    for (Size count: sameCounts) {
+        if (count != n / 4) return t.fail("all-equal elements were not spread evenly over the buckets");
+    }
+
+    return t.success();
+}
+
+bool testParallelStableSort(testing::Test& t) {
+    std::mt19937 rng(5);
+    VaList<Record> records;
+    for (Size i = 0; i < parallelCount; i++) records.append(Record{int(rng() % 500), i, VaString("record")});
+
+    auto byKey = [](const Record& lhs, const Record& rhs) { return lhs.key < rhs.key; };
+    for (Size threads: {Size(1), Size(2), Size(4)}) {
+        VaList<Record> data = records;
+        va::par::stableSort(data, byKey, threads);
+
+        for (Size i = 1; i < len(data); i++) {
+            const Record& prev = data[i - 1];
+            const Record& cur = data[i];
+            if (prev.key > cur.key || (prev.key == cur.key && prev.index > cur.index)) return t.fail("par::stableSort() is not stable");
+            if (cur.name != "record") return t.fail("par::stableSort() lost a value");
+        }
+
+        data = records;
+        va::par::sort(data, byKey, threads);
+        for (Size i = 1; i < len(data); i++) {
+            if (data[i - 1].key > data[i].key) return t.fail("par::sort() of records failed");
+        }
+    }
+
+    return t.success();
+}
+
+bool testParallelSortMoveOnly(testing::Test& t) {
+    // Move-only elements cannot be copied into splitters; par::sort() falls back to merge sort.
+    VaList<VaUniquePtr<int>> data;
+    for (int v: randomList(parallelCount, 6, 1 << 20)) data.append(VaUniquePtr<int>(new int(v)));
+
+    auto byValue = [](const VaUniquePtr<int>& lhs, const VaUniquePtr<int>& rhs) { return *lhs < *rhs; };
+    va::par::sort(data, byValue, 3);
+
+    for (Size i = 1; i < len(data); i++) {
+        if (*data[i - 1] > *data[i]) return t.fail("par::sort() of move-only elements failed");
+    }
+
+    return t.success();
+}
+
+// Virtual memory of the process, in bytes
+static Size addressSpaceUsed() {
+    Size pages = 0;
+    if (FILE* statm = std::fopen("/proc/self/statm", "r")) {
+        if (std::fscanf(statm, "%zu", &pages) != 1) pages = 0;
+        std::fclose(statm);
+    }
+    return pages * Size(sysconf(_SC_PAGESIZE));
+}
+
+bool testThreadStartFailure(testing::Test& t) {
+    rlimit saved;
+    Size used = addressSpaceUsed();
+    if (used == 0 || getrlimit(RLIMIT_AS, &saved) != 0) return t.success(); // Cannot limit the address space here
+
+    // Room for the data and one thread stack at most: starting the other threads fails
+    VaList<int> input = randomList(parallelCount, 7, 1 << 30);
+    VaList<int> expected = input;
+    std::sort(expected.begin(), expected.end());
+    VaList<int> data = input;
+    VaList<int> stable = input;
+
+    rlimit limited = saved;
+    limited.rlim_cur = rlim_t(addressSpaceUsed() + (Size(12) << 20));
+    if (setrlimit(RLIMIT_AS, &limited) != 0) return t.success();
+
+    // Workers meeting at a barrier: either all of them run or none does, never a deadlock
+    std::atomic<Size> ran(0);
+    std::barrier sync(5);
+    auto worker = [&](Size) {
+        sync.arrive_and_wait();
+        ran.fetch_add(1);
+    };
+    bool started = va::detail::runWorkers(5, worker);
+
+    va::par::sort(data, std::less<int>(), 5);
+    va::par::stableSort(stable, std::less<int>(), 5);
+    setrlimit(RLIMIT_AS, &saved);
+
+    if (started || ran.load() != 0) return t.failf("runWorkers() should fail without running a worker, %d ran", int(ran.load()));
+    if (data != expected) return t.fail("par::sort() failed when its threads could not be started");
+    if (stable != expected) return t.fail("par::stableSort() failed when its threads could not be started");
+
+    return t.success();
+}
+
+bool testParallelSort(testing::Test& t) {
+    // First: the stacks of finished threads are cached and reused, so they could still be started
+    if (!t.helper(testThreadStartFailure)) return false;
+    if (!t.helper(testParallelSortInts)) return false;
+    if (!t.helper(testSampleBucketTies)) return false;
+    if (!t.helper(testParallelStableSort)) return false;
+    if (!t.helper(testParallelSortMoveOnly)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testParallelSort); }
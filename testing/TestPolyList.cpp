@@ -0,0 +1,149 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Types/PolyList.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <type_traits>
+
+struct Shape {
+    static inline int alive = 0;
+
+    Shape() { alive++; }
+    Shape(const Shape&) { alive++; }
+    Shape(Shape&&) noexcept { alive++; }
+    virtual ~Shape() { alive--; }
+
+    virtual float64 area() const = 0;
+    virtual VaString name() const = 0;
+};
+
+struct Circle final: Shape {
+    float64 radius;
+    explicit Circle(float64 radius) : radius(radius) {}
+
+    float64 area() const override { return 3 * radius * radius; }
+    VaString name() const override { return "circle"; }
+};
+
+struct Square final: Shape {
+    float64 side;
+    explicit Square(float64 side) : side(side) {}
+
+    float64 area() const override { return side * side; }
+    VaString name() const override { return "square"; }
+};
+
+struct Label: Shape {
+    VaString text;
+    explicit Label(VaString text) : text(std::move(text)) {}
+
+    float64 area() const override { return 0; }
+    VaString name() const override { return text; }
+};
+
+struct Triangle final: Shape { // Never inserted
+    float64 area() const override { return 0; }
+    VaString name() const override { return "triangle"; }
+};
+
+bool testPolyListInsert(testing::Test& t) {
+    {
+        VaPolyList<Shape> shapes;
+        for (int i = 0; i < 100; i++) {
+            switch (i % 3) {
+            case 0:
+                shapes.emplace<Circle>(1.0);
+                break;
+            case 1:
+                shapes.emplace<Square>(float64(i));
+                break;
+            default:
+                shapes.append(Label("label"));
+                break;
+            }
+        }
+
+        if (len(shapes) != 100 || shapes.getSegmentCount() != 3) return t.fail("wrong size or segment count");
+        if (shapes.count<Circle>() != 34 || shapes.count<Square>() != 33 || shapes.count<Label>() != 33) return t.fail("count() failed");
+        if (Shape::alive != 100) return t.fail("append() left a temporary alive");
+
+        Circle& added = shapes.emplace<Circle>(2.0);
+        if (added.radius != 2.0 || &shapes.segment<Circle>()[34] != &added) return t.fail("emplace() returned a wrong reference");
+
+        // Segments are contiguous
+        VaSlice<Square> squares = shapes.segment<Square>();
+        for (Size i = 0; i < len(squares); i++) {
+            if (squares[i].side != float64(3 * i + 1)) return t.fail("a segment is out of insertion order");
+        }
+        if (len(shapes.segment<Circle>()) != 35 || len(shapes.segment<Triangle>()) != 0) return t.fail("segment() failed");
+
+        VaPolyList<Shape> moved = std::move(shapes);
+        if (!shapes.isEmpty() || len(moved) != 101 || Shape::alive != 101) return t.fail("move failed");
+
+        moved.clear();
+        if (!moved.isEmpty() || moved.count<Circle>() != 0 || Shape::alive != 0) return t.fail("clear() failed");
+        if (moved.getSegmentCount() != 3) return t.fail("clear() dropped the segments");
+
+        moved.emplace<Square>(5.0);
+    }
+    if (Shape::alive != 0) return t.fail("the destructor leaked an object");
+
+    return t.success();
+}
+
+bool testPolyListForEach(testing::Test& t) {
+    VaPolyList<Shape> shapes;
+    shapes.emplace<Label>("first");
+    shapes.emplace<Circle>(1.0);
+    shapes.emplace<Square>(2.0);
+    shapes.emplace<Circle>(2.0);
+
+    // Segment order: Label, Circle, Square
+    VaString names;
+    shapes.forEach([&names](const Shape& shape) { names += shape.name() + " "; });
+    if (names != "first circle circle square ") return t.fail("forEach() order failed");
+
+    // The listed types are passed as themselves, the others as Base
+    Size asCircle = 0, asSquare = 0, asBase = 0;
+    float64 area = 0;
+    shapes.forEach<Circle, Square>([&](auto& shape) {
+        using T = tt::Decay<decltype(shape)>;
+        if constexpr (tt::IsSame<T, Circle>) {
+            asCircle++;
+        } else if constexpr (tt::IsSame<T, Square>) {
+            asSquare++;
+        } else {
+            asBase++;
+        }
+        area += shape.area();
+    });
+    if (asCircle != 2 || asSquare != 1 || asBase != 1) return t.fail("forEach<Ts...>() passed the wrong types");
+    if (area != 3 + 4 + 12) return t.fail("forEach<Ts...>() missed an object");
+
+    // Mutation through forEach<Ts...>() and per-type iteration
+    shapes.forEach<Circle>([](auto& shape) {
+        if constexpr (tt::IsSame<tt::Decay<decltype(shape)>, Circle>) shape.radius *= 2;
+    });
+    for (Square& square: shapes.segment<Square>()) square.side = 1;
+
+    const VaPolyList<Shape>& view = shapes;
+    area = 0;
+    view.forEach<Square>([&area](const auto& shape) { area += shape.area(); });
+    if (area != 12 + 48 + 1) return t.fail("modification through forEach() failed");
+    if (view.segment<Circle>()[0].radius != 2.0 || len(view.segment<Triangle>()) != 0) return t.fail("const segment() failed");
+
+    return t.success();
+}
+
+bool testPolyList(testing::Test& t) {
+    if (!t.helper(testPolyListInsert)) return false;
+    if (!t.helper(testPolyListForEach)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testPolyList); }
@@ -0,0 +1,126 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/PriorityQueue.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <random>
+
+using Queue = VaPriorityQueue<VaString, int>;
+
+bool testPriorityQueueBasic(testing::Test& t) {
+    Queue queue;
+    Queue::Handle c = queue.push("c", 30);
+    Queue::Handle a = queue.push("a", 10);
+    Queue::Handle b = queue.push("b", 20);
+
+    if (queue.top() != "a" || queue.topPriority() != 10 || queue.topHandle() != a) return t.fail("Wrong top");
+
+    queue.decreaseKey(c, 5);
+    if (queue.top() != "c" || queue.priorityOf(c) != 5) return t.fail("decreaseKey() should move the entry to the top");
+
+    queue.increaseKey(c, 40);
+    if (queue.top() != "a") return t.fail("increaseKey() should move the entry away from the top");
+
+    queue.update(b, 1);
+    if (queue.top() != "b") return t.fail("update() should move the entry up");
+
+    expect({
+        queue.decreaseKey(a, 50);
+        return t.fail("decreaseKey() with a worse priority should throw");
+    })
+
+    expect({
+        queue.increaseKey(a, 0);
+        return t.fail("increaseKey() with a better priority should throw");
+    })
+
+    queue.get(a) = "A";
+    if (queue.erase(a) != "A" || queue.contains(a)) return t.fail("erase() should remove the entry");
+    if (len(queue) != 2) return t.fail("Wrong length after erase()");
+
+    expect({
+        queue.get(a);
+        return t.fail("A stale handle should be rejected");
+    })
+
+    Queue::Handle d = queue.push("d", 2);
+    if (d == a || queue.contains(a)) return t.fail("A reused slot must not revive an old handle");
+
+    if (queue.pop() != "b" || queue.pop() != "d" || queue.pop() != "c") return t.fail("Wrong pop() order");
+    if (!queue.isEmpty()) return t.fail("Queue should be empty");
+
+    expect({
+        queue.pop();
+        return t.fail("pop() on empty queue should throw");
+    })
+
+    expect({
+        queue.decreaseKey(Queue::Handle(), 1);
+        return t.fail("A default handle should be rejected");
+    })
+
+    return t.success();
+}
+
+bool testPriorityQueueRandom(testing::Test& t) {
+    std::mt19937 rng(1);
+    VaPriorityQueue<int, int, std::greater<int>, 2> queue;
+    VaList<VaPriorityQueue<int, int, std::greater<int>, 2>::Handle> handles;
+    VaList<int> priority;
+
+    for (int i = 0; i < 2000; i++) {
+        int p = int(rng() % 1000);
+        handles.append(queue.push(i, p));
+        priority.append(p);
+    }
+
+    for (int round = 0; round < 3000; round++) {
+        Size i = rng() % len(handles);
+        if (!queue.contains(handles[i])) continue;
+
+        switch (rng() % 3) {
+        case 0:
+            priority[i] = int(rng() % 2000);
+            queue.update(handles[i], priority[i]);
+            break;
+        case 1:
+            queue.erase(handles[i]);
+            break;
+        default:
+            priority[i] += 10;
+            queue.decreaseKey(handles[i], priority[i]);
+            break;
+        }
+    }
+
+    int last = 1 << 30;
+    Size count = len(queue);
+    for (Size n = 0; n < count; n++) {
+        int p = queue.topPriority();
+        int value = queue.pop();
+        if (p > last) return t.fail("Entries popped out of order");
+        if (priority[Size(value)] != p) return t.fail("Entry has a wrong priority");
+        last = p;
+    }
+
+    queue.push(1, 1);
+    queue.clear();
+    if (!queue.isEmpty() || queue.contains(handles[0])) return t.fail("clear() should invalidate everything");
+
+    return t.success();
+}
+
+bool testPriorityQueue(testing::Test& t) {
+    if (!t.helper(testPriorityQueueBasic)) return false;
+    if (!t.helper(testPriorityQueueRandom)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testPriorityQueue); }
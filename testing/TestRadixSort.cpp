@@ -0,0 +1,219 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Types/ImmutableString.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Utils/RadixSort.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+// Large enough for the parallel sorts to really use several threads.
+constexpr Size parallelCount = 4 * va::detail::radixParallelMinPerThread;
+
+template <typename T>
+static VaList<T> randomList(Size n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    VaList<T> result;
+    result.reserve(n);
+    for (Size i = 0; i < n; i++) result.append(T(rng()));
+    return result;
+}
+
+template <typename T>
+static bool sortsLikeStd(VaList<T> data) {
+    VaList<T> expected = data;
+    std::sort(expected.begin(), expected.end());
+    va::radixSort(data);
+    return data == expected;
+}
+
+bool testRadixSortIntegers(testing::Test& t) {
+    for (Size n: {Size(0), Size(1), Size(10), Size(1000), Size(100000)}) {
+        if (!sortsLikeStd(randomList<uint8>(n, 1))) return t.fail("radixSort() failed for uint8");
+        if (!sortsLikeStd(randomList<uint32>(n, 2))) return t.fail("radixSort() failed for uint32");
+        if (!sortsLikeStd(randomList<int>(n, 3))) return t.fail("radixSort() failed for int");
+        if (!sortsLikeStd(randomList<int16>(n, 4))) return t.fail("radixSort() failed for int16");
+        if (!sortsLikeStd(randomList<int64>(n, 5))) return t.fail("radixSort() failed for int64");
+        if (!sortsLikeStd(randomList<uint64>(n, 6))) return t.fail("radixSort() failed for uint64");
+    }
+
+    VaList<int> extremes = {0, -1, 1, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), -1000, 1000};
+    for (int i = 0; i < 100; i++) extremes.append(i * 7919 - 400000);
+    if (!sortsLikeStd(extremes)) return t.fail("radixSort() failed for extreme ints");
+
+    // Small values in a wide type: only the low digits differ, the others are skipped.
+    VaList<uint64> small;
+    for (Size i = 0; i < 5000; i++) small.append((i * 2654435761u) % 1000);
+    if (!sortsLikeStd(small)) return t.fail("radixSort() failed when skipping constant digits");
+
+    VaList<int> constant = VaList<int>::Filled(1000, -42);
+    if (!sortsLikeStd(constant)) return t.fail("radixSort() failed for constant input");
+
+    return t.success();
+}
+
+bool testRadixSortFloats(testing::Test& t) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+
+    VaList<double> doubles;
+    VaList<float> floats;
+    for (Size i = 0; i < 10000; i++) {
+        doubles.append(dist(rng));
+        floats.append(float(dist(rng)));
+    }
+
+    double inf = std::numeric_limits<double>::infinity();
+    VaList<double> special = {0.0, -inf, inf, -1.5, 1.5, std::numeric_limits<double>::denorm_min(), -1e-300, 1e300, 2.0, -2.0};
+    for (double d: special) doubles.append(d);
+
+    if (!sortsLikeStd(doubles)) return t.fail("radixSort() failed for double");
+    if (!sortsLikeStd(floats)) return t.fail("radixSort() failed for float");
+
+    VaList<double> zeros = {0.0, -0.0, 0.0, -0.0};
+    for (int i = 0; i < 100; i++) zeros.append(i % 2 ? 0.0 : -0.0);
+    va::radixSort(zeros);
+    for (Size i = 0; i < len(zeros); i++) {
+        if (std::signbit(zeros[i]) != (i < len(zeros) / 2)) return t.fail("-0.0 should sort before +0.0");
+    }
+
+    return t.success();
+}
+
+struct Record {
+    int key;
+    Size index;
+    VaString name; // Not trivially copyable: exercises the scratch buffer's construct/destroy path
+};
+
+static VaList<Record> randomRecords(Size n, unsigned seed) {
+    std::mt19937 rng(seed);
+    VaList<Record> records;
+    records.reserve(n);
+    for (Size i = 0; i < n; i++) records.append(Record{int(rng() % 1000) - 500, i, VaString("record")});
+    return records;
+}
+
+static bool isStablySorted(const VaList<Record>& records) {
+    for (Size i = 1; i < len(records); i++) {
+        const Record& prev = records[i - 1];
+        const Record& cur = records[i];
+        if (prev.key > cur.key || (prev.key == cur.key && prev.index > cur.index)) return false;
+        if (cur.name != "record") return false;
+    }
+    return true;
+}
+
+bool testRadixSortByKey(testing::Test& t) {
+    for (Size n: {Size(5), Size(100), Size(20000)}) {
+        VaList<Record> records = randomRecords(n, unsigned(n));
+        va::radixSort(records, [](const Record& r) { return r.key; });
+        if (len(records) != n || !isStablySorted(records)) return t.fail("radixSort() by key is not a stable sort");
+    }
+
+    // Sorting a part of a list through a slice.
+    VaList<uint32> data = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    va::radixSort(VaSlice<uint32>(data.dataPtr() + 2, 6), [](uint32 x) { return ~x; });
+    VaList<uint32> expected = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    if (data != expected) return t.fail("radixSort() by descending key changed the order of a descending slice");
+
+    va::radixSort(VaSlice<uint32>(data.dataPtr() + 2, 6));
+    expected = {9, 8, 2, 3, 4, 5, 6, 7, 1, 0};
+    if (data != expected) return t.fail("radixSort() of a subslice failed");
+
+    return t.success();
+}
+
+template <typename S>
+static bool sortsStrings(const VaList<S>& input) {
+    auto byteLess = [](const S& lhs, const S& rhs) { return va::detail::radixStringLess(lhs, rhs, 0); };
+
+    VaList<S> expected = input;
+    std::sort(expected.begin(), expected.end(), byteLess);
+
+    VaList<S> data = input;
+    va::radixSort(data);
+    if (data != expected) return false;
+
+    data = input;
+    va::par::radixSort(data, 4);
+    return data == expected;
+}
+
+template <typename S>
+static VaList<S> randomStrings(Size n, unsigned seed, Size maxLength, const char* prefix) {
+    std::mt19937 rng(seed);
+    VaList<S> result;
+    result.reserve(n);
+    for (Size i = 0; i < n; i++) {
+        VaString str = prefix;
+        Size length = rng() % (maxLength + 1);
+        for (Size c = 0; c < length; c++) str += char('a' + rng() % 4);
+        result.append(S(str));
+    }
+    return result;
+}
+
+bool testRadixSortStrings(testing::Test& t) {
+    VaList<VaString> words = {"banana", "apple", "", "cherry", "app", "apple", "b", "", "applesauce", "\xff", "z"};
+    if (!sortsStrings(words)) return t.fail("radixSort() of a few strings failed");
+
+    VaList<VaString> ordered = words;
+    va::radixSort(ordered);
+    if (ordered[0] != "" || ordered[2] != "app" || ordered[len(ordered) - 1] != "\xff") return t.fail("Strings should sort byte-wise, shorter first");
+
+    if (!sortsStrings(randomStrings<VaString>(20000, 1, 12, ""))) return t.fail("radixSort() of random strings failed");
+    if (!sortsStrings(randomStrings<VaString>(5000, 2, 6, "a-long-common-prefix-"))) return t.fail("radixSort() of prefixed strings failed");
+    if (!sortsStrings(randomStrings<VaImmutableString>(20000, 3, 12, ""))) return t.fail("radixSort() of VaImmutableString failed");
+    if (!sortsStrings(VaList<VaString>::Filled(1000, "same"))) return t.fail("radixSort() of equal strings failed");
+    if (!sortsStrings(randomStrings<VaString>(parallelCount, 4, 8, ""))) return t.fail("Parallel radixSort() of strings failed");
+
+    return t.success();
+}
+
+bool testParallelRadixSort(testing::Test& t) {
+    for (Size threads: {Size(0), Size(1), Size(3), Size(4)}) {
+        VaList<int64> data = randomList<int64>(parallelCount + 17, unsigned(threads));
+        VaList<int64> expected = data;
+        std::sort(expected.begin(), expected.end());
+        va::par::radixSort(data, threads);
+        if (data != expected) return t.fail("Parallel radixSort() of int64 failed");
+    }
+
+    VaList<uint32> small;
+    for (Size i = 0; i < parallelCount; i++) small.append(uint32(parallelCount - i) % 300);
+    VaList<uint32> expected = small;
+    std::sort(expected.begin(), expected.end());
+    va::par::radixSort(small, 4);
+    if (small != expected) return t.fail("Parallel radixSort() with constant digits failed");
+
+    VaList<Record> records = randomRecords(parallelCount, 9);
+    va::par::radixSort(records, [](const Record& r) { return r.key; }, 4);
+    if (len(records) != parallelCount || !isStablySorted(records)) return t.fail("Parallel radixSort() by key is not a stable sort");
+
+    VaList<float> few = {3.0f, -1.0f, 2.0f};
+    va::par::radixSort(few);
+    if (few[0] != -1.0f || few[2] != 3.0f) return t.fail("Parallel radixSort() of a small list failed");
+
+    return t.success();
+}
+
+bool testRadixSort(testing::Test& t) {
+    if (!t.helper(testRadixSortIntegers)) return false;
+    if (!t.helper(testRadixSortFloats)) return false;
+    if (!t.helper(testRadixSortByKey)) return false;
+    if (!t.helper(testRadixSortStrings)) return false;
+    if (!t.helper(testParallelRadixSort)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testRadixSort); }
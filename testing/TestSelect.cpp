@@ -0,0 +1,141 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Utils/Select.hpp>
+
+#include <algorithm>
+#include <random>
+
+static VaList<int> randomList(Size n, unsigned seed, int range) {
+    std::mt19937 rng(seed);
+    VaList<int> result;
+    for (Size i = 0; i < n; i++) result.append(int(rng() % Size(range)));
+    return result;
+}
+
+static bool isPartitionedAt(const VaList<int>& list, Size nth) {
+    for (Size i = 0; i < nth; i++) {
+        if (list[i] > list[nth]) return false;
+    }
+    for (Size i = nth + 1; i < len(list); i++) {
+        if (list[i] < list[nth]) return false;
+    }
+    return true;
+}
+
+bool testNthElement(testing::Test& t) {
+    // Random data, heavy duplicates, sorted and reversed input.
+    VaList<VaList<int>> inputs;
+    inputs.append(randomList(5000, 1, 1 << 30));
+    inputs.append(randomList(5000, 2, 3));
+    VaList<int> ascending;
+    for (int i = 0; i < 5000; i++) ascending.append(i);
+    inputs.append(ascending);
+    VaList<int> descending;
+    for (int i = 5000; i > 0; i--) descending.append(i);
+    inputs.append(descending);
+    inputs.append(randomList(7, 3, 100));
+
+    for (const VaList<int>& input: inputs) {
+        VaList<int> sorted = input;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (Size nth: {Size(0), len(input) / 2, len(input) - 1, len(input) / 3}) {
+            VaList<int> data = input;
+            va::nthElement(data, nth);
+            if (data[nth] != sorted[nth]) return t.fail("nthElement() placed a wrong element");
+            if (!isPartitionedAt(data, nth)) return t.fail("nthElement() did not partition around nth");
+        }
+    }
+
+    VaList<int> data = randomList(100, 4, 1000);
+    VaList<int> sorted = data;
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    va::nthElement(VaSlice<int>(data), 10, std::greater<int>());
+    if (data[10] != sorted[10]) return t.fail("nthElement() ignored the comparator");
+
+    // The fallback used when introselect runs out of depth.
+    VaList<int> fallback = randomList(1000, 7, 1 << 30);
+    VaList<int> fallbackSorted = fallback;
+    std::sort(fallbackSorted.begin(), fallbackSorted.end());
+    std::less<int> less;
+    va::detail::heapSelect(fallback.dataPtr(), fallback.dataPtr() + 300, fallback.dataPtr() + 1000, less);
+    if (fallback[300] != fallbackSorted[300] || !isPartitionedAt(fallback, 300)) return t.fail("heapSelect() failed");
+
+    expect({
+        va::nthElement(data, 100);
+        return t.fail("nthElement() with nth out of range should throw");
+    })
+
+    return t.success();
+}
+
+bool testPartialSort(testing::Test& t) {
+    VaList<int> input = randomList(10000, 5, 1000000);
+    VaList<int> sorted = input;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (Size k: {Size(0), Size(1), Size(10), Size(100), Size(9999), Size(10000), Size(20000)}) {
+        VaList<int> data = input;
+        va::partialSort(data, k);
+        for (Size i = 0; i < std::min(k, len(data)); i++) {
+            if (data[i] != sorted[i]) return t.fail("partialSort() produced a wrong prefix");
+        }
+    }
+
+    VaArray<int, 8> array = {5, 1, 7, 3, 8, 2, 6, 4};
+    va::partialSort(array, 3, std::greater<int>());
+    if (array[0] != 8 || array[1] != 7 || array[2] != 6) return t.fail("partialSort() on VaArray failed");
+
+    return t.success();
+}
+
+bool testQuantiles(testing::Test& t) {
+    VaList<int> data;
+    for (int i = 0; i <= 100; i++) data.append(100 - i);
+
+    if (va::quantile(data, 0.5) != 50) return t.fail("Median of 0..100 should be 50");
+    if (va::quantile(data, 0.0) != 0 || va::quantile(data, 1.0) != 100) return t.fail("Extreme quantiles are wrong");
+
+    VaArray<int, 4> qs = va::quantiles(data, {0.99, 0.5, 0.25, 0.5});
+    if (qs[0] != 99 || qs[1] != 50 || qs[2] != 25 || qs[3] != 50) return t.fail("quantiles() returned wrong values");
+
+    VaList<int> random = randomList(10001, 6, 1 << 20);
+    VaList<int> sorted = random;
+    std::sort(sorted.begin(), sorted.end());
+    VaArray<int, 3> many = va::quantiles(VaSlice<int>(random), {0.1, 0.999, 0.9});
+    if (many[0] != sorted[1000] || many[1] != sorted[9990] || many[2] != sorted[9000]) return t.fail("quantiles() on random data failed");
+
+    expect({
+        va::quantile(data, 1.5);
+        return t.fail("A quantile outside [0, 1] should throw");
+    })
+
+    VaList<int> empty;
+    expect({
+        va::quantile(empty, 0.5);
+        return t.fail("quantile() of an empty list should throw");
+    })
+
+    VaArray<int, 3> top = {1, 2, 3};
+    if (len(va::topK(top, 2)) != 2 || va::topK(top, 2)[0] != 3) return t.fail("topK() on VaArray failed");
+
+    return t.success();
+}
+
+bool testSelect(testing::Test& t) {
+    if (!t.helper(testNthElement)) return false;
+    if (!t.helper(testPartialSort)) return false;
+    if (!t.helper(testQuantiles)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testSelect); }
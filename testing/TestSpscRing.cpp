@@ -0,0 +1,110 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/SpscRing.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <thread>
+
+bool testSpscRingThreads(testing::Test& t) {
+    constexpr uint64 count = 1'000'000;
+    VaSpscRing<uint64> ring(1024);
+
+    std::thread producer([&ring] {
+        uint64 batch[64];
+        uint64 next = 0;
+        while (next < count) {
+            if (next % 3 == 0) {
+                ring.push(next++);
+                continue;
+            }
+            Size n = 0;
+            while (n < 64 && next + n < count) {
+                batch[n] = next + n;
+                n++;
+            }
+            ring.pushBatch(batch, n);
+            next += n;
+        }
+    });
+
+    uint64 expected = 0;
+    bool ordered = true;
+    uint64 batch[32];
+    while (expected < count) {
+        if (expected % 2 == 0) {
+            if (ring.pop() != expected++) ordered = false;
+            continue;
+        }
+        Size n = ring.popBatch(batch, 32);
+        for (Size i = 0; i < n; i++) {
+            if (batch[i] != expected++) ordered = false;
+        }
+    }
+    producer.join();
+
+    if (!ordered) return t.fail("elements arrived out of order");
+    if (!ring.isEmpty()) return t.fail("ring should be empty");
+
+    return t.success();
+}
+
+bool testSpscRing(testing::Test& t) {
+    expect({
+        VaSpscRing<int> invalid(0);
+        return t.fail("zero capacity should throw");
+    })
+    expect({
+        // no power of two above 2^63 fits in a Size
+        VaSpscRing<int> invalid((Size(1) << 63) + 1);
+        return t.fail("a capacity above 2^63 should throw");
+    })
+    expect({
+        VaSpscRing<uint64> invalid(Size(1) << 62);
+        return t.fail("a capacity whose slots overflow the address space should throw");
+    })
+
+    VaSpscRing<VaString> ring(3);
+    if (cap(ring) != 4 || !ring.isEmpty()) {
+        return t.fail("capacity should be rounded up to a power of two");
+    }
+
+    if (!ring.tryPush("one") || !ring.tryEmplace("two") || !ring.tryPush(VaString("three")) || !ring.tryPush("four")) {
+        return t.fail("tryPush() failed");
+    }
+    if (ring.tryPush("five") || len(ring) != 4) {
+        return t.fail("tryPush() on a full ring should fail");
+    }
+
+    VaString out;
+    if (!ring.tryPop(out) || out != "one" || ring.pop() != "two") {
+        return t.fail("tryPop()/pop() failed");
+    }
+
+    VaString items[] = {"a", "b", "c"};
+    if (ring.tryPushBatch(items, 3) != 2 || len(ring) != 4) {
+        return t.fail("tryPushBatch() should push what fits");
+    }
+
+    VaString popped[8];
+    if (ring.tryPopBatch(popped, 8) != 4 || popped[0] != "three" || popped[3] != "b") {
+        return t.fail("tryPopBatch() failed");
+    }
+    if (ring.tryPop(out) || ring.tryPopBatch(popped, 8) != 0) {
+        return t.fail("popping an empty ring should fail");
+    }
+
+    // leftovers are destroyed by the ring
+    ring.push("left");
+    ring.push("over");
+
+    if (!t.helper(testSpscRingThreads)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testSpscRing); }
@@ -36,10 +36,13 @@ bool testStackFor(testing::Test& t) {
         return t.fail("stack should be empty now.");
     }
 
-    expect({
+    try {
         s.pop();
         return t.fail("Expected exception on pop() from empty stack.");
-    })
+    } catch (const IndexOutOfRangeError&) {
+    } catch (...) {
+        return t.fail("pop() from an empty stack should throw IndexOutOfRangeError, like top().");
+    }
 
     expect({
         s.top();
@@ -0,0 +1,94 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Types/Error.hpp>
+#include <VaLib/Types/StaticDict.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+constexpr auto methods = va::mkStaticDict<int>({{"GET", 1}, {"HEAD", 2}, {"POST", 3}, {"PUT", 4}, {"DELETE", 5}, {"", 6}});
+
+static_assert(methods.at("HEAD") == 2 && methods["DELETE"] == 5 && methods.at("") == 6, "VaStaticDict lookups must work in constant expressions");
+static_assert(!methods.contains("PATCH") && !methods.contains("GE") && !methods.contains("GETS") && len(methods) == 6);
+static_assert(*methods.tryAt("POSTED", 4) == 3);
+
+constexpr auto single = va::mkStaticDict<char>({{"only", 'o'}});
+static_assert(single.at("only") == 'o' && single.tryAt("other") == nullptr);
+
+bool testLookup(testing::Test& t) {
+    if (methods.at(VaString("GET")) != 1 || methods[VaString("PUT")] != 4) return t.fail("a VaString lookup failed");
+    if (methods.tryAt(VaString("get")) || methods.contains(VaString("HEADER"))) return t.fail("a missing VaString key was found");
+
+    const char with[] = {'P', 'U', 'T', '\0', 'x'};
+    if (methods.tryAt(VaString(with, 5))) return t.fail("characters after the key must not be ignored");
+
+    bool thrown = false;
+    try {
+        methods.at("OPTIONS");
+    } catch (const KeyNotFoundError&) {
+        thrown = true;
+    }
+    if (!thrown) return t.fail("at() must throw KeyNotFoundError on a missing key");
+
+    return t.success();
+}
+
+bool testEntries(testing::Test& t) {
+    int sum = 0;
+    for (const auto& entry: methods) {
+        if (VaHash<VaString>{}(VaString(entry.key)) != entry.hash) return t.fail("the hash of an entry must be the VaHash of its key");
+        if (methods.tryAt(entry.key, entry.len) != &entry.value) return t.fail("an entry was not found in its own slot");
+        sum += entry.value;
+    }
+    if (sum != 21) return t.fail("iteration must visit every entry once");
+
+    return t.success();
+}
+
+constexpr auto keywords = va::mkStaticDict<int>({
+    {"alignas", 0}, {"alignof", 1}, {"and", 2}, {"asm", 3}, {"auto", 4}, {"bool", 5}, {"break", 6}, {"case", 7},
+    {"catch", 8}, {"char", 9}, {"class", 10}, {"concept", 11}, {"const", 12}, {"consteval", 13}, {"constexpr", 14},
+    {"constinit", 15}, {"const_cast", 16}, {"continue", 17}, {"decltype", 18}, {"default", 19}, {"delete", 20},
+    {"do", 21}, {"double", 22}, {"dynamic_cast", 23}, {"else", 24}, {"enum", 25}, {"explicit", 26}, {"export", 27},
+    {"extern", 28}, {"false", 29}, {"float", 30}, {"for", 31}, {"friend", 32}, {"goto", 33}, {"if", 34},
+    {"inline", 35}, {"int", 36}, {"long", 37}, {"mutable", 38}, {"namespace", 39}, {"new", 40}, {"noexcept", 41},
+    {"not", 42}, {"nullptr", 43}, {"operator", 44}, {"or", 45}, {"private", 46}, {"protected", 47}, {"public", 48},
+    {"register", 49}, {"requires", 50}, {"return", 51}, {"short", 52}, {"signed", 53}, {"sizeof", 54}, {"static", 55},
+    {"static_assert", 56}, {"static_cast", 57}, {"struct", 58}, {"switch", 59}, {"template", 60}, {"this", 61},
+    {"throw", 62}, {"true", 63}, {"try", 64}, {"typedef", 65}, {"typeid", 66}, {"typename", 67}, {"union", 68},
+    {"unsigned", 69}, {"using", 70}, {"virtual", 71}, {"void", 72}, {"volatile", 73}, {"while", 74}, {"xor", 75},
+});
+
+bool testManyKeys(testing::Test& t) {
+    const char* names[] = {"alignas", "alignof", "and", "asm", "auto", "bool", "break", "case", "catch", "char", "class",
+                           "concept", "const", "consteval", "constexpr", "constinit", "const_cast", "continue", "decltype",
+                           "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export",
+                           "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable",
+                           "namespace", "new", "noexcept", "not", "nullptr", "operator", "or", "private", "protected",
+                           "public", "register", "requires", "return", "short", "signed", "sizeof", "static",
+                           "static_assert", "static_cast", "struct", "switch", "template", "this", "throw", "true", "try",
+                           "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile",
+                           "while", "xor"};
+
+    for (int i = 0; i < int(sizeof(names) / sizeof(*names)); i++) {
+        if (keywords.at(names[i]) != i) return t.fail("a keyword was mapped to the wrong value");
+    }
+    for (const char* word: {"main", "std", "In", "int ", "static_assert_", "x"}) {
+        if (keywords.contains(word)) return t.fail("a non-keyword was found");
+    }
+
+    return t.success();
+}
+
+bool testStaticDict(testing::Test& t) {
+    if (!t.helper(testLookup)) return false;
+    if (!t.helper(testEntries)) return false;
+    if (!t.helper(testManyKeys)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testStaticDict); }
@@ -0,0 +1,269 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/Stack.hpp>
+#include <VaLib/Types/StaticList.hpp>
+#include <VaLib/Types/StaticStack.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <cstdlib>
+#include <new>
+
+// Counts the allocations of the whole test, to check the paths that must not allocate
+static Size allocations = 0;
+
+void* operator new(std::size_t size) {
+    allocations++;
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+constexpr int constexprSum() {
+    VaStaticList<int, 8> list = {3, 4};
+    list.prepend(1);
+    list.insert(1, 2);
+    list.append(5);
+    list.del(0);
+
+    int sum = 0;
+    for (int x: list) sum += x;
+    return sum + list.pop() * 100;
+}
+
+constexpr bool constexprOverflow() {
+    VaStaticStack<int, 2> stack;
+    if (stack.push(1).isErr() || stack.push(2).isErr()) return false;
+    if (!stack.isFull()) return false;
+    stack.pop();
+    return stack.top() == 1 && len(stack) == 1;
+}
+
+static_assert(constexprSum() == 514, "VaStaticList must work in constant expressions");
+static_assert(constexprOverflow(), "VaStaticStack must work in constant expressions");
+static_assert(tt::IsTriviallyCopyable<VaStaticList<int, 4>>, "VaStaticList of a trivial type must be trivially copyable");
+static_assert(sizeof(VaStaticList<int, 4>) == 4 * sizeof(int) + sizeof(Size), "VaStaticList must store its elements inline");
+
+template <typename List>
+bool fillList(List& list) {
+    list.append(2);
+    list.prepend(0);
+    list.insert(1, 1);
+    list.appendEmplace(3);
+    return len(list) == 4 && list[0] == 0 && list[3] == 3 && list.at(-1) == 3;
+}
+
+bool testStaticListBasic(testing::Test& t) {
+    VaStaticList<int, 4> list;
+    VaList<int> reference;
+
+    if (!fillList(list) || !fillList(reference)) return t.fail("VaStaticList and VaList disagree on shared operations");
+
+    for (Size i = 0; i < len(list); i++) {
+        if (list[i] != reference[i]) return t.fail("VaStaticList contents differ from VaList");
+    }
+
+    if (!list.isFull() || cap(list) != 4) return t.fail("List should be full with capacity 4");
+
+    auto res = list.append(9);
+    if (res.isOk()) return t.fail("append() on a full list should fail");
+    if (len(list) != 4) return t.fail("Failed append() must not change the list");
+    if (list.prepend(9).isOk() || list.insert(2, 9).isOk()) return t.fail("prepend()/insert() on a full list should fail");
+
+    expect({
+        res.throwErr();
+        return t.fail("throwErr() should throw CapacityError");
+    })
+
+    expect({
+        list.appendEmplace(9);
+        return t.fail("appendEmplace() on a full list should throw");
+    })
+
+    expect({
+        list.insert(7, 1);
+        return t.fail("insert() past the end should throw");
+    })
+
+    if (list.pop(1) != 1 || list.pop() != 3) return t.fail("pop() returned wrong values");
+    list.delRange(0, 1);
+    if (len(list) != 1 || list.front() != 2 || list.back() != 2) return t.fail("delRange() left wrong contents");
+
+    list.delRange(1, 1);
+    list.delRange(0, 0);
+    if (len(list) != 1) return t.fail("delRange() of an empty range must delete nothing");
+    expect({
+        list.delRange(2, 2);
+        return t.fail("delRange() past the end should throw");
+    })
+
+    list.set(-1, 7);
+    if (list.get(0) != 7) return t.fail("set() failed");
+
+    VaStaticList<int, 4> copy = list;
+    if (copy != list) return t.fail("Copy should be equal");
+
+    list.clear();
+    if (!list.isEmpty()) return t.fail("clear() should empty the list");
+
+    expect({
+        list.pop();
+        return t.fail("pop() on empty list should throw");
+    })
+
+    expect({
+        list.front();
+        return t.fail("front() on empty list should throw");
+    })
+
+    using SmallList = VaStaticList<int, 2>;
+    std::initializer_list<int> three = {1, 2, 3};
+    expect({
+        SmallList tooMany(three);
+        return t.fail("Constructing from too many elements should throw");
+    })
+
+    return t.success();
+}
+
+bool testStaticListObjects(testing::Test& t) {
+    VaStaticList<VaString, 3> list;
+    list.append("b");
+    list.prepend("a");
+    list.appendEmplace("c");
+
+    if (list.append("d").isOk()) return t.fail("append() on a full list should fail");
+    if (list[0] != "a" || list[1] != "b" || list[2] != "c") return t.fail("Wrong contents");
+
+    VaStaticList<VaString, 3> copy = list;
+    VaStaticList<VaString, 3> moved = std::move(copy);
+    if (moved != list || len(copy) != 0) return t.fail("Copy or move failed");
+
+    list.del(1);
+    if (len(list) != 2 || list[1] != "c") return t.fail("del() failed");
+
+    list.insertEmplace(1, "x");
+    if (list[1] != "x" || list[2] != "c") return t.fail("insertEmplace() failed");
+
+    VaString popped = list.pop(0);
+    if (popped != "a" || list[0] != "x") return t.fail("pop(index) failed");
+
+    moved = list;
+    if (moved != list) return t.fail("Copy assignment failed");
+
+    return t.success();
+}
+
+// A fixed-capacity container must not allocate, least of all to report that it is full
+bool testStaticListFullDoesNotAllocate(testing::Test& t) {
+    VaStaticList<int, 2> list = {1, 2};
+    const Size before = allocations;
+
+    if (list.append(3).isOk() || list.prepend(0).isOk() || list.insert(1, 5).isOk()) {
+        return t.fail("adding to a full list should fail");
+    }
+    auto failed = list.append(3);
+
+    int thrown = 0;
+    try {
+        list.appendEmplace(3);
+    } catch (const CapacityError&) {
+        thrown++;
+    }
+    try {
+        list.insertEmplace(0, 3);
+    } catch (const CapacityError&) {
+        thrown++;
+    }
+    try {
+        VaStaticList<int, 2> tooMany = {1, 2, 3};
+    } catch (const CapacityError&) {
+        thrown++;
+    }
+
+    if (thrown != 3) return t.fail("the throwing additions to a full list should throw CapacityError");
+    if (allocations != before) return t.failf("reporting a full list allocated %d times", int(allocations - before));
+    if (failed.unwrapErr()->what() != "VaStaticList is full") return t.fail("wrong error message");
+
+    return t.success();
+}
+
+// Copyable, but its move constructor may throw
+struct ThrowingMove {
+    int value;
+
+    ThrowingMove(int value) : value(value) {}
+    ThrowingMove(const ThrowingMove&) = default;
+    ThrowingMove(ThrowingMove&& other) noexcept(false) : value(other.value) {}
+    ThrowingMove& operator=(const ThrowingMove&) = default;
+};
+
+template <typename Stack>
+bool throwsOutOfRangeOnEmptyPop(Stack& s) {
+    try {
+        s.pop();
+    } catch (const IndexOutOfRangeError&) {
+        return true;
+    } catch (...) {}
+    return false;
+}
+
+template <typename Stack>
+bool exerciseStack(Stack& s) {
+    s.push(5);
+    s.push(15);
+    if (s.top() != 15) return false;
+    s.pop();
+    if (s.top() != 5 || len(s) != 1) return false;
+    s.pop();
+    return s.isEmpty();
+}
+
+bool testStaticStack(testing::Test& t) {
+    VaStaticStack<int, 2> s;
+    VaStack<int> reference;
+
+    if (!exerciseStack(s) || !exerciseStack(reference)) return t.fail("VaStaticStack and VaStack disagree");
+
+    if (s.push(1).isErr() || s.push(2).isErr()) return t.fail("push() below capacity should succeed");
+    if (s.push(3).isOk()) return t.fail("push() on a full stack should fail");
+    if (s.top() != 2 || len(s) != 2 || cap(s) != 2) return t.fail("Failed push() must not change the stack");
+
+    s.pop();
+    s.pop();
+
+    if (!throwsOutOfRangeOnEmptyPop(s) || !throwsOutOfRangeOnEmptyPop(reference)) {
+        return t.fail("pop() on an empty VaStaticStack must throw IndexOutOfRangeError, like VaStack");
+    }
+
+    expect({
+        s.top();
+        return t.fail("Expected exception on top() from empty stack.");
+    })
+
+    // Pushing and popping never shifts elements, so a throwing move is fine there
+    VaStaticStack<ThrowingMove, 2> objects;
+    if (objects.push(ThrowingMove(1)).isErr() || objects.push(ThrowingMove(2)).isErr()) return t.fail("push() of ThrowingMove failed");
+    objects.pop();
+    if (objects.top().value != 1) return t.fail("pop() of ThrowingMove failed");
+
+    return t.success();
+}
+
+bool testStaticList(testing::Test& t) {
+    if (!t.helper(testStaticListBasic)) return false;
+    if (!t.helper(testStaticListObjects)) return false;
+    if (!t.helper(testStaticListFullDoesNotAllocate)) return false;
+    if (!t.helper(testStaticStack)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testStaticList); }
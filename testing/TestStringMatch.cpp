@@ -0,0 +1,109 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/ConstexprStrings.hpp>
+#include <VaLib/Meta/FixedString.hpp>
+#include <VaLib/Meta/StringMatch.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Utils/Hash.hpp>
+
+static_assert(va::constexprStrHash("") == Size(14695981039346656037ull));
+static_assert(va::constexprStrHash("help") == va::constexprStrHash("help!", 4));
+static_assert(VaFixedString("quit").hash() == va::constexprStrHash("quit") && VaFixedString("quit").len == 4);
+
+constexpr int opcode(const char* name) {
+    return va::match(name,
+        va::on<"add">([] { return 1; }),
+        va::on<"sub">([] { return 2; }),
+        va::on<"mul">([] { return 3; }),
+        va::otherwise([] { return -1; }));
+}
+
+static_assert(opcode("add") == 1 && opcode("mul") == 3 && opcode("div") == -1 && opcode("") == -1, "va::match() must work in constant expressions");
+
+bool testConstexprHash(testing::Test& t) {
+    for (const char* str: {"", "a", "help", "a longer command name", "caf\xc3\xa9"}) {
+        if (VaHash<VaString>{}(VaString(str)) != va::constexprStrHash(str)) return t.fail("constexprStrHash() must equal the VaHash of a VaString");
+    }
+
+    if (!va::constexprStrEq("abc", "abd", 2) || va::constexprStrEq("abc", "abd", 3)) return t.fail("constexprStrEq() with a length failed");
+
+    return t.success();
+}
+
+VaString describe(const VaString& command) {
+    return va::match(command,
+        va::on<"help">([] { return VaString("help"); }),
+        va::on<"quit">([] { return VaString("quit"); }),
+        va::on<"">([] { return VaString("empty"); }),
+        va::on<"list">([] { return VaString("list"); }),
+        va::on<"lis">([] { return VaString("lis"); }),
+        va::otherwise([] { return VaString("unknown"); }));
+}
+
+bool testMatch(testing::Test& t) {
+    if (describe("help") != "help" || describe("quit") != "quit" || describe("list") != "list") return t.fail("a case was not matched");
+    if (describe("") != "empty" || describe("lis") != "lis") return t.fail("the empty string or a prefix was not matched");
+    if (describe("hel") != "unknown" || describe("helpx") != "unknown" || describe("HELP") != "unknown") return t.fail("a non-matching string was matched");
+
+    // Matching strings of the same length and hash slot must still compare the contents
+    const char with[] = {'l', 'i', 's', 't', '\0', 'x'};
+    if (describe(VaString(with, 6)) != "unknown") return t.fail("characters after the key must not be ignored");
+
+    // Void cases need no fallback, and the case functions may keep state
+    int calls = 0;
+    auto counter = va::on<"count">([&calls] { calls++; });
+    for (const char* word: {"count", "skip", "count"}) va::match(word, counter);
+    if (calls != 2) return t.fail("a void match() failed");
+
+    const char* buffer = "quitting";
+    if (va::match(buffer, 4, va::on<"quit">([] { return true; }), va::otherwise([] { return false; })) != true) return t.fail("match() with an explicit length failed");
+
+    int fallback = va::match("anything", va::otherwise([] { return 7; }));
+    if (fallback != 7) return t.fail("match() with only a fallback failed");
+
+    return t.success();
+}
+
+bool testManyCases(testing::Test& t) {
+    auto code = [](const VaString& keyword) {
+        return va::match(keyword,
+            va::on<"alignas">([] { return 0; }), va::on<"alignof">([] { return 1; }), va::on<"auto">([] { return 2; }),
+            va::on<"bool">([] { return 3; }), va::on<"break">([] { return 4; }), va::on<"case">([] { return 5; }),
+            va::on<"catch">([] { return 6; }), va::on<"char">([] { return 7; }), va::on<"class">([] { return 8; }),
+            va::on<"const">([] { return 9; }), va::on<"constexpr">([] { return 10; }), va::on<"continue">([] { return 11; }),
+            va::on<"default">([] { return 12; }), va::on<"delete">([] { return 13; }), va::on<"do">([] { return 14; }),
+            va::on<"double">([] { return 15; }), va::on<"else">([] { return 16; }), va::on<"enum">([] { return 17; }),
+            va::on<"explicit">([] { return 18; }), va::on<"extern">([] { return 19; }), va::on<"false">([] { return 20; }),
+            va::on<"float">([] { return 21; }), va::on<"for">([] { return 22; }), va::on<"friend">([] { return 23; }),
+            va::on<"goto">([] { return 24; }), va::on<"if">([] { return 25; }), va::on<"inline">([] { return 26; }),
+            va::on<"int">([] { return 27; }), va::on<"long">([] { return 28; }), va::on<"mutable">([] { return 29; }),
+            va::on<"namespace">([] { return 30; }), va::on<"new">([] { return 31; }), va::on<"noexcept">([] { return 32; }),
+            va::otherwise([] { return -1; }));
+    };
+
+    const char* keywords[] = {"alignas", "alignof", "auto", "bool", "break", "case", "catch", "char", "class",
+                              "const", "constexpr", "continue", "default", "delete", "do", "double", "else",
+                              "enum", "explicit", "extern", "false", "float", "for", "friend", "goto", "if",
+                              "inline", "int", "long", "mutable", "namespace", "new", "noexcept"};
+
+    for (int i = 0; i < int(sizeof(keywords) / sizeof(*keywords)); i++) {
+        if (code(keywords[i]) != i) return t.fail("a keyword was dispatched to the wrong case");
+    }
+    if (code("nullptr") != -1 || code("in") != -1 || code("constexpr ") != -1) return t.fail("a non-keyword was matched");
+
+    return t.success();
+}
+
+bool testStringMatch(testing::Test& t) {
+    if (!t.helper(testConstexprHash)) return false;
+    if (!t.helper(testMatch)) return false;
+    if (!t.helper(testManyCases)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testStringMatch); }
@@ -0,0 +1,209 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+#include <VaLib/Types/Array.hpp>
+#include <VaLib/Types/Dict.hpp>
+#include <VaLib/Types/Heap.hpp>
+#include <VaLib/Types/IntrusiveList.hpp>
+#include <VaLib/Types/LinkedChunkedList.hpp>
+#include <VaLib/Types/LinkedList.hpp>
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/PriorityQueue.hpp>
+#include <VaLib/Types/Slice.hpp>
+#include <VaLib/Types/Stack.hpp>
+#include <VaLib/Types/StaticList.hpp>
+#include <VaLib/Types/StaticStack.hpp>
+#include <VaLib/Types/String.hpp>
+
+#include <utility>
+#include <vector>
+
+static_assert(noexcept(std::declval<VaList<int>&>().tryAt(0)) && noexcept(std::declval<VaList<VaString>&>().tryPop(std::declval<VaString&>())));
+static_assert(noexcept(std::declval<const VaLinkedList<int>&>().tryFront()) && noexcept(std::declval<VaStack<int>&>().tryPop(std::declval<int&>())));
+
+constexpr bool constexprTryAccess() {
+    VaStaticList<int, 4> list = {1, 2, 3};
+    if (list.tryAt(3) != nullptr || *list.tryAt(-1) != 3 || *list.tryFront() != 1) return false;
+
+    int out = 0;
+    if (!list.tryPop(out) || out != 3 || *list.tryBack() != 2) return false;
+
+    VaStaticStack<int, 2> stack;
+    if (stack.tryTop() != nullptr || stack.tryPop(out)) return false;
+    stack.push(7);
+    return stack.tryPop(out) && out == 7 && stack.isEmpty();
+}
+
+static_assert(constexprTryAccess(), "the try* accessors of VaStaticList and VaStaticStack must be constexpr");
+
+/**
+ * @brief Checks tryAt(), tryFront(), tryBack() and tryPop() of a sequence holding 10, 20, 30.
+ */
+template <typename List>
+bool checkSequence(testing::Test& t, List& list) {
+    const List& view = list;
+
+    if (*list.tryAt(0) != 10 || *list.tryAt(2) != 30 || *list.tryAt(-1) != 30 || *view.tryAt(-3) != 10) return t.fail("tryAt() missed an element");
+    if (list.tryAt(3) != nullptr || list.tryAt(-4) != nullptr || view.tryAt(100) != nullptr) return t.fail("tryAt() out of bounds must return nullptr");
+    if (*list.tryFront() != 10 || *view.tryBack() != 30) return t.fail("tryFront()/tryBack() failed");
+
+    *list.tryAt(1) = 25;
+    if (*view.tryAt(1) != 25) return t.fail("tryAt() must return a pointer into the container");
+
+    int out = 0;
+    if (!list.tryPop(out) || out != 30 || len(list) != 2) return t.fail("tryPop() failed");
+    if (!list.tryPop(out) || !list.tryPop(out) || out != 10) return t.fail("tryPop() in order failed");
+    if (list.tryPop(out) || out != 10) return t.fail("tryPop() on an empty container must return false and keep out");
+    if (list.tryFront() != nullptr || view.tryBack() != nullptr || list.tryAt(0) != nullptr) return t.fail("accessors on an empty container must return nullptr");
+
+    return t.success();
+}
+
+bool testTrySequences(testing::Test& t) {
+    VaList<int> list = {10, 20, 30};
+    if (!checkSequence(t, list)) return false;
+
+    VaLinkedList<int> linked = {10, 20, 30};
+    if (!checkSequence(t, linked)) return false;
+
+    VaLinkedChunkedList<int> chunked;
+    for (int x: {10, 20, 30}) chunked.append(x);
+    if (!checkSequence(t, chunked)) return false;
+
+    VaStaticList<int, 8> fixed = {10, 20, 30};
+    if (!checkSequence(t, fixed)) return false;
+
+    // tryShift() takes from the front
+    VaLinkedList<VaString> names = {"a", "b"};
+    VaString name;
+    if (!names.tryShift(name) || name != "a" || !names.tryShift(name) || names.tryShift(name) || name != "b") return t.fail("VaLinkedList::tryShift() failed");
+
+    VaLinkedChunkedList<int> shifted;
+    shifted.append(1);
+    int first = 0;
+    if (!shifted.tryShift(first) || first != 1 || shifted.tryShift(first)) return t.fail("VaLinkedChunkedList::tryShift() failed");
+
+    // Moved, not copied
+    VaList<VaString> strings = {"moved"};
+    VaString popped;
+    if (!strings.tryPop(popped) || popped != "moved" || !strings.isEmpty()) return t.fail("VaList::tryPop() with a VaString failed");
+
+    return t.success();
+}
+
+bool testTryViews(testing::Test& t) {
+    VaList<int> list = {1, 2, 3};
+    VaSlice<int> slice(list);
+    if (*slice.tryAt(-1) != 3 || slice.tryAt(3) != nullptr || *slice.tryFront() != 1 || *slice.tryBack() != 3) return t.fail("VaSlice try* failed");
+
+    VaSlice<int> empty(nullptr, Size(0));
+    if (empty.tryFront() != nullptr || empty.tryBack() != nullptr || empty.tryAt(0) != nullptr) return t.fail("an empty VaSlice must return nullptr");
+
+    VaArray<int, 3> array = {4, 5, 6};
+    if (*array.tryAt(2) != 6 || array.tryAt(3) != nullptr) return t.fail("VaArray::tryAt() failed");
+
+    return t.success();
+}
+
+template <typename T, typename C>
+bool testTryStack(testing::Test& t) {
+    VaStack<T, C> stack;
+    T out = 0;
+    if (stack.tryTop() != nullptr || stack.tryPop(out)) return t.fail("try* on an empty stack failed");
+
+    stack.push(1);
+    stack.push(2);
+    if (*stack.tryTop() != 2) return t.fail("tryTop() failed");
+    if (!stack.tryPop(out) || out != 2 || *stack.tryTop() != 1) return t.fail("tryPop() failed");
+    if (!stack.tryPop(out) || out != 1 || !stack.isEmpty() || stack.tryPop(out)) return t.fail("tryPop() to empty failed");
+
+    return t.success();
+}
+
+bool testTryQueues(testing::Test& t) {
+    VaHeap<int> heap;
+    int out = 0;
+    if (heap.tryTop() != nullptr || heap.tryPop(out)) return t.fail("try* on an empty heap failed");
+
+    for (int x: {5, 1, 3}) heap.push(x);
+    if (*heap.tryTop() != 1) return t.fail("VaHeap::tryTop() failed");
+    if (!heap.tryPop(out) || out != 1 || !heap.tryPop(out) || out != 3) return t.fail("VaHeap::tryPop() failed");
+
+    VaPriorityQueue<VaString, int> queue;
+    VaString value;
+    if (queue.tryTop() != nullptr || queue.tryPop(value)) return t.fail("try* on an empty priority queue failed");
+
+    auto a = queue.push("a", 10);
+    auto b = queue.push("b", 5);
+    if (*queue.tryTop() != "b" || *queue.tryGet(a) != "a") return t.fail("VaPriorityQueue::tryTop()/tryGet() failed");
+    if (!queue.tryPop(value) || value != "b" || queue.tryGet(b) != nullptr) return t.fail("tryGet() of a removed entry must return nullptr");
+
+    return t.success();
+}
+
+bool testTryDict(testing::Test& t) {
+    VaDict<VaString, int> dict;
+    if (dict.tryAt("missing") != nullptr || dict.tryFront() != nullptr || dict.tryBack() != nullptr) return t.fail("try* on an empty dict failed");
+
+    dict.putAtBack("one", 1);
+    dict.putAtBack("two", 2);
+
+    const VaDict<VaString, int>& view = dict;
+    if (*dict.tryAt("two") != 2 || view.tryAt("three") != nullptr) return t.fail("VaDict::tryAt() failed");
+    if (*dict.tryFront() != 1 || *view.tryBack() != 2) return t.fail("VaDict::tryFront()/tryBack() failed");
+
+    return t.success();
+}
+
+struct Linked {
+    int value;
+    VaIntrusiveListHook hook;
+};
+
+using LinkedList = VaIntrusiveList<Linked, &Linked::hook>;
+
+static_assert(noexcept(std::declval<LinkedList&>().tryPop()) && noexcept(std::declval<const LinkedList&>().tryFront()));
+static_assert(tt::IsSame<decltype(std::declval<const LinkedList&>().tryBack()), const Linked*>);
+
+bool testTryIntrusive(testing::Test& t) {
+    Linked a{1, {}}, b{2, {}}, c{3, {}};
+    LinkedList list;
+    const LinkedList& view = list;
+
+    if (list.tryFront() || view.tryBack() || list.tryPop() || list.tryShift()) return t.fail("try* on an empty intrusive list failed");
+
+    list.append(a);
+    list.append(b);
+    list.append(c);
+    if (list.tryFront() != &a || view.tryFront() != &a || list.tryBack() != &c || view.tryBack() != &c) {
+        return t.fail("VaIntrusiveList::tryFront()/tryBack() failed");
+    }
+
+    if (list.tryPop() != &c || list.tryShift() != &a || c.hook.isLinked() || a.hook.isLinked()) {
+        return t.fail("VaIntrusiveList::tryPop()/tryShift() did not unlink the right object");
+    }
+    if (list.tryPop() != &b || !list.isEmpty() || list.tryShift() != nullptr) return t.fail("tryPop() did not empty the intrusive list");
+
+    return t.success();
+}
+
+bool testTryAccess(testing::Test& t) {
+    if (!t.helper(testTrySequences)) return false;
+    if (!t.helper(testTryViews)) return false;
+    if (!t.helper(testTryStack<int, void>)) return false;
+    if (!t.helper(testTryStack<int, VaList<int>>)) return false;
+    #ifdef VaLib_USE_CONCEPTS
+        if (!t.helper(testTryStack<int, std::vector<int>>)) return false;
+    #endif
+    if (!t.helper(testTryQueues)) return false;
+    if (!t.helper(testTryDict)) return false;
+    if (!t.helper(testTryIntrusive)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testTryAccess); }
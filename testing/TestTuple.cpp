@@ -9,7 +9,9 @@
 
 VaTuple<int, int> mulAndDiv(int x, int y) { return {x * y, x / y}; };
 
-bool testTuple(testing::Test& t) {
+struct Empty {};
+
+bool testTupleBasics(testing::Test& t) {
     VaTuple<int, int, int> tuple(1, 2, 3);
     if (tuple.get<0>() != 1 || tuple.get<1>() != 2 || tuple.get<2>() != 3) {
         return t.fail("unexpected result");
@@ -35,4 +37,55 @@ bool testTuple(testing::Test& t) {
     return t.success();
 }
 
+bool testTupleStorage(testing::Test& t) {
+    VaTuple<int, VaString, float64> defaulted;
+    if (defaulted.get<0>() != 0 || defaulted.get<1>() != "" || defaulted.get<2>() != 0) return t.fail("the default constructor must value-initialize");
+
+    // Elements are laid out in order
+    VaTuple<int32, int32, int32> ordered(1, 2, 3);
+    if (&ordered.get<0>() + 1 != &ordered.get<1>() || &ordered.get<1>() + 1 != &ordered.get<2>()) return t.fail("unexpected layout");
+
+    VaTuple<Empty, int, Empty*> withEmpty;
+    if (sizeof(withEmpty) != sizeof(VaTuple<int, Empty*>)) return t.fail("an empty element must take no space");
+
+    VaTuple<VaString, int> named(VaString("name"), 5);
+    if (named.get<VaString>() != "name" || named.get<int>() != 5) return t.fail("get<T>() failed");
+
+    VaString moved = std::move(named).get<0>();
+    if (moved != "name" || named.get<0>() != "") return t.fail("get<I>() on an rvalue must allow moving out");
+
+    int x = 1;
+    VaTuple<int&, int> refs(x, 2);
+    refs.get<0>() = 10;
+    if (x != 10) return t.fail("a reference element must refer to the original");
+
+    return t.success();
+}
+
+bool testTupleIteration(testing::Test& t) {
+    const VaTuple<int, float64, VaString> tuple(1, 2.5, VaString("three"));
+
+    int count = 0;
+    tuple.forEach([&count](const auto&) { count++; });
+    if (count != 3) return t.fail("forEach() did not visit every element");
+
+    VaString order;
+    tuple.forEachIndexed([&order](auto index, const auto&) { order += VaString(index + 1, 'x') + ","; });
+    if (order != "x,xx,xxx,") return t.fail("forEachIndexed() visited out of order");
+
+    VaTuple<int, int> numbers(1, 2);
+    numbers.forEach([](int& n) { n *= 10; });
+    if (numbers != VaTuple<int, int>(10, 20)) return t.fail("forEach() must allow modifying the elements");
+
+    return t.success();
+}
+
+bool testTuple(testing::Test& t) {
+    if (!t.helper(testTupleBasics)) return false;
+    if (!t.helper(testTupleStorage)) return false;
+    if (!t.helper(testTupleIteration)) return false;
+
+    return t.success();
+}
+
 int main() { return testing::run(testTuple); }
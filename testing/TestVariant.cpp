@@ -0,0 +1,184 @@
+// VaLib - Vast Library
+// Licensed under GNU GPL v3 License. See LICENSE file.
+// (C) 2025 VaLibTeam
+
+#include <lib/testing.hpp>
+
+#include <VaLib/Meta/BasicDefine.hpp>
+
+#include <VaLib/Types/List.hpp>
+#include <VaLib/Types/String.hpp>
+#include <VaLib/Types/Variant.hpp>
+
+#include <type_traits>
+
+static_assert(sizeof(VaVariant<int, char, float64>) == 16, "the index must fit in the padding after the storage");
+static_assert(tt::IsSame<VaVariant<int, char>::IndexType, uint8>, "the index must be a byte");
+static_assert(std::is_trivially_copyable_v<VaVariant<int, float64>>, "a variant of trivial types must be trivially copyable");
+static_assert(!std::is_trivially_copyable_v<VaVariant<int, VaString>>);
+static_assert(std::is_constructible_v<VaVariant<int, VaString>, const char*>, "a literal must select VaString");
+static_assert(!std::is_constructible_v<VaVariant<bool, VaString>, const char*>, "an ambiguous conversion must be rejected");
+static_assert(VaVariant<int, VaString, float64>::indexOf<float64> == 2);
+
+struct Tracked {
+    static inline int alive = 0;
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    int a, b;
+
+    Tracked(int a, int b) : a(a), b(b) { alive++; }
+    Tracked(const Tracked& other) : a(other.a), b(other.b) {
+        alive++;
+        copies++;
+    }
+    Tracked(Tracked&& other) noexcept : a(other.a), b(other.b) {
+        alive++;
+        moves++;
+    }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { alive--; }
+
+    bool operator==(const Tracked& other) const { return a == other.a && b == other.b; }
+};
+
+struct Throwing {
+    explicit Throwing(bool fail) {
+        if (fail) throw ValueError("construction failed");
+    }
+};
+
+bool testVariantBasics(testing::Test& t) {
+    VaVariant<int, VaString, float64> v;
+    if (!v.holds<int>() || v.get<int>() != 0 || v.getIndex() != 0) return t.fail("default constructor failed");
+
+    v = VaString("hello");
+    if (!v.holds<VaString>() || v.holds<int>() || v.get<VaString>() != "hello" || v.getIndex() != 1) {
+        return t.fail("assignment failed");
+    }
+
+    v = "world"; // Converts to VaString, the only alternative constructible from a literal
+    if (v.get<1>() != "world") return t.fail("converting assignment failed");
+
+    v = 2.5;
+    if (v.tryGet<float64>() == nullptr || *v.tryGet<float64>() != 2.5 || v.tryGet<int>() != nullptr) {
+        return t.fail("tryGet() failed");
+    }
+
+    expect({
+        v.get<VaString>();
+        return t.fail("expected InvalidVariantCastError");
+    })
+
+    VaVariant<int, VaString, float64> w(std::in_place_type<VaString>, 3, 'x');
+    if (w.get<VaString>() != "xxx") return t.fail("in-place constructor failed");
+
+    VaVariant<int, VaString, float64> copy = w;
+    if (copy != w || copy == v) return t.fail("operator== failed");
+
+    return t.success();
+}
+
+bool testVariantEmplace(testing::Test& t) {
+    {
+        VaVariant<int, Tracked> v = 7;
+        Tracked& tracked = v.emplace<Tracked>(1, 2);
+        if (Tracked::alive != 1 || Tracked::copies != 0 || Tracked::moves != 0) return t.fail("emplace() made a temporary");
+        if (&tracked != v.tryGet<Tracked>() || tracked.b != 2) return t.fail("emplace() returned a wrong reference");
+
+        VaVariant<int, Tracked> copy = v;
+        VaVariant<int, Tracked> moved = std::move(copy);
+        if (Tracked::alive != 3 || Tracked::copies != 1 || Tracked::moves != 1) return t.fail("copy or move failed");
+
+        moved = 5; // Destroys the Tracked
+        if (Tracked::alive != 2 || moved.get<int>() != 5) return t.fail("assignment of another alternative failed");
+
+        moved = v; // Copy-constructs, since the alternatives differ
+        copy = v;  // Copy-assigns, since both hold a Tracked
+        if (Tracked::alive != 3 || Tracked::copies != 2 || !(moved == v)) return t.fail("copy assignment failed");
+
+        v.emplace<0>(3);
+        if (Tracked::alive != 2 || v.get<0>() != 3) return t.fail("emplace() by index failed");
+    }
+    if (Tracked::alive != 0) return t.fail("the destructor leaked a value");
+
+    return t.success();
+}
+
+bool testVariantVisit(testing::Test& t) {
+    VaList<VaVariant<int, VaString, float64>> values = {1, VaString("two"), 3.0};
+
+    Size sizes = 0;
+    for (const auto& value: values) {
+        sizes += value.visit([](const auto& x) { return sizeof(x); });
+    }
+    if (sizes != sizeof(int) + sizeof(VaString) + sizeof(float64)) return t.fail("const visit() failed");
+
+    // A mutable visit, with a non-generic overload set
+    struct Doubler {
+        void operator()(int& x) const { x *= 2; }
+        void operator()(VaString& s) const { s = s + s; }
+        void operator()(float64& x) const { x *= 2; }
+    };
+    for (auto& value: values) value.visit(Doubler{});
+    if (values[0].get<int>() != 2 || values[1].get<VaString>() != "twotwo" || values[2].get<float64>() != 6.0) {
+        return t.fail("visit() failed");
+    }
+
+    // An rvalue visit passes the value as an rvalue
+    VaString taken = std::move(values[1]).visit([](auto&& x) -> VaString {
+        if constexpr (tt::IsSame<tt::Decay<decltype(x)>, VaString>) {
+            return VaString(std::move(x));
+        } else {
+            return VaString();
+        }
+    });
+    if (taken != "twotwo") return t.fail("rvalue visit() failed");
+
+    // Past the alternatives dispatched by the switch
+    using Wide = VaVariant<int8, int16, int32, int64, uint8, uint16, uint32, uint64, float32, VaString>;
+    Wide wide(std::in_place_index<9>, "tenth");
+    if (wide.visit([](const auto& x) { return sizeof(x); }) != sizeof(VaString)) return t.fail("visit() of the tenth alternative failed");
+    wide = uint64(8);
+    if (wide.getIndex() != 7 || wide.visit([](const auto& x) { return sizeof(x); }) != 8) return t.fail("visit() of the eighth alternative failed");
+
+    return t.success();
+}
+
+bool testVariantValueless(testing::Test& t) {
+    VaVariant<VaString, Throwing> v = VaString("kept?");
+
+    bool threw = false;
+    try {
+        v.emplace<Throwing>(true);
+    } catch (const ValueError&) {
+        threw = true;
+    }
+    if (!threw || !v.isValueless() || v.getIndex() != v.npos) return t.fail("a failed emplace() must leave the variant valueless");
+    if (v.holds<VaString>() || v.holds<Throwing>()) return t.fail("holds() of a valueless variant");
+
+    expect({
+        v.visit([](const auto&) {});
+        return t.fail("expected InvalidVariantCastError from visit()");
+    })
+
+    VaVariant<VaString, Throwing> copy = v;
+    if (!copy.isValueless()) return t.fail("copy of a valueless variant failed");
+
+    v.emplace<Throwing>(false);
+    if (!v.holds<Throwing>()) return t.fail("emplace() after valueless failed");
+
+    return t.success();
+}
+
+bool testVariant(testing::Test& t) {
+    if (!t.helper(testVariantBasics)) return false;
+    if (!t.helper(testVariantEmplace)) return false;
+    if (!t.helper(testVariantVisit)) return false;
+    if (!t.helper(testVariantValueless)) return false;
+
+    return t.success();
+}
+
+int main() { return testing::run(testVariant); }
@@ -20,7 +20,7 @@ Time Benchmark::done() {
     return duration.count();
 }
 
-int run(VaFunc<Time(Benchmark&)> func, int repeat) {
+int run(VaFuncRef<Time(Benchmark&)> func, int repeat) {
     Benchmark b;
     Time total = 0;
     for (int i = 0; i < repeat; i++) {
@@ -6,6 +6,7 @@
 #include <VaLib/AutoEnable.hpp>
 
 #include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/FuncTools/FuncRef.hpp>
 #include <VaLib/Types/String.hpp>
 #include <VaLib/Types/List.hpp>
 
@@ -29,7 +30,7 @@ class Benchmark {
     }
 };
 
-int run(VaFunc<Time(Benchmark&)> func, int repeat = 1);
+int run(VaFuncRef<Time(Benchmark&)> func, int repeat = 1);
 
 class BenchmarkGroup {
     struct Entry {
@@ -4,7 +4,7 @@
 
 #include <lib/testing.hpp>
 
-#include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/FuncTools/FuncRef.hpp>
 
 namespace testing {
 
@@ -23,11 +23,11 @@ bool Test::fail(VaString msg) {
     return false;
 }
 
-bool Test::helper(VaFunc<bool(Test&)> testFunc) {
+bool Test::helper(VaFuncRef<bool(Test&)> testFunc) {
     return testFunc(*this);
 }
 
-int run(VaFunc<bool(Test&)> func) {
+int run(VaFuncRef<bool(Test&)> func) {
     Test t;
     return func(t) ? 0 : 1;
 }
@@ -5,7 +5,7 @@
 
 #include <VaLib/AutoEnable.hpp>
 
-#include <VaLib/FuncTools/Func.hpp>
+#include <VaLib/FuncTools/FuncRef.hpp>
 #include <VaLib/Types/String.hpp>
 
 #include <VaLib/Utils/format.hpp>
@@ -33,9 +33,9 @@ public:
         return false;
     }
 
-    bool helper(VaFunc<bool(Test&)> testFunc);
+    bool helper(VaFuncRef<bool(Test&)> testFunc);
 };
 
-int run(VaFunc<bool(Test&)> func);
+int run(VaFuncRef<bool(Test&)> func);
 
 } // namespace testing
@@ -258,13 +258,15 @@ MetaTest() {
     local metaFile="$1"
     echo -e "\033[36;1m" "MetaTesting $metaFile..." "\033[0m"
 
+    local start="$(date +%s%N)"
     CompileMetaTest "$metaFile"
     local exitCode="$?"
+    local elapsed="$(( ($(date +%s%N) - start) / 1000000 ))"
     if [[ $exitCode -eq 0 ]]; then
         rm -f "$out"
         rm -f "$OUTDIR/${metaFile}-compile.log"
 
-        echo -e  "\033[36;1m" "$metaFile: pass." "\033[0m"
+        echo -e  "\033[36;1m" "$metaFile: pass." "\033[0m\033[36m(compiled in ${elapsed} ms)\033[0m"
         return 0
     else
         echo -e "\033[31;1m" "$metaFile: fail." "\033[0m\033[31mCompile error. See $OUTDIR/${metaFile}-compile.log\033[0m"